@@ -0,0 +1,272 @@
+﻿/**
+ *	@file	CollisionStream3DTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	CollisionStream3Dのまとめて判定する版と1組ずつの版(Collision3D)の比較と処理速度。
+ *			判定結果が食い違うか、交点の誤差が上限を超えると1を返す
+ *			g++ -std=c++17 -O2 -mavx2 -I../../UtilityLib CollisionStream3DTest.cpp ../../UtilityLib/Collision/CollisionStream3D.cpp ../../UtilityLib/Collision/Collision3D.cpp ../../UtilityLib/Math/Vector3Stream.cpp ../../UtilityLib/Math/Vector3f.cpp ../../UtilityLib/Task/ThreadPool.cpp -lpthread
+ */
+#include "Collision/CollisionStream3D.h"
+#include "Task/ThreadPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Utility::Capsule;
+	using Utility::CapsuleStream;
+	using Utility::ContactStream;
+	using Utility::Sphere;
+	using Utility::SphereStream;
+	using Utility::Math::Vector3;
+
+	const size_t	SampleCount = 200000;	//	!<	判定する組の数(ParallelGrainより多くして並列の経路も通す)
+	const double	PointBound = 2.0e-6;	//	!<	交点の誤差の上限(座標の大きさに対する比)
+	const double	BoundaryMargin = 1e-4;	//	!<	距離と半径の和の比がこれより1に近い組は丸めで結果が変わるので作らない
+	int				failCount = 0;			//	!<	確認に失敗した数
+
+	/**
+	 *	@fn			Report
+	 *	@brief		結果が一致したかを表示する
+	 */
+	void Report(const char *argName, bool argIsPassed)
+	{
+		std::printf("%-6s %-24s\n", argIsPassed ? "ok" : "FAIL", argName);
+		if (!argIsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			Report
+	 *	@brief		誤差を上限と比べて表示する
+	 */
+	void Report(const char *argName, double argError, double argBound)
+	{
+		const bool IsPassed = argError <= argBound;
+		std::printf("%-6s %-24s max %.2e bound %.1e\n", IsPassed ? "ok" : "FAIL", argName, argError, argBound);
+		if (!IsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			PointError
+	 *	@brief		交点の各成分の誤差の最大値(1より大きい値は大きさで割る)
+	 */
+	double PointError(const Vector3 &argResult, const Vector3 &argExpected)
+	{
+		double error = 0.0;
+		const float Result[] = { argResult.x, argResult.y, argResult.z };
+		const float Expected[] = { argExpected.x, argExpected.y, argExpected.z };
+		for (int i = 0; i < 3; ++i)
+			error = std::max(error, std::fabs(static_cast<double>(Result[i]) - Expected[i]) / std::max(1.0, std::fabs(static_cast<double>(Expected[i]))));
+		return error;
+	}
+
+	/**
+	 *	@fn			IsNearBoundary
+	 *	@brief		距離が半径の和にほぼ等しいか(丸めの違いで判定が変わりうるか)
+	 */
+	bool IsNearBoundary(double argDistanceSQ, double argRadiusSum)
+	{
+		return std::fabs(std::sqrt(argDistanceSQ) / argRadiusSum - 1.0) < BoundaryMargin;
+	}
+
+	/**
+	 *  @struct		Pairs
+	 *  @brief		判定する組(半分ほどが当たるように作る)
+	 */
+	struct Pairs
+	{
+		std::vector<Sphere>		sphereA;
+		std::vector<Sphere>		sphereB;
+		std::vector<Capsule>	capsule;
+	};
+
+	Pairs MakePairs(unsigned int argSeed)
+	{
+		std::mt19937 engine(argSeed);
+		std::uniform_real_distribution<float> position(-100.f, 100.f);
+		std::uniform_real_distribution<float> offset(-3.f, 3.f);
+		std::uniform_real_distribution<float> radius(0.1f, 2.f);
+		auto Near = [&](const Vector3 &argBase) { return Vector3(argBase.x + offset(engine), argBase.y + offset(engine), argBase.z + offset(engine)); };
+
+		Pairs pairs;
+		pairs.sphereA.resize(SampleCount);
+		pairs.sphereB.resize(SampleCount);
+		pairs.capsule.resize(SampleCount);
+		for (size_t i = 0; i < SampleCount; ++i)
+		{
+			Sphere &a = pairs.sphereA[i];
+			Sphere &b = pairs.sphereB[i];
+			Capsule &c = pairs.capsule[i];
+			for (;;)
+			{
+				a.center = Vector3(position(engine), position(engine), position(engine));
+				a.radius = radius(engine);
+				b.center = Near(a.center);
+				b.radius = radius(engine);
+				c.segment.start = Near(a.center);
+				c.segment.end = Near(c.segment.start);
+				c.radius = radius(engine);
+
+				// 倍精度で距離を求め、判定の境目に近すぎる組は作り直す
+				const double DX = a.center.x - b.center.x, DY = a.center.y - b.center.y, DZ = a.center.z - b.center.z;
+				const double VX = c.segment.end.x - c.segment.start.x, VY = c.segment.end.y - c.segment.start.y, VZ = c.segment.end.z - c.segment.start.z;
+				const double PX = a.center.x - c.segment.start.x, PY = a.center.y - c.segment.start.y, PZ = a.center.z - c.segment.start.z;
+				const double LengthSQ = VX * VX + VY * VY + VZ * VZ;
+				const double T = std::min(std::max((VX * PX + VY * PY + VZ * PZ) / LengthSQ, 0.0), 1.0);
+				const double QX = PX - T * VX, QY = PY - T * VY, QZ = PZ - T * VZ;
+				if (LengthSQ > 1e-6
+					&& !IsNearBoundary(DX * DX + DY * DY + DZ * DZ, static_cast<double>(a.radius) + b.radius)
+					&& !IsNearBoundary(QX * QX + QY * QY + QZ * QZ, static_cast<double>(a.radius) + c.radius))
+				{
+					break;
+				}
+			}
+		}
+		return pairs;
+	}
+
+	/**
+	 *	@fn			Compare
+	 *	@brief		1組ずつの判定とまとめた判定の結果を比べる
+	 */
+	template<typename Single>
+	void Compare(const char *argName, const ContactStream &argContacts, const Single &argSingle)
+	{
+		bool isSame = true;
+		double error = 0.0;
+		for (size_t i = 0; i < SampleCount; ++i)
+		{
+			Vector3 inter;
+			const bool IsHit = argSingle(i, &inter);
+			isSame = isSame && IsHit == argContacts.IsHit(i);
+			if (IsHit)
+				error = std::max(error, PointError(argContacts.point.Get(i), inter));
+		}
+		std::printf("       %-24s %zu / %zu hits\n", argName, argContacts.CountHits(), SampleCount);
+		Report("hit == single", isSame);
+		Report("point", error, PointBound);
+	}
+
+	/**
+	 *	@fn			Measure
+	 *	@brief		argFuncを何度か呼び、1組あたりの最短の時間(ナノ秒)を返す
+	 */
+	double Measure(const std::function<void()> &argFunc)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (int i = 0; i < 5; ++i)
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			argFunc();
+			const std::chrono::duration<double, std::nano> Elapsed = std::chrono::steady_clock::now() - Start;
+			if (Elapsed.count() < best)
+				best = Elapsed.count();
+		}
+		return best / SampleCount;
+	}
+
+	/**
+	 *	@fn			ReportThroughput
+	 *	@brief		1組ずつの判定と比べた処理速度を表示する(計測環境に左右されるので失敗にはしない)
+	 */
+	void ReportThroughput(const Pairs &argPairs, const SphereStream &argSphereA, const SphereStream &argSphereB, const CapsuleStream &argCapsule, Utility::ThreadPool *argPool)
+	{
+		std::vector<Vector3> points(SampleCount);
+		std::vector<char> hits(SampleCount);
+		ContactStream contacts;
+		volatile size_t sink = 0;
+
+		struct Row
+		{
+			const char				*name;
+			std::function<void()>	func;
+		};
+		const Row Rows[] = {
+			{ "CheckSphere2Sphere single", [&] {
+				for (size_t i = 0; i < SampleCount; ++i)
+					hits[i] = Utility::CheckSphere2Sphere(argPairs.sphereA[i], argPairs.sphereB[i], &points[i]);
+			} },
+			{ "CheckSphere2Sphere stream", [&] { Utility::CheckSphere2Sphere(argSphereA, argSphereB, &contacts); } },
+			{ "CheckSphere2Sphere pool", [&] { Utility::CheckSphere2Sphere(argSphereA, argSphereB, &contacts, argPool); } },
+			{ "CheckSphere2Capsule single", [&] {
+				for (size_t i = 0; i < SampleCount; ++i)
+					hits[i] = Utility::CheckSphere2Capsule(argPairs.sphereA[i], argPairs.capsule[i], &points[i]);
+			} },
+			{ "CheckSphere2Capsule stream", [&] { Utility::CheckSphere2Capsule(argSphereA, argCapsule, &contacts); } },
+			{ "CheckSphere2Capsule pool", [&] { Utility::CheckSphere2Capsule(argSphereA, argCapsule, &contacts, argPool); } },
+		};
+		for (const Row &row : Rows)
+		{
+			std::printf("       %-28s %.2f ns/pair\n", row.name, Measure(row.func));
+			sink = sink + static_cast<size_t>(hits[SampleCount / 2]) + contacts.hitMask.size();
+		}
+	}
+}
+
+int main()
+{
+	Utility::ThreadPool pool;
+
+	const Pairs Source = MakePairs(1);
+	SphereStream sphereA, sphereB;
+	CapsuleStream capsule;
+	sphereA.Load(Source.sphereA.data(), SampleCount);
+	sphereB.Load(Source.sphereB.data(), SampleCount);
+	capsule.Load(Source.capsule.data(), SampleCount);
+
+	// 球と球
+	ContactStream contacts, serial;
+	Utility::CheckSphere2Sphere(sphereA, sphereB, &contacts, &pool);
+	Compare("CheckSphere2Sphere", contacts, [&](size_t argIndex, Vector3 *argInter) {
+		return Utility::CheckSphere2Sphere(Source.sphereA[argIndex], Source.sphereB[argIndex], argInter);
+	});
+	Utility::CheckSphere2Sphere(sphereA, sphereB, &serial);
+	Report("pool == serial", contacts.hitMask == serial.hitMask);
+
+	// 球とカプセル
+	Utility::CheckSphere2Capsule(sphereA, capsule, &contacts, &pool);
+	Compare("CheckSphere2Capsule", contacts, [&](size_t argIndex, Vector3 *argInter) {
+		return Utility::CheckSphere2Capsule(Source.sphereA[argIndex], Source.capsule[argIndex], argInter);
+	});
+	Utility::CheckSphere2Capsule(sphereA, capsule, &serial);
+	Report("pool == serial", contacts.hitMask == serial.hitMask);
+
+	// 法線と深さ(当たった組だけ)
+	double normalError = 0.0;
+	bool isOutward = true;
+	contacts.ForEachHit([&](size_t argIndex) {
+		const Vector3 Normal = contacts.normal.Get(argIndex);
+		const Vector3 Center = Source.sphereA[argIndex].center;
+		const Vector3 Point = contacts.point.Get(argIndex);
+		const double Length = std::sqrt(static_cast<double>(Normal.x) * Normal.x + static_cast<double>(Normal.y) * Normal.y + static_cast<double>(Normal.z) * Normal.z);
+		normalError = std::max(normalError, std::fabs(Length - 1.0));
+		// 交点から法線の向きに球Aの中心がある
+		const double Along = (Center.x - Point.x) * Normal.x + (Center.y - Point.y) * Normal.y + (Center.z - Point.z) * Normal.z;
+		isOutward = isOutward && contacts.depth[argIndex] >= 0.f && Along >= -1e-4;
+	});
+	Report("normal length", normalError, 1.0e-6);
+	Report("depth/normal direction", isOutward);
+
+	// 端数(ParallelGrainやレジスターの幅で割り切れない組の数)
+	SphereStream headA, headB;
+	headA.Load(Source.sphereA.data(), 37);
+	headB.Load(Source.sphereB.data(), 37);
+	Utility::CheckSphere2Sphere(headA, headB, &serial);
+	bool isSameHead = serial.Size() == 37 && serial.hitMask.size() == 2;
+	for (size_t i = 0; i < 37; ++i)
+		isSameHead = isSameHead && serial.IsHit(i) == Utility::CheckSphere2Sphere(Source.sphereA[i], Source.sphereB[i]);
+	Report("remainder", isSameHead);
+
+	ReportThroughput(Source, sphereA, sphereB, capsule, &pool);
+	return (failCount == 0) ? 0 : 1;
+}
@@ -0,0 +1,258 @@
+﻿/**
+ *	@file	FastMathTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	FastMathの精度と処理速度の確認。単体で実行し、誤差がFastMath.hに書いた値を超えると1を返す
+ *			g++ -std=c++17 -O2 -mavx2 -I../../UtilityLib FastMathTest.cpp ../../UtilityLib/Math/FastMath.cpp ../../UtilityLib/Task/ThreadPool.cpp -lpthread
+ */
+#include "Math/FastMath.h"
+#include "Task/ThreadPool.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Utility::Math::ePrecision;
+	using Utility::Math::FastMath;
+
+	const size_t	SampleCount = 1 << 20;	//	!<	1回の確認で計算する要素数
+	int				failCount = 0;			//	!<	誤差が上限を超えた確認の数
+
+	/**
+	 *  @enum		eError
+	 *  @brief		誤差の測り方
+	 */
+	enum class eError
+	{
+		Absolute,
+		Relative,
+	};
+
+	/**
+	 *	@fn			Uniform
+	 *	@brief		[argMin, argMax]の一様乱数の列
+	 */
+	std::vector<float> Uniform(float argMin, float argMax, unsigned int argSeed)
+	{
+		std::mt19937 engine(argSeed);
+		std::uniform_real_distribution<float> dist(argMin, argMax);
+		std::vector<float> values(SampleCount);
+		for (float &value : values)
+			value = dist(engine);
+		return values;
+	}
+
+	/**
+	 *	@fn			LogUniform
+	 *	@brief		[2^argMinExp, 2^argMaxExp]で指数が一様になる正の乱数の列
+	 */
+	std::vector<float> LogUniform(float argMinExp, float argMaxExp, unsigned int argSeed)
+	{
+		std::vector<float> values = Uniform(argMinExp, argMaxExp, argSeed);
+		for (float &value : values)
+			value = std::exp2(value);
+		return values;
+	}
+
+	/**
+	 *	@fn			MaxError
+	 *	@brief		倍精度で計算した値との差の最大値
+	 */
+	double MaxError(const std::vector<float> &argResult, const std::vector<double> &argExpected, eError argError)
+	{
+		double maxError = 0.0;
+		for (size_t i = 0; i < argResult.size(); ++i)
+		{
+			double error = std::fabs(argResult[i] - argExpected[i]);
+			if (argError == eError::Relative)
+				error /= std::fabs(argExpected[i]);
+			if (error > maxError)
+				maxError = error;
+		}
+		return maxError;
+	}
+
+	/**
+	 *	@fn			Check
+	 *	@brief		まとめて計算する版と1要素ずつの版の誤差を上限と比べる
+	 *	@param[in]	argName		!<	表示する名前
+	 *	@param[in]	argBatch	!<	まとめて計算した値
+	 *	@param[in]	argSingle	!<	1要素ずつ計算した値
+	 *	@param[in]	argExpected	!<	倍精度で計算した値
+	 *	@param[in]	argError	!<	誤差の測り方
+	 *	@param[in]	argBound	!<	誤差の上限
+	 */
+	void Check(const char *argName, const std::vector<float> &argBatch, const std::vector<float> &argSingle,
+		const std::vector<double> &argExpected, eError argError, double argBound)
+	{
+		const double BatchError = MaxError(argBatch, argExpected, argError);
+		const double SingleError = MaxError(argSingle, argExpected, argError);
+		const bool IsPassed = BatchError <= argBound && SingleError <= argBound;
+		std::printf("%-6s %-28s batch %.2e single %.2e bound %.1e\n", IsPassed ? "ok" : "FAIL", argName, BatchError, SingleError, argBound);
+		if (!IsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			CheckUnary
+	 *	@brief		1入力の関数の誤差を確認する
+	 */
+	template<ePrecision P>
+	void CheckUnary(const char *argName, const std::vector<float> &argSrc,
+		void (*argBatch)(Utility::Span<const float>, Utility::Span<float>, Utility::ThreadPool*), float (*argSingle)(float),
+		double (*argExpected)(double), eError argError, double argBound, Utility::ThreadPool *argPool)
+	{
+		std::vector<float> batch(argSrc.size()), single(argSrc.size());
+		std::vector<double> expected(argSrc.size());
+		argBatch(argSrc, batch, argPool);
+		for (size_t i = 0; i < argSrc.size(); ++i)
+		{
+			single[i] = argSingle(argSrc[i]);
+			expected[i] = argExpected(argSrc[i]);
+		}
+		Check(argName, batch, single, expected, argError, argBound);
+	}
+
+	double Rsqrt(double argX) { return 1.0 / std::sqrt(argX); }
+	double Sin(double argX) { return std::sin(argX); }
+	double Cos(double argX) { return std::cos(argX); }
+	double Exp(double argX) { return std::exp(argX); }
+	double Log(double argX) { return std::log(argX); }
+
+	/**
+	 *	@fn			CheckAccuracy
+	 *	@brief		FastMath.hに書いた誤差の上限を確認する
+	 *	@param[in]	argSinBound	!<	Sin, Cosの範囲ごとの上限(|x| <= 100, 1024, 8192)
+	 */
+	template<ePrecision P>
+	void CheckAccuracy(const double (&argSinBound)[3], double argAtan2Bound, double argLogBound, eError argLogError,
+		double argExpBound, double argRsqrtBound, Utility::ThreadPool *argPool)
+	{
+		using Math = FastMath<P>;
+		const float SinRange[] = { 100.f, 1024.f, 8192.f };
+		for (size_t i = 0; i < 3; ++i)
+		{
+			char name[64];
+			const std::vector<float> Src = Uniform(-SinRange[i], SinRange[i], 1 + static_cast<unsigned int>(i));
+			std::snprintf(name, sizeof(name), "Sin |x| <= %g", SinRange[i]);
+			CheckUnary<P>(name, Src, &Math::Sin, &Math::Sin, &Sin, eError::Absolute, argSinBound[i], argPool);
+			std::snprintf(name, sizeof(name), "Cos |x| <= %g", SinRange[i]);
+			CheckUnary<P>(name, Src, &Math::Cos, &Math::Cos, &Cos, eError::Absolute, argSinBound[i], argPool);
+		}
+
+		CheckUnary<P>("Exp [-87.33, 88.02]", Uniform(-87.33f, 88.02f, 4), &Math::Exp, &Math::Exp, &Exp, eError::Relative, argExpBound, argPool);
+		CheckUnary<P>("Log [2^-126, 2^127]", LogUniform(-126.f, 127.f, 5), &Math::Log, &Math::Log, &Log, argLogError, argLogBound, argPool);
+		CheckUnary<P>("Rsqrt [2^-126, 2^127]", LogUniform(-126.f, 127.f, 6), &Math::Rsqrt, &Math::Rsqrt, &Rsqrt, eError::Relative, argRsqrtBound, argPool);
+
+		const std::vector<float> Y = Uniform(-1000.f, 1000.f, 7);
+		const std::vector<float> X = Uniform(-1000.f, 1000.f, 8);
+		std::vector<float> batch(SampleCount), single(SampleCount);
+		std::vector<double> expected(SampleCount);
+		Math::Atan2(Y, X, batch, argPool);
+		for (size_t i = 0; i < SampleCount; ++i)
+		{
+			single[i] = Math::Atan2(Y[i], X[i]);
+			expected[i] = std::atan2(static_cast<double>(Y[i]), static_cast<double>(X[i]));
+		}
+		Check("Atan2 [-1000, 1000]", batch, single, expected, eError::Absolute, argAtan2Bound);
+	}
+
+	/**
+	 *	@fn			CheckSpecialValues
+	 *	@brief		範囲外とNaNの扱いを確認する
+	 */
+	template<ePrecision P>
+	void CheckSpecialValues()
+	{
+		using Math = FastMath<P>;
+		const float NaN = std::numeric_limits<float>::quiet_NaN();
+		std::vector<float> src(33, NaN), dst(33);
+		Math::Exp(src, dst);
+		bool isPassed = std::isnan(Math::Exp(NaN));
+		for (float value : dst)
+			isPassed = isPassed && std::isnan(value);
+		isPassed = isPassed && Math::Exp(-1000.f) > 0.f && std::isfinite(Math::Exp(1000.f));
+		isPassed = isPassed && Math::Atan2(0.f, 0.f) == 0.f;
+		std::printf("%-6s %-28s\n", isPassed ? "ok" : "FAIL", "NaN and out of range");
+		if (!isPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			Measure
+	 *	@brief		argFuncを何度か呼び、1要素あたりの最短の時間(ナノ秒)を返す
+	 */
+	double Measure(const std::function<void()> &argFunc)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (int i = 0; i < 5; ++i)
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			argFunc();
+			const std::chrono::duration<double, std::nano> Elapsed = std::chrono::steady_clock::now() - Start;
+			if (Elapsed.count() < best)
+				best = Elapsed.count();
+		}
+		return best / SampleCount;
+	}
+
+	/**
+	 *	@fn			ReportThroughput
+	 *	@brief		std::の関数と比べた処理速度を表示する(計測環境に左右されるので失敗にはしない)
+	 */
+	void ReportThroughput(Utility::ThreadPool *argPool)
+	{
+		const std::vector<float> Angle = Uniform(-100.f, 100.f, 9);
+		const std::vector<float> Power = Uniform(-80.f, 80.f, 10);
+		std::vector<float> dst(SampleCount);
+		volatile float sink = 0.f;
+
+		struct Row
+		{
+			const char				*name;
+			std::function<void()>	func;
+		};
+		const Row Rows[] = {
+			{ "std::sin", [&] { for (size_t i = 0; i < SampleCount; ++i) dst[i] = std::sin(Angle[i]); } },
+			{ "FastMath<Full>::Sin", [&] { FastMath<ePrecision::Full>::Sin(Angle, dst); } },
+			{ "FastMath<Fast>::Sin", [&] { FastMath<ePrecision::Fast>::Sin(Angle, dst); } },
+			{ "FastMath<Full>::Sin pool", [&] { FastMath<ePrecision::Full>::Sin(Angle, dst, argPool); } },
+			{ "std::exp", [&] { for (size_t i = 0; i < SampleCount; ++i) dst[i] = std::exp(Power[i]); } },
+			{ "FastMath<Full>::Exp", [&] { FastMath<ePrecision::Full>::Exp(Power, dst); } },
+			{ "FastMath<Fast>::Exp", [&] { FastMath<ePrecision::Fast>::Exp(Power, dst); } },
+			{ "FastMath<Full>::Exp pool", [&] { FastMath<ePrecision::Full>::Exp(Power, dst, argPool); } },
+		};
+		for (const Row &row : Rows)
+		{
+			std::printf("       %-28s %.2f ns/element\n", row.name, Measure(row.func));
+			sink = sink + dst[SampleCount / 2];
+		}
+	}
+}
+
+int main()
+{
+	Utility::ThreadPool pool;
+
+	std::printf("Full\n");
+	const double FullSinBound[] = { 2.7e-7, 2.7e-7, 2.7e-7 };
+	CheckAccuracy<ePrecision::Full>(FullSinBound, 2.9e-7, 1.2e-7, eError::Relative, 1.1e-7, 9.0e-8, &pool);
+	CheckSpecialValues<ePrecision::Full>();
+
+	std::printf("Fast\n");
+	const double FastSinBound[] = { 1.4e-5, 6.4e-5, 5.0e-4 };
+	CheckAccuracy<ePrecision::Fast>(FastSinBound, 1.8e-5, 7.1e-6, eError::Absolute, 7.0e-6, 4.8e-6, &pool);
+	CheckSpecialValues<ePrecision::Fast>();
+
+	std::printf("Throughput (%zu elements)\n", SampleCount);
+	ReportThroughput(&pool);
+
+	return (failCount == 0) ? 0 : 1;
+}
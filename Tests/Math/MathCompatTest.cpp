@@ -0,0 +1,481 @@
+﻿/**
+ *	@file	MathCompatTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	Vector3/Matrix/QuaternionをMathConfig.hで選んだ命令セットで計算し、倍精度の値と比べる。
+ *			--write <file>で結果を書き出し、--compare <file>で別の命令セットの結果(既定はWindowsと同じSSE2)と比べる。
+ *			--exactはビット単位の一致を、--expect <名前>は選ばれた命令セットを確かめる。上限を超えると1を返す
+ *			Tests/CMakeLists.txtが命令セットごとに作って順に実行する
+ */
+#include "Math/Math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Utility::Math::Matrix;
+	using Utility::Math::Quaternion;
+	using Utility::Math::Vector3;
+
+	const size_t	SampleCount = 4096;		//	!<	確認する要素数
+	const double	CompareBound = 2.0e-5;	//	!<	命令セットどうしの差の上限(1以上の値は相対誤差)
+	int				failCount = 0;			//	!<	誤差が上限を超えた確認の数
+	std::vector<float>	results;			//	!<	他の命令セットと比べる全ての結果
+
+	/**
+	 *  @struct		Vec
+	 *  @brief		倍精度の基準値(クォータニオンはwも使う)
+	 */
+	struct Vec
+	{
+		double x, y, z, w;
+	};
+	/**
+	 *  @struct		Mat
+	 *  @brief		倍精度の基準行列(行ベクトルに右から掛ける)
+	 */
+	struct Mat
+	{
+		double m[4][4];
+	};
+
+	Vec ToVec(const Vector3 &argValue) { return { argValue.x, argValue.y, argValue.z, 0.0 }; }
+	Vec ToVec(const Quaternion &argValue) { return { argValue.x, argValue.y, argValue.z, argValue.w }; }
+	Mat ToMat(const Matrix &argValue)
+	{
+		Mat result;
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				result.m[i][j] = argValue.m[i][j];
+		return result;
+	}
+	double Dot3(const Vec &argA, const Vec &argB) { return argA.x * argB.x + argA.y * argB.y + argA.z * argB.z; }
+	double Dot4(const Vec &argA, const Vec &argB) { return Dot3(argA, argB) + argA.w * argB.w; }
+
+	/**
+	 *	@fn			Hamilton
+	 *	@brief		クォータニオンの積argA * argB(argBの回転の後にargAの回転)
+	 */
+	Vec Hamilton(const Vec &argA, const Vec &argB)
+	{
+		return {
+			argA.w * argB.x + argA.x * argB.w + argA.y * argB.z - argA.z * argB.y,
+			argA.w * argB.y - argA.x * argB.z + argA.y * argB.w + argA.z * argB.x,
+			argA.w * argB.z + argA.x * argB.y - argA.y * argB.x + argA.z * argB.w,
+			argA.w * argB.w - argA.x * argB.x - argA.y * argB.y - argA.z * argB.z };
+	}
+	Mat Multiply(const Mat &argA, const Mat &argB)
+	{
+		Mat result = {};
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				for (int k = 0; k < 4; ++k)
+					result.m[i][j] += argA.m[i][k] * argB.m[k][j];
+		return result;
+	}
+	/**
+	 *	@fn			Inverse
+	 *	@brief		部分ピボット選択のガウス・ジョルダン法による逆行列
+	 */
+	Mat Inverse(const Mat &argValue)
+	{
+		double work[4][8];
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+			{
+				work[i][j] = argValue.m[i][j];
+				work[i][j + 4] = (i == j) ? 1.0 : 0.0;
+			}
+		for (int col = 0; col < 4; ++col)
+		{
+			int pivot = col;
+			for (int row = col + 1; row < 4; ++row)
+				if (std::fabs(work[row][col]) > std::fabs(work[pivot][col]))
+					pivot = row;
+			for (int j = 0; j < 8; ++j)
+				std::swap(work[pivot][j], work[col][j]);
+			const double Scale = 1.0 / work[col][col];
+			for (int j = 0; j < 8; ++j)
+				work[col][j] *= Scale;
+			for (int row = 0; row < 4; ++row)
+			{
+				const double Factor = work[row][col];
+				if (row != col)
+					for (int j = 0; j < 8; ++j)
+						work[row][j] -= Factor * work[col][j];
+			}
+		}
+		Mat result;
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				result.m[i][j] = work[i][j + 4];
+		return result;
+	}
+	Mat FromQuaternion(const Vec &argQ)
+	{
+		const double X = argQ.x, Y = argQ.y, Z = argQ.z, W = argQ.w;
+		return { {
+			{ 1.0 - 2.0 * (Y * Y + Z * Z), 2.0 * (X * Y + W * Z), 2.0 * (X * Z - W * Y), 0.0 },
+			{ 2.0 * (X * Y - W * Z), 1.0 - 2.0 * (X * X + Z * Z), 2.0 * (Y * Z + W * X), 0.0 },
+			{ 2.0 * (X * Z + W * Y), 2.0 * (Y * Z - W * X), 1.0 - 2.0 * (X * X + Y * Y), 0.0 },
+			{ 0.0, 0.0, 0.0, 1.0 } } };
+	}
+
+	/**
+	 *	@fn			Random
+	 *	@brief		[argMin, argMax)の一様乱数
+	 *	@note		分布クラスは標準ライブラリごとに数列が違うので、生成器の出力から直接作る
+	 */
+	float Random(std::mt19937 &argEngine, float argMin, float argMax)
+	{
+		return argMin + (argMax - argMin) * static_cast<float>(argEngine() >> 8) * (1.f / 16777216.f);
+	}
+	Vector3 RandomVector(std::mt19937 &argEngine, float argRange)
+	{
+		const float X = Random(argEngine, -argRange, argRange);
+		const float Y = Random(argEngine, -argRange, argRange);
+		const float Z = Random(argEngine, -argRange, argRange);
+		return Vector3(X, Y, Z);
+	}
+	Quaternion RandomRotation(std::mt19937 &argEngine)
+	{
+		Vector3 axis;
+		do
+		{
+			axis = RandomVector(argEngine, 1.f);
+		} while (axis.LengthSquared() < 1.0e-2f);
+		return Quaternion::CreateFromAxisAngle(axis, Random(argEngine, -Utility::Math::PI, Utility::Math::PI));
+	}
+	Matrix RandomTrs(std::mt19937 &argEngine)
+	{
+		const Vector3 Scale(Random(argEngine, 0.5f, 2.f), Random(argEngine, 0.5f, 2.f), Random(argEngine, 0.5f, 2.f));
+		const Quaternion Rotation = RandomRotation(argEngine);
+		const Vector3 Position = RandomVector(argEngine, 10.f);
+		return Matrix::CreateScale(Scale) * Matrix::CreateFromQuaternion(Rotation) * Matrix::CreateTranslation(Position);
+	}
+
+	/**
+	 *	@fn			Error
+	 *	@brief		基準値との差(絶対値が1以上なら相対誤差)
+	 */
+	double Error(double argResult, double argExpected)
+	{
+		return std::fabs(argResult - argExpected) / std::max(1.0, std::fabs(argExpected));
+	}
+	double Error(const Vec &argResult, const Vec &argExpected, double argScale = 1.0)
+	{
+		if (argScale > 1.0)
+			return Error(Vec{ argResult.x / argScale, argResult.y / argScale, argResult.z / argScale, argResult.w / argScale },
+				Vec{ argExpected.x / argScale, argExpected.y / argScale, argExpected.z / argScale, argExpected.w / argScale });
+		return std::max(std::max(Error(argResult.x, argExpected.x), Error(argResult.y, argExpected.y)),
+			std::max(Error(argResult.z, argExpected.z), Error(argResult.w, argExpected.w)));
+	}
+	double Error(const Mat &argResult, const Mat &argExpected, double argScale = 1.0)
+	{
+		double error = 0.0;
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				error = std::max(error, Error(argResult.m[i][j] / std::max(1.0, argScale), argExpected.m[i][j] / std::max(1.0, argScale)));
+		return error;
+	}
+	/**
+	 *	@fn			Magnitude
+	 *	@brief		行列の成分の絶対値の最大値(打ち消し合う計算の誤差を測る基準)
+	 */
+	double Magnitude(const Mat &argValue)
+	{
+		double magnitude = 0.0;
+		for (int i = 0; i < 4; ++i)
+			for (int j = 0; j < 4; ++j)
+				magnitude = std::max(magnitude, std::fabs(argValue.m[i][j]));
+		return magnitude;
+	}
+
+	void Record(float argValue) { results.push_back(argValue); }
+	void Record(const Vector3 &argValue) { results.insert(results.end(), { argValue.x, argValue.y, argValue.z }); }
+	void Record(const Quaternion &argValue) { results.insert(results.end(), { argValue.x, argValue.y, argValue.z, argValue.w }); }
+	void Record(const Matrix &argValue) { results.insert(results.end(), &argValue.m[0][0], &argValue.m[0][0] + 16); }
+
+	/**
+	 *	@fn			Report
+	 *	@brief		誤差を上限と比べて表示する
+	 */
+	void Report(const char *argName, double argError, double argBound)
+	{
+		const bool IsPassed = argError <= argBound;
+		std::printf("%-6s %-30s max %.2e bound %.1e\n", IsPassed ? "ok" : "FAIL", argName, argError, argBound);
+		if (!IsPassed)
+			++failCount;
+	}
+	/**
+	 *	@fn			Report
+	 *	@brief		結果が一致したかを表示する
+	 */
+	void Report(const char *argName, bool argIsPassed)
+	{
+		std::printf("%-6s %-30s\n", argIsPassed ? "ok" : "FAIL", argName);
+		if (!argIsPassed)
+			++failCount;
+	}
+
+	void TestVector(std::mt19937 &argEngine)
+	{
+		double dotError = 0.0, lengthError = 0.0, crossError = 0.0, normalizeError = 0.0, lerpError = 0.0;
+		for (size_t i = 0; i < SampleCount; ++i)
+		{
+			const Vector3 A = RandomVector(argEngine, 10.f);
+			const Vector3 B = RandomVector(argEngine, 10.f);
+			const float T = Random(argEngine, 0.f, 1.f);
+			const Vec DA = ToVec(A), DB = ToVec(B);
+
+			const float Dot = A.Dot(B);
+			const float Length = A.Length();
+			const float Distance = Vector3::Distance(A, B);
+			const Vector3 Cross = A.Cross(B);
+			Vector3 normalized;
+			A.Normalize(normalized);
+			const Vector3 Lerp = Vector3::Lerp(A, B, T);
+
+			// 内積と外積は打ち消し合うので、長さの積に対する誤差で比べる
+			const double ExpectedLength = std::sqrt(Dot3(DA, DA));
+			const double LengthProduct = ExpectedLength * std::sqrt(Dot3(DB, DB));
+			const Vec Sub = { DA.x - DB.x, DA.y - DB.y, DA.z - DB.z, 0.0 };
+			dotError = std::max(dotError, std::fabs(Dot - Dot3(DA, DB)) / std::max(1.0, LengthProduct));
+			lengthError = std::max(lengthError, std::max(Error(Length, ExpectedLength), Error(Distance, std::sqrt(Dot3(Sub, Sub)))));
+			crossError = std::max(crossError, Error(ToVec(Cross), { DA.y * DB.z - DA.z * DB.y, DA.z * DB.x - DA.x * DB.z, DA.x * DB.y - DA.y * DB.x, 0.0 }, LengthProduct));
+			normalizeError = std::max(normalizeError, Error(ToVec(normalized), { DA.x / ExpectedLength, DA.y / ExpectedLength, DA.z / ExpectedLength, 0.0 }));
+			lerpError = std::max(lerpError, Error(ToVec(Lerp), { DA.x + (DB.x - DA.x) * T, DA.y + (DB.y - DA.y) * T, DA.z + (DB.z - DA.z) * T, 0.0 },
+				std::max(ExpectedLength, std::sqrt(Dot3(DB, DB)))));
+
+			Record(Dot);
+			Record(Length);
+			Record(Distance);
+			Record(Cross);
+			Record(normalized);
+			Record(Lerp);
+		}
+		Report("Vector3 Dot", dotError, 2.4e-7);
+		Report("Vector3 Length/Distance", lengthError, 2.4e-7);
+		Report("Vector3 Cross", crossError, 4.8e-7);
+		Report("Vector3 Normalize", normalizeError, 4.8e-7);
+		Report("Vector3 Lerp", lerpError, 4.8e-7);
+	}
+
+	void TestQuaternion(std::mt19937 &argEngine)
+	{
+		double axisAngleError = 0.0, multiplyError = 0.0, slerpError = 0.0, rotateError = 0.0;
+		for (size_t i = 0; i < SampleCount; ++i)
+		{
+			Vector3 axis;
+			do
+			{
+				axis = RandomVector(argEngine, 1.f);
+			} while (axis.LengthSquared() < 1.0e-2f);
+			const float Angle = Random(argEngine, -Utility::Math::PI, Utility::Math::PI);
+			const Quaternion A = Quaternion::CreateFromAxisAngle(axis, Angle);
+			const Quaternion B = RandomRotation(argEngine);
+			const float T = Random(argEngine, 0.f, 1.f);
+			const Vector3 V = RandomVector(argEngine, 10.f);
+
+			const Quaternion Product = A * B;
+			Quaternion slerp;
+			Quaternion::Slerp(A, B, T, slerp);
+			const Vector3 Rotated = Vector3::Transform(V, A);
+
+			// 回転軸と角度
+			const Vec Axis = ToVec(axis);
+			const double AxisLength = std::sqrt(Dot3(Axis, Axis));
+			const double Sin = std::sin(Angle * 0.5) / AxisLength;
+			axisAngleError = std::max(axisAngleError, Error(ToVec(A), { Axis.x * Sin, Axis.y * Sin, Axis.z * Sin, std::cos(Angle * 0.5) }));
+
+			// XMQuaternionMultiply(A, B)はAの回転の後にBの回転
+			const Vec DA = ToVec(A), DB = ToVec(B);
+			multiplyError = std::max(multiplyError, Error(ToVec(Product), Hamilton(DB, DA)));
+
+			// 近い方を回る球面線形補間
+			double cosine = Dot4(DA, DB);
+			const double Sign = (cosine < 0.0) ? -1.0 : 1.0;
+			cosine = std::min(std::fabs(cosine), 1.0);
+			const double Omega = std::acos(cosine);
+			const double S0 = (Omega > 1.0e-6) ? std::sin((1.0 - T) * Omega) / std::sin(Omega) : 1.0 - T;
+			const double S1 = ((Omega > 1.0e-6) ? std::sin(T * Omega) / std::sin(Omega) : T) * Sign;
+			slerpError = std::max(slerpError, Error(ToVec(slerp), { DA.x * S0 + DB.x * S1, DA.y * S0 + DB.y * S1, DA.z * S0 + DB.z * S1, DA.w * S0 + DB.w * S1 }));
+
+			const Vec Conjugate = { -DA.x, -DA.y, -DA.z, DA.w };
+			const Vec DV = ToVec(V);
+			Vec expected = Hamilton(Hamilton(DA, { DV.x, DV.y, DV.z, 0.0 }), Conjugate);
+			expected.w = 0.0;
+			rotateError = std::max(rotateError, Error(ToVec(Rotated), expected, std::sqrt(Dot3(DV, DV))));
+
+			Record(A);
+			Record(Product);
+			Record(slerp);
+			Record(Rotated);
+		}
+		Report("Quaternion FromAxisAngle", axisAngleError, 1.0e-6);
+		Report("Quaternion Multiply", multiplyError, 4.8e-7);
+		Report("Quaternion Slerp", slerpError, 4.0e-6);
+		Report("Vector3 Transform(Quaternion)", rotateError, 1.0e-6);
+	}
+
+	void TestMatrix(std::mt19937 &argEngine)
+	{
+		double rotationError = 0.0, multiplyError = 0.0, inverseError = 0.0, transformError = 0.0, normalError = 0.0;
+		for (size_t i = 0; i < SampleCount; ++i)
+		{
+			const Quaternion Rotation = RandomRotation(argEngine);
+			const Matrix A = RandomTrs(argEngine);
+			const Matrix B = RandomTrs(argEngine);
+			const Vector3 V = RandomVector(argEngine, 10.f);
+
+			const Matrix FromRotation = Matrix::CreateFromQuaternion(Rotation);
+			const Matrix Product = A * B;
+			const Matrix Inverse = A.Invert();
+			const Vector3 Transformed = Vector3::Transform(V, A);
+			const Vector3 Normal = Vector3::TransformNormal(V, A);
+
+			rotationError = std::max(rotationError, Error(ToMat(FromRotation), FromQuaternion(ToVec(Rotation))));
+			const Mat DA = ToMat(A);
+			const Mat DB = ToMat(B);
+			const Vec DV = ToVec(V);
+			multiplyError = std::max(multiplyError, Error(ToMat(Product), Multiply(DA, DB), Magnitude(DA) * Magnitude(DB)));
+			inverseError = std::max(inverseError, Error(ToMat(Inverse), ::Inverse(DA), Magnitude(DA)));
+			Vec coord = {}, normal = {};
+			for (int j = 0; j < 3; ++j)
+			{
+				(&coord.x)[j] = DV.x * DA.m[0][j] + DV.y * DA.m[1][j] + DV.z * DA.m[2][j] + DA.m[3][j];
+				(&normal.x)[j] = DV.x * DA.m[0][j] + DV.y * DA.m[1][j] + DV.z * DA.m[2][j];
+			}
+			const double Scale = std::sqrt(Dot3(DV, DV)) * Magnitude(DA);
+			transformError = std::max(transformError, Error(ToVec(Transformed), coord, Scale));
+			normalError = std::max(normalError, Error(ToVec(Normal), normal, Scale));
+
+			Record(FromRotation);
+			Record(Product);
+			Record(Inverse);
+			Record(Transformed);
+			Record(Normal);
+		}
+		Report("Matrix FromQuaternion", rotationError, 4.8e-7);
+		Report("Matrix Multiply", multiplyError, 1.0e-6);
+		Report("Matrix Invert", inverseError, 1.0e-5);
+		Report("Vector3 Transform(Matrix)", transformError, 1.0e-6);
+		Report("Vector3 TransformNormal", normalError, 1.0e-6);
+	}
+
+	const char *SimdName(Utility::Math::eSimd argSimd)
+	{
+		switch (argSimd)
+		{
+		case Utility::Math::eSimd::Scalar:	return "Scalar";
+		case Utility::Math::eSimd::SSE2:	return "SSE2";
+		case Utility::Math::eSimd::SSE4:	return "SSE4";
+		case Utility::Math::eSimd::AVX:		return "AVX";
+		case Utility::Math::eSimd::AVX2:	return "AVX2";
+		case Utility::Math::eSimd::NEON:	return "NEON";
+		}
+		return "Unknown";
+	}
+
+	/**
+	 *	@fn			Write
+	 *	@brief		全ての結果を書き出す
+	 */
+	bool Write(const char *argFileName)
+	{
+		FILE *file = std::fopen(argFileName, "wb");
+		if (!file)
+			return false;
+		const uint32_t Count = static_cast<uint32_t>(results.size());
+		const bool IsWritten = std::fwrite(&Count, sizeof(Count), 1, file) == 1 && std::fwrite(results.data(), sizeof(float), Count, file) == Count;
+		std::fclose(file);
+		return IsWritten;
+	}
+
+	/**
+	 *	@fn			Compare
+	 *	@brief		別の命令セットで書き出した結果と比べる
+	 */
+	void Compare(const char *argFileName, bool argIsExact)
+	{
+		FILE *file = std::fopen(argFileName, "rb");
+		uint32_t count = 0;
+		std::vector<float> expected;
+		if (file && std::fread(&count, sizeof(count), 1, file) == 1)
+		{
+			expected.resize(count);
+			if (std::fread(expected.data(), sizeof(float), count, file) != count)
+				expected.clear();
+		}
+		if (file)
+			std::fclose(file);
+		if (expected.size() != results.size())
+		{
+			std::printf("FAIL   cannot read %s\n", argFileName);
+			++failCount;
+			return;
+		}
+
+		if (argIsExact)
+		{
+			Report("bit-identical to reference", std::memcmp(results.data(), expected.data(), results.size() * sizeof(float)) == 0);
+			return;
+		}
+		double error = 0.0;
+		for (size_t i = 0; i < results.size(); ++i)
+			error = std::max(error, Error(results[i], expected[i]));
+		Report("reference difference", error, CompareBound);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const char *writeFile = nullptr;
+	const char *compareFile = nullptr;
+	const char *expectSimd = nullptr;
+	bool isExact = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--write") == 0 && i + 1 < argc)
+			writeFile = argv[++i];
+		else if (std::strcmp(argv[i], "--compare") == 0 && i + 1 < argc)
+			compareFile = argv[++i];
+		else if (std::strcmp(argv[i], "--expect") == 0 && i + 1 < argc)
+			expectSimd = argv[++i];
+		else if (std::strcmp(argv[i], "--exact") == 0)
+			isExact = true;
+		else
+		{
+			std::printf("usage: %s [--write file] [--compare file [--exact]] [--expect simd]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	const char *Simd = SimdName(Utility::Math::ActiveSimd);
+	std::printf("simd %s\n", Simd);
+	if (expectSimd)
+		Report("selected instruction set", std::strcmp(expectSimd, Simd) == 0);
+
+	std::mt19937 engine(20261019);
+	TestVector(engine);
+	TestQuaternion(engine);
+	TestMatrix(engine);
+
+	if (writeFile && !Write(writeFile))
+	{
+		std::printf("FAIL   cannot write %s\n", writeFile);
+		++failCount;
+	}
+	if (compareFile)
+		Compare(compareFile, isExact);
+
+	std::printf("%d failed\n", failCount);
+	return (failCount == 0) ? 0 : 1;
+}
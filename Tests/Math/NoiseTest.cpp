@@ -0,0 +1,295 @@
+﻿/**
+ *	@file	NoiseTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	Noiseの結果が命令セットやFMAの有無によらずビット単位で同じかの確認。一致しないと1を返す
+ *			1点ずつの版をSSE2(FMAなし)で計算した値と比べ、まとめて計算する版(AVX2/SSE2、並列)と1点ずつの版を比べる。
+ *			--printで基準値の表を書き出す(基準値はFMAのない構成で作り直すこと)
+ *			このファイルは格子の座標を同じ丸めで作るため-ffp-contract=offで作り、Noise.cppはFMAを使う指定のまま作る
+ *			g++ -std=c++17 -O2 -mavx2 -mfma -c -I../../UtilityLib ../../UtilityLib/Math/Noise.cpp
+ *			g++ -std=c++17 -O2 -mavx2 -mfma -ffp-contract=off -I../../UtilityLib NoiseTest.cpp Noise.o ../../UtilityLib/Math/Vector2f.cpp ../../UtilityLib/Math/Vector3f.cpp ../../UtilityLib/Task/ThreadPool.cpp -lpthread
+ */
+#include "Math/Noise.h"
+#include "Task/ThreadPool.h"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Utility::Math::eFractal;
+	using Utility::Math::eNoiseType;
+	using Utility::Math::Noise;
+	using Utility::Math::NoiseSettings;
+	using Utility::Math::Vector2;
+	using Utility::Math::Vector3;
+
+	const size_t	SampleCount = 50000;	//	!<	まとめて計算する版で確認する要素数
+	int				failCount = 0;			//	!<	一致しなかった確認の数
+
+	const float Points[][4] = {
+		{ 0.3f, 0.7f, 0.1f, 0.9f },
+		{ -12.25f, 3.5f, 100.75f, -0.125f },
+		{ 1234.5678f, -987.654f, 0.001f, 42.f },
+	};
+	const eNoiseType Types[] = { eNoiseType::Value, eNoiseType::Perlin, eNoiseType::Simplex };
+	const char *const TypeNames[] = { "Value", "Perlin", "Simplex" };
+
+	/**
+	 *	@var		Expected
+	 *	@brief		1点ずつの版をSSE2(FMAなし)で計算した値([種類][次元 - 2][点])
+	 */
+	const float Expected[3][3][3] = {
+		{
+			{ -0x1.33c25cp-3f, 0x1.06b1dp-2f, -0x1.5d81fp-3f },
+			{ -0x1.25734ep-3f, -0x1.4053cp-1f, -0x1.5d81fp-3f },
+			{ 0x1.061c78p-1f, -0x1.35e5fcp-1f, -0x1.0cef8ep-1f },
+		},
+		{
+			{ 0x1.92a456p-2f, 0x1.16d27ep-1f, -0x1.33b0eep-2f },
+			{ 0x1.afb938p-2f, -0x1.8f318p-5f, 0x1.ed10bcp-3f },
+			{ -0x1.e905fep-3f, -0x1.5920bap-3f, -0x1.f0821cp-2f },
+		},
+		{
+			{ 0x1.754562p-3f, 0x1.e0f132p-2f, 0x1.a9a6e8p-1f },
+			{ 0x1.e58e22p-5f, -0x1.26dd66p-8f, -0x1.fdde92p-5f },
+			{ -0x1.f9718ep-5f, 0x1.b6e262p-1f, 0x1.8f3c9ap-7f },
+		},
+	};
+	/**
+	 *	@var		ExpectedFractal
+	 *	@brief		3次元のFbm(5オクターブ)とRidged(4オクターブ)の値([重ね方][点])
+	 */
+	const float ExpectedFractal[2][3] = {
+		{ -0x1.29796cp-2f, -0x1.0d6f74p-7f, -0x1.d00c98p-3f },
+		{ 0x1.03c2c4p-1f, 0x1.b4c49cp-1f, 0x1.e6ecdcp-2f },
+	};
+
+	/**
+	 *	@fn			Report
+	 *	@brief		結果が一致したかを表示する
+	 */
+	void Report(const char *argName, bool argIsPassed)
+	{
+		std::printf("%-6s %-32s\n", argIsPassed ? "ok" : "FAIL", argName);
+		if (!argIsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			IsSameBits
+	 *	@brief		2つの値がビット単位で同じか(NaNの比較や-0.0と0.0の違いも区別する)
+	 */
+	bool IsSameBits(float argA, float argB)
+	{
+		return std::memcmp(&argA, &argB, sizeof(float)) == 0;
+	}
+
+	/**
+	 *	@fn			Basis
+	 *	@brief		1点ずつの版で種類と次元を選んで計算する
+	 */
+	float Basis(const Noise &argNoise, eNoiseType argType, size_t argDim, const float (&argPoint)[4])
+	{
+		NoiseSettings settings;
+		settings.type = argType;
+		switch (argDim)
+		{
+		case 2:
+			return argNoise.Fractal(settings, argPoint[0], argPoint[1]);
+		case 3:
+			return argNoise.Fractal(settings, argPoint[0], argPoint[1], argPoint[2]);
+		default:
+			return argNoise.Fractal(settings, argPoint[0], argPoint[1], argPoint[2], argPoint[3]);
+		}
+	}
+
+	/**
+	 *	@fn			FractalSettings
+	 *	@brief		基準値に使う重ね方の設定
+	 */
+	NoiseSettings FractalSettings(eFractal argFractal)
+	{
+		NoiseSettings settings;
+		settings.type = eNoiseType::Simplex;
+		settings.fractal = argFractal;
+		settings.octaves = (argFractal == eFractal::Fbm) ? 5 : 4;
+		settings.frequency = 0.37f;
+		return settings;
+	}
+
+	/**
+	 *	@fn			PrintExpected
+	 *	@brief		基準値の表をソースに貼れる形で書き出す
+	 */
+	void PrintExpected(const Noise &argNoise)
+	{
+		std::printf("\tconst float Expected[3][3][3] = {\n");
+		for (size_t t = 0; t < 3; ++t)
+		{
+			std::printf("\t\t{\n");
+			for (size_t dim = 2; dim <= 4; ++dim)
+			{
+				std::printf("\t\t\t{");
+				for (size_t p = 0; p < 3; ++p)
+					std::printf(" %af,", Basis(argNoise, Types[t], dim, Points[p]));
+				std::printf(" },\n");
+			}
+			std::printf("\t\t},\n");
+		}
+		std::printf("\t};\n\tconst float ExpectedFractal[2][3] = {\n");
+		for (eFractal fractal : { eFractal::Fbm, eFractal::Ridged })
+		{
+			std::printf("\t\t{");
+			for (size_t p = 0; p < 3; ++p)
+				std::printf(" %af,", argNoise.Fractal(FractalSettings(fractal), Points[p][0], Points[p][1], Points[p][2]));
+			std::printf(" },\n");
+		}
+		std::printf("\t};\n");
+	}
+
+	/**
+	 *	@fn			CheckExpected
+	 *	@brief		1点ずつの版が基準値と同じかを確認する
+	 */
+	void CheckExpected(const Noise &argNoise)
+	{
+		for (size_t t = 0; t < 3; ++t)
+		{
+			bool isPassed = true;
+			for (size_t dim = 2; dim <= 4; ++dim)
+			{
+				for (size_t p = 0; p < 3; ++p)
+					isPassed = isPassed && IsSameBits(Basis(argNoise, Types[t], dim, Points[p]), Expected[t][dim - 2][p]);
+			}
+			char name[64];
+			std::snprintf(name, sizeof(name), "%s == reference", TypeNames[t]);
+			Report(name, isPassed);
+		}
+
+		bool isPassed = true;
+		for (size_t p = 0; p < 3; ++p)
+		{
+			isPassed = isPassed && IsSameBits(argNoise.Fractal(FractalSettings(eFractal::Fbm), Points[p][0], Points[p][1], Points[p][2]), ExpectedFractal[0][p]);
+			isPassed = isPassed && IsSameBits(argNoise.Fractal(FractalSettings(eFractal::Ridged), Points[p][0], Points[p][1], Points[p][2]), ExpectedFractal[1][p]);
+		}
+		Report("Fbm / Ridged == reference", isPassed);
+	}
+
+	/**
+	 *	@fn			CheckBatch
+	 *	@brief		まとめて計算する版(1スレッドと並列)が1点ずつの版と同じかを確認する
+	 */
+	void CheckBatch(const Noise &argNoise, Utility::ThreadPool *argPool)
+	{
+		std::mt19937 engine(1);
+		std::uniform_real_distribution<float> dist(-300.f, 300.f);
+		std::vector<float> x(SampleCount), y(SampleCount), z(SampleCount), w(SampleCount);
+		for (size_t i = 0; i < SampleCount; ++i)
+		{
+			x[i] = dist(engine);
+			y[i] = dist(engine);
+			z[i] = dist(engine);
+			w[i] = dist(engine);
+		}
+
+		std::vector<float> single(SampleCount), parallel(SampleCount);
+		for (size_t t = 0; t < 3; ++t)
+		{
+			NoiseSettings settings;
+			settings.type = Types[t];
+			settings.octaves = 3;
+			settings.frequency = 0.05f;
+			for (size_t dim = 2; dim <= 4; ++dim)
+			{
+				bool isPassed = true;
+				for (Utility::ThreadPool *pool : { static_cast<Utility::ThreadPool *>(nullptr), argPool })
+				{
+					std::vector<float> &dst = (pool != nullptr) ? parallel : single;
+					if (dim == 2)
+						argNoise.Evaluate(settings, x, y, dst, pool);
+					else if (dim == 3)
+						argNoise.Evaluate(settings, x, y, z, dst, pool);
+					else
+						argNoise.Evaluate(settings, x, y, z, w, dst, pool);
+				}
+				for (size_t i = 0; i < SampleCount; ++i)
+				{
+					const float Scalar = (dim == 2) ? argNoise.Fractal(settings, x[i], y[i]) :
+						(dim == 3) ? argNoise.Fractal(settings, x[i], y[i], z[i]) : argNoise.Fractal(settings, x[i], y[i], z[i], w[i]);
+					isPassed = isPassed && IsSameBits(single[i], Scalar) && IsSameBits(parallel[i], Scalar);
+				}
+				char name[64];
+				std::snprintf(name, sizeof(name), "%s %zuD Evaluate == scalar", TypeNames[t], dim);
+				Report(name, isPassed);
+			}
+		}
+	}
+
+	/**
+	 *	@fn			CheckGrid
+	 *	@brief		格子の版が1点ずつの版と同じかを確認する
+	 */
+	void CheckGrid(const Noise &argNoise, Utility::ThreadPool *argPool)
+	{
+		const size_t Width = 67, Height = 45, Depth = 9;
+		const Vector3 Origin(-3.25f, 17.5f, 0.125f);
+		const Vector3 Step(0.173f, 0.091f, 0.5f);
+		std::vector<float> dst(Width * Height * Depth);
+		for (size_t t = 0; t < 3; ++t)
+		{
+			NoiseSettings settings;
+			settings.type = Types[t];
+			settings.octaves = 2;
+
+			bool isPassed = true;
+			argNoise.Grid(settings, dst, Width, Height, Vector2(Origin.x, Origin.y), Vector2(Step.x, Step.y), argPool);
+			for (size_t j = 0; j < Height; ++j)
+			{
+				for (size_t i = 0; i < Width; ++i)
+				{
+					const float X = Origin.x + Step.x * static_cast<float>(i);
+					const float Y = Origin.y + Step.y * static_cast<float>(j);
+					isPassed = isPassed && IsSameBits(dst[j * Width + i], argNoise.Fractal(settings, X, Y));
+				}
+			}
+			argNoise.Grid(settings, dst, Width, Height, Depth, Origin, Step, argPool);
+			for (size_t k = 0; k < Depth; ++k)
+			{
+				for (size_t j = 0; j < Height; ++j)
+				{
+					for (size_t i = 0; i < Width; ++i)
+					{
+						const float X = Origin.x + Step.x * static_cast<float>(i);
+						const float Y = Origin.y + Step.y * static_cast<float>(j);
+						const float Z = Origin.z + Step.z * static_cast<float>(k);
+						isPassed = isPassed && IsSameBits(dst[(k * Height + j) * Width + i], argNoise.Fractal(settings, X, Y, Z));
+					}
+				}
+			}
+			char name[64];
+			std::snprintf(name, sizeof(name), "%s Grid == scalar", TypeNames[t]);
+			Report(name, isPassed);
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	const Noise Generator(12345);
+	if (argc > 1 && std::strcmp(argv[1], "--print") == 0)
+	{
+		PrintExpected(Generator);
+		return 0;
+	}
+
+	Utility::ThreadPool pool;
+	CheckExpected(Generator);
+	CheckBatch(Generator, &pool);
+	CheckGrid(Generator, &pool);
+
+	return (failCount == 0) ? 0 : 1;
+}
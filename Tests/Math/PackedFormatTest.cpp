@@ -0,0 +1,299 @@
+﻿/**
+ *	@file	PackedFormatTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	PackedFormatの往復の精度と、まとめて変換する版が1要素ずつの版と同じ結果になることの確認。
+ *			単体で実行し、どれかの確認に失敗すると1を返す
+ *			g++ -std=c++17 -O2 -mavx2 -I../../UtilityLib PackedFormatTest.cpp ../../UtilityLib/Math/PackedFormat.cpp ../../UtilityLib/Task/ThreadPool.cpp -lpthread
+ */
+#include "Math/PackedFormat.h"
+#include "Task/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Utility::Math::PackedFormat;
+	using Utility::Math::PackedNormal;
+	using Utility::Math::Vector3;
+
+	int failCount = 0;	//	!<	失敗した確認の数
+
+	/**
+	 *	@fn			Report
+	 *	@brief		確認の結果を表示する
+	 *	@param[in]	argName		!<	表示する名前
+	 *	@param[in]	argIsPassed	!<	成功したか
+	 *	@param[in]	argDetail	!<	補足(誤差等)
+	 */
+	void Report(const char *argName, bool argIsPassed, const char *argDetail = "")
+	{
+		std::printf("%-6s %-36s %s\n", argIsPassed ? "ok" : "FAIL", argName, argDetail);
+		if (!argIsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			IsSameBits
+	 *	@brief		floatがビット単位で同じか
+	 */
+	bool IsSameBits(float argA, float argB)
+	{
+		return std::memcmp(&argA, &argB, sizeof(float)) == 0;
+	}
+
+	/**
+	 *	@fn			HalfValue
+	 *	@brief		半精度のビット列が表す値(倍精度で計算した基準値)
+	 */
+	double HalfValue(std::uint16_t argHalf)
+	{
+		const int Exponent = (argHalf >> 10) & 0x1f;
+		const int Mantissa = argHalf & 0x3ff;
+		const double Sign = (argHalf & 0x8000) ? -1.0 : 1.0;
+		if (Exponent == 0x1f)
+			return (Mantissa == 0) ? Sign * std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+		if (Exponent == 0)
+			return Sign * std::ldexp(Mantissa, -24);
+		return Sign * std::ldexp(Mantissa + 1024, Exponent - 25);
+	}
+
+	/**
+	 *	@fn			IsNearestHalf
+	 *	@brief		argHalfがargValueに最も近い半精度か(同じ距離なら仮数が偶数の方)
+	 */
+	bool IsNearestHalf(float argValue, std::uint16_t argHalf)
+	{
+		const std::uint16_t Sign = std::signbit(argValue) ? 0x8000 : 0;
+		const std::uint16_t Magnitude = argHalf & 0x7fff;
+		if ((argHalf & 0x8000) != Sign && Magnitude != 0)
+			return false;
+
+		// 最大の有限値(65504)と無限大の中間(65520)以上は無限大
+		const double Value = std::fabs(static_cast<double>(argValue));
+		if (Value >= 65520.0)
+			return Magnitude == 0x7c00;
+		if (Magnitude >= 0x7c00)
+			return false;
+
+		const double Error = std::fabs(Value - HalfValue(Magnitude));
+		const double Lower = (Magnitude > 0) ? std::fabs(Value - HalfValue(Magnitude - 1)) : std::numeric_limits<double>::max();
+		const double Upper = std::fabs(Value - HalfValue(Magnitude + 1));
+		if (Error > Lower || Error > Upper)
+			return false;
+		return (Error < Lower && Error < Upper) || (Magnitude & 1) == 0;
+	}
+
+	/**
+	 *	@fn			CheckHalf
+	 *	@brief		半精度の変換を確認する
+	 */
+	void CheckHalf(Utility::ThreadPool *argPool)
+	{
+		// 全てのビット列を戻し、NaN以外は基準値と同じで、もう一度詰めると元に戻ること
+		std::vector<std::uint16_t> all(65536);
+		for (size_t i = 0; i < all.size(); ++i)
+			all[i] = static_cast<std::uint16_t>(i);
+		std::vector<float> decoded(all.size());
+		std::vector<std::uint16_t> encoded(all.size());
+		PackedFormat::HalfToFloat(all, decoded, argPool);
+		PackedFormat::FloatToHalf(decoded, encoded, argPool);
+
+		bool isDecoded = true, isRoundTrip = true, isSame = true;
+		for (size_t i = 0; i < all.size(); ++i)
+		{
+			const double Expected = HalfValue(all[i]);
+			if (std::isnan(Expected))
+			{
+				isDecoded = isDecoded && std::isnan(decoded[i]);
+				isRoundTrip = isRoundTrip && (encoded[i] & 0x7c00) == 0x7c00 && (encoded[i] & 0x3ff) != 0;
+			}
+			else
+			{
+				isDecoded = isDecoded && static_cast<double>(decoded[i]) == Expected;
+				isRoundTrip = isRoundTrip && encoded[i] == all[i];
+			}
+			isSame = isSame && IsSameBits(PackedFormat::HalfToFloat(all[i]), decoded[i]);
+		}
+		Report("Half -> float every code", isDecoded);
+		Report("Half round trip every code", isRoundTrip);
+		Report("Half -> float batch == single", isSame);
+
+		// 乱数(半精度の範囲付近に寄せたものを含む)が最も近い半精度になること
+		std::mt19937 engine(1);
+		std::vector<float> src(1 << 22);
+		for (size_t i = 0; i < src.size(); ++i)
+		{
+			std::uint32_t bits = engine();
+			if (i % 2 == 0)
+				bits = (bits & 0x807fffffu) | ((100u + engine() % 45u) << 23);
+			std::memcpy(&src[i], &bits, sizeof(float));
+		}
+		std::vector<std::uint16_t> halves(src.size());
+		PackedFormat::FloatToHalf(src, halves, argPool);
+
+		bool isNearest = true;
+		isSame = true;
+		for (size_t i = 0; i < src.size(); ++i)
+		{
+			if (std::isnan(src[i]))
+				isNearest = isNearest && (halves[i] & 0x7c00) == 0x7c00 && (halves[i] & 0x3ff) != 0;
+			else
+				isNearest = isNearest && IsNearestHalf(src[i], halves[i]);
+			isSame = isSame && PackedFormat::FloatToHalf(src[i]) == halves[i];
+		}
+		Report("Float -> half nearest even", isNearest);
+		Report("Float -> half batch == single", isSame);
+	}
+
+	/**
+	 *	@fn			CheckNorm
+	 *	@brief		正規化整数の変換を確認する
+	 *	@param[in]	argName	!<	表示する名前
+	 */
+	template<typename T>
+	void CheckNorm(const char *argName, Utility::ThreadPool *argPool)
+	{
+		const bool IsSigned = std::numeric_limits<T>::is_signed;
+		const float Scale = static_cast<float>(std::numeric_limits<T>::max());
+		const float Lower = IsSigned ? -1.f : 0.f;
+		char name[64];
+
+		// 全ての値を戻し、もう一度詰めると元に戻ること(SNORMの最小値は-1になるので最小値+1に戻る)
+		std::vector<T> all;
+		for (int i = std::numeric_limits<T>::min(); i <= std::numeric_limits<T>::max(); ++i)
+			all.push_back(static_cast<T>(i));
+		std::vector<float> decoded(all.size());
+		std::vector<T> encoded(all.size());
+		PackedFormat::NormToFloat(all, decoded, argPool);
+		PackedFormat::FloatToNorm(decoded, encoded, argPool);
+
+		bool isDecoded = true, isRoundTrip = true, isSame = true;
+		for (size_t i = 0; i < all.size(); ++i)
+		{
+			const float Expected = std::max(static_cast<float>(all[i]) / Scale, Lower);
+			isDecoded = isDecoded && std::fabs(decoded[i] - Expected) <= std::numeric_limits<float>::epsilon();
+			const T Back = (IsSigned && all[i] == std::numeric_limits<T>::min()) ? static_cast<T>(all[i] + 1) : all[i];
+			isRoundTrip = isRoundTrip && encoded[i] == Back;
+
+			float single;
+			PackedFormat::NormToFloat(Utility::Span<const T>(&all[i], 1), Utility::Span<float>(&single, 1));
+			isSame = isSame && IsSameBits(single, decoded[i]);
+		}
+		std::snprintf(name, sizeof(name), "%s -> float every code", argName);
+		Report(name, isDecoded);
+		std::snprintf(name, sizeof(name), "%s round trip every code", argName);
+		Report(name, isRoundTrip);
+		std::snprintf(name, sizeof(name), "%s -> float batch == single", argName);
+		Report(name, isSame);
+
+		// 範囲外は丸め、NaNは下限、それ以外は単精度で掛けた値に最も近い整数になること(D3Dの変換規則と同じ)
+		std::mt19937 engine(2);
+		std::uniform_real_distribution<float> dist(-1.5f, 1.5f);
+		std::vector<float> src(100003);
+		for (float &value : src)
+			value = dist(engine);
+		src[0] = std::numeric_limits<float>::quiet_NaN();
+		src[1] = std::numeric_limits<float>::infinity();
+		src[2] = -std::numeric_limits<float>::infinity();
+		std::vector<T> quantized(src.size());
+		PackedFormat::FloatToNorm(src, quantized, argPool);
+
+		bool isNearest = true;
+		isSame = true;
+		for (size_t i = 0; i < src.size(); ++i)
+		{
+			const float Clamped = std::isnan(src[i]) ? Lower : std::min(std::max(src[i], Lower), 1.f);
+			const float Scaled = Clamped * Scale;
+			isNearest = isNearest && static_cast<float>(quantized[i]) == std::nearbyint(Scaled);
+
+			T single;
+			PackedFormat::FloatToNorm(Utility::Span<const float>(&src[i], 1), Utility::Span<T>(&single, 1));
+			isSame = isSame && single == quantized[i];
+		}
+		std::snprintf(name, sizeof(name), "Float -> %s nearest", argName);
+		Report(name, isNearest);
+		std::snprintf(name, sizeof(name), "Float -> %s batch == single", argName);
+		Report(name, isSame);
+	}
+
+	/**
+	 *	@fn			CheckOctahedral
+	 *	@brief		八面体写像の往復を確認する
+	 */
+	void CheckOctahedral(Utility::ThreadPool *argPool)
+	{
+		const double MaxAngle = 6.5e-5;
+
+		std::mt19937 engine(3);
+		std::normal_distribution<float> dist;
+		std::vector<Vector3> src(200000);
+		for (Vector3 &normal : src)
+		{
+			float x, y, z, length;
+			do
+			{
+				x = dist(engine);
+				y = dist(engine);
+				z = dist(engine);
+				length = std::sqrt(x * x + y * y + z * z);
+			} while (length < 1e-3f);
+			normal = Vector3(x / length, y / length, z / length);
+		}
+		// 八面体の頂点と折り返しの境目
+		src[0] = Vector3(0.f, 0.f, 1.f);
+		src[1] = Vector3(0.f, 0.f, -1.f);
+		src[2] = Vector3(1.f, 0.f, 0.f);
+		src[3] = Vector3(0.f, -1.f, 0.f);
+		src[4] = Vector3(0.70710678f, -0.70710678f, 0.f);
+
+		std::vector<PackedNormal> packed(src.size());
+		std::vector<Vector3> decoded(src.size());
+		PackedFormat::EncodeOctahedral(src, packed, argPool);
+		PackedFormat::DecodeOctahedral(packed, decoded, argPool);
+
+		double maxAngle = 0.0;
+		bool isSame = true;
+		for (size_t i = 0; i < src.size(); ++i)
+		{
+			const double AX = src[i].x, AY = src[i].y, AZ = src[i].z;
+			const double BX = decoded[i].x, BY = decoded[i].y, BZ = decoded[i].z;
+			const double CX = AY * BZ - AZ * BY, CY = AZ * BX - AX * BZ, CZ = AX * BY - AY * BX;
+			const double Angle = std::atan2(std::sqrt(CX * CX + CY * CY + CZ * CZ), AX * BX + AY * BY + AZ * BZ);
+			maxAngle = std::max(maxAngle, Angle);
+
+			const PackedNormal Single = PackedFormat::EncodeOctahedral(src[i]);
+			const Vector3 Back = PackedFormat::DecodeOctahedral(Single);
+			isSame = isSame && Single.x == packed[i].x && Single.y == packed[i].y &&
+				IsSameBits(Back.x, decoded[i].x) && IsSameBits(Back.y, decoded[i].y) && IsSameBits(Back.z, decoded[i].z);
+		}
+		char detail[64];
+		std::snprintf(detail, sizeof(detail), "max %.2e rad (bound %.1e)", maxAngle, MaxAngle);
+		Report("Octahedral round trip angle", maxAngle <= MaxAngle, detail);
+		Report("Octahedral batch == single", isSame);
+
+		const Vector3 Zero = PackedFormat::DecodeOctahedral(PackedFormat::EncodeOctahedral(Vector3(0.f, 0.f, 0.f)));
+		Report("Octahedral zero -> (0, 0, 1)", Zero.x == 0.f && Zero.y == 0.f && Zero.z == 1.f);
+	}
+}
+
+int main()
+{
+	Utility::ThreadPool pool;
+
+	CheckHalf(&pool);
+	CheckNorm<std::int8_t>("SNORM8", &pool);
+	CheckNorm<std::int16_t>("SNORM16", &pool);
+	CheckNorm<std::uint8_t>("UNORM8", &pool);
+	CheckNorm<std::uint16_t>("UNORM16", &pool);
+	CheckOctahedral(&pool);
+
+	return (failCount == 0) ? 0 : 1;
+}
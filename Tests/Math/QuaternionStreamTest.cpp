@@ -0,0 +1,262 @@
+﻿/**
+ *	@file	QuaternionStreamTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	QuaternionStreamの誤差の確認。倍精度で計算した値と比べ、QuaternionStream.hに書いた上限を超えると1を返す
+ *			g++ -std=c++17 -O2 -mavx2 -I../../UtilityLib QuaternionStreamTest.cpp ../../UtilityLib/Math/QuaternionStream.cpp ../../UtilityLib/Math/Vector3Stream.cpp ../../UtilityLib/Task/ThreadPool.cpp -lpthread
+ */
+#include "Math/QuaternionStream.h"
+#include "Math/Vector3Stream.h"
+#include "Task/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Utility::Math::Quaternion;
+	using Utility::Math::QuaternionStream;
+	using Utility::Math::Vector3;
+	using Utility::Math::Vector3Stream;
+
+	const size_t	SampleCount = 200000;	//	!<	確認する要素数
+	const double	RoundingBound = 4.8e-7;	//	!<	DirectXMathと同じ計算順序の演算の上限(単精度の丸め誤差程度)
+	int				failCount = 0;			//	!<	誤差が上限を超えた確認の数
+
+	/**
+	 *  @struct		Quat
+	 *  @brief		倍精度の基準値
+	 */
+	struct Quat
+	{
+		double x, y, z, w;
+	};
+
+	Quat ToQuat(const Quaternion &argValue) { return { argValue.x, argValue.y, argValue.z, argValue.w }; }
+	double Dot(const Quat &argA, const Quat &argB) { return argA.x * argB.x + argA.y * argB.y + argA.z * argB.z + argA.w * argB.w; }
+	Quat Scale(const Quat &argValue, double argScale) { return { argValue.x * argScale, argValue.y * argScale, argValue.z * argScale, argValue.w * argScale }; }
+	Quat Add(const Quat &argA, const Quat &argB) { return { argA.x + argB.x, argA.y + argB.y, argA.z + argB.z, argA.w + argB.w }; }
+	Quat Normalize(const Quat &argValue) { return Scale(argValue, 1.0 / std::sqrt(Dot(argValue, argValue))); }
+
+	/**
+	 *	@fn			RandomUnit
+	 *	@brief		一様に分布する単位クォータニオンの列
+	 */
+	std::vector<Quaternion> RandomUnit(unsigned int argSeed)
+	{
+		std::mt19937 engine(argSeed);
+		std::normal_distribution<float> dist;
+		std::vector<Quaternion> values(SampleCount);
+		for (Quaternion &value : values)
+		{
+			const Quat Q = Normalize({ dist(engine), dist(engine), dist(engine), dist(engine) });
+			value = Quaternion(static_cast<float>(Q.x), static_cast<float>(Q.y), static_cast<float>(Q.z), static_cast<float>(Q.w));
+		}
+		return values;
+	}
+
+	/**
+	 *	@fn			Load
+	 *	@brief		QuaternionStreamに読み込む
+	 */
+	QuaternionStream Load(const std::vector<Quaternion> &argSrc)
+	{
+		QuaternionStream stream;
+		stream.Load(argSrc.data(), argSrc.size());
+		return stream;
+	}
+
+	/**
+	 *	@fn			MaxError
+	 *	@brief		各成分の誤差の最大値
+	 */
+	double MaxError(const Quaternion &argResult, const Quat &argExpected)
+	{
+		return std::max(std::max(std::fabs(argResult.x - argExpected.x), std::fabs(argResult.y - argExpected.y)),
+			std::max(std::fabs(argResult.z - argExpected.z), std::fabs(argResult.w - argExpected.w)));
+	}
+
+	/**
+	 *	@fn			Report
+	 *	@brief		誤差を上限と比べて表示する
+	 */
+	void Report(const char *argName, double argError, double argBound)
+	{
+		const bool IsPassed = argError <= argBound;
+		std::printf("%-6s %-24s max %.2e bound %.1e\n", IsPassed ? "ok" : "FAIL", argName, argError, argBound);
+		if (!IsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			Report
+	 *	@brief		結果が一致したかを表示する
+	 */
+	void Report(const char *argName, bool argIsPassed)
+	{
+		std::printf("%-6s %-24s\n", argIsPassed ? "ok" : "FAIL", argName);
+		if (!argIsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			IsSame
+	 *	@brief		2つの列が全ての成分で同じか
+	 */
+	bool IsSame(const QuaternionStream &argA, const QuaternionStream &argB)
+	{
+		if (argA.Size() != argB.Size())
+			return false;
+		for (size_t i = 0; i < argA.Size(); ++i)
+		{
+			const Quaternion A = argA.Get(i);
+			const Quaternion B = argB.Get(i);
+			if (A.x != B.x || A.y != B.y || A.z != B.z || A.w != B.w)
+				return false;
+		}
+		return true;
+	}
+
+	/**
+	 *	@fn			ExpectedSlerp
+	 *	@brief		三角関数で計算した球面線形補間(近い方を回る)
+	 */
+	Quat ExpectedSlerp(Quat argA, Quat argB, double argT)
+	{
+		double cos = Dot(argA, argB);
+		if (cos < 0.0)
+		{
+			argB = Scale(argB, -1.0);
+			cos = -cos;
+		}
+		const double Theta = std::acos(std::min(cos, 1.0));
+		if (Theta < 1e-6)
+			return Normalize(Add(Scale(argA, 1.0 - argT), Scale(argB, argT)));
+		const double Sin = std::sin(Theta);
+		return Add(Scale(argA, std::sin((1.0 - argT) * Theta) / Sin), Scale(argB, std::sin(argT * Theta) / Sin));
+	}
+
+	/**
+	 *	@fn			ExpectedLerp
+	 *	@brief		正規化付きの線形補間(近い方を回る)
+	 */
+	Quat ExpectedLerp(const Quat &argA, Quat argB, double argT)
+	{
+		if (Dot(argA, argB) < 0.0)
+			argB = Scale(argB, -1.0);
+		return Normalize(Add(Scale(argA, 1.0 - argT), Scale(argB, argT)));
+	}
+}
+
+int main()
+{
+	Utility::ThreadPool pool;
+
+	const std::vector<Quaternion> A = RandomUnit(1);
+	const std::vector<Quaternion> B = RandomUnit(2);
+	const QuaternionStream StreamA = Load(A);
+	const QuaternionStream StreamB = Load(B);
+
+	std::mt19937 engine(3);
+	std::uniform_real_distribution<float> dist(0.f, 1.f);
+	std::vector<float> t(SampleCount);
+	for (float &value : t)
+		value = dist(engine);
+	const float SharedT = 0.3f;
+
+	// Multiply(argAの後にargB)
+	QuaternionStream result;
+	QuaternionStream::Multiply(StreamA, StreamB, &result, &pool);
+	double error = 0.0;
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		const Quat QA = ToQuat(A[i]), QB = ToQuat(B[i]);
+		const Quat Expected = {
+			QB.w * QA.x + QB.x * QA.w + QB.y * QA.z - QB.z * QA.y,
+			QB.w * QA.y - QB.x * QA.z + QB.y * QA.w + QB.z * QA.x,
+			QB.w * QA.z + QB.x * QA.y - QB.y * QA.x + QB.z * QA.w,
+			QB.w * QA.w - QB.x * QA.x - QB.y * QA.y - QB.z * QA.z };
+		error = std::max(error, MaxError(result.Get(i), Expected));
+	}
+	Report("Multiply", error, RoundingBound);
+
+	// Normalize(長さがばらばらの入力)
+	std::vector<Quaternion> unnormalized(A);
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		const float Length = 0.01f + 100.f * dist(engine);
+		unnormalized[i] = Quaternion(A[i].x * Length, A[i].y * Length, A[i].z * Length, A[i].w * Length);
+	}
+	unnormalized[0] = Quaternion(0.f, 0.f, 0.f, 0.f);
+	QuaternionStream::Normalize(Load(unnormalized), &result, &pool);
+	error = 0.0;
+	for (size_t i = 1; i < SampleCount; ++i)
+		error = std::max(error, MaxError(result.Get(i), Normalize(ToQuat(unnormalized[i]))));
+	Report("Normalize", error, RoundingBound);
+	const Quaternion Zero = result.Get(0);
+	Report("Normalize zero", Zero.x == 0.f && Zero.y == 0.f && Zero.z == 0.f && Zero.w == 0.f);
+
+	// Conjugate
+	QuaternionStream::Conjugate(StreamA, &result, &pool);
+	bool isConjugate = true;
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		const Quaternion Q = result.Get(i);
+		isConjugate = isConjugate && Q.x == -A[i].x && Q.y == -A[i].y && Q.z == -A[i].z && Q.w == A[i].w;
+	}
+	Report("Conjugate", isConjugate);
+
+	// Lerp、Slerp(要素ごとの係数と、全要素で共通の係数を要素ごとに並べたものが同じ結果になること)
+	const std::vector<float> Shared(SampleCount, SharedT);
+	QuaternionStream shared, each;
+	QuaternionStream::Lerp(StreamA, StreamB, t, &result, &pool);
+	error = 0.0;
+	for (size_t i = 0; i < SampleCount; ++i)
+		error = std::max(error, MaxError(result.Get(i), ExpectedLerp(ToQuat(A[i]), ToQuat(B[i]), t[i])));
+	Report("Lerp", error, RoundingBound);
+	QuaternionStream::Lerp(StreamA, StreamB, SharedT, &shared, &pool);
+	QuaternionStream::Lerp(StreamA, StreamB, Shared, &each, &pool);
+	Report("Lerp shared == each", IsSame(shared, each));
+
+	QuaternionStream::Slerp(StreamA, StreamB, t, &result, &pool);
+	error = 0.0;
+	for (size_t i = 0; i < SampleCount; ++i)
+		error = std::max(error, MaxError(result.Get(i), ExpectedSlerp(ToQuat(A[i]), ToQuat(B[i]), t[i])));
+	Report("Slerp", error, 5.0e-7);
+	QuaternionStream::Slerp(StreamA, StreamB, SharedT, &shared, &pool);
+	QuaternionStream::Slerp(StreamA, StreamB, Shared, &each, &pool);
+	Report("Slerp shared == each", IsSame(shared, each));
+
+	// Rotate(単位ベクトル)
+	std::normal_distribution<float> normal;
+	std::vector<Vector3> vectors(SampleCount);
+	for (Vector3 &value : vectors)
+	{
+		const float X = normal(engine), Y = normal(engine), Z = normal(engine);
+		const float Length = std::sqrt(X * X + Y * Y + Z * Z);
+		value = Vector3(X / Length, Y / Length, Z / Length);
+	}
+	Vector3Stream src, rotated;
+	src.Load(vectors.data(), vectors.size());
+	QuaternionStream::Rotate(src, StreamA, &rotated, &pool);
+	error = 0.0;
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		// v' = v + 2w * (q × v) + 2q × (q × v)
+		const Quat Q = ToQuat(A[i]);
+		const double VX = vectors[i].x, VY = vectors[i].y, VZ = vectors[i].z;
+		const double CX = Q.y * VZ - Q.z * VY, CY = Q.z * VX - Q.x * VZ, CZ = Q.x * VY - Q.y * VX;
+		const double EX = VX + 2.0 * (Q.w * CX + Q.y * CZ - Q.z * CY);
+		const double EY = VY + 2.0 * (Q.w * CY + Q.z * CX - Q.x * CZ);
+		const double EZ = VZ + 2.0 * (Q.w * CZ + Q.x * CY - Q.y * CX);
+		const Vector3 R = rotated.Get(i);
+		error = std::max(error, std::max(std::max(std::fabs(R.x - EX), std::fabs(R.y - EY)), std::fabs(R.z - EZ)));
+	}
+	Report("Rotate", error, 1.0e-6);
+
+	return (failCount == 0) ? 0 : 1;
+}
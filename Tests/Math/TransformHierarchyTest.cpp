@@ -0,0 +1,207 @@
+﻿/**
+ *	@file	TransformHierarchyTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	TransformHierarchyのワールド行列の確認。倍精度で親から順に掛けた行列と比べ、上限を超えると1を返す
+ *			g++ -std=c++17 -O2 -mavx2 -I../../UtilityLib TransformHierarchyTest.cpp ../../UtilityLib/Math/TransformHierarchy.cpp ../../UtilityLib/Math/Vector3Stream.cpp ../../UtilityLib/Math/Matrix.cpp ../../UtilityLib/Math/Quaternion.cpp ../../UtilityLib/Math/Vector3f.cpp ../../UtilityLib/Task/ThreadPool.cpp -lpthread
+ */
+#include "Math/TransformHierarchy.h"
+#include "Task/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Utility::Math::Matrix;
+	using Utility::Math::Quaternion;
+	using Utility::Math::TransformHierarchy;
+	using Utility::Math::Vector3;
+	using Utility::Math::Vector3Stream;
+
+	const size_t	NodeCount = 50000;		//	!<	ノード数(ParallelGrainより多くして並列の経路も通す)
+	const size_t	RootCount = 16;			//	!<	親を持たないノードの数
+	const double	WorldBound = 1.0e-5;	//	!<	ワールド行列の誤差の上限(行の大きさに対する比。深さの分だけ丸め誤差が積み重なる)
+	int				failCount = 0;			//	!<	確認に失敗した数
+
+	/**
+	 *  @struct		Affine
+	 *  @brief		倍精度の基準値(行ベクトルの流儀の4x3)
+	 */
+	struct Affine
+	{
+		double m[4][3];
+	};
+
+	/**
+	 *	@fn			LocalOf
+	 *	@brief		ノードのローカルの行列(S * R * T)
+	 */
+	Affine LocalOf(const TransformHierarchy &argHierarchy, size_t argIndex)
+	{
+		const Quaternion R = argHierarchy.Rotation(argIndex);
+		const Vector3 S = argHierarchy.Scale(argIndex);
+		const Vector3 T = argHierarchy.Position(argIndex);
+		const double X = R.x, Y = R.y, Z = R.z, W = R.w;
+		const Affine Local = { {
+			{ (1.0 - 2.0 * (Y * Y + Z * Z)) * S.x, 2.0 * (X * Y + W * Z) * S.x, 2.0 * (X * Z - W * Y) * S.x },
+			{ 2.0 * (X * Y - W * Z) * S.y, (1.0 - 2.0 * (X * X + Z * Z)) * S.y, 2.0 * (Y * Z + W * X) * S.y },
+			{ 2.0 * (X * Z + W * Y) * S.z, 2.0 * (Y * Z - W * X) * S.z, (1.0 - 2.0 * (X * X + Y * Y)) * S.z },
+			{ T.x, T.y, T.z } } };
+		return Local;
+	}
+
+	/**
+	 *	@fn			Multiply
+	 *	@brief		argLocal * argParent
+	 */
+	Affine Multiply(const Affine &argLocal, const Affine &argParent)
+	{
+		Affine result;
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int column = 0; column < 3; ++column)
+			{
+				result.m[row][column] = argLocal.m[row][0] * argParent.m[0][column] + argLocal.m[row][1] * argParent.m[1][column] + argLocal.m[row][2] * argParent.m[2][column];
+				if (row == 3)
+					result.m[row][column] += argParent.m[3][column];
+			}
+		}
+		return result;
+	}
+
+	/**
+	 *	@fn			Expected
+	 *	@brief		親から順に倍精度で掛けたワールド行列
+	 */
+	std::vector<Affine> Expected(const TransformHierarchy &argHierarchy)
+	{
+		std::vector<Affine> world(argHierarchy.Size());
+		for (size_t i = 0; i < argHierarchy.Size(); ++i)
+		{
+			const int32_t Parent = argHierarchy.Parent(i);
+			world[i] = (Parent == TransformHierarchy::NoParent) ? LocalOf(argHierarchy, i) : Multiply(LocalOf(argHierarchy, i), world[Parent]);
+		}
+		return world;
+	}
+
+	/**
+	 *	@fn			MaxError
+	 *	@brief		全ノードのワールド行列の誤差の最大値(4列目は0, 0, 0, 1であること)
+	 */
+	double MaxError(const TransformHierarchy &argHierarchy)
+	{
+		const std::vector<Affine> World = Expected(argHierarchy);
+		double error = 0.0;
+		for (size_t i = 0; i < argHierarchy.Size(); ++i)
+		{
+			const Matrix &M = argHierarchy.World(i);
+			for (int row = 0; row < 4; ++row)
+			{
+				const double *Row = World[i].m[row];
+				const double Magnitude = std::max(1.0, std::max(std::fabs(Row[0]), std::max(std::fabs(Row[1]), std::fabs(Row[2]))));
+				for (int column = 0; column < 3; ++column)
+					error = std::max(error, std::fabs(M.m[row][column] - Row[column]) / Magnitude);
+				if (M.m[row][3] != ((row == 3) ? 1.f : 0.f))
+					error = 1.0;
+			}
+		}
+		return error;
+	}
+
+	/**
+	 *	@fn			Report
+	 *	@brief		誤差を上限と比べて表示する
+	 */
+	void Report(const char *argName, double argError, double argBound)
+	{
+		const bool IsPassed = argError <= argBound;
+		std::printf("%-6s %-24s max %.2e bound %.1e\n", IsPassed ? "ok" : "FAIL", argName, argError, argBound);
+		if (!IsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			Report
+	 *	@brief		結果が一致したかを表示する
+	 */
+	void Report(const char *argName, bool argIsPassed)
+	{
+		std::printf("%-6s %-24s\n", argIsPassed ? "ok" : "FAIL", argName);
+		if (!argIsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			IsSame
+	 *	@brief		2つの階層のワールド行列が全て同じか
+	 */
+	bool IsSame(const TransformHierarchy &argA, const TransformHierarchy &argB)
+	{
+		return argA.Size() == argB.Size() && std::memcmp(argA.WorldMatrices().data(), argB.WorldMatrices().data(), sizeof(Matrix) * argA.Size()) == 0;
+	}
+}
+
+int main()
+{
+	Utility::ThreadPool pool;
+
+	// 親は自分より前のノードから選ぶ(深さはおよそlog(ノード数))
+	std::mt19937 engine(1);
+	std::uniform_real_distribution<float> position(-5.f, 5.f);
+	std::uniform_real_distribution<float> scale(0.8f, 1.25f);
+	std::normal_distribution<float> normal;
+	auto RandomRotation = [&]
+	{
+		const float X = normal(engine), Y = normal(engine), Z = normal(engine), W = normal(engine);
+		const float Length = std::sqrt(X * X + Y * Y + Z * Z + W * W);
+		return Quaternion(X / Length, Y / Length, Z / Length, W / Length);
+	};
+
+	TransformHierarchy serial, parallel;
+	serial.Reserve(NodeCount);
+	for (size_t i = 0; i < NodeCount; ++i)
+	{
+		const int32_t Parent = (i < RootCount) ? TransformHierarchy::NoParent : static_cast<int32_t>(std::uniform_int_distribution<size_t>(0, i - 1)(engine));
+		serial.Add(Parent, Vector3(position(engine), position(engine), position(engine)), RandomRotation(), Vector3(scale(engine), scale(engine), scale(engine)));
+	}
+	parallel = serial;
+
+	serial.Update();
+	parallel.Update(&pool);
+	Report("World", MaxError(serial), WorldBound);
+	Report("pool == serial", IsSame(serial, parallel));
+
+	// 成分ごとの配列とまとめて書き換える関数で書き換えても、Setで1つずつ書き換えたのと同じになること
+	TransformHierarchy each = serial;
+	Vector3Stream moved(serial.Size());
+	for (size_t i = 0; i < serial.Size(); ++i)
+		moved.Set(i, Vector3(position(engine), position(engine), position(engine)));
+	Utility::Span<float> ScaleY = serial.ScaleY();
+	Utility::Span<float> RotationW = serial.RotationW();
+	serial.SetPositions(moved);
+	for (size_t i = 0; i < serial.Size(); ++i)
+	{
+		ScaleY[i] *= 1.1f;
+		RotationW[i] = -RotationW[i];
+
+		Vector3 scaled = each.Scale(i);
+		scaled.y *= 1.1f;
+		Quaternion rotation = each.Rotation(i);
+		rotation.w = -rotation.w;
+		each.SetPosition(i, moved.Get(i));
+		each.SetScale(i, scaled);
+		each.SetRotation(i, rotation);
+	}
+	serial.Update();
+	each.Update(&pool);
+	Report("Span/SetPositions", IsSame(serial, each) && serial.Positions().Size() == serial.Size());
+	Report("World after edit", MaxError(serial), WorldBound);
+
+	return (failCount == 0) ? 0 : 1;
+}
@@ -0,0 +1,279 @@
+﻿/**
+ *	@file	Vector3StreamTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	Vector3Streamの誤差と、配列の確保・コピー・ムーブの確認。倍精度で計算した値と比べ、上限を超えると1を返す
+ *			g++ -std=c++17 -O2 -mavx2 -I../../UtilityLib Vector3StreamTest.cpp ../../UtilityLib/Math/Vector3Stream.cpp ../../UtilityLib/Task/ThreadPool.cpp -lpthread
+ */
+#include "Math/Vector3Stream.h"
+#include "Math/Matrix.h"
+#include "Task/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Utility::Math::Matrix;
+	using Utility::Math::Vector3;
+	using Utility::Math::Vector3Stream;
+
+	const size_t	SampleCount = 200000;	//	!<	確認する要素数(ParallelGrainより多くして並列の経路も通す)
+	const double	RoundingBound = 4.8e-7;	//	!<	DirectXMathと同じ計算順序の演算の上限(単精度の丸め誤差程度)
+	int				failCount = 0;			//	!<	誤差が上限を超えた確認の数
+
+	/**
+	 *  @struct		Vec
+	 *  @brief		倍精度の基準値
+	 */
+	struct Vec
+	{
+		double x, y, z;
+	};
+
+	Vec ToVec(const Vector3 &argValue) { return { argValue.x, argValue.y, argValue.z }; }
+
+	/**
+	 *	@fn			Random
+	 *	@brief		各成分が[-argRange, argRange]の一様分布のベクトルの列
+	 */
+	std::vector<Vector3> Random(unsigned int argSeed, float argRange)
+	{
+		std::mt19937 engine(argSeed);
+		std::uniform_real_distribution<float> dist(-argRange, argRange);
+		std::vector<Vector3> values(SampleCount);
+		for (Vector3 &value : values)
+			value = Vector3(dist(engine), dist(engine), dist(engine));
+		return values;
+	}
+
+	/**
+	 *	@fn			Load
+	 *	@brief		Vector3Streamに読み込む
+	 */
+	Vector3Stream Load(const std::vector<Vector3> &argSrc)
+	{
+		Vector3Stream stream;
+		stream.Load(argSrc.data(), argSrc.size());
+		return stream;
+	}
+
+	/**
+	 *	@fn			RelativeError
+	 *	@brief		各成分の誤差の最大値(1より大きい値は大きさで割る)
+	 */
+	double RelativeError(double argResult, double argExpected)
+	{
+		return std::fabs(argResult - argExpected) / std::max(1.0, std::fabs(argExpected));
+	}
+	double RelativeError(const Vector3 &argResult, const Vec &argExpected)
+	{
+		return std::max(std::max(RelativeError(argResult.x, argExpected.x), RelativeError(argResult.y, argExpected.y)), RelativeError(argResult.z, argExpected.z));
+	}
+
+	/**
+	 *	@fn			Report
+	 *	@brief		誤差を上限と比べて表示する
+	 */
+	void Report(const char *argName, double argError, double argBound)
+	{
+		const bool IsPassed = argError <= argBound;
+		std::printf("%-6s %-24s max %.2e bound %.1e\n", IsPassed ? "ok" : "FAIL", argName, argError, argBound);
+		if (!IsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			Report
+	 *	@brief		結果が一致したかを表示する
+	 */
+	void Report(const char *argName, bool argIsPassed)
+	{
+		std::printf("%-6s %-24s\n", argIsPassed ? "ok" : "FAIL", argName);
+		if (!argIsPassed)
+			++failCount;
+	}
+
+	/**
+	 *	@fn			IsSame
+	 *	@brief		列が配列と全ての成分で同じか
+	 */
+	bool IsSame(const Vector3Stream &argStream, const std::vector<Vector3> &argValues)
+	{
+		if (argStream.Size() != argValues.size())
+			return false;
+		for (size_t i = 0; i < argValues.size(); ++i)
+		{
+			const Vector3 V = argStream.Get(i);
+			if (V.x != argValues[i].x || V.y != argValues[i].y || V.z != argValues[i].z)
+				return false;
+		}
+		return true;
+	}
+
+	/**
+	 *	@fn			IsAligned
+	 *	@brief		各成分の配列の先頭がAlignmentに揃っているか
+	 */
+	bool IsAligned(const Vector3Stream &argStream)
+	{
+		const float *Components[] = { argStream.X(), argStream.Y(), argStream.Z() };
+		for (const float *component : Components)
+		{
+			if (reinterpret_cast<std::uintptr_t>(component) % Vector3Stream::Alignment != 0)
+				return false;
+		}
+		return argStream.Capacity() % (Vector3Stream::Alignment / sizeof(float)) == 0;
+	}
+}
+
+int main()
+{
+	Utility::ThreadPool pool;
+
+	const std::vector<Vector3> A = Random(1, 10.f);
+	const std::vector<Vector3> B = Random(2, 10.f);
+	const Vector3Stream StreamA = Load(A);
+	const Vector3Stream StreamB = Load(B);
+	Vector3Stream result;
+
+	// Transform(wが1から外れる行列で、wで割るところも確かめる)、TransformNormal
+	const Matrix M(
+		0.8f, -0.3f, 0.5f, 0.01f,
+		0.4f, 0.9f, -0.2f, -0.02f,
+		-0.5f, 0.3f, 0.7f, 0.015f,
+		3.f, -2.f, 1.5f, 1.f);
+	double error = 0.0, normalError = 0.0;
+	Vector3Stream normals;
+	Vector3Stream::Transform(StreamA, M, &result, &pool);
+	Vector3Stream::TransformNormal(StreamA, M, &normals, &pool);
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		const Vec V = ToVec(A[i]);
+		double r[4];
+		for (int c = 0; c < 4; ++c)
+			r[c] = V.x * M.m[0][c] + V.y * M.m[1][c] + V.z * M.m[2][c];
+		error = std::max(error, RelativeError(result.Get(i), { (r[0] + M.m[3][0]) / (r[3] + M.m[3][3]), (r[1] + M.m[3][1]) / (r[3] + M.m[3][3]), (r[2] + M.m[3][2]) / (r[3] + M.m[3][3]) }));
+		normalError = std::max(normalError, RelativeError(normals.Get(i), { r[0], r[1], r[2] }));
+	}
+	Report("Transform", error, 2.0e-6);
+	Report("TransformNormal", normalError, 2.0e-6);
+
+	// Normalize(出力先が入力と同じでもよいこと、長さ0は0のまま)
+	std::vector<Vector3> withZero(A);
+	withZero[0] = Vector3(0.f, 0.f, 0.f);
+	Vector3Stream inPlace = Load(withZero);
+	Vector3Stream::Normalize(inPlace, &inPlace, &pool);
+	error = 0.0;
+	for (size_t i = 1; i < SampleCount; ++i)
+	{
+		const Vec V = ToVec(withZero[i]);
+		const double Length = std::sqrt(V.x * V.x + V.y * V.y + V.z * V.z);
+		error = std::max(error, RelativeError(inPlace.Get(i), { V.x / Length, V.y / Length, V.z / Length }));
+	}
+	Report("Normalize", error, RoundingBound);
+	const Vector3 Zero = inPlace.Get(0);
+	Report("Normalize zero", Zero.x == 0.f && Zero.y == 0.f && Zero.z == 0.f);
+
+	// Dot、Distance、DistanceSquared
+	std::vector<float> dot(SampleCount), distance(SampleCount), distanceSquared(SampleCount);
+	Vector3Stream::Dot(StreamA, StreamB, dot, &pool);
+	Vector3Stream::Distance(StreamA, StreamB, distance, &pool);
+	Vector3Stream::DistanceSquared(StreamA, StreamB, distanceSquared, &pool);
+	double dotError = 0.0, distanceError = 0.0, distanceSquaredError = 0.0;
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		const Vec VA = ToVec(A[i]), VB = ToVec(B[i]);
+		const Vec D = { VB.x - VA.x, VB.y - VA.y, VB.z - VA.z };
+		const double Squared = D.x * D.x + D.y * D.y + D.z * D.z;
+		// 内積は打ち消し合って小さくなるので、大きさの和に対する誤差で比べる
+		const double Magnitude = std::fabs(VA.x * VB.x) + std::fabs(VA.y * VB.y) + std::fabs(VA.z * VB.z);
+		dotError = std::max(dotError, std::fabs(dot[i] - (VA.x * VB.x + VA.y * VB.y + VA.z * VB.z)) / std::max(1.0, Magnitude));
+		distanceError = std::max(distanceError, RelativeError(distance[i], std::sqrt(Squared)));
+		distanceSquaredError = std::max(distanceSquaredError, RelativeError(distanceSquared[i], Squared));
+	}
+	Report("Dot", dotError, RoundingBound);
+	Report("Distance", distanceError, RoundingBound);
+	Report("DistanceSquared", distanceSquaredError, RoundingBound);
+
+	// Cross、Lerp、Min、Max
+	Vector3Stream::Cross(StreamA, StreamB, &result, &pool);
+	error = 0.0;
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		const Vec VA = ToVec(A[i]), VB = ToVec(B[i]);
+		const Vector3 R = result.Get(i);
+		// 外積も打ち消し合うので、項の大きさに対する誤差で比べる
+		const double Magnitude = std::max(1.0, std::max(std::fabs(VA.x), std::max(std::fabs(VA.y), std::fabs(VA.z))) * std::max(std::fabs(VB.x), std::max(std::fabs(VB.y), std::fabs(VB.z))));
+		error = std::max(error, std::fabs(R.x - (VA.y * VB.z - VA.z * VB.y)) / Magnitude);
+		error = std::max(error, std::fabs(R.y - (VA.z * VB.x - VA.x * VB.z)) / Magnitude);
+		error = std::max(error, std::fabs(R.z - (VA.x * VB.y - VA.y * VB.x)) / Magnitude);
+	}
+	Report("Cross", error, 2.0 * RoundingBound);
+
+	const float T = 0.3f;
+	Vector3Stream::Lerp(StreamA, StreamB, T, &result, &pool);
+	error = 0.0;
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		const Vec VA = ToVec(A[i]), VB = ToVec(B[i]);
+		error = std::max(error, RelativeError(result.Get(i), { VA.x + (VB.x - VA.x) * T, VA.y + (VB.y - VA.y) * T, VA.z + (VB.z - VA.z) * T }));
+	}
+	Report("Lerp", error, 2.0 * RoundingBound);
+
+	Vector3Stream minimum, maximum;
+	Vector3Stream::Min(StreamA, StreamB, &minimum, &pool);
+	Vector3Stream::Max(StreamA, StreamB, &maximum, &pool);
+	bool isMinMax = true;
+	for (size_t i = 0; i < SampleCount; ++i)
+	{
+		const Vector3 Lo = minimum.Get(i), Hi = maximum.Get(i);
+		isMinMax = isMinMax && Lo.x == std::min(A[i].x, B[i].x) && Lo.y == std::min(A[i].y, B[i].y) && Lo.z == std::min(A[i].z, B[i].z);
+		isMinMax = isMinMax && Hi.x == std::max(A[i].x, B[i].x) && Hi.y == std::max(A[i].y, B[i].y) && Hi.z == std::max(A[i].z, B[i].z);
+	}
+	Report("Min/Max", isMinMax);
+
+	// 並列に処理しても1つのスレッドで処理しても同じ結果になること
+	Vector3Stream serial;
+	Vector3Stream::Transform(StreamA, M, &serial);
+	Vector3Stream::Transform(StreamA, M, &result, &pool);
+	std::vector<Vector3> stored(SampleCount);
+	result.Store(stored.data());
+	Report("Transform pool == serial", IsSame(serial, stored));
+
+	// 配列の確保(先頭の境界、増やしても要素が残ること、増えた分が0になること)
+	Vector3Stream buffer;
+	Report("Empty", buffer.Empty() && buffer.Size() == 0 && buffer.Capacity() == 0);
+	const std::vector<Vector3> Head(A.begin(), A.begin() + 5);
+	buffer.Load(Head.data(), Head.size());
+	Report("Load aligned", IsAligned(buffer) && IsSame(buffer, Head));
+	buffer.Reserve(1000);
+	Report("Reserve keeps values", IsAligned(buffer) && buffer.Capacity() >= 1000 && IsSame(buffer, Head));
+	buffer.Resize(9);
+	std::vector<Vector3> grown(Head);
+	grown.resize(9, Vector3(0.f, 0.f, 0.f));
+	Report("Resize fills zero", IsSame(buffer, grown));
+	const size_t Capacity = buffer.Capacity();
+	buffer.Clear();
+	Report("Clear keeps capacity", buffer.Empty() && buffer.Capacity() == Capacity);
+
+	// コピーは別の配列を持ち、ムーブは元を空にする
+	Vector3Stream copied(StreamA);
+	copied.Set(0, Vector3(1.f, 2.f, 3.f));
+	Report("Copy", IsAligned(copied) && copied.X() != StreamA.X() && IsSame(StreamA, A));
+	Vector3Stream assigned;
+	assigned = StreamA;
+	Report("Copy assign", IsAligned(assigned) && IsSame(assigned, A));
+	const float *Data = copied.X();
+	Vector3Stream moved(std::move(copied));
+	Report("Move", moved.X() == Data && copied.Empty() && copied.Capacity() == 0);
+	assigned = std::move(moved);
+	Report("Move assign", assigned.X() == Data && moved.Empty() && assigned.Get(0).z == 3.f);
+
+	return (failCount == 0) ? 0 : 1;
+}
@@ -0,0 +1,251 @@
+﻿/**
+ *	@file	PathTest.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	String::GetFileNameなどのパス関数の確認と処理速度の比較。単体で実行し、以前のstd::stringを返す版と結果が違うと1を返す
+ *			g++ -std=c++17 -O2 -I../../UtilityLib PathTest.cpp
+ */
+#include "String/String.h"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using Utility::String;
+
+	const size_t	RepeatCount = 1 << 14;	//	!<	処理速度の計測でパスの一覧を繰り返す回数
+	int				failCount = 0;			//	!<	結果が合わなかった確認の数
+
+	/**
+	 *	@namespace	Legacy
+	 *	@brief		std::string_viewの版を足す前の実装(比較用にそのまま写したもの)
+	 */
+	namespace Legacy
+	{
+		std::string GetFileName(const std::string &argPath)
+		{
+			size_t pos = argPath.rfind('\\');
+			if (pos != std::string::npos)
+				return argPath.substr(pos + 1, argPath.size() - pos - 1);
+
+			pos = argPath.rfind('/');
+			if (pos != std::string::npos)
+				return argPath.substr(pos + 1, argPath.size() - pos - 1);
+
+			return argPath;
+		}
+		std::string GetFolderPath(const std::string &argPath)
+		{
+			size_t pos = argPath.rfind('\\');
+			if (pos != std::string::npos)
+				return argPath.substr(0, pos + 1);
+
+			pos = argPath.rfind('/');
+			if (pos != std::string::npos)
+				return argPath.substr(0, pos + 1);
+
+			return "";
+		}
+		std::string GetParentFolderName(const std::string &argPath)
+		{
+			std::string::size_type pos1, pos0;
+			pos1 = argPath.find_last_of("\\/");
+			pos0 = argPath.find_last_of("\\/", pos1 - 1);
+
+			if (pos0 != std::string::npos && pos1 != std::string::npos)
+				return argPath.substr(pos0 + 1, pos1 - pos0 - 1);
+
+			return "";
+		}
+		std::string GetExtension(const std::string &argPath)
+		{
+			std::string ext;
+			size_t pos1 = argPath.rfind('.');
+			if (pos1 != std::string::npos)
+			{
+				ext = argPath.substr(pos1 + 1, argPath.size() - pos1);
+				std::string::iterator itr = ext.begin();
+				while (itr != ext.end())
+				{
+					*itr = static_cast<char>(tolower(*itr));
+					itr++;
+				}
+				itr = ext.end() - 1;
+				while (itr != ext.begin())
+				{
+					if (*itr == 0 || *itr == 32)
+						ext.erase(itr--);
+					else
+						itr--;
+				}
+			}
+
+			return ext;
+		}
+		std::string ExtractPathWithoutExt(const std::string &argFn)
+		{
+			std::string::size_type pos;
+			if ((pos = argFn.find_last_of(".")) == std::string::npos)
+				return argFn;
+
+			return argFn.substr(0, pos);
+		}
+		std::string ExtractFileName(const std::string &argPath, bool argWithoutExtension = true)
+		{
+			std::string fn;
+			std::string::size_type fpos;
+			if ((fpos = argPath.find_last_of("/")) != std::string::npos)
+				fn = argPath.substr(fpos + 1);
+			else if ((fpos = argPath.find_last_of("\\")) != std::string::npos)
+				fn = argPath.substr(fpos + 1);
+			else
+				fn = argPath;
+
+			if (argWithoutExtension && (fpos = fn.find_last_of(".")) != std::string::npos)
+				fn = fn.substr(0, fpos);
+
+			return fn;
+		}
+	}
+
+	/**
+	 *	@fn			Check
+	 *	@brief		結果を表示し、合わなければ失敗として数える
+	 */
+	void Check(bool argIsPassed, const char *argName, const std::string &argPath)
+	{
+		if (argIsPassed)
+			return;
+
+		std::printf("FAIL   %-28s \"%s\"\n", argName, argPath.c_str());
+		++failCount;
+	}
+
+	/**
+	 *	@fn			CheckPaths
+	 *	@brief		std::string_viewの版とstd::stringの版が以前の実装と同じ結果を返すかを確認する
+	 */
+	void CheckPaths(const std::vector<std::string> &argPaths)
+	{
+		const int FailCount = failCount;
+		for (const std::string &path : argPaths)
+		{
+			const std::string_view View(path);
+			Check(String::GetFileName(View) == Legacy::GetFileName(path) && String::GetFileName(path) == Legacy::GetFileName(path), "GetFileName", path);
+			Check(String::GetFolderPath(View) == Legacy::GetFolderPath(path) && String::GetFolderPath(path) == Legacy::GetFolderPath(path), "GetFolderPath", path);
+			Check(String::GetParentFolderName(View) == Legacy::GetParentFolderName(path) && String::GetParentFolderName(path) == Legacy::GetParentFolderName(path), "GetParentFolderName", path);
+			Check(String::ExtractPathWithoutExt(View) == Legacy::ExtractPathWithoutExt(path) && String::ExtractPathWithoutExt(path) == Legacy::ExtractPathWithoutExt(path), "ExtractPathWithoutExt", path);
+			Check(String::ExtractFileName(View) == Legacy::ExtractFileName(path) && String::ExtractFileName(path, false) == Legacy::ExtractFileName(path, false), "ExtractFileName", path);
+
+			// std::stringとconst char*の版は以前と同じく小文字にする。std::string_viewの版は大文字小文字をそのまま返す
+			const std::string Extension = Legacy::GetExtension(path);
+			Check(String::GetExtension(path) == Extension && String::GetExtension(path.c_str()) == Extension, "GetExtension", path);
+			Check(String::IsExtension(View, Extension) && String::GetExtension(View).size() == Extension.size(), "GetExtension view", path);
+		}
+
+		char buffer[64];
+		Check(String::JoinPath("Data/Texture", "Player.PNG", buffer) == "Data/Texture/Player.PNG", "JoinPath", "Data/Texture");
+		Check(String::JoinPath("Data\\Texture\\", "/Player.PNG", buffer, sizeof(buffer), '\\') == "Data\\Texture\\Player.PNG", "JoinPath", "Data\\Texture\\");
+		Check(String::JoinPath("", "Player.PNG", buffer) == "Player.PNG", "JoinPath", "");
+		Check(String::JoinPath("Data", "Player.PNG", buffer, 8).empty() && buffer[0] == '\0', "JoinPath overflow", "Data");
+
+		std::printf("%-6s %-28s\n", (failCount == FailCount) ? "ok" : "FAIL", "path functions");
+	}
+
+	/**
+	 *	@fn			Measure
+	 *	@brief		argFuncを何度か呼び、パス1つあたりの最短の時間(ナノ秒)を返す
+	 */
+	double Measure(const std::function<size_t()> &argFunc, size_t argPathCount)
+	{
+		volatile size_t sink = 0;
+		double best = std::numeric_limits<double>::max();
+		for (int i = 0; i < 5; ++i)
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			sink = sink + argFunc();
+			const std::chrono::duration<double, std::nano> Elapsed = std::chrono::steady_clock::now() - Start;
+			if (Elapsed.count() < best)
+				best = Elapsed.count();
+		}
+		return best / static_cast<double>(RepeatCount * argPathCount);
+	}
+
+	/**
+	 *	@fn			ReportThroughput
+	 *	@brief		以前の版と比べた処理速度を表示する(計測環境に左右されるので失敗にはしない)
+	 */
+	void ReportThroughput(const std::vector<std::string> &argPaths)
+	{
+		// 各関数をパスの一覧に対してRepeatCount回呼び、結果の長さを足し合わせる
+		const auto Run = [&argPaths](const auto &argFunc)
+		{
+			return [&argPaths, argFunc]
+			{
+				size_t length = 0;
+				for (size_t i = 0; i < RepeatCount; ++i)
+				{
+					for (const std::string &path : argPaths)
+						length += argFunc(path).size();
+				}
+				return length;
+			};
+		};
+		char buffer[256];
+
+		struct Row
+		{
+			const char				*name;
+			std::function<size_t()>	func;
+		};
+		const Row Rows[] = {
+			{ "GetFileName legacy", Run([](const std::string &argPath) { return Legacy::GetFileName(argPath); }) },
+			{ "GetFileName view", Run([](const std::string &argPath) { return String::GetFileName(std::string_view(argPath)); }) },
+			{ "GetFolderPath legacy", Run([](const std::string &argPath) { return Legacy::GetFolderPath(argPath); }) },
+			{ "GetFolderPath view", Run([](const std::string &argPath) { return String::GetFolderPath(std::string_view(argPath)); }) },
+			{ "GetParentFolderName legacy", Run([](const std::string &argPath) { return Legacy::GetParentFolderName(argPath); }) },
+			{ "GetParentFolderName view", Run([](const std::string &argPath) { return String::GetParentFolderName(std::string_view(argPath)); }) },
+			{ "GetExtension legacy", Run([](const std::string &argPath) { return Legacy::GetExtension(argPath); }) },
+			{ "GetExtension", Run([](const std::string &argPath) { return String::GetExtension(argPath); }) },
+			{ "GetExtension view", Run([](const std::string &argPath) { return String::GetExtension(std::string_view(argPath)); }) },
+			{ "ExtractPathWithoutExt legacy", Run([](const std::string &argPath) { return Legacy::ExtractPathWithoutExt(argPath); }) },
+			{ "ExtractPathWithoutExt view", Run([](const std::string &argPath) { return String::ExtractPathWithoutExt(std::string_view(argPath)); }) },
+			{ "ExtractFileName legacy", Run([](const std::string &argPath) { return Legacy::ExtractFileName(argPath); }) },
+			{ "ExtractFileName view", Run([](const std::string &argPath) { return String::ExtractFileName(std::string_view(argPath)); }) },
+			{ "JoinPath std::string", Run([](const std::string &argPath) { return Legacy::GetFolderPath(argPath) + "Cache/" + Legacy::GetFileName(argPath); }) },
+			{ "JoinPath buffer", Run([&buffer](const std::string &argPath) { return String::JoinPath(String::GetFolderPath(std::string_view(argPath)), String::GetFileName(std::string_view(argPath)), buffer); }) },
+		};
+		for (const Row &row : Rows)
+			std::printf("       %-28s %.2f ns/path\n", row.name, Measure(row.func, argPaths.size()));
+	}
+}
+
+int main()
+{
+	// 短いパス(SSOに収まる)と長いパス、区切りや拡張子のないものを混ぜる
+	const std::vector<std::string> Paths = {
+		"Player.png",
+		"Data/Texture/Player.PNG",
+		"Data\\Model\\Character\\Enemy\\Boss_LastStage_Variation03.FBX",
+		"C:\\Users\\Project\\Resource\\Archive\\Sound\\BGM\\Stage01_Loop.Ogg",
+		"Data/Shader/Include/Common",
+		"Data/Config/Table.csv ",
+		"Data/Folder.d/File",
+		"../Data/Font/JapaneseFont_Regular.ttf",
+		"NoExtension",
+		"/",
+	};
+
+	CheckPaths(Paths);
+
+	std::printf("Throughput (%zu paths x %zu)\n", Paths.size(), RepeatCount);
+	ReportThroughput(Paths);
+
+	return (failCount == 0) ? 0 : 1;
+}
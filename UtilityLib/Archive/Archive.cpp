@@ -139,6 +139,12 @@ Utility::Archive::Archive(const char* argArchiveName)
 }
 
 void Utility::Archive::Read(const char *argFileName, char** argFileData, int *argFileSize)
+{
+	// 検索だけなので登録はしない
+	Read(Singleton<AtomTable>::Get()->Find(argFileName), argFileData, argFileSize);
+}
+
+void Utility::Archive::Read(Atom argFileName, char** argFileData, int *argFileSize)
 {
 	auto it = entries_.find(argFileName);
 	assert(it != entries_.end() && "Argment filename Don't found...");
@@ -178,17 +184,16 @@ void Utility::Archive::Import(const char * argArchiveName)
 	//4バイト読むとファイル数
 	int fileNumber_ = GetInt(stream_.get());
 
+	std::string name;
 	for (int lFileIndex = 0; lFileIndex < fileNumber_; ++lFileIndex)
 	{
 		Entry e;
 		e.Position = GetInt(stream_.get());
 		e.Size = GetInt(stream_.get());
 		int nameLength = GetInt(stream_.get());
-		char* name = new char[nameLength + 1]; //終端NULLで+1
-		stream_->read(name, nameLength);
-		name[nameLength] = '\0';
-		entries_.insert(std::make_pair(name, e));
-		delete[] name;
+		name.resize(nameLength);
+		stream_->read(&name[0], nameLength);
+		entries_.insert(std::make_pair(Atom(name), e));
 	}
 }
 
@@ -8,7 +8,7 @@
 #include "FollowingCamera.h"
 
 Utility::FollowingCamera::FollowingCamera()
-	:delay_(1.f)
+	:delay_(1.f), rotation_(0.f, 0.f, 0.f)
 {
 	projData_.fovY = Math::ToRadian(60.0f);
 	projData_.aspect = (1280.0f / 720.0f);
@@ -26,17 +26,20 @@ Utility::FollowingCamera::~FollowingCamera() = default;
 
 void Utility::FollowingCamera::Following(DirectX::XMFLOAT3 argTrans, DirectX::XMFLOAT3 argRot)
 {
-	Math::Vector3 eyepos = argTrans + Math::Vector3(0.f, 5.f, 0.f);
-	Math::Vector3 refpos = argTrans + Math::Vector3(0.0f, 2.0f, 0.0f);
+	// 回転が変わったときだけ姿勢を作り直す(X、Y、Zの順に回す)
+	if (argRot.x != rotation_.x || argRot.y != rotation_.y || argRot.z != rotation_.z)
+	{
+		using namespace DirectX;
+		const XMVECTOR RotX = XMQuaternionRotationNormal(g_XMIdentityR0, argRot.x);
+		const XMVECTOR RotY = XMQuaternionRotationNormal(g_XMIdentityR1, argRot.y);
+		const XMVECTOR RotZ = XMQuaternionRotationNormal(g_XMIdentityR2, argRot.z);
+		pivot_.SetRotation(Math::Quaternion(XMQuaternionMultiply(XMQuaternionMultiply(RotX, RotY), RotZ)));
+		rotation_ = argRot;
+	}
 
-	Math::Matrix rotx = Math::Matrix::CreateRotationX(argRot.x);
-	Math::Matrix roty = Math::Matrix::CreateRotationY(argRot.y);
-	Math::Matrix rotz = Math::Matrix::CreateRotationZ(argRot.z);
-	Math::Matrix rot = rotx * roty * rotz;
+	Math::Vector3 refpos = argTrans + Math::Vector3(0.0f, 2.0f, 0.0f);
+	Math::Vector3 eyepos = refpos + pivot_.TransformVector(Math::Vector3(0.f, 3.f, 0.f));
 
-	Math::Vector3 cameraV = Math::Vector3::TransformNormal(cameraV, rot);
-	eyepos = refpos + cameraV;
-	
 	refpos = viewData_.ref + (refpos - viewData_.ref) * delay_;
 	eyepos = viewData_.eye + (eyepos - viewData_.eye) * delay_;
 	viewData_.eye = eyepos;
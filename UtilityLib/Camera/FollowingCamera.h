@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Camera.h"
+#include "../Math/Transform.h"
 
 namespace Utility
 {
@@ -18,6 +19,8 @@ namespace Utility
 	{
 	private:
 		float delay_;
+		DirectX::XMFLOAT3 rotation_;	//	!<	pivot_を作ったときの回転
+		Math::Transform pivot_;			//	!<	追跡する座標から見たカメラの向き
 	public:
 		FollowingCamera();
 		~FollowingCamera();
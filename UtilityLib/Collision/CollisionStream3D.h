@@ -0,0 +1,159 @@
+﻿/**
+ *	@file	CollisionStream3D.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Collision3D.h"
+#include "../Math/Vector3Stream.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <assert.h>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	/**
+	 *  @struct		SphereStream
+	 *  @brief		球の列(中心と半径を成分ごとの配列で持つ)
+	 */
+	struct SphereStream
+	{
+	public:
+		Math::Vector3Stream	center;
+		std::vector<float>	radius;
+
+		/**
+		 *	@fn			Resize
+		 *	@brief		要素数を変える
+		 *	@param[in]	argCount	!<	要素数
+		 */
+		void Resize(size_t argCount);
+		/**
+		 *	@fn			Load
+		 *	@brief		Sphereの配列から読み込む
+		 *	@param[in]	argSrc		!<	読み込む配列
+		 *	@param[in]	argCount	!<	要素数
+		 */
+		void Load(const Sphere *argSrc, size_t argCount);
+
+		inline size_t Size() const { return center.Size(); }
+		inline void Set(size_t argIndex, const Sphere &argSphere)
+		{
+			center.Set(argIndex, argSphere.center);
+			radius[argIndex] = argSphere.radius;
+		}
+	};
+
+	/**
+	 *  @struct		CapsuleStream
+	 *  @brief		カプセルの列(線分の端点と半径を成分ごとの配列で持つ)
+	 */
+	struct CapsuleStream
+	{
+	public:
+		Math::Vector3Stream	start;
+		Math::Vector3Stream	end;
+		std::vector<float>	radius;
+
+		/**
+		 *	@fn			Resize
+		 *	@brief		要素数を変える
+		 *	@param[in]	argCount	!<	要素数
+		 */
+		void Resize(size_t argCount);
+		/**
+		 *	@fn			Load
+		 *	@brief		Capsuleの配列から読み込む
+		 *	@param[in]	argSrc		!<	読み込む配列
+		 *	@param[in]	argCount	!<	要素数
+		 */
+		void Load(const Capsule *argSrc, size_t argCount);
+
+		inline size_t Size() const { return start.Size(); }
+		inline void Set(size_t argIndex, const Capsule &argCapsule)
+		{
+			start.Set(argIndex, argCapsule.segment.start);
+			end.Set(argIndex, argCapsule.segment.end);
+			radius[argIndex] = argCapsule.radius;
+		}
+	};
+
+	/**
+	 *  @struct		ContactStream
+	 *  @brief		組ごとの判定結果
+	 *  @note		当たっていない組のpoint、normal、depthにも計算途中の値が入るので、hitMaskで選んで使う
+	 */
+	struct ContactStream
+	{
+	public:
+		static const size_t MaskBits = 32;	//	!<	hitMaskの1要素に入る組の数
+
+		std::vector<uint32_t>	hitMask;	//	!<	i番目の組が当たっていればhitMask[i / 32]の(i % 32)ビット目が立つ
+		Math::Vector3Stream		point;		//	!<	交点(1つずつ判定する関数のargInterと同じ)
+		Math::Vector3Stream		normal;		//	!<	BからAへ向かう単位ベクトル(中心が重なると0)
+		std::vector<float>		depth;		//	!<	めり込んだ深さ(半径の和 - 距離)
+
+		/**
+		 *	@fn			Resize
+		 *	@brief		要素数を変える
+		 *	@param[in]	argCount	!<	組の数
+		 */
+		void Resize(size_t argCount);
+		/**
+		 *	@fn			CountHits
+		 *	@brief		当たった組の数
+		 */
+		size_t CountHits() const;
+
+		inline size_t Size() const { return point.Size(); }
+		inline bool IsHit(size_t argIndex) const
+		{
+			assert(argIndex < Size() && "ContactStream index out of range...");
+			return ((hitMask[argIndex / MaskBits] >> (argIndex % MaskBits)) & 1u) != 0;
+		}
+		/**
+		 *	@fn			ForEachHit
+		 *	@brief		当たった組を添字の順に列挙する
+		 *	@param[in]	argFunc	!<	組ごとに呼ぶ関数(void(size_t index))
+		 */
+		template<typename Func>
+		void ForEachHit(const Func &argFunc) const
+		{
+			for (size_t word = 0; word < hitMask.size(); ++word)
+			{
+				for (uint32_t bits = hitMask[word], lane = 0; bits != 0; bits >>= 1, ++lane)
+				{
+					if ((bits & 1u) != 0)
+						argFunc(word * MaskBits + lane);
+				}
+			}
+		}
+	};
+
+	/**
+	 *	@fn			CheckSphere2Sphere
+	 *	@brief		球と球の組をまとめて判定する(広域判定で集めた組の詳細判定用)
+	 *	@note		AVX2/SSE2で8/4組ずつ判定する。判定と交点は1組ずつの版と同じ式で求める
+	 *	@param[in]	argSphereA	!<	組の球A
+	 *	@param[in]	argSphereB	!<	組の球B(argSphereAと同じ要素数)
+	 *	@param[out]	argContacts	!<	判定結果(要素数は組の数に合わせて変わる)
+	 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+	 */
+	void CheckSphere2Sphere(const SphereStream &argSphereA, const SphereStream &argSphereB, ContactStream *argContacts, ThreadPool *argPool = nullptr);
+	/**
+	 *	@fn			CheckSphere2Capsule
+	 *	@brief		球とカプセルの組をまとめて判定する(広域判定で集めた組の詳細判定用)
+	 *	@note		AVX2/SSE2で8/4組ずつ判定する。判定と交点は1組ずつの版と同じ式で求める
+	 *	@param[in]	argSphere	!<	組の球(A)
+	 *	@param[in]	argCapsule	!<	組のカプセル(B。argSphereと同じ要素数)
+	 *	@param[out]	argContacts	!<	判定結果(要素数は組の数に合わせて変わる)
+	 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+	 */
+	void CheckSphere2Capsule(const SphereStream &argSphere, const CapsuleStream &argCapsule, ContactStream *argContacts, ThreadPool *argPool = nullptr);
+}
@@ -8,8 +8,32 @@
 
 #include "../Math/Math.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+#undef min
+#undef max
+#endif
+
+#include <cstdint>
+
 namespace Utility
 {
+#if defined(_WIN32)
+	using ShapeRect = RECT;
+#else
+	/**
+	 *	@struct	ShapeRect
+	 *	@brief	矩形(WindowsではRECT、それ以外は同じ並びの構造体)
+	 */
+	struct ShapeRect
+	{
+		int32_t	left;
+		int32_t	top;
+		int32_t	right;
+		int32_t	bottom;
+	};
+#endif
+
 	/**
 	 *	@enum	eShapeType
 	 *	@brief	形状の種類
@@ -33,7 +57,7 @@ namespace Utility
 		inline virtual eShapeType Type() const = 0;
 		inline virtual Math::Vector2 Pos()const = 0;
 		inline virtual float Radius()const = 0;
-		inline virtual RECT Rect()const = 0;
+		inline virtual ShapeRect Rect()const = 0;
 	};
 
 	/**
@@ -54,7 +78,7 @@ namespace Utility
 		inline virtual eShapeType Type() const = 0;
 		inline virtual Math::Vector2 Pos()const = 0;
 		inline virtual float Radius()const = 0;
-		inline virtual RECT Rect()const = 0;
+		inline virtual ShapeRect Rect()const = 0;
 	};
 
 	/**
@@ -103,10 +127,10 @@ namespace Utility
 		inline eShapeType Type()const override { return eShapeType::Circle; }
 		inline Math::Vector2 Pos()const override { return (parent_) ? (*parent_ + pos_) : pos_; }
 		inline float Radius()const override { return (radius_) ? *radius_ : 0.f; }
-		inline RECT Rect()const override
+		inline ShapeRect Rect()const override
 		{
 			assert(false && "Mistaking the SharpType");
-			return RECT();
+			return ShapeRect();
 		}
 	};
 
@@ -117,17 +141,17 @@ namespace Utility
 	class RectShape : public CShape
 	{
 	private:
-		RECT	rect_;
+		ShapeRect	rect_;
 
 	public:
-		RectShape(RECT argRect, Math::Vector2 *argParent)
+		RectShape(ShapeRect argRect, Math::Vector2 *argParent)
 			:CShape(argParent), rect_(argRect)
 		{
 		}
 
 		virtual ~RectShape() = default;
 		inline eShapeType Type()const override { return eShapeType::Rect; }
-		inline RECT Rect()const override { return rect_; }
+		inline ShapeRect Rect()const override { return rect_; }
 		inline virtual Math::Vector2 Pos()const override
 		{
 			assert(false && "Mistaking the SharpType");
@@ -0,0 +1,223 @@
+﻿/**
+ *	@file	SweepAndPrune.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "SweepAndPrune.h"
+#include "../Math/SimdLanes.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+#pragma region		Lanes
+	/*
+	 *	SimdLanesに区間の重なりを調べるための比較とマスクの演算を足したもの。
+	 *	MoveMaskは要素ごとの比較結果を下位ビットから並べた整数にする。
+	 */
+
+	/**
+	 *  @struct		ScalarSweepLanes
+	 *  @brief		1要素ずつの演算
+	 */
+	struct ScalarSweepLanes : public Utility::Math::Simd::ScalarLanes
+	{
+		static inline Mask LessEqual(Reg argA, Reg argB) { return argA <= argB; }
+		static inline Mask And(Mask argA, Mask argB) { return argA && argB; }
+		static inline unsigned int MoveMask(Mask argMask) { return argMask ? 1u : 0u; }
+	};
+
+#if defined(UTILITY_MATH_LANES_AVX2)
+	/**
+	 *  @struct		Avx2SweepLanes
+	 *  @brief		8要素ずつの演算
+	 */
+	struct Avx2SweepLanes : public Utility::Math::Simd::Avx2Lanes
+	{
+		static inline Mask LessEqual(Reg argA, Reg argB) { return _mm256_cmp_ps(argA, argB, _CMP_LE_OQ); }
+		static inline Mask And(Mask argA, Mask argB) { return _mm256_and_ps(argA, argB); }
+		static inline unsigned int MoveMask(Mask argMask) { return static_cast<unsigned int>(_mm256_movemask_ps(argMask)); }
+	};
+	using WideSweepLanes = Avx2SweepLanes;
+#elif defined(UTILITY_MATH_LANES_SSE2)
+	/**
+	 *  @struct		Sse2SweepLanes
+	 *  @brief		4要素ずつの演算
+	 */
+	struct Sse2SweepLanes : public Utility::Math::Simd::Sse2Lanes
+	{
+		static inline Mask LessEqual(Reg argA, Reg argB) { return _mm_cmple_ps(argA, argB); }
+		static inline Mask And(Mask argA, Mask argB) { return _mm_and_ps(argA, argB); }
+		static inline unsigned int MoveMask(Mask argMask) { return static_cast<unsigned int>(_mm_movemask_ps(argMask)); }
+	};
+	using WideSweepLanes = Sse2SweepLanes;
+#else
+	using WideSweepLanes = ScalarSweepLanes;
+#endif
+#pragma endregion	Lanes
+}
+
+Utility::SweepAndPrune::SweepAndPrune()
+	: proxies_(), order_(), lowerX_(), upperX_(), lowerY_(), upperY_(), lowerZ_(), upperZ_(), pairs_(), removed_(),
+	freeList_(NullProxy), proxyCount_(0), addedCount_(0)
+{
+}
+
+int32_t Utility::SweepAndPrune::Insert(const Aabb &argBounds, uint32_t argUserData)
+{
+	int32_t proxy = freeList_;
+	if (proxy == NullProxy)
+	{
+		proxy = static_cast<int32_t>(proxies_.size());
+		proxies_.emplace_back();
+	}
+	else
+	{
+		freeList_ = proxies_[proxy].next;
+	}
+
+	Proxy &added = proxies_[proxy];
+	added.bounds = argBounds;
+	added.userData = argUserData;
+	added.next = NullProxy;
+	added.isActive = true;
+
+	order_.push_back({ argBounds.lower.x, proxy });
+	++addedCount_;
+	++proxyCount_;
+	return proxy;
+}
+
+void Utility::SweepAndPrune::Remove(int32_t argProxy)
+{
+	assert(IsProxy(argProxy) && "Invalid proxy...");
+	proxies_[argProxy].isActive = false;
+	removed_.push_back(argProxy);
+	--proxyCount_;
+}
+
+void Utility::SweepAndPrune::Clear()
+{
+	proxies_.clear();
+	order_.clear();
+	pairs_.clear();
+	removed_.clear();
+	freeList_ = NullProxy;
+	proxyCount_ = 0;
+	addedCount_ = 0;
+}
+
+Utility::Span<const Utility::SweepAndPrune::ProxyPair> Utility::SweepAndPrune::UpdatePairs()
+{
+	SortAxis();
+	Sweep();
+	return GetPairs();
+}
+
+void Utility::SweepAndPrune::SortAxis()
+{
+	// 取り除いたプロキシを詰める(追加したばかりの分は末尾に残す)
+	if (!removed_.empty())
+	{
+		const auto IsRemoved = [this](const SortKey &argKey) { return !proxies_[argKey.proxy].isActive; };
+		const auto AddedBegin = order_.end() - addedCount_;
+		const auto SortedEnd = std::remove_if(order_.begin(), AddedBegin, IsRemoved);
+		const auto AddedEnd = std::remove_if(AddedBegin, order_.end(), IsRemoved);
+		addedCount_ = static_cast<size_t>(AddedEnd - AddedBegin);
+		order_.erase(std::move(AddedBegin, AddedEnd, SortedEnd), order_.end());
+
+		for (const int32_t Proxy : removed_)
+		{
+			proxies_[Proxy].next = freeList_;
+			freeList_ = Proxy;
+		}
+		removed_.clear();
+	}
+
+	for (SortKey &key : order_)
+		key.lowerX = proxies_[key.proxy].bounds.lower.x;
+
+	// 前の並びはほぼ揃っているので挿入ソートで直す
+	const size_t SortedCount = order_.size() - addedCount_;
+	for (size_t i = 1; i < SortedCount; ++i)
+	{
+		const SortKey Key = order_[i];
+		size_t j = i;
+		for (; j > 0 && Key.lowerX < order_[j - 1].lowerX; --j)
+			order_[j] = order_[j - 1];
+		order_[j] = Key;
+	}
+
+	// 追加した分は並べてから混ぜる
+	if (addedCount_ > 0)
+	{
+		const auto Less = [](const SortKey &argA, const SortKey &argB) { return argA.lowerX < argB.lowerX; };
+		const auto AddedBegin = order_.begin() + SortedCount;
+		std::sort(AddedBegin, order_.end(), Less);
+		std::inplace_merge(order_.begin(), AddedBegin, order_.end(), Less);
+		addedCount_ = 0;
+	}
+}
+
+void Utility::SweepAndPrune::Sweep()
+{
+	using L = WideSweepLanes;
+
+	// 末尾のL::Width個はlowerXをNaNにして、どの比較も偽になる番兵にする
+	const size_t Count = order_.size();
+	const size_t Padded = Count + L::Width;
+	lowerX_.resize(Padded);
+	upperX_.resize(Padded);
+	lowerY_.resize(Padded);
+	upperY_.resize(Padded);
+	lowerZ_.resize(Padded);
+	upperZ_.resize(Padded);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		const Aabb &Bounds = proxies_[order_[i].proxy].bounds;
+		lowerX_[i] = Bounds.lower.x;
+		upperX_[i] = Bounds.upper.x;
+		lowerY_[i] = Bounds.lower.y;
+		upperY_[i] = Bounds.upper.y;
+		lowerZ_[i] = Bounds.lower.z;
+		upperZ_[i] = Bounds.upper.z;
+	}
+	std::fill(lowerX_.begin() + Count, lowerX_.end(), std::numeric_limits<float>::quiet_NaN());
+	std::fill(upperX_.begin() + Count, upperX_.end(), 0.f);
+	std::fill(lowerY_.begin() + Count, lowerY_.end(), 0.f);
+	std::fill(upperY_.begin() + Count, upperY_.end(), 0.f);
+	std::fill(lowerZ_.begin() + Count, lowerZ_.end(), 0.f);
+	std::fill(upperZ_.begin() + Count, upperZ_.end(), 0.f);
+
+	pairs_.clear();
+	const unsigned int FullMask = (1u << L::Width) - 1;
+	for (size_t i = 0; i < Count; ++i)
+	{
+		const int32_t ProxyI = order_[i].proxy;
+		const L::Reg UpperX = L::Set(upperX_[i]);
+		const L::Reg LowerY = L::Set(lowerY_[i]);
+		const L::Reg UpperY = L::Set(upperY_[i]);
+		const L::Reg LowerZ = L::Set(lowerZ_[i]);
+		const L::Reg UpperZ = L::Set(upperZ_[i]);
+
+		// lowerXの順に並んでいるので、Xの区間が重なる相手はiの直後に続く
+		for (size_t j = i + 1; ; j += L::Width)
+		{
+			const L::Mask InX = L::LessEqual(L::Load(&lowerX_[j]), UpperX);
+			const L::Mask InY = L::And(L::LessEqual(L::Load(&lowerY_[j]), UpperY), L::LessEqual(LowerY, L::Load(&upperY_[j])));
+			const L::Mask InZ = L::And(L::LessEqual(L::Load(&lowerZ_[j]), UpperZ), L::LessEqual(LowerZ, L::Load(&upperZ_[j])));
+			for (unsigned int hits = L::MoveMask(L::And(InX, L::And(InY, InZ))), lane = 0; hits != 0; hits >>= 1, ++lane)
+			{
+				if ((hits & 1) == 0)
+					continue;
+				const int32_t ProxyJ = order_[j + lane].proxy;
+				pairs_.push_back((ProxyI < ProxyJ) ? ProxyPair{ ProxyI, ProxyJ } : ProxyPair{ ProxyJ, ProxyI });
+			}
+
+			if (L::MoveMask(InX) != FullMask)
+				break;
+		}
+	}
+}
@@ -0,0 +1,769 @@
+﻿/**
+ *	@file	TriangleBvh.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "TriangleBvh.h"
+#include "../Task/ThreadPool.h"
+#include "../Archive/Archive.h"
+#include "../Loader/Loader.h"
+#include "../Singleton/Singleton.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace
+{
+	const uint32_t BinCount = 16;
+	const float TraversalCost = 1.f;			//	!<	三角形1つの判定に対する、節を1つたどる費用
+	const uint32_t SahDepthLimit = 48;			//	!<	これより深い節は重心の中央で分ける(深さをQueryStackSize未満に抑える)
+	const size_t ParallelBinThreshold = 65536;	//	!<	これより多い三角形の節は分類を並列に行う
+	const size_t BinGrain = 16384;
+	const size_t BoundsGrain = 4096;
+	const size_t MinTaskSize = 4096;			//	!<	部分木ごとに並列に作るときの部分木の大きさの下限
+	const size_t TaskDivisor = 64;
+
+	const uint32_t Magic = 0x48564254;	//	!<	'TBVH'
+	const uint32_t Version = 1;
+
+	/**
+	 *	@fn			ForEachChunk
+	 *	@brief		[0, argCount)をargGrain個ずつの塊に分けて処理する(argPoolがあれば並列に)
+	 */
+	template<typename Func>
+	void ForEachChunk(size_t argCount, size_t argGrain, Utility::ThreadPool *argPool, const Func &argFunc)
+	{
+		if (argPool)
+		{
+			argPool->ParallelFor(argCount, argGrain, argFunc);
+			return;
+		}
+		for (size_t begin = 0; begin < argCount; begin += argGrain)
+			argFunc(begin, std::min(begin + argGrain, argCount));
+	}
+
+	/**
+	 *  @struct		Box
+	 *  @brief		作る途中の箱
+	 */
+	struct Box
+	{
+		float lower[3];
+		float upper[3];
+
+		Box()
+		{
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				lower[axis] = std::numeric_limits<float>::max();
+				upper[axis] = -std::numeric_limits<float>::max();
+			}
+		}
+		inline void Grow(const float *argPoint)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				lower[axis] = std::min(lower[axis], argPoint[axis]);
+				upper[axis] = std::max(upper[axis], argPoint[axis]);
+			}
+		}
+		inline void Grow(const Utility::Math::Vector3 &argPoint)
+		{
+			const float Point[3] = { argPoint.x, argPoint.y, argPoint.z };
+			Grow(Point);
+		}
+		inline void Grow(const Box &argBox)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				lower[axis] = std::min(lower[axis], argBox.lower[axis]);
+				upper[axis] = std::max(upper[axis], argBox.upper[axis]);
+			}
+		}
+		/**
+		 *	@fn			HalfArea
+		 *	@brief		表面積の半分(空の箱は0)
+		 */
+		inline float HalfArea() const
+		{
+			const float X = upper[0] - lower[0];
+			const float Y = upper[1] - lower[1];
+			const float Z = upper[2] - lower[2];
+			return (X < 0.f) ? 0.f : X * Y + Y * Z + Z * X;
+		}
+	};
+
+	/**
+	 *  @struct		Reference
+	 *  @brief		分類する三角形
+	 */
+	struct Reference
+	{
+		Box			bounds;
+		float		centroid[3];
+		uint32_t	triangle;
+	};
+
+	/**
+	 *  @struct		Bin
+	 *  @brief		重心の区間に入った三角形の箱と数
+	 */
+	struct Bin
+	{
+		Box			bounds;
+		uint32_t	count = 0;
+	};
+	using AxisBins = Bin[3][BinCount];
+
+	/**
+	 *  @struct		SerializedHeader
+	 *  @brief		Serializeしたバイト列の先頭
+	 */
+	struct SerializedHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t nodeCount;
+		uint32_t triangleCount;
+	};
+	const size_t SerializedTriangleSize = sizeof(float) * 12;
+
+	inline void Append(std::vector<char> *argData, const void *argSrc, size_t argSize)
+	{
+		const char *Src = static_cast<const char*>(argSrc);
+		argData->insert(argData->end(), Src, Src + argSize);
+	}
+
+	/**
+	 *  @struct		BuildNode
+	 *  @brief		作る途中の節(子を両方とも添字で指す)
+	 */
+	struct BuildNode
+	{
+		Box			bounds;
+		uint32_t	left = 0;
+		uint32_t	right = 0;
+		uint32_t	first = 0;
+		uint32_t	count = 0;		//	!<	葉の三角形の数(内部の節は0)
+		uint32_t	axis = 0;
+		int32_t		task = -1;		//	!<	0以上なら、この節はその番号の部分木に置き換える
+	};
+
+	/**
+	 *  @struct		Task
+	 *  @brief		並列に作る部分木
+	 */
+	struct Task
+	{
+		uint32_t				first;
+		uint32_t				count;
+		uint32_t				depth;
+		std::vector<BuildNode>	nodes;
+	};
+
+	/**
+	 *  @class		Builder
+	 *  @brief		Referenceの配列を分けながら節を作る
+	 */
+	class Builder
+	{
+	private:
+		std::vector<Reference>	&references_;
+		std::vector<Task>		&tasks_;
+		Utility::ThreadPool		*pool_;
+		size_t					taskSize_;
+
+	public:
+		Builder(std::vector<Reference> &argReferences, std::vector<Task> &argTasks, Utility::ThreadPool *argPool)
+			: references_(argReferences), tasks_(argTasks), pool_(argPool),
+			taskSize_(std::max(MinTaskSize, argReferences.size() / TaskDivisor))
+		{
+		}
+
+		/**
+		 *	@fn			BuildRange
+		 *	@brief		references_の[argFirst, argFirst + argCount)の節を作る
+		 *	@param[in]	argIsTop	!<	trueなら小さくなった範囲はtasks_に回す
+		 *	@return		作った節の添字
+		 */
+		uint32_t BuildRange(std::vector<BuildNode> &argNodes, uint32_t argFirst, uint32_t argCount, uint32_t argDepth, bool argIsTop)
+		{
+			const uint32_t Index = static_cast<uint32_t>(argNodes.size());
+			argNodes.emplace_back();
+
+			if (argIsTop && argCount <= taskSize_)
+			{
+				argNodes[Index].task = static_cast<int32_t>(tasks_.size());
+				tasks_.push_back({ argFirst, argCount, argDepth, {} });
+				return Index;
+			}
+
+			const bool IsParallel = argIsTop && argCount > ParallelBinThreshold;
+			Box bounds;
+			Box centroids;
+			ComputeBounds(argFirst, argCount, IsParallel, &bounds, &centroids);
+			argNodes[Index].bounds = bounds;
+
+			if (argCount == 1)
+				return MakeLeaf(argNodes, Index, argFirst, argCount);
+
+			uint32_t axis = 0;
+			for (uint32_t i = 1; i < 3; ++i)
+			{
+				if (centroids.upper[i] - centroids.lower[i] > centroids.upper[axis] - centroids.lower[axis])
+					axis = i;
+			}
+			const float Extent = centroids.upper[axis] - centroids.lower[axis];
+			uint32_t leftCount = argCount / 2;
+			if (Extent <= 0.f)
+			{
+				// 重心が全て同じ点なら区間に分けられないので、数だけで半分にする
+				if (argCount <= Utility::TriangleBvh::MaxLeafSize)
+					return MakeLeaf(argNodes, Index, argFirst, argCount);
+			}
+			else if (argDepth >= SahDepthLimit)
+			{
+				const auto Begin = references_.begin() + argFirst;
+				std::nth_element(Begin, Begin + leftCount, Begin + argCount, [axis](const Reference &argA, const Reference &argB)
+				{
+					return argA.centroid[axis] < argB.centroid[axis];
+				});
+			}
+			else
+			{
+				uint32_t bin = 0;
+				const float Cost = FindSplit(argFirst, argCount, bounds, centroids, IsParallel, &axis, &bin);
+				if (argCount <= Utility::TriangleBvh::MaxLeafSize && static_cast<float>(argCount) <= Cost)
+					return MakeLeaf(argNodes, Index, argFirst, argCount);
+
+				const float Lower = centroids.lower[axis];
+				const float Scale = BinCount / (centroids.upper[axis] - Lower);
+				const auto Begin = references_.begin() + argFirst;
+				leftCount = static_cast<uint32_t>(std::partition(Begin, Begin + argCount, [axis, bin, Lower, Scale](const Reference &argReference)
+				{
+					return BinIndex(argReference.centroid[axis], Lower, Scale) < bin;
+				}) - Begin);
+				if (leftCount == 0 || leftCount == argCount)
+					leftCount = argCount / 2;
+			}
+
+			argNodes[Index].axis = axis;
+			const uint32_t Left = BuildRange(argNodes, argFirst, leftCount, argDepth + 1, argIsTop);
+			const uint32_t Right = BuildRange(argNodes, argFirst + leftCount, argCount - leftCount, argDepth + 1, argIsTop);
+			argNodes[Index].left = Left;
+			argNodes[Index].right = Right;
+			return Index;
+		}
+
+	private:
+		static inline uint32_t BinIndex(float argCentroid, float argLower, float argScale)
+		{
+			const int32_t Bin = static_cast<int32_t>((argCentroid - argLower) * argScale);
+			return static_cast<uint32_t>(std::min(std::max(Bin, 0), static_cast<int32_t>(BinCount) - 1));
+		}
+
+		static inline uint32_t MakeLeaf(std::vector<BuildNode> &argNodes, uint32_t argIndex, uint32_t argFirst, uint32_t argCount)
+		{
+			argNodes[argIndex].first = argFirst;
+			argNodes[argIndex].count = argCount;
+			return argIndex;
+		}
+
+		void ComputeBounds(uint32_t argFirst, uint32_t argCount, bool argIsParallel, Box *argBounds, Box *argCentroids) const
+		{
+			const size_t ChunkCount = argIsParallel ? (argCount + BinGrain - 1) / BinGrain : 1;
+			std::vector<Box> bounds(ChunkCount);
+			std::vector<Box> centroids(ChunkCount);
+			ForEachChunk(argCount, argIsParallel ? BinGrain : argCount, argIsParallel ? pool_ : nullptr, [&](size_t argBegin, size_t argEnd)
+			{
+				const size_t Chunk = argIsParallel ? argBegin / BinGrain : 0;
+				for (size_t i = argFirst + argBegin; i < argFirst + argEnd; ++i)
+				{
+					bounds[Chunk].Grow(references_[i].bounds);
+					centroids[Chunk].Grow(references_[i].centroid);
+				}
+			});
+			for (size_t chunk = 0; chunk < ChunkCount; ++chunk)
+			{
+				argBounds->Grow(bounds[chunk]);
+				argCentroids->Grow(centroids[chunk]);
+			}
+		}
+
+		/**
+		 *	@fn			FindSplit
+		 *	@brief		3軸の区間の境目のうち、分けた後の費用が最小になるものを探す
+		 *	@param[out]	argAxis	!<	分ける軸
+		 *	@param[out]	argBin	!<	この区間より前を左の子にする
+		 *	@return		分けた後の費用(三角形1つの判定を1とする)
+		 */
+		float FindSplit(uint32_t argFirst, uint32_t argCount, const Box &argBounds, const Box &argCentroids, bool argIsParallel, uint32_t *argAxis, uint32_t *argBin) const
+		{
+			float lower[3];
+			float scale[3];
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				const float Extent = argCentroids.upper[axis] - argCentroids.lower[axis];
+				lower[axis] = argCentroids.lower[axis];
+				scale[axis] = (Extent > 0.f) ? BinCount / Extent : 0.f;
+			}
+
+			const size_t ChunkCount = argIsParallel ? (argCount + BinGrain - 1) / BinGrain : 1;
+			std::vector<AxisBins> chunkBins(ChunkCount);
+			ForEachChunk(argCount, argIsParallel ? BinGrain : argCount, argIsParallel ? pool_ : nullptr, [&](size_t argBegin, size_t argEnd)
+			{
+				AxisBins &bins = chunkBins[argIsParallel ? argBegin / BinGrain : 0];
+				for (size_t i = argFirst + argBegin; i < argFirst + argEnd; ++i)
+				{
+					const Reference &Current = references_[i];
+					for (int axis = 0; axis < 3; ++axis)
+					{
+						Bin &bin = bins[axis][BinIndex(Current.centroid[axis], lower[axis], scale[axis])];
+						bin.bounds.Grow(Current.bounds);
+						++bin.count;
+					}
+				}
+			});
+			for (size_t chunk = 1; chunk < ChunkCount; ++chunk)
+			{
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					for (uint32_t i = 0; i < BinCount; ++i)
+					{
+						chunkBins[0][axis][i].bounds.Grow(chunkBins[chunk][axis][i].bounds);
+						chunkBins[0][axis][i].count += chunkBins[chunk][axis][i].count;
+					}
+				}
+			}
+
+			const float ParentArea = argBounds.HalfArea();
+			const float InverseArea = (ParentArea > 0.f) ? 1.f / ParentArea : 0.f;
+			float bestCost = std::numeric_limits<float>::max();
+			for (uint32_t axis = 0; axis < 3; ++axis)
+			{
+				if (scale[axis] == 0.f)
+					continue;
+
+				// 右から積み上げた面積と数を先に求めておき、左から積み上げながら境目ごとの費用を出す
+				const Bin *Bins = chunkBins[0][axis];
+				float rightCost[BinCount];
+				Box right;
+				uint32_t rightCount = 0;
+				for (uint32_t i = BinCount - 1; i > 0; --i)
+				{
+					right.Grow(Bins[i].bounds);
+					rightCount += Bins[i].count;
+					rightCost[i] = (rightCount > 0) ? right.HalfArea() * rightCount : -1.f;
+				}
+
+				Box left;
+				uint32_t leftCount = 0;
+				for (uint32_t i = 1; i < BinCount; ++i)
+				{
+					left.Grow(Bins[i - 1].bounds);
+					leftCount += Bins[i - 1].count;
+					if (leftCount == 0 || rightCost[i] < 0.f)
+						continue;
+
+					const float Cost = TraversalCost + (left.HalfArea() * leftCount + rightCost[i]) * InverseArea;
+					if (Cost < bestCost)
+					{
+						bestCost = Cost;
+						*argAxis = axis;
+						*argBin = i;
+					}
+				}
+			}
+			return bestCost;
+		}
+	};
+}
+
+Utility::TriangleBvh::TriangleBvh()
+	: nodes_(), triangles_(), indices_()
+{
+}
+
+void Utility::TriangleBvh::Build(Span<const Triangle> argTriangles, ThreadPool *argPool)
+{
+	Clear();
+	const size_t Count = argTriangles.size();
+	if (Count == 0)
+		return;
+	assert(Count < UINT32_MAX && "Too many triangles...");
+
+	std::vector<Reference> references(Count);
+	ForEachChunk(Count, BoundsGrain, argPool, [&references, argTriangles](size_t argBegin, size_t argEnd)
+	{
+		for (size_t i = argBegin; i < argEnd; ++i)
+		{
+			const Triangle &Current = argTriangles[i];
+			Reference &reference = references[i];
+			reference.bounds = Box();
+			reference.bounds.Grow(Current.pointTop);
+			reference.bounds.Grow(Current.pointLeft);
+			reference.bounds.Grow(Current.pointRight);
+			reference.centroid[0] = (Current.pointTop.x + Current.pointLeft.x + Current.pointRight.x) / 3.f;
+			reference.centroid[1] = (Current.pointTop.y + Current.pointLeft.y + Current.pointRight.y) / 3.f;
+			reference.centroid[2] = (Current.pointTop.z + Current.pointLeft.z + Current.pointRight.z) / 3.f;
+			reference.triangle = static_cast<uint32_t>(i);
+		}
+	});
+
+	// 上の方は順に分け、小さくなった部分木を並列に作る
+	std::vector<Task> tasks;
+	std::vector<BuildNode> top;
+	Builder builder(references, tasks, argPool);
+	builder.BuildRange(top, 0, static_cast<uint32_t>(Count), 0, true);
+	ForEachChunk(tasks.size(), 1, argPool, [&builder, &tasks](size_t argBegin, size_t argEnd)
+	{
+		for (size_t i = argBegin; i < argEnd; ++i)
+			builder.BuildRange(tasks[i].nodes, tasks[i].first, tasks[i].count, tasks[i].depth, false);
+	});
+
+	// 1つ目の子が親の直後に来るように並べる(2つ目の子の添字は並べたときに埋める)
+	struct Pending
+	{
+		const std::vector<BuildNode>	*nodes;
+		uint32_t						index;
+		uint32_t						parent;	//	!<	2つ目の子なら親の添字、1つ目の子はUINT32_MAX
+	};
+	size_t nodeCount = top.size();
+	for (const Task &Current : tasks)
+		nodeCount += Current.nodes.size();
+	nodes_.reserve(nodeCount);
+
+	std::vector<Pending> stack;
+	stack.push_back({ &top, 0, UINT32_MAX });
+	while (!stack.empty())
+	{
+		Pending pending = stack.back();
+		stack.pop_back();
+		while ((*pending.nodes)[pending.index].task >= 0)
+		{
+			pending.nodes = &tasks[(*pending.nodes)[pending.index].task].nodes;
+			pending.index = 0;
+		}
+
+		const BuildNode &Current = (*pending.nodes)[pending.index];
+		const uint32_t Index = static_cast<uint32_t>(nodes_.size());
+		if (pending.parent != UINT32_MAX)
+			nodes_[pending.parent].index = Index;
+
+		Node node;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			node.lower[axis] = Current.bounds.lower[axis];
+			node.upper[axis] = Current.bounds.upper[axis];
+		}
+		node.index = Current.first;
+		node.count = static_cast<uint16_t>(Current.count);
+		node.axis = static_cast<uint16_t>(Current.axis);
+		nodes_.push_back(node);
+
+		if (Current.count == 0)
+		{
+			stack.push_back({ pending.nodes, Current.right, Index });
+			stack.push_back({ pending.nodes, Current.left, UINT32_MAX });
+		}
+	}
+
+	triangles_.resize(Count);
+	indices_.resize(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		indices_[i] = references[i].triangle;
+		triangles_[i] = argTriangles[references[i].triangle];
+	}
+}
+
+void Utility::TriangleBvh::Clear()
+{
+	nodes_.clear();
+	triangles_.clear();
+	indices_.clear();
+}
+
+Utility::Aabb Utility::TriangleBvh::GetBounds() const
+{
+	if (nodes_.empty())
+		return Aabb();
+
+	const Node &Root = nodes_[0];
+	return Aabb(Math::Vector3(Root.lower[0], Root.lower[1], Root.lower[2]), Math::Vector3(Root.upper[0], Root.upper[1], Root.upper[2]));
+}
+
+bool Utility::TriangleBvh::Raycast(const Segment &argSegment, RayHit *argHit) const
+{
+	float entry = 0.f;
+	const RaySetup Ray(argSegment);
+	if (nodes_.empty() || !Ray.Overlaps(nodes_[0], 1.f, &entry))
+		return false;
+
+	struct Pending
+	{
+		uint32_t	index;
+		float		entry;
+	};
+	Pending stack[QueryStackSize];
+	size_t count = 0;
+
+	RayHit best;
+	best.fraction = std::numeric_limits<float>::max();
+	bool isHit = false;
+	uint32_t index = 0;
+	for (;;)
+	{
+		const Node &Current = nodes_[index];
+		if (Current.count > 0)
+		{
+			for (uint32_t i = Current.index; i < Current.index + Current.count; ++i)
+			{
+				RayHit hit;
+				if (IntersectSegment(argSegment, i, &hit) && hit.fraction < best.fraction)
+				{
+					best = hit;
+					isHit = true;
+				}
+			}
+		}
+		else
+		{
+			// 入る位置が近い方の子を先にたどり、今の最も近い交点より遠い箱はたどらない
+			const float MaxFraction = isHit ? best.fraction : 1.f;
+			uint32_t nearChild = index + 1;
+			uint32_t farChild = Current.index;
+			float nearEntry = 0.f;
+			float farEntry = 0.f;
+			bool isNearHit = Ray.Overlaps(nodes_[nearChild], MaxFraction, &nearEntry);
+			bool isFarHit = Ray.Overlaps(nodes_[farChild], MaxFraction, &farEntry);
+			if (isNearHit && isFarHit && farEntry < nearEntry)
+			{
+				std::swap(nearChild, farChild);
+				std::swap(nearEntry, farEntry);
+			}
+			else if (!isNearHit)
+			{
+				std::swap(nearChild, farChild);
+				std::swap(nearEntry, farEntry);
+				std::swap(isNearHit, isFarHit);
+			}
+
+			if (isNearHit)
+			{
+				if (isFarHit)
+				{
+					if (count == QueryStackSize)
+					{// Deserializeで深さを確かめているので起きないが、壊れた木でもスタックの外に書かない
+						assert(false && "TriangleBvh is too deep...");
+						break;
+					}
+					stack[count++] = { farChild, farEntry };
+				}
+				index = nearChild;
+				continue;
+			}
+		}
+
+		// 積んだ後で見つかった交点より遠い箱は捨てる
+		while (count > 0 && stack[count - 1].entry > best.fraction)
+			--count;
+		if (count == 0)
+			break;
+		index = stack[--count].index;
+	}
+
+	if (isHit && argHit)
+		*argHit = best;
+	return isHit;
+}
+
+void Utility::TriangleBvh::Serialize(std::vector<char> *argData) const
+{
+	const SerializedHeader Header = { Magic, Version, static_cast<uint32_t>(nodes_.size()), static_cast<uint32_t>(triangles_.size()) };
+	argData->clear();
+	argData->reserve(sizeof(Header) + nodes_.size() * sizeof(Node) + triangles_.size() * (SerializedTriangleSize + sizeof(uint32_t)));
+	Append(argData, &Header, sizeof(Header));
+	Append(argData, nodes_.data(), nodes_.size() * sizeof(Node));
+	for (const Triangle &Current : triangles_)
+	{
+		const float Values[12] = {
+			Current.pointTop.x, Current.pointTop.y, Current.pointTop.z,
+			Current.pointLeft.x, Current.pointLeft.y, Current.pointLeft.z,
+			Current.pointRight.x, Current.pointRight.y, Current.pointRight.z,
+			Current.normal.x, Current.normal.y, Current.normal.z };
+		Append(argData, Values, sizeof(Values));
+	}
+	Append(argData, indices_.data(), indices_.size() * sizeof(uint32_t));
+}
+
+bool Utility::TriangleBvh::Deserialize(const char *argData, size_t argSize)
+{
+	Clear();
+
+	SerializedHeader header;
+	if (argData == nullptr || argSize < sizeof(header))
+		return false;
+	std::memcpy(&header, argData, sizeof(header));
+	if (header.magic != Magic || header.version != Version)
+		return false;
+
+	const size_t NodeBytes = static_cast<size_t>(header.nodeCount) * sizeof(Node);
+	const size_t TriangleBytes = static_cast<size_t>(header.triangleCount) * SerializedTriangleSize;
+	const size_t IndexBytes = static_cast<size_t>(header.triangleCount) * sizeof(uint32_t);
+	if (argSize != sizeof(header) + NodeBytes + TriangleBytes + IndexBytes)
+		return false;
+
+	const char *src = argData + sizeof(header);
+	nodes_.resize(header.nodeCount);
+	std::memcpy(nodes_.data(), src, NodeBytes);
+	src += NodeBytes;
+
+	// 壊れたデータでたどる先が範囲外にならないか、たどるときのスタックに収まる深さか確かめる
+	// (子は親より後ろにあるので、前から順に親の深さを子に伝えれば各節の最も深い経路が求まる)
+	std::vector<uint32_t> depths(header.nodeCount, 0);
+	for (uint32_t i = 0; i < header.nodeCount; ++i)
+	{
+		const Node &Current = nodes_[i];
+		const bool IsValid = (Current.count > 0) ?
+			(static_cast<uint64_t>(Current.index) + Current.count <= header.triangleCount) :
+			(i + 1 < header.nodeCount && Current.index > i + 1 && Current.index < header.nodeCount && depths[i] < QueryStackSize);
+		if (!IsValid)
+		{
+			Clear();
+			return false;
+		}
+		if (Current.count == 0)
+		{
+			depths[i + 1] = std::max(depths[i + 1], depths[i] + 1);
+			depths[Current.index] = std::max(depths[Current.index], depths[i] + 1);
+		}
+	}
+
+	triangles_.resize(header.triangleCount);
+	for (Triangle &current : triangles_)
+	{
+		float values[12];
+		std::memcpy(values, src, sizeof(values));
+		src += sizeof(values);
+		current.pointTop = Math::Vector3(values[0], values[1], values[2]);
+		current.pointLeft = Math::Vector3(values[3], values[4], values[5]);
+		current.pointRight = Math::Vector3(values[6], values[7], values[8]);
+		current.normal = Math::Vector3(values[9], values[10], values[11]);
+	}
+	indices_.resize(header.triangleCount);
+	std::memcpy(indices_.data(), src, IndexBytes);
+	return true;
+}
+
+bool Utility::TriangleBvh::Save(const char *argFileName) const
+{
+	std::vector<char> data;
+	Serialize(&data);
+
+	std::ofstream stream(argFileName, std::ofstream::binary);
+	if (!stream)
+		return false;
+	stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+	return stream.good();
+}
+
+bool Utility::TriangleBvh::Load(const char *argFileName, bool argUseArchive)
+{
+	if (argUseArchive)
+	{
+		char *memory = nullptr;
+		int size = 0;
+		Singleton<Archive>::Get()->Read(argFileName, &memory, &size);
+		return Deserialize(memory, static_cast<size_t>(size));
+	}
+
+	Loader loader;
+	if (!loader.Load(argFileName))
+		return false;
+	return Deserialize(loader.Data(), loader.Size());
+}
+
+Utility::TriangleBvh::RaySetup::RaySetup(const Segment &argSegment)
+{
+	const float Start[3] = { argSegment.start.x, argSegment.start.y, argSegment.start.z };
+	const float Direction[3] = { argSegment.end.x - Start[0], argSegment.end.y - Start[1], argSegment.end.z - Start[2] };
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		start[axis] = Start[axis];
+		isParallel[axis] = (Direction[axis] == 0.f);
+		inverse[axis] = isParallel[axis] ? 0.f : 1.f / Direction[axis];
+	}
+}
+
+bool Utility::TriangleBvh::RaySetup::Overlaps(const Node &argNode, float argMaxFraction, float *argEntry) const
+{
+	float entry = 0.f;
+	float exit = argMaxFraction;
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		if (isParallel[axis])
+		{
+			if (start[axis] < argNode.lower[axis] || start[axis] > argNode.upper[axis])
+				return false;
+			continue;
+		}
+
+		float t0 = (argNode.lower[axis] - start[axis]) * inverse[axis];
+		float t1 = (argNode.upper[axis] - start[axis]) * inverse[axis];
+		if (t0 > t1)
+			std::swap(t0, t1);
+		entry = std::max(entry, t0);
+		exit = std::min(exit, t1);
+		if (entry > exit)
+			return false;
+	}
+	*argEntry = entry;
+	return true;
+}
+
+bool Utility::TriangleBvh::Overlaps(const Node &argNode, const Aabb &argBounds)
+{
+	return !(argNode.upper[0] < argBounds.lower.x || argBounds.upper.x < argNode.lower[0] ||
+		argNode.upper[1] < argBounds.lower.y || argBounds.upper.y < argNode.lower[1] ||
+		argNode.upper[2] < argBounds.lower.z || argBounds.upper.z < argNode.lower[2]);
+}
+
+bool Utility::TriangleBvh::Overlaps(const Node &argNode, const Sphere &argSphere)
+{
+	// 中心から箱までの距離の二乗
+	const float Center[3] = { argSphere.center.x, argSphere.center.y, argSphere.center.z };
+	float distanceSQ = 0.f;
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		const float D = std::max(argNode.lower[axis] - Center[axis], 0.f) + std::max(Center[axis] - argNode.upper[axis], 0.f);
+		distanceSQ += D * D;
+	}
+	return distanceSQ <= argSphere.radius * argSphere.radius;
+}
+
+Utility::Aabb Utility::TriangleBvh::TriangleAabb(const Triangle &argTriangle)
+{
+	Box box;
+	box.Grow(argTriangle.pointTop);
+	box.Grow(argTriangle.pointLeft);
+	box.Grow(argTriangle.pointRight);
+	return Aabb(Math::Vector3(box.lower[0], box.lower[1], box.lower[2]), Math::Vector3(box.upper[0], box.upper[1], box.upper[2]));
+}
+
+bool Utility::TriangleBvh::IntersectSegment(const Segment &argSegment, uint32_t argIndex, RayHit *argHit) const
+{
+	Math::Vector3 point;
+	if (!CheckSegment2Triangle(argSegment, triangles_[argIndex], &point))
+		return false;
+
+	const Math::Vector3 Direction = argSegment.end - argSegment.start;
+	const float LengthSQ = Direction.Dot(Direction);
+	argHit->triangle = indices_[argIndex];
+	argHit->fraction = (LengthSQ > 0.f) ? (point - argSegment.start).Dot(Direction) / LengthSQ : 0.f;
+	argHit->point = point;
+	return true;
+}
@@ -9,7 +9,13 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <memory>
+#include <assert.h>
+
+#include "ConfigTable.h"
+#include "../String/NumberFormat.h"
+#include "../String/Atom.h"
 
 namespace Utility
 {
@@ -35,7 +41,11 @@ namespace Utility
 			 */
 			const int GetIntData()
 			{
-				return std::stoi(reinterpret_cast<char(&)[sizeof(data_)]>(data_));
+				// std::stoiと同じく先頭の整数を使う("12abc"は12、実数で書かれていたら整数部)
+				int value = 0;
+				bool isParsed = NumberFormat::ParseLeadingInt(reinterpret_cast<const char*>(data_), &value);
+				assert(isParsed && "Data isn't number...");
+				return value;
 			}
 		};
 	private:
@@ -43,9 +53,17 @@ namespace Utility
 		bool canUseArchive_ = false;
 		std::vector<Constant> data_;
 		int dataIndex_ = 0;
-		std::map<std::string, int> checker_;
+		std::unordered_map<Atom, int> checker_;
+		std::map<std::string, ConfigTable> tables_;
 		static const int Key_ = 12;
 	private:
+		/**
+		 *  @fn			Parse
+		 *  @brief		コンフィグのテキストの解析
+		 *  @param[in]	argText	!<	復号化済みのテキスト
+		 *  @note		「名前 : 値」「名前 : [値, 値, ...]」「名前 : { 列名, ... の行, 値の行..., }」に対応
+		 */
+		void Parse(const std::string &argText);
 		/**
 		 *  @fn			LoadArchive
 		 *  @brief		アーカイブからのコンフィグファイルのロード
@@ -105,6 +123,13 @@ namespace Utility
 		 *  @return		整数のデータ
 		 */
 		const int IntData(std::string argKey);
+		/**
+		 *  @fn			IntData
+		 *  @brief		整数のデータの取得
+		 *  @param[in]	argKey	!<	データのキーの識別子
+		 *  @return		整数のデータ
+		 */
+		const int IntData(Atom argKey);
 		/**
 		 *  @fn			Name
 		 *  @brief		データの名前の取得
@@ -126,6 +151,36 @@ namespace Utility
 		 */
 		inline size_t DataSize() const{ return data_.size(); }
 
+		/**
+		 *  @fn			HasTable
+		 *  @brief		配列・テーブルのデータがあるか
+		 *  @param[in]	argKey		!<	データのキー
+		 *	@retval		true		!<	存在する
+		 *	@retval		false		!<	存在しない
+		 */
+		inline bool HasTable(const std::string &argKey) const { return tables_.count(argKey) != 0; }
+		/**
+		 *  @fn			Table
+		 *  @brief		テーブルのデータの取得
+		 *  @param[in]	argKey	!<	データのキー
+		 *  @return		テーブル
+		 */
+		const ConfigTable &Table(const std::string &argKey) const;
+		/**
+		 *  @fn			IntArray
+		 *  @brief		整数の配列のデータの取得
+		 *  @param[in]	argKey	!<	データのキー
+		 *  @return		配列の値
+		 */
+		inline Span<const int> IntArray(const std::string &argKey) const { return Table(argKey).IntColumn(0); }
+		/**
+		 *  @fn			FloatArray
+		 *  @brief		実数の配列のデータの取得
+		 *  @param[in]	argKey	!<	データのキー
+		 *  @return		配列の値
+		 */
+		inline Span<const float> FloatArray(const std::string &argKey) const { return Table(argKey).FloatColumn(0); }
+
 		/**
 		 *	@fn			DataPath
 		 *	@brief		データのパスの設定
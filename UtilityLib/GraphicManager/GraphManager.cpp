@@ -17,7 +17,7 @@ void Utility::GraphManager::Initialize(ID3D11DeviceContext *argContext, IDXGISwa
 	graphic2d_ = std::make_unique<Graphic2DBase>(argContext, argSwapChain, std::move(spriteBatch));
 }
 
-void Utility::GraphManager::DrawAndWriteText(const std::wstring argStr, DirectX::XMFLOAT2 argPos)const
+void Utility::GraphManager::DrawAndWriteText(std::wstring_view argStr, DirectX::XMFLOAT2 argPos)const
 {
 	graphic2d_->DrawAndWriteText(argStr, argPos);
 }
@@ -48,6 +48,10 @@ std::shared_ptr<Utility::Texture> Utility::GraphManager::FindIndexTexture(const
 {
 	return graphic2d_->FindIndexTexture(argKey);
 }
+std::shared_ptr<Utility::Texture> Utility::GraphManager::FindIndexTexture(Atom argKey)const
+{
+	return graphic2d_->FindIndexTexture(argKey);
+}
 ID2D1RenderTarget *Utility::GraphManager::RenderTarget()const
 {
 	return graphic2d_->RenderTarget2d();
@@ -11,6 +11,8 @@
 #include "../DirectX/DWriteBase.h"
 #include "SpriteBatch/SpriteBatch.h"
 #include "TextureImage/TextureImage.h"
+#include "../String/Atom.h"
+#include "../String/TextFormat.h"
 
 struct ID3D11DeviceContext;
 struct IDXGISwapChain;
@@ -48,13 +50,20 @@ namespace Utility
 		 *	@return		テクスチャ
 		 */
 		std::shared_ptr<Texture> FindIndexTexture(const std::wstring argKey)const;
+		/**
+		 *	@fn			FindIndexTexture
+		 *	@brief		テクスチャの取得
+		 *	@param[in]	argKey	!<	取得したいテクスチャのキー
+		 *	@return		テクスチャ
+		 */
+		std::shared_ptr<Texture> FindIndexTexture(Atom argKey)const;
 		/**
 		 *	@fn			DrawAndWriteText
 		 *	@brief		テキストの描画
-		 *	@param[in]	argStr	!<	書き込むテキスト
+		 *	@param[in]	argStr	!<	書き込むテキスト(FixedTextで書式化したものも渡せる)
 		 *	@param[in]	argPos	!<	テキストを描画する座標
 		 */
-		void DrawAndWriteText(const std::wstring argStr, DirectX::XMFLOAT2 argPos)const;
+		void DrawAndWriteText(std::wstring_view argStr, DirectX::XMFLOAT2 argPos)const;
 		/**
 		 *	@fn			DrawAndWriteText
 		 *	@brief		テキストの描画
@@ -62,7 +71,7 @@ namespace Utility
 		 *	@param[in]	argPos			!<	テキストを描画する座標
 		 *	@param[in]	argScreenSize	!<	スクリーンサイズ
 		 */
-		void DrawAndWriteText(const std::wstring argStr, DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argScreenSize)const;
+		void DrawAndWriteText(std::wstring_view argStr, DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argScreenSize)const;
 		/**
 		  *	@fn			ConfigTextColor
 		  *	@brief		テキストブラシの色設定
@@ -110,6 +119,7 @@ namespace Utility
 	 *	@param[in]	扱うテクスチャ
 	 *	@param[in]	最大桁数
 	 *	@param[in]	テクスチャの色
+	 *	@note		テクスチャは0～9を横に並べたもの。負の数は、9の次に'-'のコマがあれば数字の左に描く
 	 */
 	extern void DrawNum(DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argSize, const float argNum, const std::weak_ptr<Texture> &argTexture, const int argDigitMax, DirectX::XMFLOAT4 argColor = DirectX::XMFLOAT4(1.f, 1.f, 1.f, 1.f));
 	/**
@@ -122,6 +132,7 @@ namespace Utility
 	*	@param[in]	扱うテクスチャ
 	*	@param[in]	最大桁数
 	*	@param[in]	テクスチャの色
+	*	@note		テクスチャは0～9を横に並べたもの。負の数は、9の次に'-'のコマがあれば数字の左に描く
 	*/
 	extern void DrawNum(DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argSize, float argExRate, const float argNum, const std::weak_ptr<Texture> &argTexture, const int argDigitMax, DirectX::XMFLOAT4 argColor);
 	/**
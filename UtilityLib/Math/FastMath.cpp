@@ -0,0 +1,173 @@
+﻿/**
+ *	@file	FastMath.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "FastMath.h"
+
+#include <assert.h>
+
+namespace
+{
+	using Utility::Math::ePrecision;
+
+#pragma region		Kernel
+	/*
+	 *	各カーネルはApply<Lanes>(i)でi番目からLanes::Width個を処理する。
+	 */
+
+	/**
+	 *  @struct		UnaryKernel
+	 *  @brief		1入力1出力の関数
+	 */
+	template<ePrecision P>
+	struct UnaryKernel
+	{
+		/**
+		 *  @enum		eMode
+		 *  @brief		計算する関数
+		 */
+		enum class eMode
+		{
+			Sin,
+			Cos,
+			Exp,
+			Log,
+			Rsqrt,
+		};
+
+		const float	*src_;
+		float		*dst_;
+		eMode		mode_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			using Math = Utility::Math::FastMath<P>;
+			const typename L::Reg X = L::Load(src_ + argIndex);
+			typename L::Reg result, unused;
+			switch (mode_)
+			{
+			case eMode::Sin:
+				Math::template SinCosLanes<L>(X, &result, &unused);
+				break;
+			case eMode::Cos:
+				Math::template SinCosLanes<L>(X, &unused, &result);
+				break;
+			case eMode::Exp:
+				result = Math::template ExpLanes<L>(X);
+				break;
+			case eMode::Log:
+				result = Math::template LogLanes<L>(X);
+				break;
+			default:
+				result = Math::template RsqrtLanes<L>(X);
+				break;
+			}
+			L::Store(dst_ + argIndex, result);
+		}
+	};
+
+	/**
+	 *  @struct		SinCosKernel
+	 *  @brief		正弦と余弦
+	 */
+	template<ePrecision P>
+	struct SinCosKernel
+	{
+		const float	*src_;
+		float		*sin_;
+		float		*cos_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			typename L::Reg s, c;
+			Utility::Math::FastMath<P>::template SinCosLanes<L>(L::Load(src_ + argIndex), &s, &c);
+			L::Store(sin_ + argIndex, s);
+			L::Store(cos_ + argIndex, c);
+		}
+	};
+
+	/**
+	 *  @struct		Atan2Kernel
+	 *  @brief		逆正接
+	 */
+	template<ePrecision P>
+	struct Atan2Kernel
+	{
+		const float	*y_;
+		const float	*x_;
+		float		*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			L::Store(dst_ + argIndex, Utility::Math::FastMath<P>::template Atan2Lanes<L>(L::Load(y_ + argIndex), L::Load(x_ + argIndex)));
+		}
+	};
+#pragma endregion	Kernel
+
+	/**
+	 *	@fn			RunUnary
+	 *	@brief		UnaryKernelを組み立てて適用する
+	 */
+	template<ePrecision P>
+	void RunUnary(Utility::Span<const float> argSrc, Utility::Span<float> argDst, typename UnaryKernel<P>::eMode argMode, Utility::ThreadPool *argPool)
+	{
+		assert(argDst.size() >= argSrc.size() && "Destination is too small...");
+		const UnaryKernel<P> Kernel = { argSrc.data(), argDst.data(), argMode };
+		Utility::Math::Simd::Run(Kernel, argSrc.size(), Utility::Math::FastMath<P>::ParallelGrain, argPool);
+	}
+}
+
+template<Utility::Math::ePrecision P>
+void Utility::Math::FastMath<P>::Sin(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunUnary<P>(argSrc, argDst, UnaryKernel<P>::eMode::Sin, argPool);
+}
+
+template<Utility::Math::ePrecision P>
+void Utility::Math::FastMath<P>::Cos(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunUnary<P>(argSrc, argDst, UnaryKernel<P>::eMode::Cos, argPool);
+}
+
+template<Utility::Math::ePrecision P>
+void Utility::Math::FastMath<P>::SinCos(Span<const float> argSrc, Span<float> argSin, Span<float> argCos, ThreadPool *argPool)
+{
+	assert(argSin.size() >= argSrc.size() && argCos.size() >= argSrc.size() && "Destination is too small...");
+	const SinCosKernel<P> Kernel = { argSrc.data(), argSin.data(), argCos.data() };
+	Simd::Run(Kernel, argSrc.size(), ParallelGrain, argPool);
+}
+
+template<Utility::Math::ePrecision P>
+void Utility::Math::FastMath<P>::Atan2(Span<const float> argY, Span<const float> argX, Span<float> argDst, ThreadPool *argPool)
+{
+	assert(argY.size() == argX.size() && "FastMath::Atan2 size mismatch...");
+	assert(argDst.size() >= argY.size() && "Destination is too small...");
+	const Atan2Kernel<P> Kernel = { argY.data(), argX.data(), argDst.data() };
+	Simd::Run(Kernel, argY.size(), ParallelGrain, argPool);
+}
+
+template<Utility::Math::ePrecision P>
+void Utility::Math::FastMath<P>::Exp(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunUnary<P>(argSrc, argDst, UnaryKernel<P>::eMode::Exp, argPool);
+}
+
+template<Utility::Math::ePrecision P>
+void Utility::Math::FastMath<P>::Log(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunUnary<P>(argSrc, argDst, UnaryKernel<P>::eMode::Log, argPool);
+}
+
+template<Utility::Math::ePrecision P>
+void Utility::Math::FastMath<P>::Rsqrt(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunUnary<P>(argSrc, argDst, UnaryKernel<P>::eMode::Rsqrt, argPool);
+}
+
+template class Utility::Math::FastMath<Utility::Math::ePrecision::Full>;
+template class Utility::Math::FastMath<Utility::Math::ePrecision::Fast>;
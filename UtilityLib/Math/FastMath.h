@@ -0,0 +1,318 @@
+﻿/**
+ *	@file	FastMath.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "SimdLanes.h"
+#include "../Span.h"
+
+#include <cstddef>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	namespace Math
+	{
+		/**
+		 *  @enum		ePrecision
+		 *  @brief		FastMathの精度
+		 */
+		enum class ePrecision
+		{
+			Full,	//	!<	単精度の丸め誤差程度
+			Fast,	//	!<	多項式の次数を下げた近似(見た目に影響しない用途向け)
+		};
+
+		/**
+		 *  @class		FastMath
+		 *  @brief		多項式近似による超越関数(1要素ずつとSpanでまとめて計算する版)
+		 *  @note		パーティクル等で大量に計算する用途。まとめて計算する版はAVX2/SSE2で8/4要素ずつ処理し、
+		 *				ThreadPoolを渡すとParallelGrain個ずつに分けて並列に処理する。出力先は入力と同じでもよい。
+		 *				1要素ずつの版は分岐の予測が外れやすい入力ではstd::の関数と大差ないので、大量に計算するときはまとめて計算する版を使う。
+		 *				倍精度で計算した値との差の最大値(括弧内はFast)
+		 *				Sin, Cos	!<	|x| <= 8192で絶対誤差 2.7e-7 (|x| <= 100で 1.4e-5、|x| <= 1024で 6.4e-5、|x| <= 8192で 5.0e-4。|x|に比例して増える)
+		 *				Atan2		!<	絶対誤差 2.9e-7 (1.8e-5)。xとyが共に0なら0
+		 *				Log			!<	相対誤差 1.2e-7 (絶対誤差 7.1e-6)。xは正の正規化数であること
+		 *				Exp			!<	相対誤差 1.1e-7 (7.0e-6)。xは[-87.33, 88.02]に丸める(NaNはNaNのまま)
+		 *				Rsqrt		!<	相対誤差 9.0e-8 (4.8e-6)。xは正の正規化数であること
+		 *  @tparam		P	!<	精度
+		 */
+		template<ePrecision P = ePrecision::Full>
+		class FastMath final
+		{
+		public:
+			static const size_t ParallelGrain = 16384;	//	!<	並列に処理するときの1塊の要素数
+
+		public:
+			inline static float Sin(float argX)
+			{
+				float s, c;
+				SinCos(argX, &s, &c);
+				return s;
+			}
+			inline static float Cos(float argX)
+			{
+				float s, c;
+				SinCos(argX, &s, &c);
+				return c;
+			}
+			inline static void SinCos(float argX, float *argSin, float *argCos)
+			{
+				SinCosLanes<Simd::ScalarLanes>(argX, argSin, argCos);
+			}
+			inline static float Atan2(float argY, float argX) { return Atan2Lanes<Simd::ScalarLanes>(argY, argX); }
+			inline static float Exp(float argX) { return ExpLanes<Simd::ScalarLanes>(argX); }
+			inline static float Log(float argX) { return LogLanes<Simd::ScalarLanes>(argX); }
+			inline static float Rsqrt(float argX) { return RsqrtLanes<Simd::ScalarLanes>(argX); }
+
+		public:
+			/**
+			 *	@fn			Sin
+			 *	@brief		正弦をまとめて計算する
+			 *	@param[in]	argSrc		!<	角度(ラジアン)
+			 *	@param[out]	argDst		!<	正弦(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Sin(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Cos
+			 *	@brief		余弦をまとめて計算する
+			 *	@param[in]	argSrc		!<	角度(ラジアン)
+			 *	@param[out]	argDst		!<	余弦(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Cos(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			SinCos
+			 *	@brief		正弦と余弦をまとめて計算する
+			 *	@param[in]	argSrc		!<	角度(ラジアン)
+			 *	@param[out]	argSin		!<	正弦(argSrcと同じ要素数以上)
+			 *	@param[out]	argCos		!<	余弦(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void SinCos(Span<const float> argSrc, Span<float> argSin, Span<float> argCos, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Atan2
+			 *	@brief		y / xの逆正接をまとめて計算する
+			 *	@param[in]	argY		!<	y
+			 *	@param[in]	argX		!<	x(argYと同じ要素数)
+			 *	@param[out]	argDst		!<	角度(-π～π。argYと同じ要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Atan2(Span<const float> argY, Span<const float> argX, Span<float> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Exp
+			 *	@brief		指数関数をまとめて計算する
+			 *	@param[in]	argSrc		!<	指数
+			 *	@param[out]	argDst		!<	eのargSrc乗(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Exp(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Log
+			 *	@brief		自然対数をまとめて計算する
+			 *	@param[in]	argSrc		!<	値(正の正規化数)
+			 *	@param[out]	argDst		!<	自然対数(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Log(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Rsqrt
+			 *	@brief		平方根の逆数をまとめて計算する
+			 *	@param[in]	argSrc		!<	値
+			 *	@param[out]	argDst		!<	平方根の逆数(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Rsqrt(Span<const float> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+
+		public:
+			// 以下はSimdLanes.hの演算の型で書いた本体。1要素ずつの版とまとめて計算する版で共有する
+
+			/**
+			 *	@fn			SinCosLanes
+			 *	@brief		[-π, π]に縮約し、さらに[-π/2, π/2]に折り返して多項式で近似する
+			 */
+			template<typename L>
+			inline static void SinCosLanes(typename L::Reg argX, typename L::Reg *argSin, typename L::Reg *argCos)
+			{
+				using Reg = typename L::Reg;
+				const float Pi = 3.14159265358979323846f;
+				const Reg Q = L::Round(L::Mul(argX, L::Set(0.159154943091895335768f)));
+				Reg r;
+				if constexpr (P == ePrecision::Full)
+				{// 2πを3つに分けて(Cody-Waite)、大きな角度でも桁落ちしないようにする
+					r = L::Sub(argX, L::Mul(Q, L::Set(6.28125f)));
+					r = L::Sub(r, L::Mul(Q, L::Set(1.9354820251464844e-3f)));
+					r = L::Sub(r, L::Mul(Q, L::Set(-1.7484555314695172e-7f)));
+				}
+				else
+				{
+					r = L::Sub(argX, L::Mul(Q, L::Set(2.f * Pi)));
+				}
+
+				// |r| > π/2はπ - rに折り返す(余弦は符号が反転する)
+				const typename L::Mask Flip = L::GreaterEqual(L::Abs(r), L::Set(Pi * 0.5f));
+				const Reg Y = L::Select(Flip, L::Sub(L::CopySign(L::Set(Pi), r), r), r);
+				const Reg Z = L::Mul(Y, Y);
+
+				Reg s, c;
+				if constexpr (P == ePrecision::Full)
+				{
+					static constexpr float SinCoef[] = { -1.666666660877965e-1f, 8.33333056852399e-3f, -1.9840811743478015e-4f, 2.7522953758565775e-6f, -2.3851844099704497e-8f };
+					static constexpr float CosCoef[] = { -4.999999955087318e-1f, 4.166664077895432e-2f, -1.3888404122901728e-3f, 2.476191559410091e-5f, -2.6077589314644693e-7f };
+					s = Polynomial<L>(Z, SinCoef);
+					c = Polynomial<L>(Z, CosCoef);
+				}
+				else
+				{
+					static constexpr float SinCoef[] = { -1.666568107281658e-1f, 8.312366208622246e-3f, -1.849218151325855e-4f };
+					static constexpr float CosCoef[] = { -4.999356307524532e-1f, 4.1507066878078515e-2f, -1.2757519925911762e-3f };
+					s = Polynomial<L>(Z, SinCoef);
+					c = Polynomial<L>(Z, CosCoef);
+				}
+				*argSin = L::Add(Y, L::Mul(L::Mul(Y, Z), s));
+				c = L::Add(L::Set(1.f), L::Mul(Z, c));
+				*argCos = L::Select(Flip, L::Neg(c), c);
+			}
+
+			/**
+			 *	@fn			Atan2Lanes
+			 *	@brief		min(|x|, |y|) / max(|x|, |y|)の逆正接を多項式で近似し、象限を直す
+			 */
+			template<typename L>
+			inline static typename L::Reg Atan2Lanes(typename L::Reg argY, typename L::Reg argX)
+			{
+				using Reg = typename L::Reg;
+				const float Pi = 3.14159265358979323846f;
+				const Reg AbsX = L::Abs(argX);
+				const Reg AbsY = L::Abs(argY);
+				const Reg Max = L::Max(AbsX, AbsY);
+				const Reg T = L::ZeroIfZero(Max, L::Div(L::Min(AbsX, AbsY), Max));
+				const Reg Z = L::Mul(T, T);
+
+				Reg a;
+				if constexpr (P == ePrecision::Full)
+				{
+					static constexpr float Coef[] = { -3.333299171588941e-1f, 1.9990490888198806e-1f, -1.4186671653264044e-1f, 1.0576476716945794e-1f, -7.371813126705849e-2f, 4.117920732430806e-2f, -1.5166337702429498e-2f, 2.6303901855642985e-3f };
+					a = Polynomial<L>(Z, Coef);
+				}
+				else
+				{
+					static constexpr float Coef[] = { -3.3168528322127405e-1f, 1.844909690862891e-1f, -9.045058691530317e-2f, 2.3060272502940224e-2f };
+					a = Polynomial<L>(Z, Coef);
+				}
+				a = L::Add(T, L::Mul(L::Mul(T, Z), a));
+				a = L::Select(L::Less(AbsX, AbsY), L::Sub(L::Set(Pi * 0.5f), a), a);
+				a = L::Select(L::Less(argX, L::Set(0.f)), L::Sub(L::Set(Pi), a), a);
+				return L::CopySign(a, argY);
+			}
+
+			/**
+			 *	@fn			ExpLanes
+			 *	@brief		e^x = 2^n * e^rに分け、e^r(|r| <= ln2 / 2)を多項式で近似する
+			 */
+			template<typename L>
+			inline static typename L::Reg ExpLanes(typename L::Reg argX)
+			{
+				using Reg = typename L::Reg;
+				// 2^nが正規化数に収まる範囲に丸める(NaNは範囲の端になるので、最後にNaNへ戻す)
+				const Reg X = L::Min(L::Max(argX, L::Set(-87.33654f)), L::Set(88.0296f));
+				const Reg N = L::Round(L::Mul(X, L::Set(1.44269504088896341f)));
+
+				Reg r, p;
+				if constexpr (P == ePrecision::Full)
+				{
+					static constexpr float Coef[] = { 1.0000000321650326f, 4.999999420901572e-1f, 1.6666431262688455e-1f, 4.166800204343293e-2f, 8.374155306872511e-3f, 1.3843653064532437e-3f };
+					r = L::Sub(X, L::Mul(N, L::Set(0.693359375f)));
+					r = L::Sub(r, L::Mul(N, L::Set(-2.12194440e-4f)));
+					p = Polynomial<L>(r, Coef);
+				}
+				else
+				{
+					static constexpr float Coef[] = { 9.999668365262403e-1f, 5.000301364957289e-1f, 1.6787473362119812e-1f, 4.151384712620628e-2f };
+					r = L::Sub(X, L::Mul(N, L::Set(0.693147180559945309f)));
+					p = Polynomial<L>(r, Coef);
+				}
+				return L::Select(L::IsNaN(argX), argX, L::Mul(L::Add(L::Set(1.f), L::Mul(r, p)), L::Pow2i(N)));
+			}
+
+			/**
+			 *	@fn			LogLanes
+			 *	@brief		x = 2^e * m(√0.5 <= m < √2)に分け、log(m)を多項式で近似する
+			 */
+			template<typename L>
+			inline static typename L::Reg LogLanes(typename L::Reg argX)
+			{
+				using Reg = typename L::Reg;
+				Reg e;
+				Reg m = L::SplitExponent(argX, &e);
+				const typename L::Mask Large = L::GreaterEqual(m, L::Set(1.41421356237309505f));
+				m = L::Select(Large, L::Mul(m, L::Set(0.5f)), m);
+				e = L::Select(Large, L::Add(e, L::Set(1.f)), e);
+
+				// log(1 + f) = f - f^2 / 2 + f^3 * P(f)
+				const Reg F = L::Sub(m, L::Set(1.f));
+				const Reg F2 = L::Mul(F, F);
+				Reg p;
+				if constexpr (P == ePrecision::Full)
+				{
+					static constexpr float Coef[] = { 3.3334165915863645e-1f, -2.5001698739647576e-1f, 1.9954875747248324e-1f, -1.656442562878967e-1f, 1.497799287846074e-1f, -1.437900826803219e-1f, 8.672187838792801e-2f };
+					p = Polynomial<L>(F, Coef);
+				}
+				else
+				{
+					static constexpr float Coef[] = { 3.327248730797751e-1f, -2.5252152919766613e-1f, 2.1924386145243616e-1f, -1.4702436134731478e-1f };
+					p = Polynomial<L>(F, Coef);
+				}
+				// ln2も2つに分けて、指数の項の丸め誤差を小さくする
+				Reg result = L::Mul(L::Mul(F2, F), p);
+				result = L::Add(result, L::Mul(e, L::Set(-2.12194440e-4f)));
+				result = L::Sub(result, L::Mul(L::Set(0.5f), F2));
+				result = L::Add(result, F);
+				return L::Add(result, L::Mul(e, L::Set(0.693359375f)));
+			}
+
+			/**
+			 *	@fn			RsqrtLanes
+			 *	@brief		Fullは1 / sqrt(x)、Fastはビット演算の初期値にニュートン法を2回適用する
+			 */
+			template<typename L>
+			inline static typename L::Reg RsqrtLanes(typename L::Reg argX)
+			{
+				if constexpr (P == ePrecision::Full)
+				{
+					return L::Div(L::Set(1.f), L::Sqrt(argX));
+				}
+				else
+				{
+					const typename L::Reg HalfX = L::Mul(L::Set(0.5f), argX);
+					typename L::Reg y = L::RsqrtEstimate(argX);
+					for (int i = 0; i < 2; ++i)
+						y = L::Mul(y, L::Sub(L::Set(1.5f), L::Mul(L::Mul(HalfX, y), y)));
+					return y;
+				}
+			}
+
+		private:
+			/**
+			 *	@fn			Polynomial
+			 *	@brief		係数の低い次数から順に並べた多項式をホーナー法で計算する
+			 */
+			template<typename L, size_t N>
+			inline static typename L::Reg Polynomial(typename L::Reg argX, const float (&argCoef)[N])
+			{
+				typename L::Reg result = L::Set(argCoef[N - 1]);
+				for (size_t i = N - 1; i > 0; --i)
+					result = L::Add(L::Mul(result, argX), L::Set(argCoef[i - 1]));
+				return result;
+			}
+		};
+
+		extern template class FastMath<ePrecision::Full>;
+		extern template class FastMath<ePrecision::Fast>;
+	}
+}
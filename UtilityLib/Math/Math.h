@@ -13,7 +13,7 @@
 #include "Vector4f.h"
 
 #include <algorithm>
-#include <windows.h>
+#include <cstdint>
 
 namespace Utility
 {
@@ -47,26 +47,29 @@ namespace Utility
 		/**
 		 *	@fn			XorShift
 		 *	@brief		疑似乱数生成アルゴリズム。演算が排他的論理和とシフトだけなので高速。
+		 *	@note		状態はスレッドごとに持つ。シードを指定する場合や大量に生成する場合はRandom.hの生成器を使う
+		 *				右シフトはこれまでの数列を変えないように符号付き(算術シフト)のまま行う
 		 *	@return		生成した疑似乱数
 		 */
 		inline int XorShift()
 		{
-			static int x = 123456789, y = 362436069, z = 521288629, w = 88675123;
-			int t = (x ^ (x << 11));
+			thread_local uint32_t x = 123456789, y = 362436069, z = 521288629, w = 88675123;
+			uint32_t t = (x ^ (x << 11));
 			x = y;
 			y = z;
 			z = w;
-			return w = (w ^ (w >> 19)) ^ (t ^ (t >> 8));
+			w = (w ^ static_cast<uint32_t>(static_cast<int>(w) >> 19)) ^ (t ^ static_cast<uint32_t>(static_cast<int>(t) >> 8));
+			return static_cast<int>(w);
 		}
 		/**
 		*	@fn			Rang
-		*	@brief		疑似乱数生成
-		*	@param[in]	argAngle	!<	シードにしたい角度
+		*	@brief		-argAngle～argAngleの疑似乱数生成
+		*	@param[in]	argAngle	!<	乱数の幅にしたい角度
 		*	@return		生成した疑似乱数
 		*/
 		inline double Rang(double argAngle)
 		{
-			return (-argAngle + static_cast<int>(argAngle) * 2 * XorShift() % (10000 / 10000));
+			return -argAngle + argAngle * 2.0 * (static_cast<uint32_t>(XorShift()) % 10000) / 10000.0;
 		}
 		/**
 		 *	@fn			Clamp
@@ -103,11 +106,13 @@ namespace Utility
 		/**
 		 *	@fn			LoadRect
 		 *	@brief		レクト型からXMVectorへの変換
-		 *	@param[in]	argRect	!<	XMVectorに変換したい値
+		 *	@param[in]	argRect	!<	XMVectorに変換したい値(RECTと同じ並びのleft, top, right, bottomを持つ型)
 		 *	@return		XMvectorに変換したRect型の値
 		 */
-		inline XMVector LoadRect(RECT const* argRect)
+		template<typename TRect>
+		inline XMVector LoadRect(TRect const* argRect)
 		{
+			static_assert(sizeof(TRect) == sizeof(int32_t) * 4, "LoadRect needs a RECT layout (left, top, right, bottom)...");
 			XMVector vec = DirectX::XMLoadInt4(reinterpret_cast<uint32_t const*>(argRect));
 
 			vec = DirectX::XMConvertVectorIntToFloat(vec, 0);
@@ -0,0 +1,143 @@
+﻿/**
+ *	@file	MathConfig.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+/*
+ *	DirectXMathの命令セットの選択
+ *	DirectXMathはSSE2/SSE4/AVX/AVX2/NEONとスカラーの実装を持つヘッダーだけのライブラリなので、
+ *	Linux(GCC/Clang)でも同じUtility::Mathをそのままコンパイルできる。
+ *	ライブラリ内ではDirectXMath.hを直接インクルードせず、必ずこのヘッダーを経由すること
+ *	(翻訳単位ごとに命令セットが変わるとインライン関数の中身が食い違う)。
+ *
+ *	命令セットはコンパイラの指定(/arch:AVX2、-mavx2、-msse4.1など)から選ぶ。
+ *	UTILITY_MATH_NO_INTRINSICS		!<	命令セットを使わずスカラーで計算する
+ *	UTILITY_MATH_BIT_COMPATIBLE		!<	x86/x64はSSE2まで(Windowsの既定と同じ)に抑え、それ以外はスカラーで計算する
+ *
+ *	x64の既定(SSE2)同士ならWindowsとLinuxで結果はビット単位で一致する。
+ *	SSE4の内積命令、AVX2のFMA、NEON、スカラーは丸めや近似命令の精度が違うので一致は保証しない。
+ *	GCC/Clangでは-ffp-contract=offを指定しないと、スカラーの計算がFMAに置き換わることがある。
+ *	Tests/CMakeLists.txtは命令セットごとの結果をSSE2(Windowsの既定)の結果と比べる。
+ *
+ *	Collisionの判定もWindows以外でコンパイルできる(Shape2Dの矩形はShapeRect)。
+ *	ただしTriangleBvh::LoadのようにArchive/Loaderを使う読み込みと、描画・入力・音はWindowsだけ。
+ */
+#if defined(UTILITY_MATH_BIT_COMPATIBLE)
+#	if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#		if defined(__AVX__) || defined(__SSE4_1__)
+#			error "UTILITY_MATH_BIT_COMPATIBLE requires an SSE2 target (no /arch:AVX, -mavx or -msse4.1)..."
+#		endif
+#	elif !defined(UTILITY_MATH_NO_INTRINSICS)
+#		define UTILITY_MATH_NO_INTRINSICS
+#	endif
+#endif
+
+#if defined(DIRECTX_MATH_VERSION)
+// 先にDirectXMath.hがインクルードされていたら、選択が食い違っていないかだけ調べる
+#	if defined(UTILITY_MATH_NO_INTRINSICS) && !defined(_XM_NO_INTRINSICS_)
+#		error "DirectXMath.h was included with intrinsics before MathConfig.h..."
+#	endif
+#else
+#	if defined(UTILITY_MATH_NO_INTRINSICS)
+#		define _XM_NO_INTRINSICS_
+#	elif defined(__AVX2__)
+#		define _XM_AVX2_INTRINSICS_	// FMA3とF16Cも有効になる
+#	elif defined(__AVX__)
+#		define _XM_AVX_INTRINSICS_
+#	elif defined(__SSE4_1__)
+#		define _XM_SSE4_INTRINSICS_
+#	elif defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+		// SSE2はDirectXMathが既定で使う
+#	elif defined(_M_ARM) || defined(_M_ARM64) || defined(__aarch64__) || defined(__ARM_NEON)
+#		define _XM_ARM_NEON_INTRINSICS_
+#	else
+#		define _XM_NO_INTRINSICS_
+#	endif
+#endif
+
+#if !defined(_MSC_VER)
+// DirectXMathが使うSALの注釈(Windows以外では意味を持たない)
+#	if defined(__has_include)
+#		if __has_include(<sal.h>)
+#			include <sal.h>
+#		endif
+#	endif
+#	ifndef _In_
+#		define _In_
+#	endif
+#	ifndef _In_opt_
+#		define _In_opt_
+#	endif
+#	ifndef _In_reads_
+#		define _In_reads_(size)
+#	endif
+#	ifndef _In_reads_bytes_
+#		define _In_reads_bytes_(size)
+#	endif
+#	ifndef _In_range_
+#		define _In_range_(low, high)
+#	endif
+#	ifndef _Out_
+#		define _Out_
+#	endif
+#	ifndef _Out_opt_
+#		define _Out_opt_
+#	endif
+#	ifndef _Out_writes_
+#		define _Out_writes_(size)
+#	endif
+#	ifndef _Out_writes_bytes_
+#		define _Out_writes_bytes_(size)
+#	endif
+#	ifndef _Inout_
+#		define _Inout_
+#	endif
+#	ifndef _Success_
+#		define _Success_(expr)
+#	endif
+#	ifndef _Analysis_assume_
+#		define _Analysis_assume_(expr)
+#	endif
+#	ifndef _Use_decl_annotations_
+#		define _Use_decl_annotations_
+#	endif
+#endif
+
+#include <DirectXMath.h>
+
+namespace Utility
+{
+	namespace Math
+	{
+		/**
+		 *  @enum		eSimd
+		 *  @brief		数学ライブラリが使っている命令セット
+		 */
+		enum class eSimd
+		{
+			Scalar,
+			SSE2,
+			SSE4,
+			AVX,
+			AVX2,
+			NEON,
+		};
+
+#if defined(_XM_NO_INTRINSICS_)
+		constexpr eSimd ActiveSimd = eSimd::Scalar;
+#elif defined(_XM_AVX2_INTRINSICS_)
+		constexpr eSimd ActiveSimd = eSimd::AVX2;
+#elif defined(_XM_AVX_INTRINSICS_)
+		constexpr eSimd ActiveSimd = eSimd::AVX;
+#elif defined(_XM_SSE4_INTRINSICS_)
+		constexpr eSimd ActiveSimd = eSimd::SSE4;
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+		constexpr eSimd ActiveSimd = eSimd::NEON;
+#else
+		constexpr eSimd ActiveSimd = eSimd::SSE2;
+#endif
+	}
+}
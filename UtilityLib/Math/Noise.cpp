@@ -0,0 +1,694 @@
+﻿/**
+ *	@file	Noise.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "Noise.h"
+#include "SimdLanes.h"
+
+#include <type_traits>
+#include <assert.h>
+
+// 命令セットによらずビット単位で同じ結果にするため、a * b + cをFMAにまとめさせない(/arch:AVX2や-mfmaでも1点ずつの版と揃える)
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace
+{
+	using Utility::Math::eNoiseType;
+
+#pragma region		Lanes
+	/*
+	 *	SimdLanesに格子点のハッシュを作るための32bit整数の演算を足したもの。
+	 *	IRegは32bit整数の要素、IMaskはその比較結果。ToMask、ToIMaskで浮動小数点の比較結果と行き来する。
+	 */
+
+	/**
+	 *  @struct		ScalarNoiseLanes
+	 *  @brief		1要素ずつの演算
+	 */
+	struct ScalarNoiseLanes : public Utility::Math::Simd::ScalarLanes
+	{
+		using IReg = std::int32_t;
+		using IMask = bool;
+
+		static inline IReg SetInt(std::int32_t argValue) { return argValue; }
+		// 符号付きの桁あふれを避けるため、符号無しで計算する
+		static inline IReg AddInt(IReg argA, IReg argB) { return static_cast<IReg>(static_cast<std::uint32_t>(argA) + static_cast<std::uint32_t>(argB)); }
+		static inline IReg MulInt(IReg argA, IReg argB) { return static_cast<IReg>(static_cast<std::uint32_t>(argA) * static_cast<std::uint32_t>(argB)); }
+		static inline IReg And(IReg argA, IReg argB) { return argA & argB; }
+		static inline IReg Or(IReg argA, IReg argB) { return argA | argB; }
+		static inline IReg Xor(IReg argA, IReg argB) { return argA ^ argB; }
+		template<int N> static inline IReg ShiftRight(IReg argValue) { return static_cast<IReg>(static_cast<std::uint32_t>(argValue) >> N); }
+		static inline IMask GreaterInt(IReg argA, IReg argB) { return argA > argB; }
+		static inline IMask EqualInt(IReg argA, IReg argB) { return argA == argB; }
+		static inline IReg SelectInt(IMask argMask, IReg argTrue, IReg argFalse) { return argMask ? argTrue : argFalse; }
+		static inline Mask ToMask(IMask argMask) { return argMask; }
+		static inline IMask ToIMask(Mask argMask) { return argMask; }
+
+		static inline Reg ToFloat(IReg argValue) { return static_cast<Reg>(argValue); }
+		// cvtps2dqで丸めてから、大きくなった要素を1減らす
+		static inline IReg Floor(Reg argValue)
+		{
+			const IReg Rounded = static_cast<IReg>(Round(argValue));
+			return (argValue < static_cast<Reg>(Rounded)) ? Rounded - 1 : Rounded;
+		}
+		/**
+		 *	@fn			FlipSign
+		 *	@brief		argBitsのNビット目が立っている要素の符号を反転する
+		 */
+		template<int N> static inline Reg FlipSign(Reg argValue, IReg argBits) { return ((argBits >> N) & 1) ? -argValue : argValue; }
+	};
+
+#if defined(UTILITY_MATH_LANES_AVX2)
+	/**
+	 *  @struct		Avx2NoiseLanes
+	 *  @brief		8要素ずつの演算
+	 */
+	struct Avx2NoiseLanes : public Utility::Math::Simd::Avx2Lanes
+	{
+		using IReg = __m256i;
+		using IMask = __m256i;
+
+		static inline IReg SetInt(std::int32_t argValue) { return _mm256_set1_epi32(argValue); }
+		static inline IReg AddInt(IReg argA, IReg argB) { return _mm256_add_epi32(argA, argB); }
+		static inline IReg MulInt(IReg argA, IReg argB) { return _mm256_mullo_epi32(argA, argB); }
+		static inline IReg And(IReg argA, IReg argB) { return _mm256_and_si256(argA, argB); }
+		static inline IReg Or(IReg argA, IReg argB) { return _mm256_or_si256(argA, argB); }
+		static inline IReg Xor(IReg argA, IReg argB) { return _mm256_xor_si256(argA, argB); }
+		template<int N> static inline IReg ShiftRight(IReg argValue) { return _mm256_srli_epi32(argValue, N); }
+		static inline IMask GreaterInt(IReg argA, IReg argB) { return _mm256_cmpgt_epi32(argA, argB); }
+		static inline IMask EqualInt(IReg argA, IReg argB) { return _mm256_cmpeq_epi32(argA, argB); }
+		static inline IReg SelectInt(IMask argMask, IReg argTrue, IReg argFalse) { return _mm256_blendv_epi8(argFalse, argTrue, argMask); }
+		static inline Mask ToMask(IMask argMask) { return _mm256_castsi256_ps(argMask); }
+		static inline IMask ToIMask(Mask argMask) { return _mm256_castps_si256(argMask); }
+
+		static inline Reg ToFloat(IReg argValue) { return _mm256_cvtepi32_ps(argValue); }
+		static inline IReg Floor(Reg argValue)
+		{
+			const IReg Rounded = _mm256_cvtps_epi32(argValue);
+			return _mm256_add_epi32(Rounded, _mm256_castps_si256(_mm256_cmp_ps(argValue, _mm256_cvtepi32_ps(Rounded), _CMP_LT_OQ)));
+		}
+		template<int N> static inline Reg FlipSign(Reg argValue, IReg argBits)
+		{
+			return _mm256_xor_ps(argValue, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(argBits, _mm256_set1_epi32(1 << N)), 31 - N)));
+		}
+	};
+	using WideNoiseLanes = Avx2NoiseLanes;
+#elif defined(UTILITY_MATH_LANES_SSE2)
+	/**
+	 *  @struct		Sse2NoiseLanes
+	 *  @brief		4要素ずつの演算
+	 */
+	struct Sse2NoiseLanes : public Utility::Math::Simd::Sse2Lanes
+	{
+		using IReg = __m128i;
+		using IMask = __m128i;
+
+		static inline IReg SetInt(std::int32_t argValue) { return _mm_set1_epi32(argValue); }
+		static inline IReg AddInt(IReg argA, IReg argB) { return _mm_add_epi32(argA, argB); }
+		// SSE2には32bitの積の下位を取る命令がないので、偶数と奇数の要素に分けて64bitの積を取る
+		static inline IReg MulInt(IReg argA, IReg argB)
+		{
+			const __m128i Even = _mm_mul_epu32(argA, argB);
+			const __m128i Odd = _mm_mul_epu32(_mm_srli_si128(argA, 4), _mm_srli_si128(argB, 4));
+			return _mm_unpacklo_epi32(_mm_shuffle_epi32(Even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(Odd, _MM_SHUFFLE(0, 0, 2, 0)));
+		}
+		static inline IReg And(IReg argA, IReg argB) { return _mm_and_si128(argA, argB); }
+		static inline IReg Or(IReg argA, IReg argB) { return _mm_or_si128(argA, argB); }
+		static inline IReg Xor(IReg argA, IReg argB) { return _mm_xor_si128(argA, argB); }
+		template<int N> static inline IReg ShiftRight(IReg argValue) { return _mm_srli_epi32(argValue, N); }
+		static inline IMask GreaterInt(IReg argA, IReg argB) { return _mm_cmpgt_epi32(argA, argB); }
+		static inline IMask EqualInt(IReg argA, IReg argB) { return _mm_cmpeq_epi32(argA, argB); }
+		static inline IReg SelectInt(IMask argMask, IReg argTrue, IReg argFalse) { return _mm_or_si128(_mm_and_si128(argMask, argTrue), _mm_andnot_si128(argMask, argFalse)); }
+		static inline Mask ToMask(IMask argMask) { return _mm_castsi128_ps(argMask); }
+		static inline IMask ToIMask(Mask argMask) { return _mm_castps_si128(argMask); }
+
+		static inline Reg ToFloat(IReg argValue) { return _mm_cvtepi32_ps(argValue); }
+		static inline IReg Floor(Reg argValue)
+		{
+			const IReg Rounded = _mm_cvtps_epi32(argValue);
+			return _mm_add_epi32(Rounded, _mm_castps_si128(_mm_cmplt_ps(argValue, _mm_cvtepi32_ps(Rounded))));
+		}
+		template<int N> static inline Reg FlipSign(Reg argValue, IReg argBits)
+		{
+			return _mm_xor_ps(argValue, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(argBits, _mm_set1_epi32(1 << N)), 31 - N)));
+		}
+	};
+	using WideNoiseLanes = Sse2NoiseLanes;
+#else
+	using WideNoiseLanes = ScalarNoiseLanes;
+#endif
+#pragma endregion	Lanes
+
+#pragma region		Basis
+	// 軸ごとに格子の座標に掛ける値(xorで合わせてからMixで混ぜる)
+	const std::uint32_t AxisPrimes[4] = { 0x8da6b343u, 0xd8163841u, 0xcb1ab31fu, 0x165667b1u };
+	// オクターブごとにシードに足す値
+	const std::uint32_t OctaveSeedStep = 0x9e3779b9u;
+
+	// 値がおおよそ[-1, 1]になるように掛ける値(次元ごと。山登りで探した絶対値の最大値の逆数)
+	const float PerlinScale[5] = { 0.f, 0.f, 1.323f, 0.965f, 0.817f };
+	const float SimplexScale[5] = { 0.f, 0.f, 90.46f, 76.88f, 62.77f };
+
+	/**
+	 *	@fn			Mix
+	 *	@brief		32bitのハッシュの仕上げ(lowbias32)
+	 */
+	template<typename L>
+	inline typename L::IReg Mix(typename L::IReg argValue)
+	{
+		argValue = L::Xor(argValue, L::template ShiftRight<16>(argValue));
+		argValue = L::MulInt(argValue, L::SetInt(0x7feb352d));
+		argValue = L::Xor(argValue, L::template ShiftRight<15>(argValue));
+		argValue = L::MulInt(argValue, L::SetInt(static_cast<std::int32_t>(0x846ca68bu)));
+		return L::Xor(argValue, L::template ShiftRight<16>(argValue));
+	}
+
+	template<typename L>
+	inline typename L::Reg Fade(typename L::Reg argT)
+	{
+		// 6t^5 - 15t^4 + 10t^3
+		const typename L::Reg Inner = L::Add(L::Mul(argT, L::Sub(L::Mul(argT, L::Set(6.f)), L::Set(15.f))), L::Set(10.f));
+		return L::Mul(L::Mul(L::Mul(argT, argT), argT), Inner);
+	}
+
+	template<typename L>
+	inline typename L::Reg Lerp(typename L::Reg argA, typename L::Reg argB, typename L::Reg argT)
+	{
+		return L::Add(argA, L::Mul(argT, L::Sub(argB, argA)));
+	}
+
+	/**
+	 *	@fn			Gradient
+	 *	@brief		ハッシュで選んだ勾配とargPの内積
+	 *	@note		2次元は(1, 0.5)と(0.5, 1)の符号違いの8方向、3次元は立方体の辺の中点12方向(Perlinのimproved noiseと同じ)、
+	 *				4次元は1成分が0で残りが±1の32方向
+	 */
+	template<typename L, size_t Dim>
+	inline typename L::Reg Gradient(typename L::IReg argHash, const typename L::Reg *argP)
+	{
+		using IReg = typename L::IReg;
+		if constexpr (Dim == 2)
+		{
+			const typename L::Mask Swap = L::ToMask(L::EqualInt(L::And(argHash, L::SetInt(4)), L::SetInt(4)));
+			const typename L::Reg U = L::Select(Swap, argP[1], argP[0]);
+			const typename L::Reg V = L::Select(Swap, argP[0], argP[1]);
+			return L::Add(L::template FlipSign<0>(U, argHash), L::Mul(L::template FlipSign<1>(V, argHash), L::Set(0.5f)));
+		}
+		else if constexpr (Dim == 3)
+		{
+			const IReg H = L::And(argHash, L::SetInt(15));
+			const typename L::Reg U = L::Select(L::ToMask(L::GreaterInt(L::SetInt(8), H)), argP[0], argP[1]);
+			const typename L::Reg XZ = L::Select(L::ToMask(L::EqualInt(L::Or(H, L::SetInt(2)), L::SetInt(14))), argP[0], argP[2]);
+			const typename L::Reg V = L::Select(L::ToMask(L::GreaterInt(L::SetInt(4), H)), argP[1], XZ);
+			return L::Add(L::template FlipSign<0>(U, argHash), L::template FlipSign<1>(V, argHash));
+		}
+		else
+		{
+			static_assert(Dim == 4, "Gradient supports 2 to 4 dimensions...");
+			// 0にする成分
+			const IReg Skip = L::And(L::template ShiftRight<3>(argHash), L::SetInt(3));
+			const typename L::Reg A = L::Select(L::ToMask(L::EqualInt(Skip, L::SetInt(0))), argP[1], argP[0]);
+			const typename L::Reg B = L::Select(L::ToMask(L::GreaterInt(L::SetInt(2), Skip)), argP[2], argP[1]);
+			const typename L::Reg C = L::Select(L::ToMask(L::GreaterInt(L::SetInt(3), Skip)), argP[3], argP[2]);
+			return L::Add(L::Add(L::template FlipSign<0>(A, argHash), L::template FlipSign<1>(B, argHash)), L::template FlipSign<2>(C, argHash));
+		}
+	}
+
+	/**
+	 *	@fn			LatticeNoise
+	 *	@brief		格子の2^Dim個の頂点の値をフェード関数で補間する
+	 *	@tparam		IsGradient	!<	trueならPerlin(勾配との内積)、falseならValue(ハッシュから作った[-1, 1)の値)
+	 */
+	template<typename L, size_t Dim, bool IsGradient>
+	inline typename L::Reg LatticeNoise(typename L::IReg argSeed, const typename L::Reg *argP)
+	{
+		using Reg = typename L::Reg;
+		using IReg = typename L::IReg;
+		const size_t CornerCount = static_cast<size_t>(1) << Dim;
+
+		IReg cell[Dim][2];
+		Reg offset[Dim][2];
+		Reg fade[Dim];
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			const IReg Floor = L::Floor(argP[d]);
+			const IReg Prime = L::SetInt(static_cast<std::int32_t>(AxisPrimes[d]));
+			cell[d][0] = L::MulInt(Floor, Prime);
+			cell[d][1] = L::AddInt(cell[d][0], Prime);
+			offset[d][0] = L::Sub(argP[d], L::ToFloat(Floor));
+			offset[d][1] = L::Sub(offset[d][0], L::Set(1.f));
+			fade[d] = Fade<L>(offset[d][0]);
+		}
+
+		// 頂点の番号のdビット目がd軸の+1側
+		Reg corner[CornerCount];
+		for (size_t c = 0; c < CornerCount; ++c)
+		{
+			IReg hash = argSeed;
+			Reg p[Dim];
+			for (size_t d = 0; d < Dim; ++d)
+			{
+				const size_t Side = (c >> d) & 1;
+				hash = L::Xor(hash, cell[d][Side]);
+				p[d] = offset[d][Side];
+			}
+			hash = Mix<L>(hash);
+			if constexpr (IsGradient)
+				corner[c] = Gradient<L, Dim>(hash, p);
+			else
+				corner[c] = L::Sub(L::Mul(L::ToFloat(L::template ShiftRight<8>(hash)), L::Set(1.f / 8388608.f)), L::Set(1.f));
+		}
+
+		// x軸から順に半分ずつ補間していく
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			const size_t Count = CornerCount >> (d + 1);
+			for (size_t c = 0; c < Count; ++c)
+				corner[c] = Lerp<L>(corner[c * 2], corner[c * 2 + 1], fade[d]);
+		}
+		return corner[0];
+	}
+
+	/**
+	 *	@fn			SimplexNoise
+	 *	@brief		単体のDim + 1個の頂点の寄与を足し合わせる(Gustavsonの方法をDim次元に一般化したもの)
+	 *	@note		寄与の半径の2乗は0.5(単体の外に寄与が漏れないので不連続にならない)
+	 */
+	template<typename L, size_t Dim>
+	inline typename L::Reg SimplexNoise(typename L::IReg argSeed, const typename L::Reg *argP)
+	{
+		using Reg = typename L::Reg;
+		using IReg = typename L::IReg;
+		// 立方格子へ歪める係数と、単体の格子へ戻す係数
+		const float Root = std::sqrt(static_cast<float>(Dim + 1));
+		const float Skew = (Root - 1.f) / static_cast<float>(Dim);
+		const float Unskew = (1.f - 1.f / Root) / static_cast<float>(Dim);
+
+		Reg sum = argP[0];
+		for (size_t d = 1; d < Dim; ++d)
+			sum = L::Add(sum, argP[d]);
+		const Reg S = L::Mul(sum, L::Set(Skew));
+
+		IReg cell[Dim];
+		IReg cellSum = L::SetInt(0);
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			cell[d] = L::Floor(L::Add(argP[d], S));
+			cellSum = L::AddInt(cellSum, cell[d]);
+		}
+		const Reg T = L::Mul(L::ToFloat(cellSum), L::Set(Unskew));
+
+		Reg origin[Dim];
+		IReg hash[Dim][2];
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			origin[d] = L::Sub(argP[d], L::Sub(L::ToFloat(cell[d]), T));
+			const IReg Prime = L::SetInt(static_cast<std::int32_t>(AxisPrimes[d]));
+			hash[d][0] = L::MulInt(cell[d], Prime);
+			hash[d][1] = L::AddInt(hash[d][0], Prime);
+		}
+
+		// 単体内の座標の大きい順に頂点を進める(同じ値なら軸の番号が小さい方を先にする)
+		const Reg Zero = L::Set(0.f);
+		const Reg One = L::Set(1.f);
+		Reg rank[Dim];
+		for (size_t d = 0; d < Dim; ++d)
+			rank[d] = Zero;
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			for (size_t e = d + 1; e < Dim; ++e)
+			{
+				rank[d] = L::Add(rank[d], L::Select(L::GreaterEqual(origin[d], origin[e]), One, Zero));
+				rank[e] = L::Add(rank[e], L::Select(L::Less(origin[d], origin[e]), One, Zero));
+			}
+		}
+
+		Reg result = Zero;
+		for (size_t k = 0; k <= Dim; ++k)
+		{
+			// k番目の頂点はrankが大きいk軸を+1した点
+			const Reg Threshold = L::Set(static_cast<float>(Dim - k));
+			const Reg Offset = L::Set(Unskew * static_cast<float>(k));
+			IReg h = argSeed;
+			Reg p[Dim];
+			Reg attenuation = L::Set(0.5f);
+			for (size_t d = 0; d < Dim; ++d)
+			{
+				const typename L::Mask Advance = L::GreaterEqual(rank[d], Threshold);
+				h = L::Xor(h, L::SelectInt(L::ToIMask(Advance), hash[d][1], hash[d][0]));
+				p[d] = L::Add(L::Sub(origin[d], L::Select(Advance, One, Zero)), Offset);
+				attenuation = L::Sub(attenuation, L::Mul(p[d], p[d]));
+			}
+			attenuation = L::Max(attenuation, Zero);
+			attenuation = L::Mul(attenuation, attenuation);
+			result = L::Add(result, L::Mul(L::Mul(attenuation, attenuation), Gradient<L, Dim>(Mix<L>(h), p)));
+		}
+		return result;
+	}
+
+	/**
+	 *	@fn			Basis
+	 *	@brief		種類を指定したノイズ1オクターブ分
+	 */
+	template<eNoiseType T, typename L, size_t Dim>
+	inline typename L::Reg Basis(typename L::IReg argSeed, const typename L::Reg *argP)
+	{
+		if constexpr (T == eNoiseType::Value)
+			return LatticeNoise<L, Dim, false>(argSeed, argP);
+		else if constexpr (T == eNoiseType::Perlin)
+			return L::Mul(LatticeNoise<L, Dim, true>(argSeed, argP), L::Set(PerlinScale[Dim]));
+		else
+			return L::Mul(SimplexNoise<L, Dim>(argSeed, argP), L::Set(SimplexScale[Dim]));
+	}
+#pragma endregion	Basis
+
+#pragma region		Fractal
+	/**
+	 *  @struct		Octaves
+	 *  @brief		NoiseSettingsから作ったオクターブの重ね方
+	 */
+	struct Octaves
+	{
+		std::uint32_t	count;
+		float			frequency;
+		float			lacunarity;
+		float			gain;
+		float			normalize;	//	!<	振幅の合計の逆数
+		bool			isRidged;
+	};
+
+	inline Octaves MakeOctaves(const Utility::Math::NoiseSettings &argSettings)
+	{
+		assert(argSettings.octaves >= 1 && "NoiseSettings::octaves must be at least 1...");
+		float total = 0.f;
+		float amplitude = 1.f;
+		for (std::uint32_t i = 0; i < argSettings.octaves; ++i)
+		{
+			total += amplitude;
+			amplitude *= argSettings.gain;
+		}
+		assert(total > 0.f && "NoiseSettings::gain makes the total amplitude zero...");
+		return { argSettings.octaves, argSettings.frequency, argSettings.lacunarity, argSettings.gain, 1.f / total, argSettings.fractal == Utility::Math::eFractal::Ridged };
+	}
+
+	/**
+	 *	@fn			FractalNoise
+	 *	@brief		オクターブを重ねた値
+	 */
+	template<eNoiseType T, typename L, size_t Dim>
+	inline typename L::Reg FractalNoise(const Octaves &argOctaves, std::uint32_t argSeed, const typename L::Reg *argP)
+	{
+		using Reg = typename L::Reg;
+		Reg sum = L::Set(0.f);
+		float frequency = argOctaves.frequency;
+		float amplitude = 1.f;
+		std::uint32_t seed = argSeed;
+		for (std::uint32_t i = 0; i < argOctaves.count; ++i)
+		{
+			Reg p[Dim];
+			for (size_t d = 0; d < Dim; ++d)
+				p[d] = L::Mul(argP[d], L::Set(frequency));
+
+			Reg value = Basis<T, L, Dim>(L::SetInt(static_cast<std::int32_t>(seed)), p);
+			if (argOctaves.isRidged)
+			{
+				value = L::Sub(L::Set(1.f), L::Abs(value));
+				value = L::Mul(value, value);
+			}
+			sum = L::Add(sum, L::Mul(value, L::Set(amplitude)));
+
+			frequency *= argOctaves.lacunarity;
+			amplitude *= argOctaves.gain;
+			seed += OctaveSeedStep;
+		}
+		return L::Mul(sum, L::Set(argOctaves.normalize));
+	}
+
+	/**
+	 *	@fn			ForType
+	 *	@brief		種類をテンプレート引数にして呼ぶ(argFuncはstd::integral_constant<eNoiseType, T>を受け取る)
+	 */
+	template<typename Func>
+	inline void ForType(eNoiseType argType, const Func &argFunc)
+	{
+		switch (argType)
+		{
+		case eNoiseType::Value:
+			argFunc(std::integral_constant<eNoiseType, eNoiseType::Value>());
+			break;
+		case eNoiseType::Perlin:
+			argFunc(std::integral_constant<eNoiseType, eNoiseType::Perlin>());
+			break;
+		case eNoiseType::Simplex:
+			argFunc(std::integral_constant<eNoiseType, eNoiseType::Simplex>());
+			break;
+		default:
+			assert(false && "Unknown noise type...");
+			break;
+		}
+	}
+#pragma endregion	Fractal
+
+#pragma region		Kernel
+	/*
+	 *	各カーネルはApply<Lanes>(i)でi番目からLanes::Width個を処理する。
+	 */
+
+	/**
+	 *  @struct		EvaluateKernel
+	 *  @brief		成分ごとの配列で渡した点
+	 */
+	template<eNoiseType T, size_t Dim>
+	struct EvaluateKernel
+	{
+		const float		*src_[Dim];
+		float			*dst_;
+		Octaves			octaves_;
+		std::uint32_t	seed_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			typename L::Reg p[Dim];
+			for (size_t d = 0; d < Dim; ++d)
+				p[d] = L::Load(src_[d] + argIndex);
+			L::Store(dst_ + argIndex, FractalNoise<T, L, Dim>(octaves_, seed_, p));
+		}
+	};
+
+	/**
+	 *  @struct		GridKernel
+	 *  @brief		等間隔の格子の点
+	 */
+	template<eNoiseType T, size_t Dim>
+	struct GridKernel
+	{
+		float			*dst_;
+		size_t			size_[Dim];
+		float			origin_[Dim];
+		float			step_[Dim];
+		Octaves			octaves_;
+		std::uint32_t	seed_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			// 行の途中で折り返すことがあるので、座標は要素ごとに作る
+			float coordinate[Dim][L::Width];
+			for (size_t i = 0; i < L::Width; ++i)
+			{
+				size_t index = argIndex + i;
+				for (size_t d = 0; d < Dim; ++d)
+				{
+					coordinate[d][i] = origin_[d] + step_[d] * static_cast<float>(index % size_[d]);
+					index /= size_[d];
+				}
+			}
+
+			typename L::Reg p[Dim];
+			for (size_t d = 0; d < Dim; ++d)
+				p[d] = L::Load(coordinate[d]);
+			L::Store(dst_ + argIndex, FractalNoise<T, L, Dim>(octaves_, seed_, p));
+		}
+	};
+#pragma endregion	Kernel
+
+	template<eNoiseType T, typename... Coordinates>
+	inline float ScalarBasis(std::uint32_t argSeed, Coordinates... argCoordinates)
+	{
+		const float P[] = { argCoordinates... };
+		return Basis<T, ScalarNoiseLanes, sizeof...(Coordinates)>(static_cast<std::int32_t>(argSeed), P);
+	}
+
+	template<typename... Coordinates>
+	inline float ScalarFractal(const Utility::Math::NoiseSettings &argSettings, std::uint32_t argSeed, Coordinates... argCoordinates)
+	{
+		const float P[] = { argCoordinates... };
+		const Octaves Octave = MakeOctaves(argSettings);
+		float result = 0.f;
+		ForType(argSettings.type, [&](auto argType)
+		{
+			result = FractalNoise<decltype(argType)::value, ScalarNoiseLanes, sizeof...(Coordinates)>(Octave, argSeed, P);
+		});
+		return result;
+	}
+
+	template<size_t Dim>
+	void RunEvaluate(const Utility::Math::NoiseSettings &argSettings, std::uint32_t argSeed, const Utility::Span<const float> (&argSrc)[Dim], Utility::Span<float> argDst, Utility::ThreadPool *argPool)
+	{
+		const size_t Count = argSrc[0].size();
+		for (size_t d = 1; d < Dim; ++d)
+			assert(argSrc[d].size() >= Count && "Coordinate arrays differ in size...");
+		assert(argDst.size() >= Count && "Destination is too small...");
+
+		const Octaves Octave = MakeOctaves(argSettings);
+		ForType(argSettings.type, [&](auto argType)
+		{
+			EvaluateKernel<decltype(argType)::value, Dim> kernel;
+			for (size_t d = 0; d < Dim; ++d)
+				kernel.src_[d] = argSrc[d].data();
+			kernel.dst_ = argDst.data();
+			kernel.octaves_ = Octave;
+			kernel.seed_ = argSeed;
+			Utility::Math::Simd::Run<WideNoiseLanes, ScalarNoiseLanes>(kernel, Count, Utility::Math::Noise::ParallelGrain, argPool);
+		});
+	}
+
+	template<size_t Dim>
+	void RunGrid(const Utility::Math::NoiseSettings &argSettings, std::uint32_t argSeed, Utility::Span<float> argDst, const size_t (&argSize)[Dim], const float (&argOrigin)[Dim], const float (&argStep)[Dim], Utility::ThreadPool *argPool)
+	{
+		size_t count = 1;
+		for (size_t d = 0; d < Dim; ++d)
+			count *= argSize[d];
+		assert(argDst.size() >= count && "Destination is too small...");
+		if (count == 0)
+			return;
+
+		const Octaves Octave = MakeOctaves(argSettings);
+		ForType(argSettings.type, [&](auto argType)
+		{
+			GridKernel<decltype(argType)::value, Dim> kernel;
+			kernel.dst_ = argDst.data();
+			for (size_t d = 0; d < Dim; ++d)
+			{
+				kernel.size_[d] = argSize[d];
+				kernel.origin_[d] = argOrigin[d];
+				kernel.step_[d] = argStep[d];
+			}
+			kernel.octaves_ = Octave;
+			kernel.seed_ = argSeed;
+			Utility::Math::Simd::Run<WideNoiseLanes, ScalarNoiseLanes>(kernel, count, Utility::Math::Noise::ParallelGrain, argPool);
+		});
+	}
+}
+
+void Utility::Math::Noise::Seed(uint64_t argSeed)
+{
+	seed_ = static_cast<uint32_t>(argSeed ^ (argSeed >> 32));
+}
+
+#pragma region		Scalar
+float Utility::Math::Noise::Value(float argX, float argY) const
+{
+	return ScalarBasis<eNoiseType::Value>(seed_, argX, argY);
+}
+
+float Utility::Math::Noise::Value(float argX, float argY, float argZ) const
+{
+	return ScalarBasis<eNoiseType::Value>(seed_, argX, argY, argZ);
+}
+
+float Utility::Math::Noise::Value(float argX, float argY, float argZ, float argW) const
+{
+	return ScalarBasis<eNoiseType::Value>(seed_, argX, argY, argZ, argW);
+}
+
+float Utility::Math::Noise::Perlin(float argX, float argY) const
+{
+	return ScalarBasis<eNoiseType::Perlin>(seed_, argX, argY);
+}
+
+float Utility::Math::Noise::Perlin(float argX, float argY, float argZ) const
+{
+	return ScalarBasis<eNoiseType::Perlin>(seed_, argX, argY, argZ);
+}
+
+float Utility::Math::Noise::Perlin(float argX, float argY, float argZ, float argW) const
+{
+	return ScalarBasis<eNoiseType::Perlin>(seed_, argX, argY, argZ, argW);
+}
+
+float Utility::Math::Noise::Simplex(float argX, float argY) const
+{
+	return ScalarBasis<eNoiseType::Simplex>(seed_, argX, argY);
+}
+
+float Utility::Math::Noise::Simplex(float argX, float argY, float argZ) const
+{
+	return ScalarBasis<eNoiseType::Simplex>(seed_, argX, argY, argZ);
+}
+
+float Utility::Math::Noise::Simplex(float argX, float argY, float argZ, float argW) const
+{
+	return ScalarBasis<eNoiseType::Simplex>(seed_, argX, argY, argZ, argW);
+}
+
+float Utility::Math::Noise::Fractal(const NoiseSettings &argSettings, float argX, float argY) const
+{
+	return ScalarFractal(argSettings, seed_, argX, argY);
+}
+
+float Utility::Math::Noise::Fractal(const NoiseSettings &argSettings, float argX, float argY, float argZ) const
+{
+	return ScalarFractal(argSettings, seed_, argX, argY, argZ);
+}
+
+float Utility::Math::Noise::Fractal(const NoiseSettings &argSettings, float argX, float argY, float argZ, float argW) const
+{
+	return ScalarFractal(argSettings, seed_, argX, argY, argZ, argW);
+}
+#pragma endregion	Scalar
+
+#pragma region		Batch
+void Utility::Math::Noise::Evaluate(const NoiseSettings &argSettings, Span<const float> argX, Span<const float> argY, Span<float> argDst, ThreadPool *argPool) const
+{
+	const Span<const float> Src[] = { argX, argY };
+	RunEvaluate(argSettings, seed_, Src, argDst, argPool);
+}
+
+void Utility::Math::Noise::Evaluate(const NoiseSettings &argSettings, Span<const float> argX, Span<const float> argY, Span<const float> argZ, Span<float> argDst, ThreadPool *argPool) const
+{
+	const Span<const float> Src[] = { argX, argY, argZ };
+	RunEvaluate(argSettings, seed_, Src, argDst, argPool);
+}
+
+void Utility::Math::Noise::Evaluate(const NoiseSettings &argSettings, Span<const float> argX, Span<const float> argY, Span<const float> argZ, Span<const float> argW, Span<float> argDst, ThreadPool *argPool) const
+{
+	const Span<const float> Src[] = { argX, argY, argZ, argW };
+	RunEvaluate(argSettings, seed_, Src, argDst, argPool);
+}
+
+void Utility::Math::Noise::Grid(const NoiseSettings &argSettings, Span<float> argDst, size_t argWidth, size_t argHeight, const Vector2 &argOrigin, const Vector2 &argStep, ThreadPool *argPool) const
+{
+	const size_t Size[] = { argWidth, argHeight };
+	const float Origin[] = { argOrigin.x, argOrigin.y };
+	const float Step[] = { argStep.x, argStep.y };
+	RunGrid(argSettings, seed_, argDst, Size, Origin, Step, argPool);
+}
+
+void Utility::Math::Noise::Grid(const NoiseSettings &argSettings, Span<float> argDst, size_t argWidth, size_t argHeight, size_t argDepth, const Vector3 &argOrigin, const Vector3 &argStep, ThreadPool *argPool) const
+{
+	const size_t Size[] = { argWidth, argHeight, argDepth };
+	const float Origin[] = { argOrigin.x, argOrigin.y, argOrigin.z };
+	const float Step[] = { argStep.x, argStep.y, argStep.z };
+	RunGrid(argSettings, seed_, argDst, Size, Origin, Step, argPool);
+}
+#pragma endregion	Batch
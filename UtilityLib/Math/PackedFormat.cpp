@@ -0,0 +1,593 @@
+﻿/**
+ *	@file	PackedFormat.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "PackedFormat.h"
+#include "SimdLanes.h"
+
+#include <assert.h>
+
+namespace
+{
+	using Utility::Math::PackedNormal;
+	using Utility::Math::Vector3;
+
+#pragma region		Lanes
+	/*
+	 *	SimdLanesに32bit整数の演算と、狭い整数型との読み書きを足したもの。
+	 *	IRegは32bit整数の要素、IMaskはその比較結果。狭い型へは下位のビットをそのまま書く。
+	 */
+
+	/**
+	 *  @struct		ScalarPackLanes
+	 *  @brief		1要素ずつの演算
+	 */
+	struct ScalarPackLanes : public Utility::Math::Simd::ScalarLanes
+	{
+		using IReg = std::int32_t;
+		using IMask = bool;
+
+		static inline IReg SetInt(std::int32_t argValue) { return argValue; }
+		// 符号付きの桁あふれを避けるため、符号無しで計算する
+		static inline IReg AddInt(IReg argA, IReg argB) { return static_cast<IReg>(static_cast<std::uint32_t>(argA) + static_cast<std::uint32_t>(argB)); }
+		static inline IReg SubInt(IReg argA, IReg argB) { return static_cast<IReg>(static_cast<std::uint32_t>(argA) - static_cast<std::uint32_t>(argB)); }
+		static inline IReg And(IReg argA, IReg argB) { return argA & argB; }
+		static inline IReg Or(IReg argA, IReg argB) { return argA | argB; }
+		static inline IReg Xor(IReg argA, IReg argB) { return argA ^ argB; }
+		template<int N> static inline IReg ShiftLeft(IReg argValue) { return static_cast<IReg>(static_cast<std::uint32_t>(argValue) << N); }
+		template<int N> static inline IReg ShiftRight(IReg argValue) { return static_cast<IReg>(static_cast<std::uint32_t>(argValue) >> N); }
+		template<int N> static inline IReg ShiftRightArithmetic(IReg argValue)
+		{
+			const std::uint32_t Bits = static_cast<std::uint32_t>(argValue);
+			return static_cast<IReg>((argValue < 0) ? ~(~Bits >> N) : (Bits >> N));
+		}
+		static inline IMask GreaterInt(IReg argA, IReg argB) { return argA > argB; }
+		static inline IMask EqualInt(IReg argA, IReg argB) { return argA == argB; }
+		static inline IReg SelectInt(IMask argMask, IReg argTrue, IReg argFalse) { return argMask ? argTrue : argFalse; }
+
+		static inline IReg AsInt(Reg argValue)
+		{
+			IReg bits;
+			std::memcpy(&bits, &argValue, sizeof(bits));
+			return bits;
+		}
+		static inline Reg AsFloat(IReg argValue)
+		{
+			Reg value;
+			std::memcpy(&value, &argValue, sizeof(value));
+			return value;
+		}
+		static inline Reg ToFloat(IReg argValue) { return static_cast<Reg>(argValue); }
+		// cvtps2dqと同じく最近接偶数に丸める
+		static inline IReg ToInt(Reg argValue) { return static_cast<IReg>(Round(argValue)); }
+
+		static inline IReg LoadInt(const std::int8_t *argSrc) { return *argSrc; }
+		static inline IReg LoadInt(const std::uint8_t *argSrc) { return *argSrc; }
+		static inline IReg LoadInt(const std::int16_t *argSrc) { return *argSrc; }
+		static inline IReg LoadInt(const std::uint16_t *argSrc) { return *argSrc; }
+		static inline IReg LoadInt32(const void *argSrc)
+		{
+			IReg value;
+			std::memcpy(&value, argSrc, sizeof(value));
+			return value;
+		}
+		static inline void StoreInt(std::int8_t *argDst, IReg argValue) { *argDst = static_cast<std::int8_t>(argValue); }
+		static inline void StoreInt(std::uint8_t *argDst, IReg argValue) { *argDst = static_cast<std::uint8_t>(argValue); }
+		static inline void StoreInt(std::int16_t *argDst, IReg argValue) { *argDst = static_cast<std::int16_t>(argValue); }
+		static inline void StoreInt(std::uint16_t *argDst, IReg argValue) { *argDst = static_cast<std::uint16_t>(argValue); }
+		static inline void StoreInt32(void *argDst, IReg argValue) { std::memcpy(argDst, &argValue, sizeof(argValue)); }
+	};
+
+#if defined(UTILITY_MATH_LANES_AVX2)
+	/**
+	 *  @struct		Avx2PackLanes
+	 *  @brief		8要素ずつの演算
+	 */
+	struct Avx2PackLanes : public Utility::Math::Simd::Avx2Lanes
+	{
+		using IReg = __m256i;
+		using IMask = __m256i;
+
+		static inline IReg SetInt(std::int32_t argValue) { return _mm256_set1_epi32(argValue); }
+		static inline IReg AddInt(IReg argA, IReg argB) { return _mm256_add_epi32(argA, argB); }
+		static inline IReg SubInt(IReg argA, IReg argB) { return _mm256_sub_epi32(argA, argB); }
+		static inline IReg And(IReg argA, IReg argB) { return _mm256_and_si256(argA, argB); }
+		static inline IReg Or(IReg argA, IReg argB) { return _mm256_or_si256(argA, argB); }
+		static inline IReg Xor(IReg argA, IReg argB) { return _mm256_xor_si256(argA, argB); }
+		template<int N> static inline IReg ShiftLeft(IReg argValue) { return _mm256_slli_epi32(argValue, N); }
+		template<int N> static inline IReg ShiftRight(IReg argValue) { return _mm256_srli_epi32(argValue, N); }
+		template<int N> static inline IReg ShiftRightArithmetic(IReg argValue) { return _mm256_srai_epi32(argValue, N); }
+		static inline IMask GreaterInt(IReg argA, IReg argB) { return _mm256_cmpgt_epi32(argA, argB); }
+		static inline IMask EqualInt(IReg argA, IReg argB) { return _mm256_cmpeq_epi32(argA, argB); }
+		static inline IReg SelectInt(IMask argMask, IReg argTrue, IReg argFalse) { return _mm256_blendv_epi8(argFalse, argTrue, argMask); }
+
+		static inline IReg AsInt(Reg argValue) { return _mm256_castps_si256(argValue); }
+		static inline Reg AsFloat(IReg argValue) { return _mm256_castsi256_ps(argValue); }
+		static inline Reg ToFloat(IReg argValue) { return _mm256_cvtepi32_ps(argValue); }
+		static inline IReg ToInt(Reg argValue) { return _mm256_cvtps_epi32(argValue); }
+
+		static inline IReg LoadInt(const std::int8_t *argSrc) { return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(argSrc))); }
+		static inline IReg LoadInt(const std::uint8_t *argSrc) { return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(argSrc))); }
+		static inline IReg LoadInt(const std::int16_t *argSrc) { return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc))); }
+		static inline IReg LoadInt(const std::uint16_t *argSrc) { return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc))); }
+		static inline IReg LoadInt32(const void *argSrc) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(argSrc)); }
+		static inline void StoreInt(std::int8_t *argDst, IReg argValue) { StoreInt8(argDst, argValue); }
+		static inline void StoreInt(std::uint8_t *argDst, IReg argValue) { StoreInt8(argDst, argValue); }
+		static inline void StoreInt(std::int16_t *argDst, IReg argValue) { _mm_storeu_si128(reinterpret_cast<__m128i*>(argDst), Pack16(argValue)); }
+		static inline void StoreInt(std::uint16_t *argDst, IReg argValue) { _mm_storeu_si128(reinterpret_cast<__m128i*>(argDst), Pack16(argValue)); }
+		static inline void StoreInt32(void *argDst, IReg argValue) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(argDst), argValue); }
+
+	private:
+		/**
+		 *	@fn			Pack16
+		 *	@brief		各要素の下位16bitを並べる(符号拡張してから飽和させずに詰める)
+		 */
+		static inline __m128i Pack16(IReg argValue)
+		{
+			const __m256i Low = _mm256_srai_epi32(_mm256_slli_epi32(argValue, 16), 16);
+			return _mm_packs_epi32(_mm256_castsi256_si128(Low), _mm256_extracti128_si256(Low, 1));
+		}
+		static inline void StoreInt8(void *argDst, IReg argValue)
+		{
+			const __m256i Low = _mm256_srai_epi32(_mm256_slli_epi32(argValue, 24), 24);
+			const __m128i Packed = _mm_packs_epi32(_mm256_castsi256_si128(Low), _mm256_extracti128_si256(Low, 1));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(argDst), _mm_packs_epi16(Packed, Packed));
+		}
+	};
+	using WidePackLanes = Avx2PackLanes;
+#elif defined(UTILITY_MATH_LANES_SSE2)
+	/**
+	 *  @struct		Sse2PackLanes
+	 *  @brief		4要素ずつの演算
+	 */
+	struct Sse2PackLanes : public Utility::Math::Simd::Sse2Lanes
+	{
+		using IReg = __m128i;
+		using IMask = __m128i;
+
+		static inline IReg SetInt(std::int32_t argValue) { return _mm_set1_epi32(argValue); }
+		static inline IReg AddInt(IReg argA, IReg argB) { return _mm_add_epi32(argA, argB); }
+		static inline IReg SubInt(IReg argA, IReg argB) { return _mm_sub_epi32(argA, argB); }
+		static inline IReg And(IReg argA, IReg argB) { return _mm_and_si128(argA, argB); }
+		static inline IReg Or(IReg argA, IReg argB) { return _mm_or_si128(argA, argB); }
+		static inline IReg Xor(IReg argA, IReg argB) { return _mm_xor_si128(argA, argB); }
+		template<int N> static inline IReg ShiftLeft(IReg argValue) { return _mm_slli_epi32(argValue, N); }
+		template<int N> static inline IReg ShiftRight(IReg argValue) { return _mm_srli_epi32(argValue, N); }
+		template<int N> static inline IReg ShiftRightArithmetic(IReg argValue) { return _mm_srai_epi32(argValue, N); }
+		static inline IMask GreaterInt(IReg argA, IReg argB) { return _mm_cmpgt_epi32(argA, argB); }
+		static inline IMask EqualInt(IReg argA, IReg argB) { return _mm_cmpeq_epi32(argA, argB); }
+		static inline IReg SelectInt(IMask argMask, IReg argTrue, IReg argFalse) { return _mm_or_si128(_mm_and_si128(argMask, argTrue), _mm_andnot_si128(argMask, argFalse)); }
+
+		static inline IReg AsInt(Reg argValue) { return _mm_castps_si128(argValue); }
+		static inline Reg AsFloat(IReg argValue) { return _mm_castsi128_ps(argValue); }
+		static inline Reg ToFloat(IReg argValue) { return _mm_cvtepi32_ps(argValue); }
+		static inline IReg ToInt(Reg argValue) { return _mm_cvtps_epi32(argValue); }
+
+		static inline IReg LoadInt(const std::int8_t *argSrc)
+		{
+			const __m128i Bytes = Load8(argSrc);
+			const __m128i Words = _mm_unpacklo_epi8(Bytes, Bytes);
+			return _mm_srai_epi32(_mm_unpacklo_epi16(Words, Words), 24);
+		}
+		static inline IReg LoadInt(const std::uint8_t *argSrc)
+		{
+			const __m128i Zero = _mm_setzero_si128();
+			return _mm_unpacklo_epi16(_mm_unpacklo_epi8(Load8(argSrc), Zero), Zero);
+		}
+		static inline IReg LoadInt(const std::int16_t *argSrc)
+		{
+			const __m128i Words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(argSrc));
+			return _mm_srai_epi32(_mm_unpacklo_epi16(Words, Words), 16);
+		}
+		static inline IReg LoadInt(const std::uint16_t *argSrc) { return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(argSrc)), _mm_setzero_si128()); }
+		static inline IReg LoadInt32(const void *argSrc) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc)); }
+		static inline void StoreInt(std::int8_t *argDst, IReg argValue) { StoreInt8(argDst, argValue); }
+		static inline void StoreInt(std::uint8_t *argDst, IReg argValue) { StoreInt8(argDst, argValue); }
+		static inline void StoreInt(std::int16_t *argDst, IReg argValue) { _mm_storel_epi64(reinterpret_cast<__m128i*>(argDst), Pack16(argValue)); }
+		static inline void StoreInt(std::uint16_t *argDst, IReg argValue) { _mm_storel_epi64(reinterpret_cast<__m128i*>(argDst), Pack16(argValue)); }
+		static inline void StoreInt32(void *argDst, IReg argValue) { _mm_storeu_si128(reinterpret_cast<__m128i*>(argDst), argValue); }
+
+	private:
+		static inline __m128i Load8(const void *argSrc)
+		{
+			std::int32_t bytes;
+			std::memcpy(&bytes, argSrc, sizeof(bytes));
+			return _mm_cvtsi32_si128(bytes);
+		}
+		/**
+		 *	@fn			Pack16
+		 *	@brief		各要素の下位16bitを並べる(符号拡張してから飽和させずに詰める)
+		 */
+		static inline __m128i Pack16(IReg argValue)
+		{
+			const __m128i Low = _mm_srai_epi32(_mm_slli_epi32(argValue, 16), 16);
+			return _mm_packs_epi32(Low, Low);
+		}
+		static inline void StoreInt8(void *argDst, IReg argValue)
+		{
+			const __m128i Low = _mm_srai_epi32(_mm_slli_epi32(argValue, 24), 24);
+			const __m128i Packed = _mm_packs_epi32(Low, Low);
+			const std::int32_t Bytes = _mm_cvtsi128_si32(_mm_packs_epi16(Packed, Packed));
+			std::memcpy(argDst, &Bytes, sizeof(Bytes));
+		}
+	};
+	using WidePackLanes = Sse2PackLanes;
+#else
+	using WidePackLanes = ScalarPackLanes;
+#endif
+#pragma endregion	Lanes
+
+#pragma region		Conversion
+	/*
+	 *	F. Giesen, "Packing and unpacking half floats" の分岐のない変換。
+	 *	整数演算と浮動小数点の加減算1回だけなので、F16Cがなくても同じ結果になる。
+	 */
+	const std::int32_t HalfOverflowBits = (127 + 16) << 23;			// 65536.0f(丸めても無限大になる境界)
+	const std::int32_t HalfNormalBits = (127 - 14) << 23;			// 2^-14(半精度の正規化数の最小値)
+	const std::int32_t HalfDenormalMagicBits = (127 - 1) << 23;		// 0.5f(足すと仮数の下位に非正規化数が並ぶ)
+	const std::int32_t HalfRebiasBits = -((127 - 15) << 23);		// 指数の偏りを単精度(127)から半精度(15)に付け替える(負の値は左シフトしない)
+
+	/**
+	 *	@fn			FloatToHalfLanes
+	 *	@brief		単精度を半精度のビット列(下位16bit)にする
+	 */
+	template<typename L>
+	inline typename L::IReg FloatToHalfLanes(typename L::Reg argValue)
+	{
+		using IReg = typename L::IReg;
+		const IReg Bits = L::AsInt(argValue);
+		const IReg Sign = L::And(Bits, L::SetInt(static_cast<std::int32_t>(0x80000000u)));
+		const IReg Abs = L::Xor(Bits, Sign);
+
+		// 正規化数: 指数を付け替え、仮数の下位13bitを最近接偶数に丸める
+		const IReg Odd = L::And(L::template ShiftRight<13>(Abs), L::SetInt(1));
+		const IReg Normal = L::template ShiftRight<13>(L::AddInt(L::AddInt(Abs, L::SetInt(HalfRebiasBits + 0xfff)), Odd));
+		// 非正規化数: 0.5を足して仮数の下位に押し出し、加算の丸めに任せる
+		const IReg Denormal = L::SubInt(L::AsInt(L::Add(L::AsFloat(Abs), L::AsFloat(L::SetInt(HalfDenormalMagicBits)))), L::SetInt(HalfDenormalMagicBits));
+		// 範囲外: NaNは0x7e00、それ以外は無限大
+		const IReg Overflow = L::SelectInt(L::GreaterInt(Abs, L::SetInt(0x7f800000)), L::SetInt(0x7e00), L::SetInt(0x7c00));
+
+		IReg result = L::SelectInt(L::GreaterInt(L::SetInt(HalfNormalBits), Abs), Denormal, Normal);
+		result = L::SelectInt(L::GreaterInt(Abs, L::SetInt(HalfOverflowBits - 1)), Overflow, result);
+		return L::Or(result, L::template ShiftRight<16>(Sign));
+	}
+
+	/**
+	 *	@fn			HalfToFloatLanes
+	 *	@brief		半精度のビット列(下位16bit)を単精度にする
+	 */
+	template<typename L>
+	inline typename L::Reg HalfToFloatLanes(typename L::IReg argHalf)
+	{
+		using IReg = typename L::IReg;
+		const IReg ShiftedExponent = L::SetInt(0x7c00 << 13);
+		const IReg Shifted = L::template ShiftLeft<13>(L::And(argHalf, L::SetInt(0x7fff)));
+		const IReg Exponent = L::And(Shifted, ShiftedExponent);
+		const IReg Normal = L::AddInt(Shifted, L::SetInt((127 - 15) << 23));
+
+		// 無限大とNaNは指数をさらに進め、非正規化数は2^-14を足した値から引いて正規化する
+		const IReg Special = L::AddInt(Normal, L::SetInt((128 - 16) << 23));
+		const IReg Denormal = L::AsInt(L::Sub(L::AsFloat(L::AddInt(Normal, L::SetInt(1 << 23))), L::AsFloat(L::SetInt(HalfNormalBits))));
+
+		IReg result = L::SelectInt(L::EqualInt(Exponent, ShiftedExponent), Special, Normal);
+		result = L::SelectInt(L::EqualInt(Exponent, L::SetInt(0)), Denormal, result);
+		return L::AsFloat(L::Or(result, L::template ShiftLeft<16>(L::And(argHalf, L::SetInt(0x8000)))));
+	}
+
+	/**
+	 *  @struct		NormTraits
+	 *  @brief		正規化整数の範囲(SNORMは-最大値を-1とし、最小値も-1に丸める)
+	 */
+	template<typename TInt> struct NormTraits;
+	template<> struct NormTraits<std::int8_t> { static constexpr float Lower = -1.f; static constexpr float Scale = 127.f; };
+	template<> struct NormTraits<std::int16_t> { static constexpr float Lower = -1.f; static constexpr float Scale = 32767.f; };
+	template<> struct NormTraits<std::uint8_t> { static constexpr float Lower = 0.f; static constexpr float Scale = 255.f; };
+	template<> struct NormTraits<std::uint16_t> { static constexpr float Lower = 0.f; static constexpr float Scale = 65535.f; };
+
+	/**
+	 *	@fn			OctahedralEncodeLanes
+	 *	@brief		法線を八面体に写して[-1, 1]の2成分にする
+	 */
+	template<typename L>
+	inline void OctahedralEncodeLanes(typename L::Reg argX, typename L::Reg argY, typename L::Reg argZ, typename L::Reg *argU, typename L::Reg *argV)
+	{
+		using Reg = typename L::Reg;
+		const Reg Zero = L::Set(0.f);
+		const Reg One = L::Set(1.f);
+		// 長さ0でも割れるように下限を付ける(0のまま(0, 0)になる)
+		const Reg Sum = L::Max(L::Add(L::Add(L::Abs(argX), L::Abs(argY)), L::Abs(argZ)), L::Set(1e-30f));
+		const Reg X = L::Div(argX, Sum);
+		const Reg Y = L::Div(argY, Sum);
+
+		// 下半分は対角線で折り返す
+		const Reg FoldX = L::Mul(L::Sub(One, L::Abs(Y)), L::Select(L::GreaterEqual(X, Zero), One, L::Set(-1.f)));
+		const Reg FoldY = L::Mul(L::Sub(One, L::Abs(X)), L::Select(L::GreaterEqual(Y, Zero), One, L::Set(-1.f)));
+		const typename L::Mask Lower = L::Less(argZ, Zero);
+		*argU = L::Select(Lower, FoldX, X);
+		*argV = L::Select(Lower, FoldY, Y);
+	}
+
+	/**
+	 *	@fn			OctahedralDecodeLanes
+	 *	@brief		八面体の2成分を正規化した法線に戻す
+	 */
+	template<typename L>
+	inline void OctahedralDecodeLanes(typename L::Reg argU, typename L::Reg argV, typename L::Reg *argX, typename L::Reg *argY, typename L::Reg *argZ)
+	{
+		using Reg = typename L::Reg;
+		const Reg Zero = L::Set(0.f);
+		const Reg Z = L::Sub(L::Sub(L::Set(1.f), L::Abs(argU)), L::Abs(argV));
+		// 折り返した分(zが負の量)を、原点へ向かう向きに戻す
+		const Reg Fold = L::Max(L::Neg(Z), Zero);
+		const Reg X = L::Add(argU, L::Select(L::GreaterEqual(argU, Zero), L::Neg(Fold), Fold));
+		const Reg Y = L::Add(argV, L::Select(L::GreaterEqual(argV, Zero), L::Neg(Fold), Fold));
+
+		const Reg Length = L::Sqrt(L::Add(L::Add(L::Mul(X, X), L::Mul(Y, Y)), L::Mul(Z, Z)));
+		*argX = L::Div(X, Length);
+		*argY = L::Div(Y, Length);
+		*argZ = L::Div(Z, Length);
+	}
+#pragma endregion	Conversion
+
+#pragma region		Kernel
+	/*
+	 *	各カーネルはApply<Lanes>(i)でi番目からLanes::Width個を処理する。
+	 */
+
+	/**
+	 *  @struct		FloatToHalfKernel
+	 *  @brief		単精度から半精度
+	 */
+	struct FloatToHalfKernel
+	{
+		const float		*src_;
+		std::uint16_t	*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			L::StoreInt(dst_ + argIndex, FloatToHalfLanes<L>(L::Load(src_ + argIndex)));
+		}
+	};
+
+	/**
+	 *  @struct		HalfToFloatKernel
+	 *  @brief		半精度から単精度
+	 */
+	struct HalfToFloatKernel
+	{
+		const std::uint16_t	*src_;
+		float				*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			L::Store(dst_ + argIndex, HalfToFloatLanes<L>(L::LoadInt(src_ + argIndex)));
+		}
+	};
+
+	/**
+	 *  @struct		FloatToNormKernel
+	 *  @brief		単精度から正規化整数
+	 */
+	template<typename TInt>
+	struct FloatToNormKernel
+	{
+		const float	*src_;
+		TInt		*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			using Traits = NormTraits<TInt>;
+			const typename L::Reg Clamped = L::Min(L::Max(L::Load(src_ + argIndex), L::Set(Traits::Lower)), L::Set(1.f));
+			L::StoreInt(dst_ + argIndex, L::ToInt(L::Mul(Clamped, L::Set(Traits::Scale))));
+		}
+	};
+
+	/**
+	 *  @struct		NormToFloatKernel
+	 *  @brief		正規化整数から単精度
+	 */
+	template<typename TInt>
+	struct NormToFloatKernel
+	{
+		const TInt	*src_;
+		float		*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			using Traits = NormTraits<TInt>;
+			const typename L::Reg Value = L::Div(L::ToFloat(L::LoadInt(src_ + argIndex)), L::Set(Traits::Scale));
+			L::Store(dst_ + argIndex, L::Max(Value, L::Set(Traits::Lower)));
+		}
+	};
+
+	/**
+	 *  @struct		EncodeOctahedralKernel
+	 *  @brief		法線を八面体写像のSNORM16にする
+	 */
+	struct EncodeOctahedralKernel
+	{
+		const Vector3	*src_;
+		PackedNormal	*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			// 構造体の配列なので、成分ごとに並べ替えてから読む
+			float x[L::Width], y[L::Width], z[L::Width];
+			for (size_t i = 0; i < L::Width; ++i)
+			{
+				x[i] = src_[argIndex + i].x;
+				y[i] = src_[argIndex + i].y;
+				z[i] = src_[argIndex + i].z;
+			}
+
+			typename L::Reg u, v;
+			OctahedralEncodeLanes<L>(L::Load(x), L::Load(y), L::Load(z), &u, &v);
+			const typename L::Reg Scale = L::Set(NormTraits<std::int16_t>::Scale);
+			const typename L::IReg U = L::ToInt(L::Mul(u, Scale));
+			const typename L::IReg V = L::ToInt(L::Mul(v, Scale));
+			// リトルエンディアンでx、yの順に並ぶ
+			L::StoreInt32(dst_ + argIndex, L::Or(L::And(U, L::SetInt(0xffff)), L::template ShiftLeft<16>(V)));
+		}
+	};
+
+	/**
+	 *  @struct		DecodeOctahedralKernel
+	 *  @brief		八面体写像のSNORM16を法線に戻す
+	 */
+	struct DecodeOctahedralKernel
+	{
+		const PackedNormal	*src_;
+		Vector3				*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			const typename L::IReg Packed = L::LoadInt32(src_ + argIndex);
+			const typename L::Reg Scale = L::Set(NormTraits<std::int16_t>::Scale);
+			const typename L::Reg MinusOne = L::Set(-1.f);
+			const typename L::Reg U = L::Max(L::Div(L::ToFloat(L::template ShiftRightArithmetic<16>(L::template ShiftLeft<16>(Packed))), Scale), MinusOne);
+			const typename L::Reg V = L::Max(L::Div(L::ToFloat(L::template ShiftRightArithmetic<16>(Packed)), Scale), MinusOne);
+
+			typename L::Reg X, Y, Z;
+			OctahedralDecodeLanes<L>(U, V, &X, &Y, &Z);
+			float x[L::Width], y[L::Width], z[L::Width];
+			L::Store(x, X);
+			L::Store(y, Y);
+			L::Store(z, Z);
+			for (size_t i = 0; i < L::Width; ++i)
+				dst_[argIndex + i] = Vector3(x[i], y[i], z[i]);
+		}
+	};
+#pragma endregion	Kernel
+
+	/**
+	 *	@fn			RunPack
+	 *	@brief		整数の演算を足したLanesでカーネルを適用する
+	 */
+	template<typename Kernel>
+	inline void RunPack(const Kernel &argKernel, size_t argCount, Utility::ThreadPool *argPool)
+	{
+		Utility::Math::Simd::Run<WidePackLanes, ScalarPackLanes>(argKernel, argCount, Utility::Math::PackedFormat::ParallelGrain, argPool);
+	}
+
+	template<typename TInt>
+	void RunFloatToNorm(Utility::Span<const float> argSrc, Utility::Span<TInt> argDst, Utility::ThreadPool *argPool)
+	{
+		assert(argDst.size() >= argSrc.size() && "Destination is too small...");
+		const FloatToNormKernel<TInt> Kernel = { argSrc.data(), argDst.data() };
+		RunPack(Kernel, argSrc.size(), argPool);
+	}
+
+	template<typename TInt>
+	void RunNormToFloat(Utility::Span<const TInt> argSrc, Utility::Span<float> argDst, Utility::ThreadPool *argPool)
+	{
+		assert(argDst.size() >= argSrc.size() && "Destination is too small...");
+		const NormToFloatKernel<TInt> Kernel = { argSrc.data(), argDst.data() };
+		RunPack(Kernel, argSrc.size(), argPool);
+	}
+}
+
+#pragma region		Scalar
+std::uint16_t Utility::Math::PackedFormat::FloatToHalf(float argValue)
+{
+	return static_cast<std::uint16_t>(FloatToHalfLanes<ScalarPackLanes>(argValue));
+}
+
+float Utility::Math::PackedFormat::HalfToFloat(std::uint16_t argValue)
+{
+	return HalfToFloatLanes<ScalarPackLanes>(argValue);
+}
+
+Utility::Math::PackedNormal Utility::Math::PackedFormat::EncodeOctahedral(const Vector3 &argNormal)
+{
+	PackedNormal result;
+	const EncodeOctahedralKernel Kernel = { &argNormal, &result };
+	Kernel.Apply<ScalarPackLanes>(0);
+	return result;
+}
+
+Utility::Math::Vector3 Utility::Math::PackedFormat::DecodeOctahedral(PackedNormal argPacked)
+{
+	Vector3 result;
+	const DecodeOctahedralKernel Kernel = { &argPacked, &result };
+	Kernel.Apply<ScalarPackLanes>(0);
+	return result;
+}
+#pragma endregion	Scalar
+
+#pragma region		Batch
+void Utility::Math::PackedFormat::FloatToHalf(Span<const float> argSrc, Span<std::uint16_t> argDst, ThreadPool *argPool)
+{
+	assert(argDst.size() >= argSrc.size() && "Destination is too small...");
+	const FloatToHalfKernel Kernel = { argSrc.data(), argDst.data() };
+	RunPack(Kernel, argSrc.size(), argPool);
+}
+
+void Utility::Math::PackedFormat::HalfToFloat(Span<const std::uint16_t> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	assert(argDst.size() >= argSrc.size() && "Destination is too small...");
+	const HalfToFloatKernel Kernel = { argSrc.data(), argDst.data() };
+	RunPack(Kernel, argSrc.size(), argPool);
+}
+
+void Utility::Math::PackedFormat::FloatToNorm(Span<const float> argSrc, Span<std::int8_t> argDst, ThreadPool *argPool)
+{
+	RunFloatToNorm(argSrc, argDst, argPool);
+}
+
+void Utility::Math::PackedFormat::FloatToNorm(Span<const float> argSrc, Span<std::int16_t> argDst, ThreadPool *argPool)
+{
+	RunFloatToNorm(argSrc, argDst, argPool);
+}
+
+void Utility::Math::PackedFormat::FloatToNorm(Span<const float> argSrc, Span<std::uint8_t> argDst, ThreadPool *argPool)
+{
+	RunFloatToNorm(argSrc, argDst, argPool);
+}
+
+void Utility::Math::PackedFormat::FloatToNorm(Span<const float> argSrc, Span<std::uint16_t> argDst, ThreadPool *argPool)
+{
+	RunFloatToNorm(argSrc, argDst, argPool);
+}
+
+void Utility::Math::PackedFormat::NormToFloat(Span<const std::int8_t> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunNormToFloat(argSrc, argDst, argPool);
+}
+
+void Utility::Math::PackedFormat::NormToFloat(Span<const std::int16_t> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunNormToFloat(argSrc, argDst, argPool);
+}
+
+void Utility::Math::PackedFormat::NormToFloat(Span<const std::uint8_t> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunNormToFloat(argSrc, argDst, argPool);
+}
+
+void Utility::Math::PackedFormat::NormToFloat(Span<const std::uint16_t> argSrc, Span<float> argDst, ThreadPool *argPool)
+{
+	RunNormToFloat(argSrc, argDst, argPool);
+}
+
+void Utility::Math::PackedFormat::EncodeOctahedral(Span<const Vector3> argSrc, Span<PackedNormal> argDst, ThreadPool *argPool)
+{
+	assert(argDst.size() >= argSrc.size() && "Destination is too small...");
+	const EncodeOctahedralKernel Kernel = { argSrc.data(), argDst.data() };
+	RunPack(Kernel, argSrc.size(), argPool);
+}
+
+void Utility::Math::PackedFormat::DecodeOctahedral(Span<const PackedNormal> argSrc, Span<Vector3> argDst, ThreadPool *argPool)
+{
+	assert(argDst.size() >= argSrc.size() && "Destination is too small...");
+	const DecodeOctahedralKernel Kernel = { argSrc.data(), argDst.data() };
+	RunPack(Kernel, argSrc.size(), argPool);
+}
+#pragma endregion	Batch
@@ -0,0 +1,313 @@
+﻿/**
+ *	@file	QuaternionStream.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "QuaternionStream.h"
+#include "Vector3Stream.h"
+#include "SimdLanes.h"
+
+namespace
+{
+	using Utility::Math::QuaternionStream;
+
+#pragma region		Slerp
+	/*
+	 *	Eberly, "A Fast and Accurate Algorithm for Computing SLERP" の多項式近似。
+	 *	cosθ(>=0)とtだけから係数を求めるので、三角関数なしでまとめて計算できる。
+	 *	8項の近似誤差はθ=90°付近で2.6e-5あるが、45°以下なら1.5e-8に収まる。
+	 */
+	const float SlerpMu = 1.90110745351730037f;
+	const float SlerpU[8] = { 1.f / (1 * 3), 1.f / (2 * 5), 1.f / (3 * 7), 1.f / (4 * 9), 1.f / (5 * 11), 1.f / (6 * 13), 1.f / (7 * 15), SlerpMu / (8 * 17) };
+	const float SlerpV[8] = { 1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, SlerpMu * 8 / 17 };
+
+	/**
+	 *	@fn			SlerpFactor
+	 *	@brief		sin(tθ) / sinθ の近似
+	 *	@param[in]	argT		!<	補間係数
+	 *	@param[in]	argCosM1	!<	cosθ - 1
+	 */
+	template<typename L>
+	inline typename L::Reg SlerpFactor(typename L::Reg argT, typename L::Reg argCosM1)
+	{
+		const typename L::Reg One = L::Set(1.f);
+		const typename L::Reg SqrT = L::Mul(argT, argT);
+		typename L::Reg f = One;
+		for (int i = 7; i >= 0; --i)
+		{
+			const typename L::Reg B = L::Mul(L::Sub(L::Mul(L::Set(SlerpU[i]), SqrT), L::Set(SlerpV[i])), argCosM1);
+			f = L::Add(One, L::Mul(B, f));
+		}
+		return L::Mul(argT, f);
+	}
+#pragma endregion	Slerp
+
+#pragma region		Kernel
+	/**
+	 *  @struct		QuaternionKernel
+	 *  @brief		クォータニオンの要素ごとの演算
+	 */
+	struct QuaternionKernel
+	{
+		/**
+		 *  @enum		eMode
+		 *  @brief		演算の種類
+		 */
+		enum class eMode
+		{
+			Multiply,
+			Normalize,
+			Conjugate,
+			Lerp,
+			Slerp,
+		};
+
+		const float	*a_[4];
+		const float	*b_[4];
+		float		*dst_[4];
+		const float	*t_;		//	!<	要素ごとの補間係数(nullptrならtValue_)
+		float		tValue_;
+		eMode		mode_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			using Reg = typename L::Reg;
+			const Reg AX = L::Load(a_[0] + argIndex);
+			const Reg AY = L::Load(a_[1] + argIndex);
+			const Reg AZ = L::Load(a_[2] + argIndex);
+			const Reg AW = L::Load(a_[3] + argIndex);
+			Reg r[4];
+			switch (mode_)
+			{
+			case eMode::Normalize:
+			{// (x^2 + z^2) + (y^2 + w^2) の順
+				const Reg Length = L::Sqrt(L::Add(L::Add(L::Mul(AX, AX), L::Mul(AZ, AZ)), L::Add(L::Mul(AY, AY), L::Mul(AW, AW))));
+				r[0] = L::ZeroIfZero(Length, L::Div(AX, Length));
+				r[1] = L::ZeroIfZero(Length, L::Div(AY, Length));
+				r[2] = L::ZeroIfZero(Length, L::Div(AZ, Length));
+				r[3] = L::ZeroIfZero(Length, L::Div(AW, Length));
+				break;
+			}
+			case eMode::Conjugate:
+				r[0] = L::Neg(AX);
+				r[1] = L::Neg(AY);
+				r[2] = L::Neg(AZ);
+				r[3] = AW;
+				break;
+			default:
+			{
+				const Reg BX = L::Load(b_[0] + argIndex);
+				const Reg BY = L::Load(b_[1] + argIndex);
+				const Reg BZ = L::Load(b_[2] + argIndex);
+				const Reg BW = L::Load(b_[3] + argIndex);
+				if (mode_ == eMode::Multiply)
+				{// XMQuaternionMultiply(a, b) = b * a
+					r[0] = L::Add(L::Add(L::Mul(BW, AX), L::Mul(BX, AW)), L::Sub(L::Mul(BY, AZ), L::Mul(BZ, AY)));
+					r[1] = L::Add(L::Sub(L::Mul(BW, AY), L::Mul(BX, AZ)), L::Add(L::Mul(BY, AW), L::Mul(BZ, AX)));
+					r[2] = L::Add(L::Add(L::Mul(BW, AZ), L::Mul(BX, AY)), L::Sub(L::Mul(BZ, AW), L::Mul(BY, AX)));
+					r[3] = L::Sub(L::Sub(L::Mul(BW, AW), L::Mul(BX, AX)), L::Add(L::Mul(BY, AY), L::Mul(BZ, AZ)));
+					break;
+				}
+
+				const Reg T = (t_ != nullptr) ? L::Load(t_ + argIndex) : L::Set(tValue_);
+				const Reg Dot = L::Add(L::Add(L::Mul(AX, BX), L::Mul(AZ, BZ)), L::Add(L::Mul(AY, BY), L::Mul(AW, BW)));
+				const typename L::Mask IsNear = L::GreaterEqual(Dot, L::Set(0.f));
+				if (mode_ == eMode::Lerp)
+				{// 内積が正なら a + (b - a) * t、負なら a * (1 - t) - b * t を正規化する
+					const Reg T1 = L::Sub(L::Set(1.f), T);
+					const Reg Src[4][2] = { { AX, BX }, { AY, BY }, { AZ, BZ }, { AW, BW } };
+					for (int i = 0; i < 4; ++i)
+						r[i] = L::Select(IsNear, L::Add(Src[i][0], L::Mul(L::Sub(Src[i][1], Src[i][0]), T)), L::Sub(L::Mul(Src[i][0], T1), L::Mul(Src[i][1], T)));
+					const Reg Length = L::Sqrt(L::Add(L::Add(L::Mul(r[0], r[0]), L::Mul(r[2], r[2])), L::Add(L::Mul(r[1], r[1]), L::Mul(r[3], r[3]))));
+					for (int i = 0; i < 4; ++i)
+						r[i] = L::ZeroIfZero(Length, L::Div(r[i], Length));
+				}
+				else
+				{// 内積が負ならbを反転して近い方を回る
+					const Reg Sign = L::Select(IsNear, L::Set(1.f), L::Set(-1.f));
+					const Reg Cos = L::Mul(Dot, Sign);
+					const Reg Src[4][2] = { { AX, L::Mul(BX, Sign) }, { AY, L::Mul(BY, Sign) }, { AZ, L::Mul(BZ, Sign) }, { AW, L::Mul(BW, Sign) } };
+
+					// 近似は角度が小さいほど正確なので、中点で区間を半分にしてから補間する
+					// |a + b| = sqrt(2 + 2cosθ)、半分の角度の cos(θ/2) = sqrt((1 + cosθ) / 2)
+					const Reg Half = L::Set(0.5f);
+					const Reg MidScale = L::Div(L::Set(1.f), L::Sqrt(L::Add(L::Set(2.f), L::Add(Cos, Cos))));
+					const Reg CosM1 = L::Sub(L::Sqrt(L::Mul(L::Add(L::Set(1.f), Cos), Half)), L::Set(1.f));
+					const typename L::Mask IsFirst = L::GreaterEqual(Half, T);
+					const Reg T2 = L::Add(T, T);
+					const Reg HalfT = L::Select(IsFirst, T2, L::Sub(T2, L::Set(1.f)));
+					const Reg FactorA = SlerpFactor<L>(L::Sub(L::Set(1.f), HalfT), CosM1);
+					const Reg FactorB = SlerpFactor<L>(HalfT, CosM1);
+					for (int i = 0; i < 4; ++i)
+					{
+						const Reg Mid = L::Mul(L::Add(Src[i][0], Src[i][1]), MidScale);
+						const Reg From = L::Select(IsFirst, Src[i][0], Mid);
+						const Reg To = L::Select(IsFirst, Mid, Src[i][1]);
+						r[i] = L::Add(L::Mul(From, FactorA), L::Mul(To, FactorB));
+					}
+				}
+				break;
+			}
+			}
+			for (int i = 0; i < 4; ++i)
+				L::Store(dst_[i] + argIndex, r[i]);
+		}
+	};
+
+	/**
+	 *  @struct		RotateKernel
+	 *  @brief		ベクトルの回転
+	 */
+	struct RotateKernel
+	{
+		const float	*v_[3];
+		const float	*q_[4];
+		float		*dst_[3];
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			using Reg = typename L::Reg;
+			const Reg VX = L::Load(v_[0] + argIndex);
+			const Reg VY = L::Load(v_[1] + argIndex);
+			const Reg VZ = L::Load(v_[2] + argIndex);
+			const Reg QX = L::Load(q_[0] + argIndex);
+			const Reg QY = L::Load(q_[1] + argIndex);
+			const Reg QZ = L::Load(q_[2] + argIndex);
+			const Reg QW = L::Load(q_[3] + argIndex);
+
+			// t = 2 * cross(q.xyz, v)、v' = v + w * t + cross(q.xyz, t)
+			const Reg Two = L::Set(2.f);
+			const Reg TX = L::Mul(Two, L::Sub(L::Mul(QY, VZ), L::Mul(QZ, VY)));
+			const Reg TY = L::Mul(Two, L::Sub(L::Mul(QZ, VX), L::Mul(QX, VZ)));
+			const Reg TZ = L::Mul(Two, L::Sub(L::Mul(QX, VY), L::Mul(QY, VX)));
+			L::Store(dst_[0] + argIndex, L::Add(L::Add(VX, L::Mul(QW, TX)), L::Sub(L::Mul(QY, TZ), L::Mul(QZ, TY))));
+			L::Store(dst_[1] + argIndex, L::Add(L::Add(VY, L::Mul(QW, TY)), L::Sub(L::Mul(QZ, TX), L::Mul(QX, TZ))));
+			L::Store(dst_[2] + argIndex, L::Add(L::Add(VZ, L::Mul(QW, TZ)), L::Sub(L::Mul(QX, TY), L::Mul(QY, TX))));
+		}
+	};
+
+	/**
+	 *	@fn			RunQuaternion
+	 *	@brief		QuaternionKernelを組み立てて適用する
+	 */
+	void RunQuaternion(const QuaternionStream &argA, const QuaternionStream *argB, const float *argT, float argTValue, QuaternionKernel::eMode argMode, QuaternionStream *argDst, Utility::ThreadPool *argPool)
+	{
+		const QuaternionStream &B = (argB != nullptr) ? *argB : argA;
+		assert(argA.Size() == B.Size() && "QuaternionStream size mismatch...");
+		argDst->Resize(argA.Size());
+		const QuaternionKernel Kernel =
+		{
+			{ argA.X(), argA.Y(), argA.Z(), argA.W() },
+			{ B.X(), B.Y(), B.Z(), B.W() },
+			{ argDst->X(), argDst->Y(), argDst->Z(), argDst->W() },
+			argT, argTValue, argMode,
+		};
+		Utility::Math::Simd::Run(Kernel, argA.Size(), QuaternionStream::ParallelGrain, argPool);
+	}
+#pragma endregion	Kernel
+}
+
+Utility::Math::QuaternionStream::QuaternionStream()
+	: buffer_()
+{
+}
+
+Utility::Math::QuaternionStream::QuaternionStream(size_t argCount)
+	: QuaternionStream()
+{
+	Resize(argCount);
+}
+
+void Utility::Math::QuaternionStream::Reserve(size_t argCapacity)
+{
+	buffer_.Reserve(argCapacity);
+}
+
+void Utility::Math::QuaternionStream::Resize(size_t argCount)
+{
+	buffer_.Resize(argCount, { 0.f, 0.f, 0.f, 1.f });
+}
+
+void Utility::Math::QuaternionStream::Load(const Quaternion *argSrc, size_t argCount)
+{
+	buffer_.Assign(argCount);
+	float *xs = X();
+	float *ys = Y();
+	float *zs = Z();
+	float *ws = W();
+	for (size_t i = 0; i < argCount; ++i)
+	{
+		xs[i] = argSrc[i].x;
+		ys[i] = argSrc[i].y;
+		zs[i] = argSrc[i].z;
+		ws[i] = argSrc[i].w;
+	}
+}
+
+void Utility::Math::QuaternionStream::Store(Quaternion *argDst) const
+{
+	const float *xs = X();
+	const float *ys = Y();
+	const float *zs = Z();
+	const float *ws = W();
+	for (size_t i = 0; i < Size(); ++i)
+	{
+		argDst[i].x = xs[i];
+		argDst[i].y = ys[i];
+		argDst[i].z = zs[i];
+		argDst[i].w = ws[i];
+	}
+}
+
+void Utility::Math::QuaternionStream::Multiply(const QuaternionStream &argA, const QuaternionStream &argB, QuaternionStream *argDst, ThreadPool *argPool)
+{
+	RunQuaternion(argA, &argB, nullptr, 0.f, QuaternionKernel::eMode::Multiply, argDst, argPool);
+}
+
+void Utility::Math::QuaternionStream::Normalize(const QuaternionStream &argSrc, QuaternionStream *argDst, ThreadPool *argPool)
+{
+	RunQuaternion(argSrc, nullptr, nullptr, 0.f, QuaternionKernel::eMode::Normalize, argDst, argPool);
+}
+
+void Utility::Math::QuaternionStream::Conjugate(const QuaternionStream &argSrc, QuaternionStream *argDst, ThreadPool *argPool)
+{
+	RunQuaternion(argSrc, nullptr, nullptr, 0.f, QuaternionKernel::eMode::Conjugate, argDst, argPool);
+}
+
+void Utility::Math::QuaternionStream::Lerp(const QuaternionStream &argA, const QuaternionStream &argB, float argT, QuaternionStream *argDst, ThreadPool *argPool)
+{
+	RunQuaternion(argA, &argB, nullptr, argT, QuaternionKernel::eMode::Lerp, argDst, argPool);
+}
+
+void Utility::Math::QuaternionStream::Lerp(const QuaternionStream &argA, const QuaternionStream &argB, Span<const float> argT, QuaternionStream *argDst, ThreadPool *argPool)
+{
+	assert(argT.size() >= argA.Size() && "Interpolation factors are too few...");
+	RunQuaternion(argA, &argB, argT.data(), 0.f, QuaternionKernel::eMode::Lerp, argDst, argPool);
+}
+
+void Utility::Math::QuaternionStream::Slerp(const QuaternionStream &argA, const QuaternionStream &argB, float argT, QuaternionStream *argDst, ThreadPool *argPool)
+{
+	RunQuaternion(argA, &argB, nullptr, argT, QuaternionKernel::eMode::Slerp, argDst, argPool);
+}
+
+void Utility::Math::QuaternionStream::Slerp(const QuaternionStream &argA, const QuaternionStream &argB, Span<const float> argT, QuaternionStream *argDst, ThreadPool *argPool)
+{
+	assert(argT.size() >= argA.Size() && "Interpolation factors are too few...");
+	RunQuaternion(argA, &argB, argT.data(), 0.f, QuaternionKernel::eMode::Slerp, argDst, argPool);
+}
+
+void Utility::Math::QuaternionStream::Rotate(const Vector3Stream &argSrc, const QuaternionStream &argRotation, Vector3Stream *argDst, ThreadPool *argPool)
+{
+	assert(argSrc.Size() == argRotation.Size() && "Rotation count mismatch...");
+	argDst->Resize(argSrc.Size());
+	const RotateKernel Kernel =
+	{
+		{ argSrc.X(), argSrc.Y(), argSrc.Z() },
+		{ argRotation.X(), argRotation.Y(), argRotation.Z(), argRotation.W() },
+		{ argDst->X(), argDst->Y(), argDst->Z() },
+	};
+	Utility::Math::Simd::Run(Kernel, argSrc.Size(), ParallelGrain, argPool);
+}
@@ -0,0 +1,322 @@
+﻿/**
+ *	@file	Random.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "Random.h"
+#include "SimdLanes.h"
+
+#include <algorithm>
+
+namespace
+{
+	const uint64_t JumpTable[4] = { 0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull };
+	const uint64_t LongJumpTable[4] = { 0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull, 0x77710069854ee241ull, 0x39109bb02acbe635ull };
+
+	/**
+	 *	@fn			SplitMix64
+	 *	@brief		シードを広げるための疑似乱数生成
+	 *	@param[in,out]	argState	!<	状態
+	 */
+	uint64_t SplitMix64(uint64_t *argState)
+	{
+		uint64_t z = (*argState += 0x9e3779b97f4a7c15ull);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		return z ^ (z >> 31);
+	}
+
+	/**
+	 *	@fn			JumpBy
+	 *	@brief		ジャンプ表の多項式の分だけ進める
+	 *	@param[in,out]	argGenerator	!<	生成器
+	 *	@param[in]		argTable		!<	ジャンプ表
+	 */
+	void JumpBy(Utility::Math::Xoshiro256 *argGenerator, const uint64_t (&argTable)[4])
+	{
+		uint64_t s[4] = {};
+		for (uint64_t word : argTable)
+		{
+			for (int bit = 0; bit < 64; ++bit)
+			{
+				if (word & (1ull << bit))
+				{
+					for (int i = 0; i < 4; ++i)
+						s[i] ^= argGenerator->State()[i];
+				}
+				argGenerator->Next();
+			}
+		}
+		argGenerator->SetState(s);
+	}
+
+#pragma region		Lanes
+	/*
+	 *	64bit整数の演算。xoshiro256**の8本をWidth本ずつ進める。
+	 *	掛け算は定数なのでシフトと足し算で行う(x * 5 = (x << 2) + x、x * 9 = (x << 3) + x)。
+	 */
+
+	/**
+	 *  @struct		ScalarU64
+	 *  @brief		1本ずつの演算
+	 */
+	struct ScalarU64
+	{
+		using Reg = uint64_t;
+		static const size_t Width = 1;
+
+		static inline Reg Load(const uint64_t *argSrc) { return *argSrc; }
+		static inline void Store(uint64_t *argDst, Reg argValue) { *argDst = argValue; }
+		static inline Reg Add(Reg argA, Reg argB) { return argA + argB; }
+		static inline Reg Xor(Reg argA, Reg argB) { return argA ^ argB; }
+		static inline Reg Or(Reg argA, Reg argB) { return argA | argB; }
+		template<int N> static inline Reg Shl(Reg argValue) { return argValue << N; }
+		template<int N> static inline Reg Shr(Reg argValue) { return argValue >> N; }
+	};
+
+#if defined(UTILITY_MATH_LANES_AVX2)
+	/**
+	 *  @struct		Avx2U64
+	 *  @brief		4本ずつの演算
+	 */
+	struct Avx2U64
+	{
+		using Reg = __m256i;
+		static const size_t Width = 4;
+
+		static inline Reg Load(const uint64_t *argSrc) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(argSrc)); }
+		static inline void Store(uint64_t *argDst, Reg argValue) { _mm256_store_si256(reinterpret_cast<__m256i*>(argDst), argValue); }
+		static inline Reg Add(Reg argA, Reg argB) { return _mm256_add_epi64(argA, argB); }
+		static inline Reg Xor(Reg argA, Reg argB) { return _mm256_xor_si256(argA, argB); }
+		static inline Reg Or(Reg argA, Reg argB) { return _mm256_or_si256(argA, argB); }
+		template<int N> static inline Reg Shl(Reg argValue) { return _mm256_slli_epi64(argValue, N); }
+		template<int N> static inline Reg Shr(Reg argValue) { return _mm256_srli_epi64(argValue, N); }
+	};
+	using WideU64 = Avx2U64;
+#elif defined(UTILITY_MATH_LANES_SSE2)
+	/**
+	 *  @struct		Sse2U64
+	 *  @brief		2本ずつの演算
+	 */
+	struct Sse2U64
+	{
+		using Reg = __m128i;
+		static const size_t Width = 2;
+
+		static inline Reg Load(const uint64_t *argSrc) { return _mm_load_si128(reinterpret_cast<const __m128i*>(argSrc)); }
+		static inline void Store(uint64_t *argDst, Reg argValue) { _mm_store_si128(reinterpret_cast<__m128i*>(argDst), argValue); }
+		static inline Reg Add(Reg argA, Reg argB) { return _mm_add_epi64(argA, argB); }
+		static inline Reg Xor(Reg argA, Reg argB) { return _mm_xor_si128(argA, argB); }
+		static inline Reg Or(Reg argA, Reg argB) { return _mm_or_si128(argA, argB); }
+		template<int N> static inline Reg Shl(Reg argValue) { return _mm_slli_epi64(argValue, N); }
+		template<int N> static inline Reg Shr(Reg argValue) { return _mm_srli_epi64(argValue, N); }
+	};
+	using WideU64 = Sse2U64;
+#else
+	using WideU64 = ScalarU64;
+#endif
+
+	/**
+	 *	@fn			Rotl
+	 *	@brief		左回転
+	 */
+	template<typename U, int N>
+	inline typename U::Reg Rotl(typename U::Reg argValue)
+	{
+		return U::Or(U::template Shl<N>(argValue), U::template Shr<64 - N>(argValue));
+	}
+
+	/**
+	 *	@fn			Step
+	 *	@brief		全ての本を1回進める
+	 *	@param[in,out]	argState	!<	成分ごとに並べた状態
+	 *	@param[out]		argDst		!<	各本の出力(LaneCount個)
+	 */
+	template<typename U>
+	inline void Step(uint64_t (&argState)[4][Utility::Math::RandomStream::LaneCount], uint64_t *argDst)
+	{
+		using Reg = typename U::Reg;
+		for (size_t i = 0; i < Utility::Math::RandomStream::LaneCount; i += U::Width)
+		{
+			Reg s0 = U::Load(argState[0] + i);
+			Reg s1 = U::Load(argState[1] + i);
+			Reg s2 = U::Load(argState[2] + i);
+			Reg s3 = U::Load(argState[3] + i);
+
+			// rotl(s1 * 5, 7) * 9
+			Reg result = Rotl<U, 7>(U::Add(U::template Shl<2>(s1), s1));
+			result = U::Add(U::template Shl<3>(result), result);
+
+			const Reg T = U::template Shl<17>(s1);
+			s2 = U::Xor(s2, s0);
+			s3 = U::Xor(s3, s1);
+			s1 = U::Xor(s1, s2);
+			s0 = U::Xor(s0, s3);
+			s2 = U::Xor(s2, T);
+			s3 = Rotl<U, 45>(s3);
+
+			U::Store(argState[0] + i, s0);
+			U::Store(argState[1] + i, s1);
+			U::Store(argState[2] + i, s2);
+			U::Store(argState[3] + i, s3);
+			U::Store(argDst + i, result);
+		}
+	}
+#pragma endregion	Lanes
+}
+
+#pragma region		Xoshiro256
+void Utility::Math::Xoshiro256::Seed(uint64_t argSeed)
+{
+	uint64_t state = argSeed;
+	for (uint64_t &s : s_)
+		s = SplitMix64(&state);
+}
+
+void Utility::Math::Xoshiro256::Jump()
+{
+	JumpBy(this, JumpTable);
+}
+
+void Utility::Math::Xoshiro256::LongJump()
+{
+	JumpBy(this, LongJumpTable);
+}
+#pragma endregion	Xoshiro256
+
+#pragma region		Pcg32
+void Utility::Math::Pcg32::Seed(uint64_t argSeed, uint64_t argStream)
+{
+	state_ = 0;
+	increment_ = (argStream << 1) | 1;
+	Next();
+	state_ += argSeed;
+	Next();
+}
+
+void Utility::Math::Pcg32::Advance(uint64_t argDelta)
+{
+	// 線形合同法のステップを2乗しながら合成する
+	uint64_t accMultiplier = 1;
+	uint64_t accIncrement = 0;
+	uint64_t curMultiplier = Multiplier;
+	uint64_t curIncrement = increment_;
+	while (argDelta > 0)
+	{
+		if (argDelta & 1)
+		{
+			accMultiplier *= curMultiplier;
+			accIncrement = accIncrement * curMultiplier + curIncrement;
+		}
+		curIncrement = (curMultiplier + 1) * curIncrement;
+		curMultiplier *= curMultiplier;
+		argDelta >>= 1;
+	}
+	state_ = accMultiplier * state_ + accIncrement;
+}
+#pragma endregion	Pcg32
+
+#pragma region		RandomStream
+void Utility::Math::RandomStream::Seed(uint64_t argSeed)
+{
+	Seed(Xoshiro256(argSeed));
+}
+
+void Utility::Math::RandomStream::Seed(const Xoshiro256 &argGenerator)
+{
+	Xoshiro256 generator = argGenerator;
+	for (size_t lane = 0; lane < LaneCount; ++lane)
+	{
+		for (int i = 0; i < 4; ++i)
+			s_[i][lane] = generator.State()[i];
+		generator.Jump();
+	}
+}
+
+Utility::Math::RandomStream Utility::Math::RandomStream::Split()
+{
+	RandomStream result = *this;
+	for (size_t lane = 0; lane < LaneCount; ++lane)
+	{
+		uint64_t state[4] = { s_[0][lane], s_[1][lane], s_[2][lane], s_[3][lane] };
+		Xoshiro256 generator;
+		generator.SetState(state);
+		generator.LongJump();
+		for (int i = 0; i < 4; ++i)
+			s_[i][lane] = generator.State()[i];
+	}
+	return result;
+}
+
+void Utility::Math::RandomStream::NextBlock(uint32_t *argDst)
+{
+	alignas(32) uint64_t values[LaneCount];
+	Step<WideU64>(s_, values);
+	// 上位32bitを前半に、下位32bitを後半に並べる
+	for (size_t i = 0; i < LaneCount; ++i)
+	{
+		argDst[i] = static_cast<uint32_t>(values[i] >> 32);
+		argDst[LaneCount + i] = static_cast<uint32_t>(values[i]);
+	}
+}
+
+void Utility::Math::RandomStream::Fill(Span<uint32_t> argDst)
+{
+	size_t i = 0;
+	for (; i + BlockSize <= argDst.size(); i += BlockSize)
+		NextBlock(argDst.data() + i);
+	if (i < argDst.size())
+	{
+		uint32_t block[BlockSize];
+		NextBlock(block);
+		std::copy_n(block, argDst.size() - i, argDst.data() + i);
+	}
+}
+
+void Utility::Math::RandomStream::FillUniform(Span<float> argDst, float argMin, float argMax)
+{
+	const float Scale = argMax - argMin;
+	uint32_t block[BlockSize];
+	float values[BlockSize];
+	for (size_t i = 0; i < argDst.size(); i += BlockSize)
+	{
+		NextBlock(block);
+		// 回数を固定してコンパイラにベクトル化させる
+		for (size_t j = 0; j < BlockSize; ++j)
+			values[j] = argMin + Scale * Random::ToUniform(block[j]);
+		std::copy_n(values, std::min(BlockSize, argDst.size() - i), argDst.data() + i);
+	}
+}
+
+void Utility::Math::RandomStream::FillNormal(Span<float> argDst, float argMean, float argStdDev)
+{
+	using L = Simd::WideLanes;
+	static_assert(LaneCount % L::Width == 0, "RandomStream lane count must be a multiple of the SIMD width...");
+
+	uint32_t block[BlockSize];
+	float u[BlockSize];
+	float result[BlockSize];
+	for (size_t i = 0; i < argDst.size(); i += BlockSize)
+	{
+		NextBlock(block);
+		for (size_t j = 0; j < BlockSize; ++j)
+			u[j] = Random::ToUniform(block[j]);
+
+		// 前半を半径(1 - uは(0, 1]なので対数が発散しない)、後半を角度にして2つずつ作る
+		for (size_t j = 0; j < LaneCount; j += L::Width)
+		{
+			const L::Reg U1 = L::Sub(L::Set(1.f), L::Load(u + j));
+			const L::Reg U2 = L::Load(u + LaneCount + j);
+			const L::Reg Radius = L::Mul(L::Set(argStdDev), L::Sqrt(L::Mul(L::Set(-2.f), FastMath<>::LogLanes<L>(U1))));
+			L::Reg s, c;
+			FastMath<>::SinCosLanes<L>(L::Mul(L::Set(6.28318530717958648f), U2), &s, &c);
+			L::Store(result + j, L::Add(L::Set(argMean), L::Mul(Radius, c)));
+			L::Store(result + LaneCount + j, L::Add(L::Set(argMean), L::Mul(Radius, s)));
+		}
+
+		const size_t Count = std::min(BlockSize, argDst.size() - i);
+		std::copy_n(result, Count, argDst.data() + i);
+	}
+}
+#pragma endregion	RandomStream
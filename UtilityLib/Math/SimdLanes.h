@@ -0,0 +1,230 @@
+﻿/**
+ *	@file	SimdLanes.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ *	@note	成分ごとの配列(SoA)を処理するカーネル用の演算の型とSimd::Run。
+ *			FastMathの*Lanes関数が型引数に取るので公開ヘッダーとして扱う。
+ *			どの型も同じ名前の関数を持ち、ScalarLanesと同じ結果になる(Roundは最近接偶数、Min/MaxはNaNのとき2つ目の引数)
+ */
+#pragma once
+
+#include "../Task/ThreadPool.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UTILITY_MATH_LANES_AVX2 1
+#endif
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTILITY_MATH_LANES_SSE2 1
+#endif
+
+namespace Utility
+{
+	namespace Math
+	{
+		namespace Simd
+		{
+			/**
+			 *  @struct		ScalarLanes
+			 *  @brief		1要素ずつの演算(端数と命令セットがない環境用)
+			 */
+			struct ScalarLanes
+			{
+				using Reg = float;
+				using Mask = bool;
+				static const size_t Width = 1;
+
+				static inline Reg Load(const float *argSrc) { return *argSrc; }
+				static inline void Store(float *argDst, Reg argValue) { *argDst = argValue; }
+				static inline Reg Set(float argValue) { return argValue; }
+				static inline Reg Add(Reg argA, Reg argB) { return argA + argB; }
+				static inline Reg Sub(Reg argA, Reg argB) { return argA - argB; }
+				static inline Reg Mul(Reg argA, Reg argB) { return argA * argB; }
+				static inline Reg Div(Reg argA, Reg argB) { return argA / argB; }
+				static inline Reg Neg(Reg argValue) { return -argValue; }
+				static inline Reg Sqrt(Reg argValue) { return std::sqrt(argValue); }
+				// SSEのminps/maxpsと同じく、比べられなければ2つ目を返す
+				static inline Reg Min(Reg argA, Reg argB) { return (argA < argB) ? argA : argB; }
+				static inline Reg Max(Reg argA, Reg argB) { return (argA > argB) ? argA : argB; }
+				static inline Reg Abs(Reg argValue) { return std::fabs(argValue); }
+				static inline Reg CopySign(Reg argMagnitude, Reg argSign) { return std::copysign(argMagnitude, argSign); }
+				// cvtps2dqと同じく、現在の丸めモード(既定は最近接偶数)で丸める
+#if defined(UTILITY_MATH_LANES_SSE2)
+				static inline Reg Round(Reg argValue) { return static_cast<float>(_mm_cvtss_si32(_mm_set_ss(argValue))); }
+#else
+				static inline Reg Round(Reg argValue) { return std::nearbyint(argValue); }
+#endif
+				static inline Mask Less(Reg argA, Reg argB) { return argA < argB; }
+				static inline Mask GreaterEqual(Reg argA, Reg argB) { return argA >= argB; }
+				static inline Mask IsNaN(Reg argValue) { return std::isnan(argValue); }
+				static inline Reg Select(Mask argMask, Reg argTrue, Reg argFalse) { return argMask ? argTrue : argFalse; }
+				/**
+				 *	@fn			Pow2i
+				 *	@brief		2のargExponent乗(argExponentは-126～127の整数値)
+				 */
+				static inline Reg Pow2i(Reg argExponent)
+				{
+					const std::uint32_t Bits = static_cast<std::uint32_t>(static_cast<std::int32_t>(argExponent) + 127) << 23;
+					float value;
+					std::memcpy(&value, &Bits, sizeof(value));
+					return value;
+				}
+				/**
+				 *	@fn			SplitExponent
+				 *	@brief		正の正規化数を[1, 2)の仮数と指数に分ける
+				 *	@param[in]	argValue	!<	値
+				 *	@param[out]	argExponent	!<	指数(整数値)
+				 *	@return		仮数
+				 */
+				static inline Reg SplitExponent(Reg argValue, Reg *argExponent)
+				{
+					std::uint32_t bits;
+					std::memcpy(&bits, &argValue, sizeof(bits));
+					*argExponent = static_cast<float>(static_cast<std::int32_t>(bits >> 23) - 127);
+					bits = (bits & 0x007fffffu) | 0x3f800000u;
+					float value;
+					std::memcpy(&value, &bits, sizeof(value));
+					return value;
+				}
+				/**
+				 *	@fn			RsqrtEstimate
+				 *	@brief		ビット演算による逆平方根の初期値(相対誤差3.5e-2以下)
+				 *	@note		rsqrtpsはCPUによって結果が違うので使わない
+				 */
+				static inline Reg RsqrtEstimate(Reg argValue)
+				{
+					std::uint32_t bits;
+					std::memcpy(&bits, &argValue, sizeof(bits));
+					bits = 0x5f375a86u - (bits >> 1);
+					float value;
+					std::memcpy(&value, &bits, sizeof(value));
+					return value;
+				}
+				/**
+				 *	@fn			ZeroIfZero
+				 *	@brief		argLengthが0の要素を0にする
+				 */
+				static inline Reg ZeroIfZero(Reg argLength, Reg argValue) { return (argLength == 0.f) ? 0.f : argValue; }
+			};
+
+#if defined(UTILITY_MATH_LANES_AVX2)
+			/**
+			 *  @struct		Avx2Lanes
+			 *  @brief		8要素ずつの演算
+			 */
+			struct Avx2Lanes
+			{
+				using Reg = __m256;
+				using Mask = __m256;
+				static const size_t Width = 8;
+
+				static inline Reg Load(const float *argSrc) { return _mm256_loadu_ps(argSrc); }
+				static inline void Store(float *argDst, Reg argValue) { _mm256_storeu_ps(argDst, argValue); }
+				static inline Reg Set(float argValue) { return _mm256_set1_ps(argValue); }
+				static inline Reg Add(Reg argA, Reg argB) { return _mm256_add_ps(argA, argB); }
+				static inline Reg Sub(Reg argA, Reg argB) { return _mm256_sub_ps(argA, argB); }
+				static inline Reg Mul(Reg argA, Reg argB) { return _mm256_mul_ps(argA, argB); }
+				static inline Reg Div(Reg argA, Reg argB) { return _mm256_div_ps(argA, argB); }
+				static inline Reg Neg(Reg argValue) { return _mm256_xor_ps(argValue, _mm256_set1_ps(-0.f)); }
+				static inline Reg Sqrt(Reg argValue) { return _mm256_sqrt_ps(argValue); }
+				static inline Reg Min(Reg argA, Reg argB) { return _mm256_min_ps(argA, argB); }
+				static inline Reg Max(Reg argA, Reg argB) { return _mm256_max_ps(argA, argB); }
+				static inline Reg Abs(Reg argValue) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), argValue); }
+				static inline Reg CopySign(Reg argMagnitude, Reg argSign) { return _mm256_or_ps(Abs(argMagnitude), _mm256_and_ps(_mm256_set1_ps(-0.f), argSign)); }
+				static inline Reg Round(Reg argValue) { return _mm256_cvtepi32_ps(_mm256_cvtps_epi32(argValue)); }
+				static inline Mask Less(Reg argA, Reg argB) { return _mm256_cmp_ps(argA, argB, _CMP_LT_OQ); }
+				static inline Mask GreaterEqual(Reg argA, Reg argB) { return _mm256_cmp_ps(argA, argB, _CMP_GE_OQ); }
+				static inline Mask IsNaN(Reg argValue) { return _mm256_cmp_ps(argValue, argValue, _CMP_UNORD_Q); }
+				static inline Reg Select(Mask argMask, Reg argTrue, Reg argFalse) { return _mm256_blendv_ps(argFalse, argTrue, argMask); }
+				static inline Reg ZeroIfZero(Reg argLength, Reg argValue) { return _mm256_and_ps(_mm256_cmp_ps(argLength, _mm256_setzero_ps(), _CMP_NEQ_UQ), argValue); }
+				static inline Reg Pow2i(Reg argExponent) { return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(argExponent), _mm256_set1_epi32(127)), 23)); }
+				static inline Reg SplitExponent(Reg argValue, Reg *argExponent)
+				{
+					const __m256i Bits = _mm256_castps_si256(argValue);
+					*argExponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(Bits, 23), _mm256_set1_epi32(127)));
+					return _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(Bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f800000)));
+				}
+				static inline Reg RsqrtEstimate(Reg argValue) { return _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32(0x5f375a86), _mm256_srli_epi32(_mm256_castps_si256(argValue), 1))); }
+			};
+			using WideLanes = Avx2Lanes;
+#elif defined(UTILITY_MATH_LANES_SSE2)
+			/**
+			 *  @struct		Sse2Lanes
+			 *  @brief		4要素ずつの演算
+			 */
+			struct Sse2Lanes
+			{
+				using Reg = __m128;
+				using Mask = __m128;
+				static const size_t Width = 4;
+
+				static inline Reg Load(const float *argSrc) { return _mm_loadu_ps(argSrc); }
+				static inline void Store(float *argDst, Reg argValue) { _mm_storeu_ps(argDst, argValue); }
+				static inline Reg Set(float argValue) { return _mm_set1_ps(argValue); }
+				static inline Reg Add(Reg argA, Reg argB) { return _mm_add_ps(argA, argB); }
+				static inline Reg Sub(Reg argA, Reg argB) { return _mm_sub_ps(argA, argB); }
+				static inline Reg Mul(Reg argA, Reg argB) { return _mm_mul_ps(argA, argB); }
+				static inline Reg Div(Reg argA, Reg argB) { return _mm_div_ps(argA, argB); }
+				static inline Reg Neg(Reg argValue) { return _mm_xor_ps(argValue, _mm_set1_ps(-0.f)); }
+				static inline Reg Sqrt(Reg argValue) { return _mm_sqrt_ps(argValue); }
+				static inline Reg Min(Reg argA, Reg argB) { return _mm_min_ps(argA, argB); }
+				static inline Reg Max(Reg argA, Reg argB) { return _mm_max_ps(argA, argB); }
+				static inline Reg Abs(Reg argValue) { return _mm_andnot_ps(_mm_set1_ps(-0.f), argValue); }
+				static inline Reg CopySign(Reg argMagnitude, Reg argSign) { return _mm_or_ps(Abs(argMagnitude), _mm_and_ps(_mm_set1_ps(-0.f), argSign)); }
+				static inline Reg Round(Reg argValue) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(argValue)); }
+				static inline Mask Less(Reg argA, Reg argB) { return _mm_cmplt_ps(argA, argB); }
+				static inline Mask GreaterEqual(Reg argA, Reg argB) { return _mm_cmpge_ps(argA, argB); }
+				static inline Mask IsNaN(Reg argValue) { return _mm_cmpunord_ps(argValue, argValue); }
+				static inline Reg Select(Mask argMask, Reg argTrue, Reg argFalse) { return _mm_or_ps(_mm_and_ps(argMask, argTrue), _mm_andnot_ps(argMask, argFalse)); }
+				static inline Reg ZeroIfZero(Reg argLength, Reg argValue) { return _mm_and_ps(_mm_cmpneq_ps(argLength, _mm_setzero_ps()), argValue); }
+				static inline Reg Pow2i(Reg argExponent) { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(argExponent), _mm_set1_epi32(127)), 23)); }
+				static inline Reg SplitExponent(Reg argValue, Reg *argExponent)
+				{
+					const __m128i Bits = _mm_castps_si128(argValue);
+					*argExponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(127)));
+					return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000)));
+				}
+				static inline Reg RsqrtEstimate(Reg argValue) { return _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32(0x5f375a86), _mm_srli_epi32(_mm_castps_si128(argValue), 1))); }
+			};
+			using WideLanes = Sse2Lanes;
+#else
+			using WideLanes = ScalarLanes;
+#endif
+
+			/**
+			 *	@fn			Run
+			 *	@brief		カーネルを全要素に適用する
+			 *	@note		カーネルはApply<Lanes>(i)でi番目からLanes::Width個を処理する。
+			 *				整数などfloat以外の要素はWide、Narrowに別のLanesを指定する(NarrowはWidth 1)
+			 *	@param[in]	argKernel	!<	カーネル
+			 *	@param[in]	argCount	!<	要素数
+			 *	@param[in]	argGrain	!<	並列に処理するときの1塊の要素数(Wide::Widthの倍数)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			template<typename Wide = WideLanes, typename Narrow = ScalarLanes, typename Kernel>
+			inline void Run(const Kernel &argKernel, size_t argCount, size_t argGrain, ThreadPool *argPool)
+			{
+				auto Range = [&argKernel](size_t argBegin, size_t argEnd)
+				{
+					size_t i = argBegin;
+					for (; i + Wide::Width <= argEnd; i += Wide::Width)
+						argKernel.template Apply<Wide>(i);
+					for (; i < argEnd; ++i)
+						argKernel.template Apply<Narrow>(i);
+				};
+
+				if (argPool != nullptr && argCount > argGrain)
+					argPool->ParallelFor(argCount, argGrain, Range);
+				else
+					Range(0, argCount);
+			}
+		}
+	}
+}
@@ -0,0 +1,298 @@
+﻿/**
+ *	@file	Spline.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "Spline.h"
+#include "../Task/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	/*
+	 *	ガウス・ルジャンドルの3点の節点([0, 1]に写したもの)と重み。
+	 *	3次式の接線の長さは滑らかなので、小区間ごとに3点で十分な精度になる。
+	 */
+	const float GaussNode = 0.387298334620741688f;	// sqrt(3 / 5) / 2
+	const float GaussNodes[3] = { 0.5f - GaussNode, 0.5f, 0.5f + GaussNode };
+	const float GaussWeights[3] = { 5.f / 18.f, 8.f / 18.f, 5.f / 18.f };
+
+	/**
+	 *	@fn			ForEach
+	 *	@brief		argFunc(i)を全要素に適用する(プールがあり要素数が多ければ並列に処理する)
+	 */
+	template<typename Func>
+	void ForEach(size_t argCount, size_t argGrain, Utility::ThreadPool *argPool, const Func &argFunc)
+	{
+		auto Range = [&argFunc](size_t argBegin, size_t argEnd)
+		{
+			for (size_t i = argBegin; i < argEnd; ++i)
+				argFunc(i);
+		};
+
+		if (argPool != nullptr && argCount > argGrain)
+			argPool->ParallelFor(argCount, argGrain, Range);
+		else
+			Range(0, argCount);
+	}
+
+	/**
+	 *	@fn			RotationAngle
+	 *	@brief		2つの回転の間の回転角
+	 *	@note		2 * acos(|q0・q1|)は角度が小さいと精度が落ちるので、差の長さ|q1 - q0| = 2 * sin(θ / 4)から求める
+	 */
+	float RotationAngle(const Utility::Math::Quaternion &argQ0, const Utility::Math::Quaternion &argQ1)
+	{
+		const float Sign = (argQ0.Dot(argQ1) < 0.f) ? -1.f : 1.f;
+		const float X = argQ1.x - argQ0.x * Sign;
+		const float Y = argQ1.y - argQ0.y * Sign;
+		const float Z = argQ1.z - argQ0.z * Sign;
+		const float W = argQ1.w - argQ0.w * Sign;
+		const float HalfLength = 0.5f * std::sqrt(X * X + Y * Y + Z * Z + W * W);
+		return 4.f * std::asin(std::min(1.f, HalfLength));
+	}
+
+	/**
+	 *	@fn			ParameterAtTable
+	 *	@brief		累積値の表を線形補間して媒介変数を求める
+	 *	@param[in]	argTable	!<	区間数 * 分割数 + 1個の累積値
+	 *	@param[in]	argValue	!<	累積値(表の範囲に丸める)
+	 */
+	float ParameterAtTable(const std::vector<float> &argTable, float argValue)
+	{
+		assert(argTable.size() >= 2 && "Table is empty...");
+		const size_t Last = argTable.size() - 1;
+		if (argValue <= 0.f)
+			return 0.f;
+		if (argValue >= argTable[Last])
+			return 1.f;
+
+		size_t index = static_cast<size_t>(std::upper_bound(argTable.begin(), argTable.end(), argValue) - argTable.begin());
+		index = (index == 0) ? 0 : (index > Last) ? Last - 1 : index - 1;
+		const float Width = argTable[index + 1] - argTable[index];
+		const float Fraction = (Width > 0.f) ? (argValue - argTable[index]) / Width : 0.f;
+		return (static_cast<float>(index) + Fraction) / static_cast<float>(Last);
+	}
+}
+
+#pragma region		Spline
+template<typename TVector>
+Utility::Math::Spline<TVector> Utility::Math::Spline<TVector>::CatmullRom(Span<const TVector> argPoints, size_t argSamples)
+{
+	assert(argPoints.size() >= 2 && "Catmull-Rom spline needs at least 2 points...");
+
+	// 接線 m_i = (P_{i+1} - P_{i-1}) / 2 のエルミート曲線にする(両端は隣の点との差)
+	const size_t Count = argPoints.size();
+	std::vector<TVector> tangents(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		const TVector &Prev = argPoints[(i == 0) ? 0 : i - 1];
+		const TVector &Next = argPoints[(i + 1 == Count) ? i : i + 1];
+		tangents[i] = (Next - Prev) * ((i == 0 || i + 1 == Count) ? 1.f : 0.5f);
+	}
+	return Hermite(argPoints, Span<const TVector>(tangents.data(), tangents.size()), argSamples);
+}
+
+template<typename TVector>
+Utility::Math::Spline<TVector> Utility::Math::Spline<TVector>::Bezier(Span<const TVector> argPoints, size_t argSamples)
+{
+	assert(argPoints.size() >= 4 && (argPoints.size() - 1) % 3 == 0 && "Bezier spline needs 3 * N + 1 points...");
+
+	Spline result;
+	const size_t Count = (argPoints.size() - 1) / 3;
+	result.segments_.resize(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		const TVector &P0 = argPoints[i * 3 + 0];
+		const TVector &C0 = argPoints[i * 3 + 1];
+		const TVector &C1 = argPoints[i * 3 + 2];
+		const TVector &P1 = argPoints[i * 3 + 3];
+
+		Cubic &segment = result.segments_[i];
+		segment.a = (P1 - P0) + (C0 - C1) * 3.f;
+		segment.b = (P0 + C1) * 3.f - C0 * 6.f;
+		segment.c = (C0 - P0) * 3.f;
+		segment.d = P0;
+	}
+	result.BuildLengthTable(argSamples);
+	return result;
+}
+
+template<typename TVector>
+Utility::Math::Spline<TVector> Utility::Math::Spline<TVector>::Hermite(Span<const TVector> argPositions, Span<const TVector> argTangents, size_t argSamples)
+{
+	assert(argPositions.size() >= 2 && "Hermite spline needs at least 2 points...");
+	assert(argPositions.size() == argTangents.size() && "Hermite spline tangent count mismatch...");
+
+	Spline result;
+	const size_t Count = argPositions.size() - 1;
+	result.segments_.resize(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		const TVector &P0 = argPositions[i];
+		const TVector &P1 = argPositions[i + 1];
+		const TVector &M0 = argTangents[i];
+		const TVector &M1 = argTangents[i + 1];
+
+		Cubic &segment = result.segments_[i];
+		segment.a = (P0 - P1) * 2.f + M0 + M1;
+		segment.b = (P1 - P0) * 3.f - M0 * 2.f - M1;
+		segment.c = M0;
+		segment.d = P0;
+	}
+	result.BuildLengthTable(argSamples);
+	return result;
+}
+
+template<typename TVector>
+float Utility::Math::Spline<TVector>::ParameterAtDistance(float argDistance) const
+{
+	const float T = ParameterAtTable(lengths_, argDistance);
+	if (T <= 0.f || T >= 1.f)
+		return T;
+
+	// 表の小区間の中は速さが一定ではないので、小区間の始めからの弧長で1回だけ補正する
+	const size_t Last = lengths_.size() - 1;
+	const float X = T * static_cast<float>(Last);
+	const size_t Index = std::min(static_cast<size_t>(X), Last - 1);
+	const size_t Segment = Index / samples_;
+	const float Step = 1.f / static_cast<float>(samples_);
+	const float Begin = static_cast<float>(Index % samples_) * Step;
+	const float Local = X / static_cast<float>(samples_) - static_cast<float>(Segment);
+
+	const Cubic &C = segments_[Segment];
+	const float Speed = Derivative(C, Local).Length();
+	if (Speed <= 0.f)
+		return T;
+	const float Error = lengths_[Index] + ArcLength(C, Begin, Local) - argDistance;
+	const float Corrected = std::min(std::max(Local - Error / Speed, Begin), Begin + Step);
+	return (static_cast<float>(Segment) + Corrected) / static_cast<float>(segments_.size());
+}
+
+template<typename TVector>
+void Utility::Math::Spline<TVector>::Evaluate(Span<const float> argT, Span<TVector> argDst, ThreadPool *argPool) const
+{
+	assert(argDst.size() >= argT.size() && "Destination is too small...");
+	const float *T = argT.data();
+	TVector *Dst = argDst.data();
+	ForEach(argT.size(), ParallelGrain, argPool, [this, T, Dst](size_t i) { Dst[i] = Evaluate(T[i]); });
+}
+
+template<typename TVector>
+void Utility::Math::Spline<TVector>::EvaluateAtDistance(Span<const float> argDistance, Span<TVector> argDst, ThreadPool *argPool) const
+{
+	assert(argDst.size() >= argDistance.size() && "Destination is too small...");
+	const float *Distance = argDistance.data();
+	TVector *Dst = argDst.data();
+	ForEach(argDistance.size(), ParallelGrain, argPool, [this, Distance, Dst](size_t i) { Dst[i] = EvaluateAtDistance(Distance[i]); });
+}
+
+template<typename TVector>
+void Utility::Math::Spline<TVector>::BuildLengthTable(size_t argSamples)
+{
+	assert(argSamples > 0 && "Length table needs at least 1 sample per segment...");
+	samples_ = argSamples;
+	lengths_.resize(segments_.size() * samples_ + 1);
+	lengths_[0] = 0.f;
+
+	const float Step = 1.f / static_cast<float>(samples_);
+	size_t index = 0;
+	for (const Cubic &Segment : segments_)
+	{
+		for (size_t i = 0; i < samples_; ++i, ++index)
+		{
+			const float Begin = static_cast<float>(i) * Step;
+			lengths_[index + 1] = lengths_[index] + ArcLength(Segment, Begin, Begin + Step);
+		}
+	}
+}
+
+template<typename TVector>
+float Utility::Math::Spline<TVector>::ArcLength(const Cubic &argCubic, float argBegin, float argEnd)
+{
+	const float Width = argEnd - argBegin;
+	float length = 0.f;
+	for (size_t i = 0; i < 3; ++i)
+		length += GaussWeights[i] * Derivative(argCubic, argBegin + GaussNodes[i] * Width).Length();
+	return length * Width;
+}
+
+template class Utility::Math::Spline<Utility::Math::Vector2>;
+template class Utility::Math::Spline<Utility::Math::Vector3>;
+#pragma endregion	Spline
+
+#pragma region		QuaternionSpline
+Utility::Math::QuaternionSpline::QuaternionSpline(Span<const Quaternion> argRotations, size_t argSamples)
+	: samples_(argSamples)
+{
+	assert(argRotations.size() >= 2 && "Quaternion spline needs at least 2 rotations...");
+	assert(argSamples > 0 && "Angle table needs at least 1 sample per segment...");
+	using namespace DirectX;
+
+	// 両端は端の回転を繰り返して制御点を作る
+	const size_t Count = argRotations.size() - 1;
+	segments_.resize(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		const XMVECTOR Q0 = XMLoadFloat4(&argRotations[(i == 0) ? 0 : i - 1]);
+		const XMVECTOR Q1 = XMLoadFloat4(&argRotations[i]);
+		const XMVECTOR Q2 = XMLoadFloat4(&argRotations[i + 1]);
+		const XMVECTOR Q3 = XMLoadFloat4(&argRotations[(i + 2 > Count) ? Count : i + 2]);
+
+		XMVECTOR a, b, c;
+		XMQuaternionSquadSetup(&a, &b, &c, Q0, Q1, Q2, Q3);
+		segments_[i].q0 = Quaternion(Q1);
+		segments_[i].a = Quaternion(a);
+		segments_[i].b = Quaternion(b);
+		segments_[i].c = Quaternion(c);
+	}
+
+	// 隣り合う標本の間の回転角を積み上げる
+	const size_t Last = Count * samples_;
+	angles_.resize(Last + 1);
+	angles_[0] = 0.f;
+	Quaternion prev = Evaluate(0.f);
+	for (size_t i = 1; i <= Last; ++i)
+	{
+		const Quaternion Current = Evaluate(static_cast<float>(i) / static_cast<float>(Last));
+		angles_[i] = angles_[i - 1] + RotationAngle(prev, Current);
+		prev = Current;
+	}
+}
+
+Utility::Math::Quaternion Utility::Math::QuaternionSpline::Evaluate(float argT) const
+{
+	assert(!segments_.empty() && "Quaternion spline is empty...");
+	using namespace DirectX;
+
+	const float X = ((argT < 0.f) ? 0.f : (argT > 1.f) ? 1.f : argT) * static_cast<float>(segments_.size());
+	size_t index = static_cast<size_t>(X);
+	index = (index < segments_.size()) ? index : segments_.size() - 1;
+	const Segment &S = segments_[index];
+	return Quaternion(XMQuaternionSquad(XMLoadFloat4(&S.q0), XMLoadFloat4(&S.a), XMLoadFloat4(&S.b), XMLoadFloat4(&S.c), X - static_cast<float>(index)));
+}
+
+float Utility::Math::QuaternionSpline::ParameterAtAngle(float argAngle) const
+{
+	return ParameterAtTable(angles_, argAngle);
+}
+
+void Utility::Math::QuaternionSpline::Evaluate(Span<const float> argT, Span<Quaternion> argDst, ThreadPool *argPool) const
+{
+	assert(argDst.size() >= argT.size() && "Destination is too small...");
+	const float *T = argT.data();
+	Quaternion *Dst = argDst.data();
+	ForEach(argT.size(), ParallelGrain, argPool, [this, T, Dst](size_t i) { Dst[i] = Evaluate(T[i]); });
+}
+
+void Utility::Math::QuaternionSpline::EvaluateAtAngle(Span<const float> argAngle, Span<Quaternion> argDst, ThreadPool *argPool) const
+{
+	assert(argDst.size() >= argAngle.size() && "Destination is too small...");
+	const float *Angle = argAngle.data();
+	Quaternion *Dst = argDst.data();
+	ForEach(argAngle.size(), ParallelGrain, argPool, [this, Angle, Dst](size_t i) { Dst[i] = EvaluateAtAngle(Angle[i]); });
+}
+#pragma endregion	QuaternionSpline
@@ -0,0 +1,264 @@
+﻿/**
+ *	@file	Spline.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Vector2f.h"
+#include "Vector3f.h"
+#include "Quaternion.h"
+#include "../Span.h"
+
+#include <cstddef>
+#include <vector>
+#include <assert.h>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	namespace Math
+	{
+		/**
+		 *  @class		Spline
+		 *  @brief		3次の区分曲線(Vector2、Vector3)
+		 *  @note		Catmull-Rom、ベジェ、エルミートのどれで作っても区間ごとに3次式の係数で持ち、同じ計算で評価する。
+		 *				媒介変数tは曲線全体で[0, 1]、区間は等分に割り当てる(tは速さが一定にならない)。
+		 *				作るときに弧長の表を作るので、...AtDistanceは距離を指定して一定の速さで動かせる。
+		 *				配列の評価はThreadPoolを渡すとParallelGrain個ずつに分けて並列に処理する。
+		 */
+		template<typename TVector>
+		class Spline final
+		{
+		public:
+			static const size_t DefaultSamples = 16;		//	!<	1区間あたりの弧長の表の分割数
+			static const size_t ParallelGrain = 4096;	//	!<	並列に処理するときの1塊の要素数
+
+		private:
+			/**
+			 *  @struct		Cubic
+			 *  @brief		1区間の3次式((a * t + b) * t + c) * t + d
+			 */
+			struct Cubic
+			{
+				TVector a;
+				TVector b;
+				TVector c;
+				TVector d;
+			};
+
+		private:
+			std::vector<Cubic>	segments_;
+			std::vector<float>	lengths_;	//	!<	弧長の表(区間数 * samples_ + 1個の累積距離)
+			size_t				samples_;
+
+		public:
+			Spline() : samples_(DefaultSamples) {}
+
+		public:
+			/**
+			 *	@fn			CatmullRom
+			 *	@brief		全ての点を通るCatmull-Romスプライン
+			 *	@param[in]	argPoints	!<	通る点(2個以上。両端の接線は隣の点から作る)
+			 *	@param[in]	argSamples	!<	1区間あたりの弧長の表の分割数
+			 */
+			static Spline CatmullRom(Span<const TVector> argPoints, size_t argSamples = DefaultSamples);
+			/**
+			 *	@fn			Bezier
+			 *	@brief		3次ベジェ曲線をつないだ曲線
+			 *	@param[in]	argPoints	!<	始点、制御点、制御点、終点(次の区間の始点)…の順(3 * 区間数 + 1個)
+			 *	@param[in]	argSamples	!<	1区間あたりの弧長の表の分割数
+			 */
+			static Spline Bezier(Span<const TVector> argPoints, size_t argSamples = DefaultSamples);
+			/**
+			 *	@fn			Hermite
+			 *	@brief		点と接線を指定するエルミート曲線
+			 *	@param[in]	argPositions	!<	通る点(2個以上)
+			 *	@param[in]	argTangents		!<	各点の接線(argPositionsと同じ要素数)
+			 *	@param[in]	argSamples		!<	1区間あたりの弧長の表の分割数
+			 */
+			static Spline Hermite(Span<const TVector> argPositions, Span<const TVector> argTangents, size_t argSamples = DefaultSamples);
+
+		public:
+			inline size_t SegmentCount() const { return segments_.size(); }
+			inline bool Empty() const { return segments_.empty(); }
+			/**
+			 *	@fn			Length
+			 *	@brief		曲線全体の長さ(弧長の表から求めた値)
+			 */
+			inline float Length() const { return lengths_.empty() ? 0.f : lengths_.back(); }
+
+			/**
+			 *	@fn			Evaluate
+			 *	@brief		曲線上の点
+			 *	@param[in]	argT	!<	媒介変数(0～1に丸める)
+			 */
+			inline TVector Evaluate(float argT) const
+			{
+				size_t index = 0;
+				float t = 0.f;
+				Locate(argT, &index, &t);
+				const Cubic &C = segments_[index];
+				return ((C.a * t + C.b) * t + C.c) * t + C.d;
+			}
+			/**
+			 *	@fn			Tangent
+			 *	@brief		曲線上の接線(区間内の媒介変数での微分)
+			 *	@param[in]	argT	!<	媒介変数(0～1に丸める)
+			 */
+			inline TVector Tangent(float argT) const
+			{
+				size_t index = 0;
+				float t = 0.f;
+				Locate(argT, &index, &t);
+				return Derivative(segments_[index], t);
+			}
+			/**
+			 *	@fn			ParameterAtDistance
+			 *	@brief		始点からの距離に対応する媒介変数(弧長の表を線形補間し、ニュートン法で1回補正する)
+			 *	@param[in]	argDistance	!<	始点からの距離(0～Length()に丸める)
+			 */
+			float ParameterAtDistance(float argDistance) const;
+			/**
+			 *	@fn			EvaluateAtDistance
+			 *	@brief		始点から曲線に沿ってargDistance進んだ点
+			 */
+			inline TVector EvaluateAtDistance(float argDistance) const { return Evaluate(ParameterAtDistance(argDistance)); }
+
+			/**
+			 *	@fn			Evaluate
+			 *	@brief		曲線上の点をまとめて求める
+			 *	@param[in]	argT	!<	媒介変数
+			 *	@param[out]	argDst	!<	点(argTの要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			void Evaluate(Span<const float> argT, Span<TVector> argDst, ThreadPool *argPool = nullptr) const;
+			/**
+			 *	@fn			EvaluateAtDistance
+			 *	@brief		始点からの距離で曲線上の点をまとめて求める
+			 *	@param[in]	argDistance	!<	始点からの距離
+			 *	@param[out]	argDst		!<	点(argDistanceの要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			void EvaluateAtDistance(Span<const float> argDistance, Span<TVector> argDst, ThreadPool *argPool = nullptr) const;
+
+		private:
+			/**
+			 *	@fn			Locate
+			 *	@brief		媒介変数から区間と区間内の媒介変数を求める
+			 */
+			inline void Locate(float argT, size_t *argIndex, float *argLocal) const
+			{
+				assert(!segments_.empty() && "Spline is empty...");
+				const float Count = static_cast<float>(segments_.size());
+				const float X = ((argT < 0.f) ? 0.f : (argT > 1.f) ? 1.f : argT) * Count;
+				const size_t Index = static_cast<size_t>(X);
+				*argIndex = (Index < segments_.size()) ? Index : segments_.size() - 1;
+				*argLocal = X - static_cast<float>(*argIndex);
+			}
+			static inline TVector Derivative(const Cubic &argCubic, float argT)
+			{
+				return (argCubic.a * (3.f * argT) + argCubic.b * 2.f) * argT + argCubic.c;
+			}
+			/**
+			 *	@fn			ArcLength
+			 *	@brief		区間内の[argBegin, argEnd]の弧長(接線の長さをガウス・ルジャンドルの3点で積分する)
+			 */
+			static float ArcLength(const Cubic &argCubic, float argBegin, float argEnd);
+			/**
+			 *	@fn			BuildLengthTable
+			 *	@brief		弧長の表を作る
+			 */
+			void BuildLengthTable(size_t argSamples);
+		};
+
+		extern template class Spline<Vector2>;
+		extern template class Spline<Vector3>;
+
+		using Spline2 = Spline<Vector2>;
+		using Spline3 = Spline<Vector3>;
+
+		/**
+		 *  @class		QuaternionSpline
+		 *  @brief		全ての回転を滑らかに通る回転の曲線(球面四角形補間、SQUAD)
+		 *  @note		媒介変数tは曲線全体で[0, 1]、区間は等分に割り当てる。
+		 *				作るときに回転角の累積の表を作るので、...AtAngleは一定の角速度で回せる。
+		 */
+		class QuaternionSpline final
+		{
+		public:
+			static const size_t DefaultSamples = 16;		//	!<	1区間あたりの回転角の表の分割数
+			static const size_t ParallelGrain = 4096;	//	!<	並列に処理するときの1塊の要素数
+
+		private:
+			/**
+			 *  @struct		Segment
+			 *  @brief		1区間のSQUADの制御点(XMQuaternionSquadSetupの結果)
+			 */
+			struct Segment
+			{
+				Quaternion q0;
+				Quaternion a;
+				Quaternion b;
+				Quaternion c;
+			};
+
+		private:
+			std::vector<Segment>	segments_;
+			std::vector<float>		angles_;	//	!<	回転角の表(区間数 * samples_ + 1個の累積角度)
+			size_t					samples_;
+
+		public:
+			QuaternionSpline() : samples_(DefaultSamples) {}
+			/**
+			 *	@constructor	QuaternionSpline
+			 *	@brief			回転の曲線を作る
+			 *	@param[in]		argRotations	!<	通る回転(2個以上。正規化しておく)
+			 *	@param[in]		argSamples		!<	1区間あたりの回転角の表の分割数
+			 */
+			explicit QuaternionSpline(Span<const Quaternion> argRotations, size_t argSamples = DefaultSamples);
+
+		public:
+			inline size_t SegmentCount() const { return segments_.size(); }
+			inline bool Empty() const { return segments_.empty(); }
+			/**
+			 *	@fn			Angle
+			 *	@brief		曲線全体の回転角(ラジアン)
+			 */
+			inline float Angle() const { return angles_.empty() ? 0.f : angles_.back(); }
+
+			/**
+			 *	@fn			Evaluate
+			 *	@brief		曲線上の回転
+			 *	@param[in]	argT	!<	媒介変数(0～1に丸める)
+			 */
+			Quaternion Evaluate(float argT) const;
+			/**
+			 *	@fn			ParameterAtAngle
+			 *	@brief		始めからの回転角に対応する媒介変数
+			 *	@param[in]	argAngle	!<	始めからの回転角(0～Angle()に丸める)
+			 */
+			float ParameterAtAngle(float argAngle) const;
+			inline Quaternion EvaluateAtAngle(float argAngle) const { return Evaluate(ParameterAtAngle(argAngle)); }
+
+			/**
+			 *	@fn			Evaluate
+			 *	@brief		曲線上の回転をまとめて求める
+			 *	@param[in]	argT	!<	媒介変数
+			 *	@param[out]	argDst	!<	回転(argTの要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			void Evaluate(Span<const float> argT, Span<Quaternion> argDst, ThreadPool *argPool = nullptr) const;
+			/**
+			 *	@fn			EvaluateAtAngle
+			 *	@brief		始めからの回転角で曲線上の回転をまとめて求める
+			 *	@param[in]	argAngle	!<	始めからの回転角
+			 *	@param[out]	argDst		!<	回転(argAngleの要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			void EvaluateAtAngle(Span<const float> argAngle, Span<Quaternion> argDst, ThreadPool *argPool = nullptr) const;
+		};
+	}
+}
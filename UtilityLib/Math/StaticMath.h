@@ -0,0 +1,443 @@
+﻿/**
+ *	@file	StaticMath.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Vector2f.h"
+#include "Vector3f.h"
+#include "Vector4f.h"
+#include "Quaternion.h"
+#include "Matrix.h"
+
+namespace Utility
+{
+	namespace Math
+	{
+		/**
+		 *  @class		StaticMath
+		 *  @brief		コンパイル時に計算できる数学関数
+		 *  @note		倍精度で計算してfloatに丸めるので、実行時のstd::の関数とほぼ同じ値になる(最終桁が違うことはある)
+		 */
+		class StaticMath final
+		{
+		public:
+			static constexpr double Pi = 3.14159265358979323846;
+
+		public:
+			/**
+			 *	@fn			Sqrt
+			 *	@brief		平方根(負の値は0)
+			 */
+			static constexpr float Sqrt(float argValue)
+			{
+				if (!(argValue > 0.f))
+					return 0.f;
+				// 1以上なら値、1未満なら1から始めれば単調に収束する
+				double x = static_cast<double>(argValue);
+				double result = (x > 1.0) ? x : 1.0;
+				for (int i = 0; i < 1024; ++i)
+				{
+					const double Next = 0.5 * (result + x / result);
+					if (Next >= result)
+						break;
+					result = Next;
+				}
+				return static_cast<float>(result);
+			}
+
+			/**
+			 *	@fn			SinCos
+			 *	@brief		正弦と余弦
+			 *	@param[in]	argAngle	!<	角度(ラジアン)
+			 *	@param[out]	argSin		!<	正弦
+			 *	@param[out]	argCos		!<	余弦
+			 */
+			static constexpr void SinCos(float argAngle, float *argSin, float *argCos)
+			{
+				// [-π, π]に縮約して[-π/2, π/2]に折り返し、テイラー展開する
+				double x = static_cast<double>(argAngle);
+				const double Turns = x / (2.0 * Pi);
+				const long long Quotient = static_cast<long long>((Turns < 0.0) ? Turns - 0.5 : Turns + 0.5);
+				x -= static_cast<double>(Quotient) * (2.0 * Pi);
+				double cosSign = 1.0;
+				if (x > Pi * 0.5)
+				{
+					x = Pi - x;
+					cosSign = -1.0;
+				}
+				else if (x < -Pi * 0.5)
+				{
+					x = -Pi - x;
+					cosSign = -1.0;
+				}
+
+				const double X2 = x * x;
+				double sinTerm = x;
+				double cosTerm = 1.0;
+				double sinSum = sinTerm;
+				double cosSum = cosTerm;
+				for (int n = 1; n < 12; ++n)
+				{
+					sinTerm *= -X2 / ((2 * n) * (2 * n + 1));
+					cosTerm *= -X2 / ((2 * n - 1) * (2 * n));
+					sinSum += sinTerm;
+					cosSum += cosTerm;
+				}
+				*argSin = static_cast<float>(sinSum);
+				*argCos = static_cast<float>(cosSign * cosSum);
+			}
+			static constexpr float Sin(float argAngle)
+			{
+				float s = 0.f, c = 0.f;
+				SinCos(argAngle, &s, &c);
+				return s;
+			}
+			static constexpr float Cos(float argAngle)
+			{
+				float s = 0.f, c = 0.f;
+				SinCos(argAngle, &s, &c);
+				return c;
+			}
+			static constexpr float ToRadian(float argDegree) { return static_cast<float>(argDegree * Pi / 180.0); }
+		};
+
+		/**
+		 *  @struct		StaticVector2
+		 *  @brief		コンパイル時に計算できる2次元ベクトル(XMFLOAT2と同じ並び)
+		 */
+		struct StaticVector2
+		{
+			float x;
+			float y;
+
+			constexpr StaticVector2() : x(0.f), y(0.f) {}
+			constexpr StaticVector2(float argX, float argY) : x(argX), y(argY) {}
+
+			constexpr StaticVector2 operator+(const StaticVector2 &argOther) const { return StaticVector2(x + argOther.x, y + argOther.y); }
+			constexpr StaticVector2 operator-(const StaticVector2 &argOther) const { return StaticVector2(x - argOther.x, y - argOther.y); }
+			constexpr StaticVector2 operator*(float argScale) const { return StaticVector2(x * argScale, y * argScale); }
+			constexpr StaticVector2 operator/(float argScale) const { return StaticVector2(x / argScale, y / argScale); }
+			constexpr StaticVector2 operator-() const { return StaticVector2(-x, -y); }
+			constexpr bool operator==(const StaticVector2 &argOther) const { return x == argOther.x && y == argOther.y; }
+			constexpr bool operator!=(const StaticVector2 &argOther) const { return !(*this == argOther); }
+
+			constexpr float Dot(const StaticVector2 &argOther) const { return x * argOther.x + y * argOther.y; }
+			constexpr float LengthSquared() const { return Dot(*this); }
+			constexpr float Length() const { return StaticMath::Sqrt(LengthSquared()); }
+			constexpr StaticVector2 Normalize() const
+			{
+				const float Len = Length();
+				return (Len > 0.f) ? *this / Len : StaticVector2();
+			}
+			static constexpr StaticVector2 Lerp(const StaticVector2 &argA, const StaticVector2 &argB, float argT) { return argA + (argB - argA) * argT; }
+
+			inline operator Vector2() const { return Vector2(x, y); }
+			inline DirectX::XMVECTOR Load() const { return DirectX::XMLoadFloat2(reinterpret_cast<const DirectX::XMFLOAT2*>(this)); }
+		};
+
+		/**
+		 *  @struct		StaticVector3
+		 *  @brief		コンパイル時に計算できる3次元ベクトル(XMFLOAT3と同じ並び)
+		 */
+		struct StaticVector3
+		{
+			float x;
+			float y;
+			float z;
+
+			constexpr StaticVector3() : x(0.f), y(0.f), z(0.f) {}
+			constexpr StaticVector3(float argX, float argY, float argZ) : x(argX), y(argY), z(argZ) {}
+
+			constexpr StaticVector3 operator+(const StaticVector3 &argOther) const { return StaticVector3(x + argOther.x, y + argOther.y, z + argOther.z); }
+			constexpr StaticVector3 operator-(const StaticVector3 &argOther) const { return StaticVector3(x - argOther.x, y - argOther.y, z - argOther.z); }
+			constexpr StaticVector3 operator*(float argScale) const { return StaticVector3(x * argScale, y * argScale, z * argScale); }
+			constexpr StaticVector3 operator/(float argScale) const { return StaticVector3(x / argScale, y / argScale, z / argScale); }
+			constexpr StaticVector3 operator-() const { return StaticVector3(-x, -y, -z); }
+			constexpr bool operator==(const StaticVector3 &argOther) const { return x == argOther.x && y == argOther.y && z == argOther.z; }
+			constexpr bool operator!=(const StaticVector3 &argOther) const { return !(*this == argOther); }
+
+			constexpr float Dot(const StaticVector3 &argOther) const { return x * argOther.x + y * argOther.y + z * argOther.z; }
+			constexpr StaticVector3 Cross(const StaticVector3 &argOther) const
+			{
+				return StaticVector3(y * argOther.z - z * argOther.y, z * argOther.x - x * argOther.z, x * argOther.y - y * argOther.x);
+			}
+			constexpr float LengthSquared() const { return Dot(*this); }
+			constexpr float Length() const { return StaticMath::Sqrt(LengthSquared()); }
+			constexpr StaticVector3 Normalize() const
+			{
+				const float Len = Length();
+				return (Len > 0.f) ? *this / Len : StaticVector3();
+			}
+			static constexpr StaticVector3 Lerp(const StaticVector3 &argA, const StaticVector3 &argB, float argT) { return argA + (argB - argA) * argT; }
+
+			inline operator Vector3() const { return Vector3(x, y, z); }
+			inline DirectX::XMVECTOR Load() const { return DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(this)); }
+		};
+
+		/**
+		 *  @struct		StaticVector4
+		 *  @brief		コンパイル時に計算できる4次元ベクトル(XMFLOAT4と同じ並び)
+		 */
+		struct StaticVector4
+		{
+			float x;
+			float y;
+			float z;
+			float w;
+
+			constexpr StaticVector4() : x(0.f), y(0.f), z(0.f), w(0.f) {}
+			constexpr StaticVector4(float argX, float argY, float argZ, float argW) : x(argX), y(argY), z(argZ), w(argW) {}
+			constexpr StaticVector4(const StaticVector3 &argXYZ, float argW) : x(argXYZ.x), y(argXYZ.y), z(argXYZ.z), w(argW) {}
+
+			constexpr StaticVector4 operator+(const StaticVector4 &argOther) const { return StaticVector4(x + argOther.x, y + argOther.y, z + argOther.z, w + argOther.w); }
+			constexpr StaticVector4 operator-(const StaticVector4 &argOther) const { return StaticVector4(x - argOther.x, y - argOther.y, z - argOther.z, w - argOther.w); }
+			constexpr StaticVector4 operator*(float argScale) const { return StaticVector4(x * argScale, y * argScale, z * argScale, w * argScale); }
+			constexpr StaticVector4 operator/(float argScale) const { return StaticVector4(x / argScale, y / argScale, z / argScale, w / argScale); }
+			constexpr StaticVector4 operator-() const { return StaticVector4(-x, -y, -z, -w); }
+			constexpr bool operator==(const StaticVector4 &argOther) const { return x == argOther.x && y == argOther.y && z == argOther.z && w == argOther.w; }
+			constexpr bool operator!=(const StaticVector4 &argOther) const { return !(*this == argOther); }
+
+			constexpr float Dot(const StaticVector4 &argOther) const { return x * argOther.x + y * argOther.y + z * argOther.z + w * argOther.w; }
+			constexpr float LengthSquared() const { return Dot(*this); }
+			constexpr float Length() const { return StaticMath::Sqrt(LengthSquared()); }
+			constexpr StaticVector4 Normalize() const
+			{
+				const float Len = Length();
+				return (Len > 0.f) ? *this / Len : StaticVector4();
+			}
+			static constexpr StaticVector4 Lerp(const StaticVector4 &argA, const StaticVector4 &argB, float argT) { return argA + (argB - argA) * argT; }
+
+			inline operator Vector4() const { return Vector4(x, y, z, w); }
+			inline DirectX::XMVECTOR Load() const { return DirectX::XMLoadFloat4(reinterpret_cast<const DirectX::XMFLOAT4*>(this)); }
+		};
+
+		/**
+		 *  @struct		StaticQuaternion
+		 *  @brief		コンパイル時に計算できるクォータニオン(XMFLOAT4と同じ並び)
+		 */
+		struct StaticQuaternion
+		{
+			float x;
+			float y;
+			float z;
+			float w;
+
+			constexpr StaticQuaternion() : x(0.f), y(0.f), z(0.f), w(1.f) {}
+			constexpr StaticQuaternion(float argX, float argY, float argZ, float argW) : x(argX), y(argY), z(argZ), w(argW) {}
+
+			static constexpr StaticQuaternion Identity() { return StaticQuaternion(); }
+			/**
+			 *	@fn			RotationAxis
+			 *	@brief		軸回りの回転(XMQuaternionRotationAxisと同じ向き)
+			 *	@param[in]	argAxis		!<	回転軸(正規化しなくてもよい)
+			 *	@param[in]	argAngle	!<	角度(ラジアン)
+			 */
+			static constexpr StaticQuaternion RotationAxis(const StaticVector3 &argAxis, float argAngle)
+			{
+				float s = 0.f, c = 0.f;
+				StaticMath::SinCos(argAngle * 0.5f, &s, &c);
+				const StaticVector3 Axis = argAxis.Normalize() * s;
+				return StaticQuaternion(Axis.x, Axis.y, Axis.z, c);
+			}
+
+			/**
+			 *	@fn			operator*
+			 *	@brief		自身の回転の後にargOtherの回転(Quaternionのoperator*と同じ)
+			 */
+			constexpr StaticQuaternion operator*(const StaticQuaternion &argOther) const
+			{
+				const StaticQuaternion &A = *this;
+				const StaticQuaternion &B = argOther;
+				return StaticQuaternion(
+					B.w * A.x + B.x * A.w + B.y * A.z - B.z * A.y,
+					B.w * A.y - B.x * A.z + B.y * A.w + B.z * A.x,
+					B.w * A.z + B.x * A.y - B.y * A.x + B.z * A.w,
+					B.w * A.w - B.x * A.x - B.y * A.y - B.z * A.z);
+			}
+			constexpr bool operator==(const StaticQuaternion &argOther) const { return x == argOther.x && y == argOther.y && z == argOther.z && w == argOther.w; }
+			constexpr bool operator!=(const StaticQuaternion &argOther) const { return !(*this == argOther); }
+
+			constexpr StaticQuaternion Conjugate() const { return StaticQuaternion(-x, -y, -z, w); }
+			constexpr StaticQuaternion Normalize() const
+			{
+				const float Len = StaticMath::Sqrt(x * x + y * y + z * z + w * w);
+				return (Len > 0.f) ? StaticQuaternion(x / Len, y / Len, z / Len, w / Len) : StaticQuaternion(0.f, 0.f, 0.f, 0.f);
+			}
+			/**
+			 *	@fn			Rotate
+			 *	@brief		ベクトルを回転する(XMVector3Rotateと同じ)
+			 */
+			constexpr StaticVector3 Rotate(const StaticVector3 &argVector) const
+			{
+				const StaticQuaternion Result = Conjugate() * StaticQuaternion(argVector.x, argVector.y, argVector.z, 0.f) * *this;
+				return StaticVector3(Result.x, Result.y, Result.z);
+			}
+
+			inline operator Quaternion() const { return Quaternion(x, y, z, w); }
+			inline DirectX::XMVECTOR Load() const { return DirectX::XMLoadFloat4(reinterpret_cast<const DirectX::XMFLOAT4*>(this)); }
+		};
+
+		/**
+		 *  @struct		StaticMatrix
+		 *  @brief		コンパイル時に計算できる4x4行列(XMFLOAT4X4と同じ並び。行ベクトルに右から掛ける)
+		 */
+		struct StaticMatrix
+		{
+			float m[4][4];
+
+			constexpr StaticMatrix() : m{ { 1.f, 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f, 0.f }, { 0.f, 0.f, 1.f, 0.f }, { 0.f, 0.f, 0.f, 1.f } } {}
+			constexpr StaticMatrix(float m00, float m01, float m02, float m03,
+				float m10, float m11, float m12, float m13,
+				float m20, float m21, float m22, float m23,
+				float m30, float m31, float m32, float m33)
+				: m{ { m00, m01, m02, m03 }, { m10, m11, m12, m13 }, { m20, m21, m22, m23 }, { m30, m31, m32, m33 } } {}
+
+			static constexpr StaticMatrix Identity() { return StaticMatrix(); }
+			static constexpr StaticMatrix Translation(const StaticVector3 &argPosition)
+			{
+				return StaticMatrix(
+					1.f, 0.f, 0.f, 0.f,
+					0.f, 1.f, 0.f, 0.f,
+					0.f, 0.f, 1.f, 0.f,
+					argPosition.x, argPosition.y, argPosition.z, 1.f);
+			}
+			static constexpr StaticMatrix Scaling(const StaticVector3 &argScale)
+			{
+				return StaticMatrix(
+					argScale.x, 0.f, 0.f, 0.f,
+					0.f, argScale.y, 0.f, 0.f,
+					0.f, 0.f, argScale.z, 0.f,
+					0.f, 0.f, 0.f, 1.f);
+			}
+			static constexpr StaticMatrix RotationX(float argAngle)
+			{
+				float s = 0.f, c = 0.f;
+				StaticMath::SinCos(argAngle, &s, &c);
+				return StaticMatrix(
+					1.f, 0.f, 0.f, 0.f,
+					0.f, c, s, 0.f,
+					0.f, -s, c, 0.f,
+					0.f, 0.f, 0.f, 1.f);
+			}
+			static constexpr StaticMatrix RotationY(float argAngle)
+			{
+				float s = 0.f, c = 0.f;
+				StaticMath::SinCos(argAngle, &s, &c);
+				return StaticMatrix(
+					c, 0.f, -s, 0.f,
+					0.f, 1.f, 0.f, 0.f,
+					s, 0.f, c, 0.f,
+					0.f, 0.f, 0.f, 1.f);
+			}
+			static constexpr StaticMatrix RotationZ(float argAngle)
+			{
+				float s = 0.f, c = 0.f;
+				StaticMath::SinCos(argAngle, &s, &c);
+				return StaticMatrix(
+					c, s, 0.f, 0.f,
+					-s, c, 0.f, 0.f,
+					0.f, 0.f, 1.f, 0.f,
+					0.f, 0.f, 0.f, 1.f);
+			}
+			/**
+			 *	@fn			RotationQuaternion
+			 *	@brief		クォータニオンから回転行列を作る(XMMatrixRotationQuaternionと同じ)
+			 */
+			static constexpr StaticMatrix RotationQuaternion(const StaticQuaternion &argRotation)
+			{
+				const StaticQuaternion &Q = argRotation;
+				const float XX = Q.x * Q.x, YY = Q.y * Q.y, ZZ = Q.z * Q.z;
+				const float XY = Q.x * Q.y, XZ = Q.x * Q.z, YZ = Q.y * Q.z;
+				const float WX = Q.w * Q.x, WY = Q.w * Q.y, WZ = Q.w * Q.z;
+				return StaticMatrix(
+					1.f - 2.f * (YY + ZZ), 2.f * (XY + WZ), 2.f * (XZ - WY), 0.f,
+					2.f * (XY - WZ), 1.f - 2.f * (XX + ZZ), 2.f * (YZ + WX), 0.f,
+					2.f * (XZ + WY), 2.f * (YZ - WX), 1.f - 2.f * (XX + YY), 0.f,
+					0.f, 0.f, 0.f, 1.f);
+			}
+			/**
+			 *	@fn			AffineTransformation
+			 *	@brief		拡大、回転、平行移動の順に合成した行列
+			 */
+			static constexpr StaticMatrix AffineTransformation(const StaticVector3 &argScale, const StaticQuaternion &argRotation, const StaticVector3 &argPosition)
+			{
+				return Scaling(argScale) * RotationQuaternion(argRotation) * Translation(argPosition);
+			}
+
+			/**
+			 *	@fn			operator*
+			 *	@brief		自身の変換の後にargOtherの変換(XMMatrixMultiplyと同じ)
+			 */
+			constexpr StaticMatrix operator*(const StaticMatrix &argOther) const
+			{
+				StaticMatrix result;
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int column = 0; column < 4; ++column)
+					{
+						result.m[row][column] = m[row][0] * argOther.m[0][column] + m[row][1] * argOther.m[1][column]
+							+ m[row][2] * argOther.m[2][column] + m[row][3] * argOther.m[3][column];
+					}
+				}
+				return result;
+			}
+			constexpr bool operator==(const StaticMatrix &argOther) const
+			{
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int column = 0; column < 4; ++column)
+					{
+						if (m[row][column] != argOther.m[row][column])
+							return false;
+					}
+				}
+				return true;
+			}
+			constexpr bool operator!=(const StaticMatrix &argOther) const { return !(*this == argOther); }
+
+			constexpr StaticMatrix Transpose() const
+			{
+				return StaticMatrix(
+					m[0][0], m[1][0], m[2][0], m[3][0],
+					m[0][1], m[1][1], m[2][1], m[3][1],
+					m[0][2], m[1][2], m[2][2], m[3][2],
+					m[0][3], m[1][3], m[2][3], m[3][3]);
+			}
+			/**
+			 *	@fn			TransformCoord
+			 *	@brief		座標の変換(平行移動してwで割る。XMVector3TransformCoordと同じ)
+			 */
+			constexpr StaticVector3 TransformCoord(const StaticVector3 &argPoint) const
+			{
+				const float X = argPoint.x * m[0][0] + argPoint.y * m[1][0] + argPoint.z * m[2][0] + m[3][0];
+				const float Y = argPoint.x * m[0][1] + argPoint.y * m[1][1] + argPoint.z * m[2][1] + m[3][1];
+				const float Z = argPoint.x * m[0][2] + argPoint.y * m[1][2] + argPoint.z * m[2][2] + m[3][2];
+				const float W = argPoint.x * m[0][3] + argPoint.y * m[1][3] + argPoint.z * m[2][3] + m[3][3];
+				return StaticVector3(X / W, Y / W, Z / W);
+			}
+			/**
+			 *	@fn			TransformNormal
+			 *	@brief		方向の変換(平行移動しない。XMVector3TransformNormalと同じ)
+			 */
+			constexpr StaticVector3 TransformNormal(const StaticVector3 &argNormal) const
+			{
+				return StaticVector3(
+					argNormal.x * m[0][0] + argNormal.y * m[1][0] + argNormal.z * m[2][0],
+					argNormal.x * m[0][1] + argNormal.y * m[1][1] + argNormal.z * m[2][1],
+					argNormal.x * m[0][2] + argNormal.y * m[1][2] + argNormal.z * m[2][2]);
+			}
+
+			inline operator Matrix() const { return Matrix(&m[0][0]); }
+			inline DirectX::XMMATRIX Load() const { return DirectX::XMLoadFloat4x4(reinterpret_cast<const DirectX::XMFLOAT4X4*>(this)); }
+		};
+
+		static_assert(sizeof(StaticVector2) == sizeof(DirectX::XMFLOAT2), "StaticVector2 must match the XMFLOAT2 layout...");
+		static_assert(sizeof(StaticVector3) == sizeof(DirectX::XMFLOAT3), "StaticVector3 must match the XMFLOAT3 layout...");
+		static_assert(sizeof(StaticVector4) == sizeof(DirectX::XMFLOAT4), "StaticVector4 must match the XMFLOAT4 layout...");
+		static_assert(sizeof(StaticQuaternion) == sizeof(DirectX::XMFLOAT4), "StaticQuaternion must match the XMFLOAT4 layout...");
+		static_assert(sizeof(StaticMatrix) == sizeof(DirectX::XMFLOAT4X4), "StaticMatrix must match the XMFLOAT4X4 layout...");
+	}
+}
@@ -0,0 +1,66 @@
+﻿/**
+ *	@file	Transform.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "Transform.h"
+
+const Utility::Math::Transform Utility::Math::Transform::Identity;
+
+void Utility::Math::Transform::Rotate(const Quaternion &argRotation)
+{
+	using namespace DirectX;
+	SetRotation(Quaternion(XMQuaternionNormalize(XMQuaternionMultiply(XMLoadFloat4(&rotation_), XMLoadFloat4(&argRotation)))));
+}
+
+Utility::Math::Vector3 Utility::Math::Transform::TransformPoint(const Vector3 &argPoint) const
+{
+	using namespace DirectX;
+	const XMVECTOR Scaled = XMVectorMultiply(XMLoadFloat3(&argPoint), XMLoadFloat3(&scale_));
+	return Vector3(XMVectorAdd(XMVector3Rotate(Scaled, XMLoadFloat4(&rotation_)), XMLoadFloat3(&position_)));
+}
+
+Utility::Math::Vector3 Utility::Math::Transform::TransformVector(const Vector3 &argVector) const
+{
+	using namespace DirectX;
+	const XMVECTOR Scaled = XMVectorMultiply(XMLoadFloat3(&argVector), XMLoadFloat3(&scale_));
+	return Vector3(XMVector3Rotate(Scaled, XMLoadFloat4(&rotation_)));
+}
+
+Utility::Math::Transform Utility::Math::Transform::Inverse() const
+{
+	using namespace DirectX;
+	const XMVECTOR InverseScale = XMVectorReciprocal(XMLoadFloat3(&scale_));
+	const XMVECTOR InverseRotation = XMQuaternionConjugate(XMLoadFloat4(&rotation_));
+	// v = p' + R^-1 * (x - p) / s なので、p' = -R^-1 * p / s
+	const XMVECTOR Position = XMVectorMultiply(XMVector3Rotate(XMVectorNegate(XMLoadFloat3(&position_)), InverseRotation), InverseScale);
+	return Transform(Vector3(Position), Quaternion(InverseRotation), Vector3(InverseScale));
+}
+
+Utility::Math::Transform Utility::Math::Transform::operator*(const Transform &argParent) const
+{
+	using namespace DirectX;
+	const XMVECTOR ParentScale = XMLoadFloat3(&argParent.scale_);
+	const XMVECTOR ParentRotation = XMLoadFloat4(&argParent.rotation_);
+
+	// 子の位置を親の拡縮、回転、平行移動の順に変換する
+	const XMVECTOR Position = XMVectorAdd(XMVector3Rotate(XMVectorMultiply(XMLoadFloat3(&position_), ParentScale), ParentRotation), XMLoadFloat3(&argParent.position_));
+	const XMVECTOR Rotation = XMQuaternionMultiply(XMLoadFloat4(&rotation_), ParentRotation);
+	const XMVECTOR Scale = XMVectorMultiply(XMLoadFloat3(&scale_), ParentScale);
+	return Transform(Vector3(Position), Quaternion(Rotation), Vector3(Scale));
+}
+
+void Utility::Math::Transform::BuildMatrix() const
+{
+	using namespace DirectX;
+	const XMMATRIX Rotation = XMMatrixRotationQuaternion(XMLoadFloat4(&rotation_));
+
+	XMMATRIX result;
+	result.r[0] = XMVectorScale(Rotation.r[0], scale_.x);
+	result.r[1] = XMVectorScale(Rotation.r[1], scale_.y);
+	result.r[2] = XMVectorScale(Rotation.r[2], scale_.z);
+	result.r[3] = XMVectorSet(position_.x, position_.y, position_.z, 1.f);
+	XMStoreFloat4x4(&matrix_, result);
+	isDirty_ = false;
+}
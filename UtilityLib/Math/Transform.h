@@ -0,0 +1,130 @@
+﻿/**
+ *	@file	Transform.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "Vector3f.h"
+
+namespace Utility
+{
+	namespace Math
+	{
+		/**
+		 *  @class		Transform
+		 *  @brief		位置、回転、拡縮で持つ姿勢
+		 *  @note		行列は必要になったときに作り、姿勢を変えるまで使い回す。
+		 *				行列はTransformHierarchyと同じく 拡縮 * 回転 * 平行移動 の順(行ベクトル)。
+		 *				合成と逆変換は行列を使わずに求める。拡縮が一様でない姿勢に回転した子を合成すると、
+		 *				行列の積と違い剪断が失われる(拡縮は成分ごとの積になる)。
+		 *				GetMatrixは作った行列を持っておくので、同じ姿勢を複数のスレッドから同時に呼ばない。
+		 */
+		class Transform final
+		{
+		private:
+			Vector3				position_;
+			Quaternion			rotation_;
+			Vector3				scale_;
+			mutable Matrix		matrix_;
+			mutable bool		isDirty_;
+
+		public:
+			Transform()
+				: position_(0.f, 0.f, 0.f), rotation_(0.f, 0.f, 0.f, 1.f), scale_(1.f), matrix_(), isDirty_(false)
+			{
+			}
+			explicit Transform(const Vector3 &argPosition, const Quaternion &argRotation = Quaternion::Identity, const Vector3 &argScale = Vector3(1.f))
+				: position_(argPosition), rotation_(argRotation), scale_(argScale), isDirty_(true)
+			{
+			}
+
+		public:
+			inline const Vector3 &Position() const { return position_; }
+			inline const Quaternion &Rotation() const { return rotation_; }
+			inline const Vector3 &Scale() const { return scale_; }
+			inline void SetPosition(const Vector3 &argPosition)
+			{
+				position_ = argPosition;
+				isDirty_ = true;
+			}
+			inline void SetRotation(const Quaternion &argRotation)
+			{
+				rotation_ = argRotation;
+				isDirty_ = true;
+			}
+			inline void SetScale(const Vector3 &argScale)
+			{
+				scale_ = argScale;
+				isDirty_ = true;
+			}
+			/**
+			 *	@fn			IsDirty
+			 *	@brief		前回GetMatrixで行列を作ってから姿勢が変わったか
+			 */
+			inline bool IsDirty() const { return isDirty_; }
+
+			/**
+			 *	@fn			Translate
+			 *	@brief		親の空間で平行移動する
+			 */
+			inline void Translate(const Vector3 &argOffset) { SetPosition(position_ + argOffset); }
+			/**
+			 *	@fn			Rotate
+			 *	@brief		今の回転の後にargRotationで回す
+			 */
+			void Rotate(const Quaternion &argRotation);
+
+			/**
+			 *	@fn			GetMatrix
+			 *	@brief		姿勢の行列(変わっていなければ前回作った行列を返す)
+			 */
+			inline const Matrix &GetMatrix() const
+			{
+				if (isDirty_)
+					BuildMatrix();
+				return matrix_;
+			}
+
+			/**
+			 *	@fn			TransformPoint
+			 *	@brief		点を変換する(GetMatrixの行列を掛けるのと同じ)
+			 */
+			Vector3 TransformPoint(const Vector3 &argPoint) const;
+			/**
+			 *	@fn			TransformVector
+			 *	@brief		向きを変換する(平行移動しない)
+			 */
+			Vector3 TransformVector(const Vector3 &argVector) const;
+
+			/**
+			 *	@fn			Inverse
+			 *	@brief		逆変換(拡縮が一様なら正確)
+			 */
+			Transform Inverse() const;
+			/**
+			 *	@fn			operator*
+			 *	@brief		合成(自身で変換してからargParentで変換する。行列の this * argParent にあたる)
+			 */
+			Transform operator*(const Transform &argParent) const;
+			inline Transform &operator*=(const Transform &argParent)
+			{
+				*this = *this * argParent;
+				return *this;
+			}
+
+		public:
+			static const Transform Identity;
+
+		private:
+			/**
+			 *	@fn			BuildMatrix
+			 *	@brief		行列を作り直す(回転行列の各行に拡縮を掛け、最後の行に位置を置く)
+			 */
+			void BuildMatrix() const;
+		};
+	}
+}
@@ -0,0 +1,362 @@
+﻿/**
+ *	@file	TransformHierarchy.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "TransformHierarchy.h"
+#include "SimdLanes.h"
+#include "../Task/ThreadPool.h"
+
+#include <algorithm>
+
+// 番号順と深さ順(ThreadPoolを渡したとき)、まとめて掛けた塊と1ノードずつ掛けた塊で同じ行列になるように、
+// a * b + cをFMAにまとめさせない
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace
+{
+	using Utility::Math::Matrix;
+	using Utility::Math::TransformHierarchy;
+
+#pragma region		Kernel
+	/*
+	 *	各カーネルはApply<Lanes>(i)でi番目からLanes::Width個のノードを処理する。
+	 *	行列は行ベクトルの流儀(ローカル * 親のワールド)で、上3列だけを12個のレジスターで扱う(4列目は(0, 0, 0, 1))。
+	 */
+
+	/**
+	 *  @struct		LocalSource
+	 *  @brief		ローカルの姿勢の成分ごとの配列
+	 */
+	struct LocalSource
+	{
+		const float	*position_[3];
+		const float	*rotation_[4];
+		const float	*scale_[3];
+
+		/**
+		 *	@fn			Load
+		 *	@brief		argIndex番目からWidth個のローカルの行列を求める
+		 *	@note		XMMatrixAffineTransformation(S, 0, R, T)と同じ S * R * T を直接組み立てる
+		 */
+		template<typename L>
+		inline void Load(size_t argIndex, typename L::Reg argLocal[12]) const
+		{
+			using Reg = typename L::Reg;
+			const Reg X = L::Load(rotation_[0] + argIndex);
+			const Reg Y = L::Load(rotation_[1] + argIndex);
+			const Reg Z = L::Load(rotation_[2] + argIndex);
+			const Reg W = L::Load(rotation_[3] + argIndex);
+			const Reg SX = L::Load(scale_[0] + argIndex);
+			const Reg SY = L::Load(scale_[1] + argIndex);
+			const Reg SZ = L::Load(scale_[2] + argIndex);
+
+			const Reg One = L::Set(1.f);
+			const Reg Two = L::Set(2.f);
+			const Reg XX = L::Mul(X, X), YY = L::Mul(Y, Y), ZZ = L::Mul(Z, Z);
+			const Reg XY = L::Mul(X, Y), XZ = L::Mul(X, Z), YZ = L::Mul(Y, Z);
+			const Reg WX = L::Mul(W, X), WY = L::Mul(W, Y), WZ = L::Mul(W, Z);
+
+			argLocal[0] = L::Mul(L::Sub(One, L::Mul(Two, L::Add(YY, ZZ))), SX);
+			argLocal[1] = L::Mul(L::Mul(Two, L::Add(XY, WZ)), SX);
+			argLocal[2] = L::Mul(L::Mul(Two, L::Sub(XZ, WY)), SX);
+			argLocal[3] = L::Mul(L::Mul(Two, L::Sub(XY, WZ)), SY);
+			argLocal[4] = L::Mul(L::Sub(One, L::Mul(Two, L::Add(XX, ZZ))), SY);
+			argLocal[5] = L::Mul(L::Mul(Two, L::Add(YZ, WX)), SY);
+			argLocal[6] = L::Mul(L::Mul(Two, L::Add(XZ, WY)), SZ);
+			argLocal[7] = L::Mul(L::Mul(Two, L::Sub(YZ, WX)), SZ);
+			argLocal[8] = L::Mul(L::Sub(One, L::Mul(Two, L::Add(XX, YY))), SZ);
+			argLocal[9] = L::Load(position_[0] + argIndex);
+			argLocal[10] = L::Load(position_[1] + argIndex);
+			argLocal[11] = L::Load(position_[2] + argIndex);
+		}
+	};
+
+	/**
+	 *	@fn			MultiplyParent
+	 *	@brief		ローカルの行列に親のワールド行列を掛けて書き出す
+	 *	@param[in]	argLocal	!<	ローカルの行列(Width個分)
+	 *	@param[in]	argParents	!<	親のワールド行列(Width個。親がなければ単位行列)
+	 *	@param[out]	argWorlds	!<	書き出す先(Width個)
+	 */
+	template<typename L>
+	inline void MultiplyParent(const typename L::Reg argLocal[12], const Matrix *const argParents[], Matrix *const argWorlds[])
+	{
+		using Reg = typename L::Reg;
+
+		// 親の行列の上3列を成分ごとに集める
+		alignas(32) float gathered[12][L::Width];
+		for (size_t lane = 0; lane < L::Width; ++lane)
+		{
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int column = 0; column < 3; ++column)
+					gathered[row * 3 + column][lane] = argParents[lane]->m[row][column];
+			}
+		}
+		Reg p[12];
+		for (int i = 0; i < 12; ++i)
+			p[i] = L::Load(gathered[i]);
+
+		// world.r[i] = l[i][0] * p.r[0] + l[i][1] * p.r[1] + l[i][2] * p.r[2] (+ p.r[3]は平行移動の行だけ)
+		alignas(32) float result[12][L::Width];
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int column = 0; column < 3; ++column)
+			{
+				Reg r = L::Add(L::Add(L::Mul(argLocal[row * 3], p[column]), L::Mul(argLocal[row * 3 + 1], p[3 + column])), L::Mul(argLocal[row * 3 + 2], p[6 + column]));
+				if (row == 3)
+					r = L::Add(r, p[9 + column]);
+				L::Store(result[row * 3 + column], r);
+			}
+		}
+
+		for (size_t lane = 0; lane < L::Width; ++lane)
+		{
+			Matrix &world = *argWorlds[lane];
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int column = 0; column < 3; ++column)
+					world.m[row][column] = result[row * 3 + column][lane];
+				world.m[row][3] = (row == 3) ? 1.f : 0.f;
+			}
+		}
+	}
+
+	/**
+	 *  @struct		SequentialKernel
+	 *  @brief		番号順にまとめて処理する(全ての配列を先頭から順に読み書きする)
+	 *	@note		Width個の中に親子がいれば、その塊だけ1ノードずつ掛ける
+	 */
+	struct SequentialKernel
+	{
+		LocalSource		source_;
+		const int32_t	*parents_;
+		Matrix			*world_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			using Reg = typename L::Reg;
+
+			Reg local[12];
+			source_.Load<L>(argIndex, local);
+
+			const Matrix *parents[L::Width];
+			Matrix *worlds[L::Width];
+			bool isIndependent = true;
+			for (size_t lane = 0; lane < L::Width; ++lane)
+			{
+				const int32_t Parent = parents_[argIndex + lane];
+				isIndependent = isIndependent && Parent < static_cast<int32_t>(argIndex);
+				parents[lane] = (Parent == TransformHierarchy::NoParent) ? &Matrix::Identity : &world_[Parent];
+				worlds[lane] = &world_[argIndex + lane];
+			}
+			if (isIndependent)
+			{
+				MultiplyParent<L>(local, parents, worlds);
+				return;
+			}
+
+			// 親が同じ塊の中にいるので、前のノードから順に掛ける(MultiplyParentと同じ順序で、成分を集め直さずに計算する)
+			alignas(32) float spilled[12][L::Width];
+			for (int i = 0; i < 12; ++i)
+				L::Store(spilled[i], local[i]);
+			for (size_t lane = 0; lane < L::Width; ++lane)
+			{
+				const Matrix &P = *parents[lane];
+				float result[12];
+				for (int row = 0; row < 4; ++row)
+				{
+					const float L0 = spilled[row * 3][lane];
+					const float L1 = spilled[row * 3 + 1][lane];
+					const float L2 = spilled[row * 3 + 2][lane];
+					for (int column = 0; column < 3; ++column)
+					{
+						float r = (L0 * P.m[0][column] + L1 * P.m[1][column]) + L2 * P.m[2][column];
+						if (row == 3)
+							r = r + P.m[3][column];
+						result[row * 3 + column] = r;
+					}
+				}
+				Matrix &world = *worlds[lane];
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int column = 0; column < 3; ++column)
+						world.m[row][column] = result[row * 3 + column];
+					world.m[row][3] = (row == 3) ? 1.f : 0.f;
+				}
+			}
+		}
+	};
+
+	/**
+	 *  @struct		LevelKernel
+	 *  @brief		同じ深さのノードをまとめて処理する(並列に処理する用)
+	 *	@note		深さ順の並びでは番号が飛び飛びなので、Width個分の姿勢を成分ごとに集めてから計算する
+	 */
+	struct LevelKernel
+	{
+		LocalSource		source_;
+		const uint32_t	*order_;
+		const int32_t	*parents_;
+		Matrix			*world_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			alignas(32) float gathered[10][L::Width];
+			const Matrix *parents[L::Width];
+			Matrix *worlds[L::Width];
+			for (size_t lane = 0; lane < L::Width; ++lane)
+			{
+				const uint32_t Node = order_[argIndex + lane];
+				for (int i = 0; i < 3; ++i)
+					gathered[i][lane] = source_.position_[i][Node];
+				for (int i = 0; i < 4; ++i)
+					gathered[3 + i][lane] = source_.rotation_[i][Node];
+				for (int i = 0; i < 3; ++i)
+					gathered[7 + i][lane] = source_.scale_[i][Node];
+
+				const int32_t Parent = parents_[Node];
+				parents[lane] = (Parent == TransformHierarchy::NoParent) ? &Matrix::Identity : &world_[Parent];
+				worlds[lane] = &world_[Node];
+			}
+
+			const LocalSource Gathered = {
+				{ gathered[0], gathered[1], gathered[2] },
+				{ gathered[3], gathered[4], gathered[5], gathered[6] },
+				{ gathered[7], gathered[8], gathered[9] } };
+			typename L::Reg local[12];
+			Gathered.Load<L>(0, local);
+			MultiplyParent<L>(local, parents, worlds);
+		}
+	};
+#pragma endregion	Kernel
+}
+
+Utility::Math::TransformHierarchy::TransformHierarchy()
+	: isOrderDirty_(false)
+{
+}
+
+uint32_t Utility::Math::TransformHierarchy::Add(int32_t argParent, const Vector3 &argPosition, const Quaternion &argRotation, const Vector3 &argScale)
+{
+	const size_t Index = Size();
+	assert((argParent == NoParent || (argParent >= 0 && static_cast<size_t>(argParent) < Index)) && "Parent must be added before its children...");
+
+	parents_.push_back(argParent);
+	position_.Resize(Index + 1);
+	scale_.Resize(Index + 1);
+	rotationX_.push_back(0.f);
+	rotationY_.push_back(0.f);
+	rotationZ_.push_back(0.f);
+	rotationW_.push_back(1.f);
+	world_.push_back(Matrix::Identity);
+
+	SetPosition(Index, argPosition);
+	SetRotation(Index, argRotation);
+	SetScale(Index, argScale);
+	isOrderDirty_ = true;
+	return static_cast<uint32_t>(Index);
+}
+
+void Utility::Math::TransformHierarchy::Reserve(size_t argCapacity)
+{
+	parents_.reserve(argCapacity);
+	position_.Reserve(argCapacity);
+	scale_.Reserve(argCapacity);
+	rotationX_.reserve(argCapacity);
+	rotationY_.reserve(argCapacity);
+	rotationZ_.reserve(argCapacity);
+	rotationW_.reserve(argCapacity);
+	world_.reserve(argCapacity);
+}
+
+void Utility::Math::TransformHierarchy::Clear()
+{
+	parents_.clear();
+	position_.Clear();
+	scale_.Clear();
+	rotationX_.clear();
+	rotationY_.clear();
+	rotationZ_.clear();
+	rotationW_.clear();
+	world_.clear();
+	order_.clear();
+	levelBegin_.clear();
+	isOrderDirty_ = false;
+}
+
+void Utility::Math::TransformHierarchy::BuildOrder()
+{
+	// 親は子より前にあるので、前から順に深さが決まる
+	std::vector<uint32_t> depth(Size());
+	uint32_t maxDepth = 0;
+	for (size_t i = 0; i < Size(); ++i)
+	{
+		depth[i] = (parents_[i] == NoParent) ? 0 : depth[parents_[i]] + 1;
+		maxDepth = std::max(maxDepth, depth[i]);
+	}
+
+	// 深さごとの数え上げソート(同じ深さの中は番号順のまま)
+	levelBegin_.assign(maxDepth + 2, 0);
+	for (uint32_t d : depth)
+		++levelBegin_[d + 1];
+	for (size_t level = 1; level < levelBegin_.size(); ++level)
+		levelBegin_[level] += levelBegin_[level - 1];
+
+	order_.resize(Size());
+	std::vector<size_t> cursor(levelBegin_.begin(), levelBegin_.end() - 1);
+	for (size_t i = 0; i < Size(); ++i)
+		order_[cursor[depth[i]]++] = static_cast<uint32_t>(i);
+
+	isOrderDirty_ = false;
+}
+
+void Utility::Math::TransformHierarchy::SetPositions(const Vector3Stream &argPositions)
+{
+	assert(argPositions.Size() == Size() && "TransformHierarchy size mismatch...");
+	std::copy_n(argPositions.X(), Size(), position_.X());
+	std::copy_n(argPositions.Y(), Size(), position_.Y());
+	std::copy_n(argPositions.Z(), Size(), position_.Z());
+}
+
+void Utility::Math::TransformHierarchy::SetScales(const Vector3Stream &argScales)
+{
+	assert(argScales.Size() == Size() && "TransformHierarchy size mismatch...");
+	std::copy_n(argScales.X(), Size(), scale_.X());
+	std::copy_n(argScales.Y(), Size(), scale_.Y());
+	std::copy_n(argScales.Z(), Size(), scale_.Z());
+}
+
+void Utility::Math::TransformHierarchy::Update(ThreadPool *argPool)
+{
+	const LocalSource Source = {
+		{ position_.X(), position_.Y(), position_.Z() },
+		{ rotationX_.data(), rotationY_.data(), rotationZ_.data(), rotationW_.data() },
+		{ scale_.X(), scale_.Y(), scale_.Z() } };
+
+	if (argPool == nullptr)
+	{// 親が先に来るので番号順にそのまま処理できる
+		const SequentialKernel Kernel = { Source, parents_.data(), world_.data() };
+		Utility::Math::Simd::Run(Kernel, Size(), ParallelGrain, nullptr);
+		return;
+	}
+
+	// 同じ深さのノードは互いに依存しないので、浅い方から深さごとに並列に処理する
+	if (isOrderDirty_)
+		BuildOrder();
+	for (size_t level = 0; level + 1 < levelBegin_.size(); ++level)
+	{
+		const LevelKernel Kernel = { Source, order_.data() + levelBegin_[level], parents_.data(), world_.data() };
+		Utility::Math::Simd::Run(Kernel, levelBegin_[level + 1] - levelBegin_[level], ParallelGrain, argPool);
+	}
+}
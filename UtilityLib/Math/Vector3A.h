@@ -0,0 +1,136 @@
+﻿/**
+ *	@file	Vector3A.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "Vector3f.h"
+
+namespace Utility
+{
+	namespace Math
+	{
+		/**
+		 *  @struct		Vector3A
+		 *  @brief		XMVECTORのまま持つVector3(16byte境界)
+		 *  @note		Vector3は演算のたびにXMFLOAT3との読み書きが入るので、何度も演算する処理ではこちらで受けて
+		 *				最後にVector3へ戻す。Vector3との変換は明示的に行う。wの値は不定なので3成分の演算だけに使う。
+		 */
+		struct alignas(16) Vector3A
+		{
+		public:
+			DirectX::XMVECTOR v;
+
+		public:
+			Vector3A() : v(DirectX::XMVectorZero()) {}
+			explicit Vector3A(float x) : v(DirectX::XMVectorReplicate(x)) {}
+			Vector3A(float _x, float _y, float _z) : v(DirectX::XMVectorSet(_x, _y, _z, 0.f)) {}
+			explicit Vector3A(_In_reads_(3) const float *pArray) : v(DirectX::XMVectorSet(pArray[0], pArray[1], pArray[2], 0.f)) {}
+			Vector3A(DirectX::FXMVECTOR V) : v(V) {}
+			explicit Vector3A(const DirectX::XMFLOAT3& V) : v(DirectX::XMLoadFloat3(&V)) {}
+
+		public:
+#pragma region	Operator
+			operator DirectX::XMVECTOR() const { return v; }
+			explicit operator Vector3() const { return Vector3(v); }
+
+			inline bool operator == (const Vector3A& V) const { return DirectX::XMVector3Equal(v, V.v); }
+			inline bool operator != (const Vector3A& V) const { return DirectX::XMVector3NotEqual(v, V.v); }
+
+			inline Vector3A& operator+= (const Vector3A& V)
+			{
+				v = DirectX::XMVectorAdd(v, V.v);
+				return *this;
+			}
+			inline Vector3A& operator-= (const Vector3A& V)
+			{
+				v = DirectX::XMVectorSubtract(v, V.v);
+				return *this;
+			}
+			inline Vector3A& operator*= (const Vector3A& V)
+			{
+				v = DirectX::XMVectorMultiply(v, V.v);
+				return *this;
+			}
+			inline Vector3A& operator*= (float S)
+			{
+				v = DirectX::XMVectorScale(v, S);
+				return *this;
+			}
+			inline Vector3A& operator/= (float S)
+			{
+				assert(S != 0.0f);
+				v = DirectX::XMVectorScale(v, 1.f / S);
+				return *this;
+			}
+
+			Vector3A operator+ () const { return *this; }
+			inline Vector3A operator- () const { return Vector3A(DirectX::XMVectorNegate(v)); }
+#pragma endregion	Operator
+
+		public:
+			inline float X() const { return DirectX::XMVectorGetX(v); }
+			inline float Y() const { return DirectX::XMVectorGetY(v); }
+			inline float Z() const { return DirectX::XMVectorGetZ(v); }
+			inline void X(float argX) { v = DirectX::XMVectorSetX(v, argX); }
+			inline void Y(float argY) { v = DirectX::XMVectorSetY(v, argY); }
+			inline void Z(float argZ) { v = DirectX::XMVectorSetZ(v, argZ); }
+			/**
+			 *	@fn			Store
+			 *	@brief		XMFLOAT3に書き出す
+			 */
+			inline void Store(DirectX::XMFLOAT3 *argDst) const { DirectX::XMStoreFloat3(argDst, v); }
+
+			inline bool InBounds(const Vector3A& Bounds) const { return DirectX::XMVector3InBounds(v, Bounds.v); }
+			inline float Length() const { return DirectX::XMVectorGetX(DirectX::XMVector3Length(v)); }
+			inline float LengthSquared() const { return DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(v)); }
+			inline float Dot(const Vector3A& V) const { return DirectX::XMVectorGetX(DirectX::XMVector3Dot(v, V.v)); }
+			inline void Cross(const Vector3A& V, Vector3A& result) const { result.v = DirectX::XMVector3Cross(v, V.v); }
+			inline Vector3A Cross(const Vector3A& V) const { return Vector3A(DirectX::XMVector3Cross(v, V.v)); }
+			inline void Normalize() { v = DirectX::XMVector3Normalize(v); }
+			inline void Normalize(Vector3A& result) const { result.v = DirectX::XMVector3Normalize(v); }
+
+			inline static float Distance(const Vector3A& v1, const Vector3A& v2)
+			{
+				using namespace DirectX;
+				return XMVectorGetX(XMVector3Length(XMVectorSubtract(v2.v, v1.v)));
+			}
+			inline static float DistanceSquared(const Vector3A& v1, const Vector3A& v2)
+			{
+				using namespace DirectX;
+				return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(v2.v, v1.v)));
+			}
+			inline static void Min(const Vector3A& v1, const Vector3A& v2, Vector3A& result) { result.v = DirectX::XMVectorMin(v1.v, v2.v); }
+			inline static Vector3A Min(const Vector3A& v1, const Vector3A& v2) { return Vector3A(DirectX::XMVectorMin(v1.v, v2.v)); }
+			inline static void Max(const Vector3A& v1, const Vector3A& v2, Vector3A& result) { result.v = DirectX::XMVectorMax(v1.v, v2.v); }
+			inline static Vector3A Max(const Vector3A& v1, const Vector3A& v2) { return Vector3A(DirectX::XMVectorMax(v1.v, v2.v)); }
+			inline static void Lerp(const Vector3A& v1, const Vector3A& v2, float t, Vector3A& result) { result.v = DirectX::XMVectorLerp(v1.v, v2.v, t); }
+			inline static Vector3A Lerp(const Vector3A& v1, const Vector3A& v2, float t) { return Vector3A(DirectX::XMVectorLerp(v1.v, v2.v, t)); }
+
+			inline static Vector3A Transform(const Vector3A& V, const Quaternion& quat)
+			{
+				using namespace DirectX;
+				return Vector3A(XMVector3Rotate(V.v, XMLoadFloat4(&quat)));
+			}
+			inline static Vector3A Transform(const Vector3A& V, const Matrix& m) { return Transform(V, DirectX::XMLoadFloat4x4(&m)); }
+			/**
+			 *	@fn			Transform
+			 *	@brief		読み込み済みの行列で変換する(同じ行列で何度も変換するとき用)
+			 */
+			inline static Vector3A Transform(const Vector3A& V, DirectX::FXMMATRIX M) { return Vector3A(DirectX::XMVector3TransformCoord(V.v, M)); }
+			inline static Vector3A TransformNormal(const Vector3A& V, const Matrix& m) { return TransformNormal(V, DirectX::XMLoadFloat4x4(&m)); }
+			inline static Vector3A TransformNormal(const Vector3A& V, DirectX::FXMMATRIX M) { return Vector3A(DirectX::XMVector3TransformNormal(V.v, M)); }
+		};
+
+		inline Vector3A operator+ (const Vector3A& V1, const Vector3A& V2) { return Vector3A(DirectX::XMVectorAdd(V1.v, V2.v)); }
+		inline Vector3A operator- (const Vector3A& V1, const Vector3A& V2) { return Vector3A(DirectX::XMVectorSubtract(V1.v, V2.v)); }
+		inline Vector3A operator* (const Vector3A& V1, const Vector3A& V2) { return Vector3A(DirectX::XMVectorMultiply(V1.v, V2.v)); }
+		inline Vector3A operator* (const Vector3A& V, float S) { return Vector3A(DirectX::XMVectorScale(V.v, S)); }
+		inline Vector3A operator/ (const Vector3A& V1, const Vector3A& V2) { return Vector3A(DirectX::XMVectorDivide(V1.v, V2.v)); }
+		inline Vector3A operator* (float S, const Vector3A& V) { return Vector3A(DirectX::XMVectorScale(V.v, S)); }
+	};
+};
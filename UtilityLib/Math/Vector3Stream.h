@@ -0,0 +1,195 @@
+﻿/**
+ *	@file	Vector3Stream.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Vector3f.h"
+#include "StreamBuffer.h"
+#include "../Span.h"
+
+#include <cstddef>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	namespace Math
+	{
+		struct Matrix;
+
+		/**
+		 *  @class		Vector3Stream
+		 *  @brief		x, y, zを成分ごとの配列に分けて持つ(SoA)Vector3の列
+		 *  @note		パーティクルや群衆、頂点のような大量のベクトルをまとめて計算する用途。
+		 *				演算はAVX2/SSE2で8/4要素ずつ処理し、Vector3の同名の関数と同じ順序で計算する。
+		 *				ThreadPoolを渡すとParallelGrain個ずつに分けて並列に処理する。
+		 *				出力先は入力と同じでもよく、要素数は入力に合わせて変わる。
+		 */
+		class Vector3Stream final
+		{
+		public:
+			static const size_t Alignment = StreamBuffer<3>::Alignment;	//	!<	各成分の配列の先頭の境界
+			static const size_t ParallelGrain = 16384;	//	!<	並列に処理するときの1塊の要素数
+
+		private:
+			StreamBuffer<3>	buffer_;
+
+		public:
+			Vector3Stream();
+			explicit Vector3Stream(size_t argCount);
+
+		public:
+			/**
+			 *	@fn			Resize
+			 *	@brief		要素数を変える(増えた分は0)
+			 *	@param[in]	argCount	!<	要素数
+			 */
+			void Resize(size_t argCount);
+			/**
+			 *	@fn			Reserve
+			 *	@brief		確保済みの要素数を増やす
+			 *	@param[in]	argCapacity	!<	確保する要素数
+			 */
+			void Reserve(size_t argCapacity);
+			/**
+			 *	@fn			Clear
+			 *	@brief		要素数を0にする(確保したメモリは残す)
+			 */
+			inline void Clear() { buffer_.Clear(); }
+
+			/**
+			 *	@fn			Load
+			 *	@brief		Vector3の配列から読み込む
+			 *	@param[in]	argSrc		!<	読み込む配列
+			 *	@param[in]	argCount	!<	要素数
+			 */
+			void Load(const Vector3 *argSrc, size_t argCount);
+			/**
+			 *	@fn			Store
+			 *	@brief		Vector3の配列に書き出す
+			 *	@param[out]	argDst	!<	書き出す先(Size()個)
+			 */
+			void Store(Vector3 *argDst) const;
+
+		public:
+			inline size_t Size() const { return buffer_.Size(); }
+			inline size_t Capacity() const { return buffer_.Capacity(); }
+			inline bool Empty() const { return buffer_.Size() == 0; }
+
+			inline float *X() { return buffer_.Component(0); }
+			inline float *Y() { return buffer_.Component(1); }
+			inline float *Z() { return buffer_.Component(2); }
+			inline const float *X() const { return buffer_.Component(0); }
+			inline const float *Y() const { return buffer_.Component(1); }
+			inline const float *Z() const { return buffer_.Component(2); }
+
+			inline Vector3 Get(size_t argIndex) const
+			{
+				assert(argIndex < Size() && "Vector3Stream index out of range...");
+				return Vector3(X()[argIndex], Y()[argIndex], Z()[argIndex]);
+			}
+			inline void Set(size_t argIndex, const Vector3 &argValue)
+			{
+				assert(argIndex < Size() && "Vector3Stream index out of range...");
+				X()[argIndex] = argValue.x;
+				Y()[argIndex] = argValue.y;
+				Z()[argIndex] = argValue.z;
+			}
+
+		public:
+			/**
+			 *	@fn			Transform
+			 *	@brief		座標変換(wで割る。Vector3::Transformと同じ)
+			 *	@param[in]	argSrc		!<	変換する座標
+			 *	@param[in]	argMatrix	!<	変換行列
+			 *	@param[out]	argDst		!<	変換した座標
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Transform(const Vector3Stream &argSrc, const Matrix &argMatrix, Vector3Stream *argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			TransformNormal
+			 *	@brief		方向の変換(平行移動しない。Vector3::TransformNormalと同じ)
+			 *	@param[in]	argSrc		!<	変換する方向
+			 *	@param[in]	argMatrix	!<	変換行列
+			 *	@param[out]	argDst		!<	変換した方向
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void TransformNormal(const Vector3Stream &argSrc, const Matrix &argMatrix, Vector3Stream *argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Normalize
+			 *	@brief		正規化(長さ0のベクトルは0のまま)
+			 *	@param[in]	argSrc		!<	正規化するベクトル
+			 *	@param[out]	argDst		!<	正規化したベクトル
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Normalize(const Vector3Stream &argSrc, Vector3Stream *argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Dot
+			 *	@brief		要素ごとの内積
+			 *	@param[in]	argA		!<	ベクトル
+			 *	@param[in]	argB		!<	ベクトル(argAと同じ要素数)
+			 *	@param[out]	argDst		!<	内積(argAの要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Dot(const Vector3Stream &argA, const Vector3Stream &argB, Span<float> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Cross
+			 *	@brief		要素ごとの外積
+			 *	@param[in]	argA		!<	ベクトル
+			 *	@param[in]	argB		!<	ベクトル(argAと同じ要素数)
+			 *	@param[out]	argDst		!<	外積
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Cross(const Vector3Stream &argA, const Vector3Stream &argB, Vector3Stream *argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Lerp
+			 *	@brief		要素ごとの線形補間
+			 *	@param[in]	argA		!<	始点
+			 *	@param[in]	argB		!<	終点(argAと同じ要素数)
+			 *	@param[in]	argT		!<	補間係数
+			 *	@param[out]	argDst		!<	補間した値
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Lerp(const Vector3Stream &argA, const Vector3Stream &argB, float argT, Vector3Stream *argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Min
+			 *	@brief		成分ごとの最小値
+			 *	@param[in]	argA		!<	ベクトル
+			 *	@param[in]	argB		!<	ベクトル(argAと同じ要素数)
+			 *	@param[out]	argDst		!<	最小値
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Min(const Vector3Stream &argA, const Vector3Stream &argB, Vector3Stream *argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Max
+			 *	@brief		成分ごとの最大値
+			 *	@param[in]	argA		!<	ベクトル
+			 *	@param[in]	argB		!<	ベクトル(argAと同じ要素数)
+			 *	@param[out]	argDst		!<	最大値
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Max(const Vector3Stream &argA, const Vector3Stream &argB, Vector3Stream *argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Distance
+			 *	@brief		要素ごとの距離
+			 *	@param[in]	argA		!<	座標
+			 *	@param[in]	argB		!<	座標(argAと同じ要素数)
+			 *	@param[out]	argDst		!<	距離(argAの要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Distance(const Vector3Stream &argA, const Vector3Stream &argB, Span<float> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			DistanceSquared
+			 *	@brief		要素ごとの距離の2乗
+			 *	@param[in]	argA		!<	座標
+			 *	@param[in]	argB		!<	座標(argAと同じ要素数)
+			 *	@param[out]	argDst		!<	距離の2乗(argAの要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void DistanceSquared(const Vector3Stream &argA, const Vector3Stream &argB, Span<float> argDst, ThreadPool *argPool = nullptr);
+		};
+	}
+}
@@ -0,0 +1,161 @@
+﻿/**
+ *	@file	NumberFormat.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "NumberFormat.h"
+
+#include <charconv>
+#include <cstring>
+#include <system_error>
+
+namespace
+{
+	/**
+	 *	@fn			Decorate
+	 *	@brief		to_charsで書き込んだ文字列の整数部を0で埋め、区切り文字を入れる
+	 *	@param[in,out]	argBuf			!<	to_charsで書き込んだバッファ
+	 *	@param[in]		argLength		!<	書き込んだ長さ
+	 *	@param[in]		argBufSize		!<	バッファのサイズ
+	 *	@param[in]		argMinDigits	!<	整数部の最小の桁数
+	 *	@param[in]		argSeparator	!<	区切り文字('\0'なら区切らない)
+	 *	@return		終端文字付きの文字列(足りなければ空)
+	 */
+	std::string_view Decorate(char *argBuf, size_t argLength, size_t argBufSize, int argMinDigits, char argSeparator)
+	{
+		const size_t Sign = (argLength != 0 && argBuf[0] == '-') ? 1 : 0;
+		size_t digits = 0;
+		while (Sign + digits < argLength && argBuf[Sign + digits] >= '0' && argBuf[Sign + digits] <= '9')
+			++digits;
+
+		// infやnanはそのまま
+		const size_t Pad = (digits != 0 && argMinDigits > static_cast<int>(digits)) ? argMinDigits - digits : 0;
+		const size_t Total = digits + Pad;
+		const size_t Separators = (digits != 0 && argSeparator != '\0') ? (Total - 1) / 3 : 0;
+		const size_t Length = argLength + Pad + Separators;
+		if (Length >= argBufSize)
+			return std::string_view();
+
+		if (Pad + Separators != 0)
+		{
+			// 後ろから詰め直すので、書き込み位置が読み込み位置を追い越すことはない
+			char *dst = argBuf + Sign + Total + Separators;
+			const char *src = argBuf + Sign + digits;
+			std::memmove(dst, src, argLength - Sign - digits);
+			for (size_t i = 0; i < Total; ++i)
+			{
+				if (argSeparator != '\0' && i != 0 && i % 3 == 0)
+					*--dst = argSeparator;
+				*--dst = (i < digits) ? *--src : '0';
+			}
+		}
+		argBuf[Length] = '\0';
+		return std::string_view(argBuf, Length);
+	}
+
+	/**
+	 *	@fn			FormatFloatImpl
+	 *	@brief		実数の文字列化
+	 */
+	template<typename T>
+	std::string_view FormatFloatImpl(T argValue, char *argBuf, size_t argBufSize, int argPrecision, int argMinDigits, char argSeparator)
+	{
+		if (argBufSize == 0)
+			return std::string_view();
+
+		// 終端文字の分を残して書き込む
+		std::to_chars_result result = (argPrecision >= 0)
+			? std::to_chars(argBuf, argBuf + argBufSize - 1, argValue, std::chars_format::fixed, argPrecision)
+			: std::to_chars(argBuf, argBuf + argBufSize - 1, argValue);
+		if (result.ec != std::errc())
+			return std::string_view();
+
+		return Decorate(argBuf, static_cast<size_t>(result.ptr - argBuf), argBufSize, argMinDigits, argSeparator);
+	}
+
+	/**
+	 *	@fn			Parse
+	 *	@brief		文字列を数値として解析する
+	 *	@param[in]	argIsWhole	!<	文字列全体が数値でなければ失敗にするか(falseなら数値の後ろは無視する)
+	 */
+	template<typename T>
+	bool Parse(std::string_view argSrc, T *argDst, bool argIsWhole = true)
+	{
+		while (!argSrc.empty() && (argSrc.front() == ' ' || argSrc.front() == '\t'))
+			argSrc.remove_prefix(1);
+		while (!argSrc.empty() && (argSrc.back() == ' ' || argSrc.back() == '\t'))
+			argSrc.remove_suffix(1);
+		// from_charsは'+'を受け付けないので読み飛ばす
+		if (argSrc.size() >= 2 && argSrc[0] == '+' && argSrc[1] != '-')
+			argSrc.remove_prefix(1);
+
+		T value;
+		const char *End = argSrc.data() + argSrc.size();
+		std::from_chars_result result = std::from_chars(argSrc.data(), End, value);
+		if (result.ec != std::errc() || (argIsWhole && result.ptr != End))
+			return false;
+
+		*argDst = value;
+		return true;
+	}
+}
+
+std::string_view Utility::NumberFormat::FormatInt(long long argValue, char *argBuf, size_t argBufSize, int argMinDigits, char argSeparator)
+{
+	if (argBufSize == 0)
+		return std::string_view();
+
+	std::to_chars_result result = std::to_chars(argBuf, argBuf + argBufSize - 1, argValue);
+	if (result.ec != std::errc())
+		return std::string_view();
+
+	return Decorate(argBuf, static_cast<size_t>(result.ptr - argBuf), argBufSize, argMinDigits, argSeparator);
+}
+
+std::string_view Utility::NumberFormat::FormatUnsigned(unsigned long long argValue, char *argBuf, size_t argBufSize, int argMinDigits, char argSeparator)
+{
+	if (argBufSize == 0)
+		return std::string_view();
+
+	std::to_chars_result result = std::to_chars(argBuf, argBuf + argBufSize - 1, argValue);
+	if (result.ec != std::errc())
+		return std::string_view();
+
+	return Decorate(argBuf, static_cast<size_t>(result.ptr - argBuf), argBufSize, argMinDigits, argSeparator);
+}
+
+std::string_view Utility::NumberFormat::FormatFloat(float argValue, char *argBuf, size_t argBufSize, int argPrecision, int argMinDigits, char argSeparator)
+{
+	return FormatFloatImpl(argValue, argBuf, argBufSize, argPrecision, argMinDigits, argSeparator);
+}
+
+std::string_view Utility::NumberFormat::FormatFloat(double argValue, char *argBuf, size_t argBufSize, int argPrecision, int argMinDigits, char argSeparator)
+{
+	return FormatFloatImpl(argValue, argBuf, argBufSize, argPrecision, argMinDigits, argSeparator);
+}
+
+bool Utility::NumberFormat::ParseInt(std::string_view argSrc, int *argDst)
+{
+	return Parse(argSrc, argDst);
+}
+
+bool Utility::NumberFormat::ParseInt(std::string_view argSrc, long long *argDst)
+{
+	return Parse(argSrc, argDst);
+}
+
+bool Utility::NumberFormat::ParseLeadingInt(std::string_view argSrc, int *argDst)
+{
+	return Parse(argSrc, argDst, false);
+}
+
+bool Utility::NumberFormat::ParseFloat(std::string_view argSrc, float *argDst)
+{
+	return Parse(argSrc, argDst);
+}
+
+bool Utility::NumberFormat::ParseFloat(std::string_view argSrc, double *argDst)
+{
+	return Parse(argSrc, argDst);
+}
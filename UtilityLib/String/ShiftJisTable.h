@@ -0,0 +1,11 @@
+﻿/**
+ *	@file	ShiftJisTable.h
+ *	@brief	Shift-JIS(CP932)の2バイト文字からUnicodeへの対応表。CP932の変換表から生成
+ *	@date	2026 / 10 / 19
+ *	@note	表の本体はShiftJisTable.cppにある(ヘッダーには宣言だけを置き、翻訳単位ごとに複製されないようにする)
+ *			インデックスは (先行バイトの番号) * 188 + (後続バイトの番号)。対応する文字がない場合は0
+ *			先行バイト: 0x81～0x9F, 0xE0～0xFC / 後続バイト: 0x40～0x7E, 0x80～0xFC
+ */
+#pragma once
+
+extern const unsigned short ShiftJisTable[60 * 188];
@@ -8,9 +8,18 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <cstring>
 #include <vector>
+#if defined(_WIN32)
 #include <windows.h>
+#endif
 #include <sstream>
+#include <charconv>
+#include <type_traits>
+
+#include "NumberFormat.h"
+#include "TextEncoding.h"
 
 namespace Utility
 {
@@ -46,76 +55,111 @@ namespace Utility
 		}
 		/**
 		 *	@fn			DeleteSpace
-		 *  @brief		空白(スペース，タブ)を削除
+		 *  @brief		空白(スペース，タブ，全角スペース)を削除してバッファに書き込む
+		 *  @param[in]	argSrc	!<	 処理文字列
+		 *  @param[in]	argSize	!<	 処理文字列の長さ
+		 *  @param[out]	argDst	!<	 書き込み先(argSize以上。argSrcと同じでもよい)
+		 *	@return		書き込んだ長さ
+		 *	@note		全角スペースはUTF-8(E3 80 80)とShift-JIS(81 40)のバイト列で判定する
+		 */
+		static size_t DeleteSpace(const char *argSrc, size_t argSize, char *argDst);
+		/**
+		 *	@fn			DeleteSpace
+		 *  @brief		空白(スペース，タブ，全角スペース)をその場で削除
+		 *  @param[in,out]	argBuf	!<	 処理文字列
+		 */
+		inline static void DeleteSpace(std::string *argBuf)
+		{
+			argBuf->resize(DeleteSpace(argBuf->data(), argBuf->size(), &(*argBuf)[0]));
+		}
+		/**
+		 *	@fn			DeleteSpace
+		 *  @brief		空白(スペース，タブ，全角スペース)を削除
 		 *  @param[in]	buf		!<	 処理文字列
 		 *	@return		変換後の文字列
 		 */
 		inline static std::string DeleteSpace(const std::string &argBuf)
 		{
-			size_t pos;
 			std::string buf = argBuf;
-			while ((pos = buf.find_first_of(" 　\t")) != std::string::npos)
-				buf.erase(pos, 1);
-			
+			DeleteSpace(&buf);
 			return buf;
 		}
 		/**
 		 *	@fn			GetFileName
 		 *  @brief		パスからファイル名のみ取り出す
 		 *  @param[in]	argPath	!<	  パス
-		 *	@return		ファイル名
+		 *	@return		ファイル名(argPathの部分文字列)
 		 */
-		inline static std::string GetFileName(const std::string &argPath)
+		inline static std::string_view GetFileName(std::string_view argPath)
 		{
 			size_t pos = argPath.rfind('\\');
-			if (pos != std::string::npos) 
-				return argPath.substr(pos + 1, argPath.size() - pos - 1);
-			
+			if (pos != std::string_view::npos)
+				return argPath.substr(pos + 1);
+
 			pos = argPath.rfind('/');
-			if (pos != std::string::npos) 
-				return argPath.substr(pos + 1, argPath.size() - pos - 1);
+			if (pos != std::string_view::npos)
+				return argPath.substr(pos + 1);
 
 			return argPath;
 		}
+		inline static std::string GetFileName(const std::string &argPath) { return std::string(GetFileName(std::string_view(argPath))); }
+		inline static std::string GetFileName(const char *argPath) { return std::string(GetFileName(std::string_view(argPath))); }
 		/**
 		 *	@fn			GetFolderPath
 		 *  @brief		パスからファイル名を取り除いたパスを抽出
 		 *  @param[in]	argPath	!<	 パス
-		 *	@return		フォルダパス
+		 *	@return		フォルダパス(argPathの部分文字列)
 		 */
-		inline static std::string GetFolderPath(const std::string &argPath)
+		inline static std::string_view GetFolderPath(std::string_view argPath)
 		{
 			size_t pos = argPath.rfind('\\');
-			if (pos != std::string::npos) 
+			if (pos != std::string_view::npos)
 				return argPath.substr(0, pos + 1);
 
-
 			pos = argPath.rfind('/');
-			if (pos != std::string::npos) 
+			if (pos != std::string_view::npos)
 				return argPath.substr(0, pos + 1);
-			
-			return "";
+
+			return std::string_view();
 		}
+		inline static std::string GetFolderPath(const std::string &argPath) { return std::string(GetFolderPath(std::string_view(argPath))); }
+		inline static std::string GetFolderPath(const char *argPath) { return std::string(GetFolderPath(std::string_view(argPath))); }
 		/**
 		 *	@fn			GetParentFolderName
 		 *  @brief		パスからファイルの親フォルダ名を取り出す
 		 *  @param[in]	argPath	!<	 パス
-		 *	@return		親フォルダ名
+		 *	@return		親フォルダ名(argPathの部分文字列)
 		 */
-		inline static std::string GetParentFolderName(const std::string &argPath)
+		inline static std::string_view GetParentFolderName(std::string_view argPath)
 		{
-			std::string::size_type pos1, pos0;
+			std::string_view::size_type pos1, pos0;
 			pos1 = argPath.find_last_of("\\/");
 			pos0 = argPath.find_last_of("\\/", pos1 - 1);
 
-			if (pos0 != std::string::npos && pos1 != std::string::npos) 
-			{
+			if (pos0 != std::string_view::npos && pos1 != std::string_view::npos)
 				return argPath.substr(pos0 + 1, pos1 - pos0 - 1);
-			}
-			else 
-			{
-				return "";
-			}
+
+			return std::string_view();
+		}
+		inline static std::string GetParentFolderName(const std::string &argPath) { return std::string(GetParentFolderName(std::string_view(argPath))); }
+		inline static std::string GetParentFolderName(const char *argPath) { return std::string(GetParentFolderName(std::string_view(argPath))); }
+		/**
+		 *	@fn			GetExtension
+		 *  @brief		パスから拡張子を取り出す
+		 *  @param[in]	argPath	!<	 ファイルパス
+		 *	@return		拡張子(argPathの部分文字列。大文字小文字はそのまま)
+		 *	@note		std::stringとconst char*の版は小文字にした拡張子を返す。確保せずに比べるときはIsExtensionを使う
+		 */
+		inline static std::string_view GetExtension(std::string_view argPath)
+		{
+			size_t pos = argPath.rfind('.');
+			if (pos == std::string_view::npos)
+				return std::string_view();
+
+			std::string_view ext = argPath.substr(pos + 1);
+			// パスの最後に\0やスペースがあったときの対策
+			size_t last = ext.find_last_not_of(std::string_view("\0 ", 2));
+			return ext.substr(0, (last == std::string_view::npos) ? 0 : last + 1);
 		}
 		/**
 		 *	@fn			GetExtension
@@ -125,76 +169,116 @@ namespace Utility
 		 */
 		inline static std::string GetExtension(const std::string &argPath)
 		{
-			std::string ext;
-			size_t pos1 = argPath.rfind('.');
-			if (pos1 != std::string::npos) 
+			std::string ext(GetExtension(std::string_view(argPath)));
+			for (char &c : ext)
+				c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+			return ext;
+		}
+		inline static std::string GetExtension(const char *argPath) { return GetExtension(std::string(argPath)); }
+		/**
+		 *	@fn			IsExtension
+		 *  @brief		パスの拡張子を大文字小文字を区別せずに比較する
+		 *  @param[in]	argPath			!<	 ファイルパス
+		 *  @param[in]	argExtension	!<	 拡張子("png"等。大文字小文字は問わない)
+		 *	@retval		true			!<	一致する
+		 *	@retval		false			!<	一致しない
+		 */
+		inline static bool IsExtension(std::string_view argPath, std::string_view argExtension)
+		{
+			std::string_view ext = GetExtension(argPath);
+			if (ext.size() != argExtension.size())
+				return false;
+
+			for (size_t i = 0; i < ext.size(); ++i)
 			{
-				ext = argPath.substr(pos1 + 1, argPath.size() - pos1);
-				std::string::iterator itr = ext.begin();
-				while (itr != ext.end()) 
-				{
-					*itr = static_cast<char>(tolower(*itr));
-					itr++;
-				}
-				itr = ext.end() - 1;
-				while (itr != ext.begin()) 
-				{    // パスの最後に\0やスペースがあったときの対策
-					if (*itr == 0 || *itr == 32) 
-					{
-						ext.erase(itr--);
-					}
-					else 
-					{
-						itr--;
-					}
-				}
+				if (tolower(static_cast<unsigned char>(ext[i])) != tolower(static_cast<unsigned char>(argExtension[i])))
+					return false;
 			}
-
-			return ext;
+			return true;
 		}
 		/**
 		 *	@fn			ExtractPathWithoutExt
 		 *  @brief		ファイル名から拡張子を削除
 		 *  @param[in]	argFn	!<	 ファイル名(フルパス or 相対パス)
-		 *	@return		フォルダパス
+		 *	@return		フォルダパス(argFnの部分文字列)
 		 */
-		inline static std::string ExtractPathWithoutExt(const std::string &argFn)
+		inline static std::string_view ExtractPathWithoutExt(std::string_view argFn)
 		{
-			std::string::size_type pos;
-			if ((pos = argFn.find_last_of(".")) == std::string::npos) 
+			std::string_view::size_type pos;
+			if ((pos = argFn.find_last_of('.')) == std::string_view::npos)
 				return argFn;
 
 			return argFn.substr(0, pos);
 		}
+		inline static std::string ExtractPathWithoutExt(const std::string &argFn) { return std::string(ExtractPathWithoutExt(std::string_view(argFn))); }
+		inline static std::string ExtractPathWithoutExt(const char *argFn) { return std::string(ExtractPathWithoutExt(std::string_view(argFn))); }
 		/**
 		 *	@fn			ExtractFileName
 		 *  @brief		ファイル名を抽出(拡張子を除くフラグ付き)
 		 *  @param[in]	argPath				!<	 パス
 		 *  @param[in]	argWithoutExtension	!<	 拡張子を除くフラグ
-		 *	@return		ファイル名
+		 *	@return		ファイル名(argPathの部分文字列)
 		 */
-		inline static std::string ExtractFileName(const std::string &argPath, bool argWithoutExtension = true)
+		inline static std::string_view ExtractFileName(std::string_view argPath, bool argWithoutExtension = true)
 		{
-			std::string fn;
-			std::string::size_type fpos;
-			if ((fpos = argPath.find_last_of("/")) != std::string::npos) 
+			std::string_view fn = argPath;
+			std::string_view::size_type fpos;
+			if ((fpos = argPath.find_last_of('/')) != std::string_view::npos)
 			{
 				fn = argPath.substr(fpos + 1);
 			}
-			else if ((fpos = argPath.find_last_of("\\")) != std::string::npos)
+			else if ((fpos = argPath.find_last_of('\\')) != std::string_view::npos)
 			{
 				fn = argPath.substr(fpos + 1);
 			}
-			else 
-			{
-				fn = argPath;
-			}
 
-			if (argWithoutExtension && (fpos = fn.find_last_of(".")) != std::string::npos) 
+			if (argWithoutExtension && (fpos = fn.find_last_of('.')) != std::string_view::npos)
 				fn = fn.substr(0, fpos);
 
 			return fn;
 		}
+		inline static std::string ExtractFileName(const std::string &argPath, bool argWithoutExtension = true) { return std::string(ExtractFileName(std::string_view(argPath), argWithoutExtension)); }
+		inline static std::string ExtractFileName(const char *argPath, bool argWithoutExtension = true) { return std::string(ExtractFileName(std::string_view(argPath), argWithoutExtension)); }
+		/**
+		 *	@fn			JoinPath
+		 *  @brief		フォルダパスとファイル名を結合してバッファに書き込む(メモリ確保なし)
+		 *  @param[in]	argFolder		!<	 フォルダパス
+		 *  @param[in]	argFileName		!<	 ファイル名
+		 *  @param[out]	argBuffer		!<	 書き込み先のバッファ
+		 *  @param[in]	argBufferSize	!<	 バッファのサイズ(終端文字を含む)
+		 *  @param[in]	argSeparator	!<	 区切り文字
+		 *	@return		書き込んだパス(終端文字付き)。バッファが足りないときは空
+		 */
+		inline static std::string_view JoinPath(std::string_view argFolder, std::string_view argFileName, char *argBuffer, size_t argBufferSize, char argSeparator = '/')
+		{
+			const bool HasSeparator = !argFolder.empty() && (argFolder.back() == '/' || argFolder.back() == '\\');
+			if (HasSeparator && !argFileName.empty() && (argFileName.front() == '/' || argFileName.front() == '\\'))
+				argFileName.remove_prefix(1);
+
+			const bool NeedSeparator = !argFolder.empty() && !HasSeparator;
+			const size_t Length = argFolder.size() + (NeedSeparator ? 1 : 0) + argFileName.size();
+			if (Length + 1 > argBufferSize)
+			{
+				if (argBufferSize > 0)
+					argBuffer[0] = '\0';
+				return std::string_view();
+			}
+
+			char *dst = argBuffer;
+			std::memcpy(dst, argFolder.data(), argFolder.size());
+			dst += argFolder.size();
+			if (NeedSeparator)
+				*dst++ = argSeparator;
+			std::memcpy(dst, argFileName.data(), argFileName.size());
+			argBuffer[Length] = '\0';
+
+			return std::string_view(argBuffer, Length);
+		}
+		template<size_t N>
+		inline static std::string_view JoinPath(std::string_view argFolder, std::string_view argFileName, char (&argBuffer)[N], char argSeparator = '/')
+		{
+			return JoinPath(argFolder, argFileName, argBuffer, N, argSeparator);
+		}
 
 		/**
 		 *	@fn			CountString
@@ -235,50 +319,76 @@ namespace Utility
 		 *	@brief		様々な型のstringへの変換(stringstreamを使用)
 		 *  @param[in]	arg	!<	入力
 		 *  @return		string型に変換したもの
+		 *	@note		整数と実数はstringstreamと同じ表記をto_charsで作る
 		 */
 		template<typename T>
 		inline static std::string RxToString(const T &arg)
 		{
-			std::stringstream ss;
-			ss << arg;
-			return ss.str();
+			if constexpr (std::is_integral_v<T> && sizeof(T) > sizeof(char) && (std::is_signed_v<T> || sizeof(T) < sizeof(long long)))
+			{
+				char buf[NumberFormat::IntegerBufferSize];
+				return std::string(NumberFormat::FormatInt(static_cast<long long>(arg), buf));
+			}
+			else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			{
+				// stringstreamの既定の書式(%g、6桁)に合わせる
+				char buf[NumberFormat::FloatBufferSize];
+				std::to_chars_result result = std::to_chars(buf, buf + sizeof(buf), arg, std::chars_format::general, 6);
+				return std::string(buf, result.ptr);
+			}
+			else
+			{
+				std::stringstream ss;
+				ss << arg;
+				return ss.str();
+			}
 		}
 	    /**
 		 *	@fn			ToWstring
 		 *	@brief		stringからwstringへの変換
-		 *	@param[in]	argSrc				!<	変換したい文字列
+		 *	@param[in]	argSrc				!<	変換したい文字列(Shift-JIS)
 		 * 	@return		変換したワイド文字列
 		 */
-		inline static std::wstring ToWstring(const std::string argStr)
+		inline static std::wstring ToWstring(std::string_view argStr)
 		{
-			size_t size;
-			if (0 != mbstowcs_s(&size, nullptr, 0, argStr.c_str(), 0))
-				return nullptr;
-
-			std::vector<wchar_t> wch(size);
-			if (0 != mbstowcs_s(&size, wch.data(), wch.size(), argStr.c_str(), argStr.length()))
-				return nullptr;
-
-			return wch.data();
+			// 1バイトが2文字以上になることはないので一度の確保で足りる
+			std::wstring dst(argStr.size(), L'\0');
+			dst.resize(TextEncoding::ShiftJisToWide(argStr, &dst[0], dst.size()));
+			return dst;
 		}
 		/**
 		 *	@fn			ToString
 		 *	@brief		wstringからstringへの変換
 		 *	@param[in]	wstr			!<	変換したいワイド文字列
-		 * 	@return		変換した文字列
+		 * 	@return		変換した文字列(Shift-JIS)
 		 */
-		inline static std::string ToString(const std::wstring argWstr)
+		inline static std::string ToString(std::wstring_view argWstr)
 		{
-			// wstring → SJIS
-			int size = WideCharToMultiByte(CP_OEMCP, 0, argWstr.c_str(), -1, nullptr, 0, nullptr, nullptr);
-			char* buffer = new char[size];
-
-			WideCharToMultiByte(CP_OEMCP, 0, argWstr.c_str(), -1, buffer, size, nullptr, nullptr);
-
-			std::string str(buffer, buffer + size - 1);
-			delete []buffer;
+			std::string dst(argWstr.size() * 2, '\0');
+			dst.resize(TextEncoding::WideToShiftJis(argWstr, &dst[0], dst.size()));
+			return dst;
+		}
+		/**
+		 *	@fn			ToString
+		 *	@brief		wstringからstringへの変換(確保しない版)
+		 *	@param[in]	argWstr			!<	変換したいワイド文字列
+		 *	@param[out]	argBuf			!<	書き込み先
+		 *	@param[in]	argBufSize		!<	書き込み先のサイズ(終端文字を含む)
+		 * 	@return		変換した文字列(終端文字付き)、書き込み先が足りなければ空
+		 */
+		inline static std::string_view ToString(std::wstring_view argWstr, char *argBuf, size_t argBufSize)
+		{
+			size_t length = TextEncoding::WideToShiftJis(argWstr, argBuf, argBufSize);
+			if (length >= argBufSize)
+				return std::string_view();
 
-			return str;
+			argBuf[length] = '\0';
+			return std::string_view(argBuf, length);
+		}
+		template<size_t N>
+		inline static std::string_view ToString(std::wstring_view argWstr, char (&argBuf)[N])
+		{
+			return ToString(argWstr, argBuf, N);
 		}
 		/**
 		 *	@fn			DeleteSubStr
@@ -295,6 +405,26 @@ namespace Utility
 
 			return argSrc.substr(0, pos + 1);
 		}
+		/**
+		 *	@fn			Replace
+		 *	@brief		文字列中から文字列を検索して別の文字列に置換し、バッファに書き込む
+		 *	@param[in]	argSrc		!< 置換対象の文字列
+		 *	@param[in]	argFrom		!< 検索文字列
+		 *	@param[in]	argTo		!< 置換後の文字列
+		 *	@param[out]	argDst		!< 書き込み先(argSrcと重ならないこと)
+		 *	@param[in]	argDstSize	!< 書き込み先のサイズ
+		 * 	@return		置換後の長さ。argDstSizeを超えるときは必要な長さを返す(書き込み先の内容は不定)
+		 */
+		static size_t Replace(std::string_view argSrc, std::string_view argFrom, std::string_view argTo, char *argDst, size_t argDstSize);
+		/**
+		 *	@fn			Replace
+		 *	@brief		文字列中から文字列を検索して別の文字列にその場で置換する
+		 *	@param[in,out]	argBuf	!< 置換対象の文字列
+		 *	@param[in]		argFrom	!< 検索文字列
+		 *	@param[in]		argTo	!< 置換後の文字列
+		 *	@note		置換後の文字列が長くならない場合はメモリ確保なしで1パスで処理する
+		 */
+		static void Replace(std::string *argBuf, std::string_view argFrom, std::string_view argTo);
 		/**
 		 *	@fn			Replace
 		 *	@brief		文字列中から文字列を検索して別の文字列に置換する
@@ -306,12 +436,7 @@ namespace Utility
 		inline static std::string Replace(const std::string& argSrc, const std::string& argFrom, const std::string& argTo)
 		{
 			std::string src = argSrc;
-			std::string::size_type pos = 0;
-			while (pos = src.find(argFrom, pos), pos != std::string::npos)
-			{
-				src.replace(pos, argFrom.length(), argTo);
-				pos += argTo.length();
-			}
+			Replace(&src, argFrom, argTo);
 			return src;
 		}
 		/**
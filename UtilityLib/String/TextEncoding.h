@@ -0,0 +1,139 @@
+﻿/**
+ *	@file	TextEncoding.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include <string_view>
+
+namespace Utility
+{
+	/**
+	 *  @class		TextEncoding
+	 *  @brief		文字コードの変換(UTF-8 / UTF-16 / UTF-32 / Shift-JIS(CP932))
+	 *  @note		どの関数も書き込み先に収まる分だけ書き込み、全体の変換に必要な長さを返す。
+	 *				戻り値が書き込み先のサイズを超えたら足りなかったということ。終端文字は書き込まない。
+	 *				不正なバイト列はU+FFFDに、Shift-JISにない文字は'?'に置き換える
+	 */
+	class TextEncoding final
+	{
+	public:
+		static const char32_t ReplacementChar = 0xFFFD;
+
+	public:
+		/**
+		 *	@fn			Utf8ToUtf16
+		 *	@brief		UTF-8からUTF-16への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t Utf8ToUtf16(std::string_view argSrc, char16_t *argDst, size_t argDstSize);
+		/**
+		 *	@fn			Utf16ToUtf8
+		 *	@brief		UTF-16からUTF-8への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t Utf16ToUtf8(std::u16string_view argSrc, char *argDst, size_t argDstSize);
+		/**
+		 *	@fn			Utf8ToUtf32
+		 *	@brief		UTF-8からUTF-32への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t Utf8ToUtf32(std::string_view argSrc, char32_t *argDst, size_t argDstSize);
+		/**
+		 *	@fn			Utf32ToUtf8
+		 *	@brief		UTF-32からUTF-8への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t Utf32ToUtf8(std::u32string_view argSrc, char *argDst, size_t argDstSize);
+
+		/**
+		 *	@fn			ShiftJisToUtf8
+		 *	@brief		Shift-JISからUTF-8への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t ShiftJisToUtf8(std::string_view argSrc, char *argDst, size_t argDstSize);
+		/**
+		 *	@fn			Utf8ToShiftJis
+		 *	@brief		UTF-8からShift-JISへの変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t Utf8ToShiftJis(std::string_view argSrc, char *argDst, size_t argDstSize);
+		/**
+		 *	@fn			ShiftJisToUtf16
+		 *	@brief		Shift-JISからUTF-16への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t ShiftJisToUtf16(std::string_view argSrc, char16_t *argDst, size_t argDstSize);
+		/**
+		 *	@fn			Utf16ToShiftJis
+		 *	@brief		UTF-16からShift-JISへの変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t Utf16ToShiftJis(std::u16string_view argSrc, char *argDst, size_t argDstSize);
+
+		/**
+		 *	@fn			Utf8ToWide
+		 *	@brief		UTF-8からワイド文字(WindowsはUTF-16、それ以外はUTF-32)への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t Utf8ToWide(std::string_view argSrc, wchar_t *argDst, size_t argDstSize);
+		/**
+		 *	@fn			WideToUtf8
+		 *	@brief		ワイド文字からUTF-8への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 */
+		static size_t WideToUtf8(std::wstring_view argSrc, char *argDst, size_t argDstSize);
+		/**
+		 *	@fn			ShiftJisToWide
+		 *	@brief		Shift-JISからワイド文字への変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 *	@note		1バイトが1要素を超えることはないので、書き込み先はargSrc.size()あれば足りる
+		 */
+		static size_t ShiftJisToWide(std::string_view argSrc, wchar_t *argDst, size_t argDstSize);
+		/**
+		 *	@fn			WideToShiftJis
+		 *	@brief		ワイド文字からShift-JISへの変換
+		 *	@param[in]	argSrc		!<	変換元
+		 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+		 *	@param[in]	argDstSize	!<	書き込み先の要素数
+		 *	@return		変換後の要素数
+		 *	@note		1要素が2バイトを超えることはないので、書き込み先はargSrc.size() * 2あれば足りる
+		 */
+		static size_t WideToShiftJis(std::wstring_view argSrc, char *argDst, size_t argDstSize);
+	};
+}
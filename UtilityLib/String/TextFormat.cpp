@@ -0,0 +1,225 @@
+﻿/**
+ *	@file	TextFormat.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "TextFormat.h"
+#include "NumberFormat.h"
+#include "TextEncoding.h"
+
+#include <algorithm>
+
+namespace
+{
+	using Utility::TextFormat;
+
+	/**
+	 *  @class		Writer
+	 *  @brief		書き込み先に入る分だけ書き込む
+	 */
+	class Writer final
+	{
+	private:
+		wchar_t	*buf_;
+		size_t	capacity_;	//	!<	終端文字を除いた書き込める数
+		size_t	length_;
+
+	public:
+		Writer(wchar_t *argBuf, size_t argCapacity) : buf_(argBuf), capacity_(argCapacity), length_(0) {}
+
+	public:
+		inline size_t Length() const { return length_; }
+		inline void Truncate(size_t argLength) { length_ = std::min(length_, argLength); }
+
+		void Put(wchar_t argChar, size_t argCount = 1)
+		{
+			argCount = std::min(argCount, capacity_ - length_);
+			std::fill_n(buf_ + length_, argCount, argChar);
+			length_ += argCount;
+		}
+		void Put(std::wstring_view argStr)
+		{
+			size_t count = std::min(argStr.size(), capacity_ - length_);
+			std::copy_n(argStr.data(), count, buf_ + length_);
+			length_ += count;
+		}
+		/**
+		 *	@fn			PutAscii
+		 *	@brief		ASCIIだけの文字列(数値の文字列化の結果)を書き込む
+		 */
+		void PutAscii(std::string_view argStr)
+		{
+			size_t count = std::min(argStr.size(), capacity_ - length_);
+			for (size_t i = 0; i < count; ++i)
+				buf_[length_ + i] = static_cast<wchar_t>(argStr[i]);
+			length_ += count;
+		}
+		/**
+		 *	@fn			PutShiftJis
+		 *	@brief		Shift-JISの文字列を変換しながら書き込む
+		 */
+		void PutShiftJis(std::string_view argStr)
+		{
+			size_t required = Utility::TextEncoding::ShiftJisToWide(argStr, buf_ + length_, capacity_ - length_);
+			length_ += std::min(required, capacity_ - length_);
+		}
+	};
+
+	/**
+	 *	@fn			PutNumber
+	 *	@brief		数値を書き込む
+	 *	@param[in]	argArg		!<	引数
+	 *	@param[in]	argSpec		!<	置き換えフィールドの指定
+	 *	@param[out]	argWriter	!<	書き込み先
+	 */
+	void PutNumber(const TextFormat::Arg &argArg, const TextFormat::Spec &argSpec, Writer *argWriter)
+	{
+		char buf[Utility::NumberFormat::FloatBufferSize * 2];
+		const char Separator = (argSpec.hasSeparator_) ? ',' : '\0';
+		auto Format = [&](int argMinDigits)
+		{
+			switch (argArg.type_)
+			{
+			case TextFormat::Arg::eType::Int:
+				return Utility::NumberFormat::FormatInt(argArg.int_, buf, argMinDigits, Separator);
+			case TextFormat::Arg::eType::Unsigned:
+				return Utility::NumberFormat::FormatUnsigned(argArg.unsigned_, buf, argMinDigits, Separator);
+			case TextFormat::Arg::eType::Float:
+				return Utility::NumberFormat::FormatFloat(argArg.float_, buf, argSpec.precision_, argMinDigits, Separator);
+			default:
+				return Utility::NumberFormat::FormatFloat(argArg.double_, buf, argSpec.precision_, argMinDigits, Separator);
+			}
+		};
+
+		std::string_view text = Format(0);
+		if (argSpec.isZeroPad_ && static_cast<int>(text.size()) < argSpec.width_)
+		{// 0埋めの幅は符号や小数部を含むので、整数部の桁数に直して作り直す
+			int digits = 0;
+			for (size_t i = (!text.empty() && text[0] == '-') ? 1 : 0; i < text.size() && ((text[i] >= '0' && text[i] <= '9') || text[i] == Separator); ++i)
+				digits += (text[i] != Separator) ? 1 : 0;
+			if (digits != 0)
+			{
+				// 区切り文字も幅に数え、幅以上になる最小の桁数で埋める(先頭に区切り文字が増える桁数では幅を1文字超える)
+				int minDigits = digits + argSpec.width_ - static_cast<int>(text.size());
+				while (minDigits > digits + 1 && static_cast<int>(Format(minDigits - 1).size()) >= argSpec.width_)
+					--minDigits;
+				text = Format(minDigits);
+			}
+		}
+
+		// 数値は右寄せ
+		if (static_cast<int>(text.size()) < argSpec.width_)
+			argWriter->Put(L' ', argSpec.width_ - text.size());
+		argWriter->PutAscii(text);
+	}
+
+	/**
+	 *	@fn			PutArg
+	 *	@brief		引数を書き込む
+	 *	@param[in]	argArg		!<	引数
+	 *	@param[in]	argSpec		!<	置き換えフィールドの指定
+	 *	@param[out]	argWriter	!<	書き込み先
+	 */
+	void PutArg(const TextFormat::Arg &argArg, const TextFormat::Spec &argSpec, Writer *argWriter)
+	{
+		const size_t Begin = argWriter->Length();
+		switch (argArg.type_)
+		{
+		case TextFormat::Arg::eType::Int:
+		case TextFormat::Arg::eType::Unsigned:
+		case TextFormat::Arg::eType::Float:
+		case TextFormat::Arg::eType::Double:
+			PutNumber(argArg, argSpec, argWriter);
+			return;
+		case TextFormat::Arg::eType::Bool:
+			argWriter->Put((argArg.bool_) ? L"true" : L"false");
+			break;
+		case TextFormat::Arg::eType::Char:
+		{
+			const char Src = static_cast<char>(argArg.char_);
+			argWriter->PutShiftJis(std::string_view(&Src, 1));
+			break;
+		}
+		case TextFormat::Arg::eType::WideChar:
+			argWriter->Put(argArg.char_);
+			break;
+		case TextFormat::Arg::eType::String:
+		{
+			std::string_view src(static_cast<const char*>(argArg.str_.data_), argArg.str_.size_);
+			argWriter->PutShiftJis(src);
+			if (argSpec.precision_ >= 0)
+			{// 精度は最大文字数。2バイト文字の途中で切らないように、変換してから切り詰める
+				argWriter->Truncate(Begin + static_cast<size_t>(argSpec.precision_));
+			}
+			break;
+		}
+		case TextFormat::Arg::eType::WideString:
+		{
+			std::wstring_view src(static_cast<const wchar_t*>(argArg.str_.data_), argArg.str_.size_);
+			if (argSpec.precision_ >= 0)
+				src = src.substr(0, static_cast<size_t>(argSpec.precision_));
+			argWriter->Put(src);
+			break;
+		}
+		default:
+			break;
+		}
+
+		// 文字列は左寄せ
+		const size_t Written = argWriter->Length() - Begin;
+		if (static_cast<int>(Written) < argSpec.width_)
+			argWriter->Put(L' ', argSpec.width_ - Written);
+	}
+}
+
+std::wstring_view Utility::TextFormat::FormatArgs(wchar_t *argBuf, size_t argBufSize, std::wstring_view argFormat, const Arg *argArgs, size_t argArgCount)
+{
+	if (argBufSize == 0)
+		return std::wstring_view();
+
+	Writer writer(argBuf, argBufSize - 1);
+	size_t next = 0;
+	size_t literal = 0;	//	!<	まだ書き込んでいない文字列の先頭
+	for (size_t pos = 0; pos < argFormat.size(); ++pos)
+	{
+		const wchar_t C = argFormat[pos];
+		if (C != L'{' && C != L'}')
+			continue;
+
+		writer.Put(argFormat.substr(literal, pos - literal));
+		if (pos + 1 < argFormat.size() && argFormat[pos + 1] == C)
+		{// "{{"、"}}"は括弧そのもの
+			writer.Put(C);
+			literal = ++pos + 1;
+			continue;
+		}
+		if (C == L'}')
+		{
+			assert(false && "Unmatched '}' in format...");
+			writer.Put(C);
+			literal = pos + 1;
+			continue;
+		}
+
+		Spec spec = {};
+		size_t end = ParseSpec(argFormat, pos + 1, &spec);
+		if (end == std::wstring_view::npos)
+		{// 不正な書式は残りをそのまま書き込む
+			assert(false && "Invalid format spec...");
+			literal = pos;
+			break;
+		}
+
+		const size_t Index = (spec.hasIndex_) ? spec.index_ : next++;
+		assert(Index < argArgCount && "Format argument index out of range...");
+		if (Index < argArgCount)
+			PutArg(argArgs[Index], spec, &writer);
+		pos = end - 1;
+		literal = end;
+	}
+	writer.Put(argFormat.substr(std::min(literal, argFormat.size())));
+
+	argBuf[writer.Length()] = L'\0';
+	return std::wstring_view(argBuf, writer.Length());
+}
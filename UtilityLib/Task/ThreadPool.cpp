@@ -0,0 +1,213 @@
+﻿/**
+ *	@file	ThreadPool.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	thread_local bool isInsideJob = false;	//	!<	仕事を処理している最中か(入れ子の呼び出しを順に処理するため)
+
+	/**
+	 *  @struct		Job
+	 *  @brief		ParallelFor1回分の仕事
+	 */
+	struct Job
+	{
+		const Utility::ThreadPool::RangeFunc	*func_;
+		size_t									count_;
+		size_t									grain_;
+		size_t									chunkCount_;
+		std::atomic<size_t>						next_;		//	!<	次に取る塊
+		size_t									active_;	//	!<	仕事に加わっているワーカーの数(mutex_で守る)
+		std::exception_ptr						error_;		//	!<	ワーカーで最初に投げられた例外(mutex_で守る)
+
+		/**
+		 *	@fn			Run
+		 *	@brief		塊がなくなるまで取って処理する
+		 */
+		void Run()
+		{
+			for (size_t chunk = next_++; chunk < chunkCount_; chunk = next_++)
+			{
+				const size_t Begin = chunk * grain_;
+				(*func_)(Begin, std::min(Begin + grain_, count_));
+			}
+		}
+		/**
+		 *	@fn			Cancel
+		 *	@brief		残りの塊を取らせない(処理中の塊はそのまま終わらせる)
+		 */
+		void Cancel()
+		{
+			next_ = chunkCount_;
+		}
+	};
+}
+
+class Utility::ThreadPool::Impl
+{
+private:
+	std::vector<std::thread>	workers_;
+	std::mutex					dispatchMutex_;	//	!<	同時に1つの仕事だけを流す
+	std::mutex					mutex_;
+	std::condition_variable		wake_;
+	std::condition_variable		done_;
+	Job							*job_;
+	size_t						generation_;
+	bool						isExit_;
+
+public:
+	explicit Impl(size_t argWorkerCount) : job_(nullptr), generation_(0), isExit_(false)
+	{
+		workers_.reserve(argWorkerCount);
+		for (size_t i = 0; i < argWorkerCount; ++i)
+			workers_.emplace_back([this] { WorkerMain(); });
+	}
+	~Impl()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			isExit_ = true;
+		}
+		wake_.notify_all();
+		for (auto &worker : workers_)
+			worker.join();
+	}
+
+private:
+	void WorkerMain()
+	{
+		isInsideJob = true;
+		size_t seen = 0;
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (true)
+		{
+			wake_.wait(lock, [&] { return isExit_ || (job_ != nullptr && generation_ != seen); });
+			if (isExit_)
+				return;
+
+			seen = generation_;
+			Job *job = job_;
+			++job->active_;
+			lock.unlock();
+			std::exception_ptr error;
+			try
+			{
+				job->Run();
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+				job->Cancel();
+			}
+			lock.lock();
+			if (error && !job->error_)
+				job->error_ = error;
+			if (--job->active_ == 0)
+				done_.notify_all();
+		}
+	}
+
+	/**
+	 *  @class		JobScope
+	 *  @brief		呼んだスレッドが仕事に加わっている間の後片付け
+	 *  @note		argFuncが例外を投げて抜けても、isInsideJobを戻し、ワーカーが手を離すまで待ってからjobを外す(jobはParallelForのスタックにある)
+	 */
+	class JobScope final
+	{
+	private:
+		Impl	&pool_;
+		Job		&job_;
+
+	public:
+		JobScope(Impl &argPool, Job &argJob) : pool_(argPool), job_(argJob)
+		{
+			isInsideJob = true;
+		}
+		~JobScope()
+		{
+			isInsideJob = false;
+			job_.Cancel();
+
+			std::unique_lock<std::mutex> lock(pool_.mutex_);
+			pool_.done_.wait(lock, [&] { return job_.active_ == 0; });
+			pool_.job_ = nullptr;
+		}
+
+		JobScope(const JobScope&) = delete;
+		JobScope &operator=(const JobScope&) = delete;
+	};
+
+public:
+	inline size_t WorkerCount() const { return workers_.size(); }
+
+	void ParallelFor(size_t argCount, size_t argGrain, const RangeFunc &argFunc)
+	{
+		if (argCount == 0)
+			return;
+
+		const size_t Grain = std::max<size_t>(argGrain, 1);
+		const size_t ChunkCount = (argCount + Grain - 1) / Grain;
+		if (ChunkCount == 1 || workers_.empty() || isInsideJob)
+		{
+			for (size_t begin = 0; begin < argCount; begin += Grain)
+				argFunc(begin, std::min(begin + Grain, argCount));
+			return;
+		}
+
+		std::lock_guard<std::mutex> dispatch(dispatchMutex_);
+		Job job;
+		job.func_ = &argFunc;
+		job.count_ = argCount;
+		job.grain_ = Grain;
+		job.chunkCount_ = ChunkCount;
+		job.next_ = 0;
+		job.active_ = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			job_ = &job;
+			++generation_;
+		}
+		wake_.notify_all();
+
+		{
+			JobScope scope(*this, job);
+			job.Run();
+		}
+		if (job.error_)
+			std::rethrow_exception(job.error_);
+	}
+};
+
+Utility::ThreadPool::ThreadPool()
+	: pImpl(std::make_unique<Impl>(std::max(std::thread::hardware_concurrency(), 1u) - 1))
+{
+}
+
+Utility::ThreadPool::ThreadPool(size_t argWorkerCount)
+	: pImpl(std::make_unique<Impl>(argWorkerCount))
+{
+}
+
+Utility::ThreadPool::~ThreadPool() = default;
+
+size_t Utility::ThreadPool::WorkerCount() const
+{
+	return pImpl->WorkerCount();
+}
+
+void Utility::ThreadPool::ParallelFor(size_t argCount, size_t argGrain, const RangeFunc &argFunc)
+{
+	pImpl->ParallelFor(argCount, argGrain, argFunc);
+}
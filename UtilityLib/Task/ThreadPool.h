@@ -0,0 +1,66 @@
+﻿/**
+ *	@file	ThreadPool.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+
+namespace Utility
+{
+	/**
+	 *  @class		ThreadPool
+	 *  @brief		常駐するワーカースレッドで範囲を分割して並列に処理する
+	 *  @note		Singleton<ThreadPool>::Get()で共有のプールを使える。
+	 *				ParallelForは全ての範囲が終わるまで戻らず、呼んだスレッドも処理に加わる。
+	 *				処理中の関数の中から呼んだ場合は、その場で順に処理する。
+	 */
+	class ThreadPool final
+	{
+	public:
+		using RangeFunc = std::function<void(size_t argBegin, size_t argEnd)>;
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+
+	public:
+		/**
+		 *	@constructor	ThreadPool
+		 *	@brief		論理コア数から呼び出し側の1つを引いた数のワーカーを作る
+		 */
+		ThreadPool();
+		/**
+		 *	@constructor	ThreadPool
+		 *	@brief		指定した数のワーカーを作る
+		 *	@param[in]	argWorkerCount	!<	ワーカーの数(0なら呼んだスレッドだけで処理する)
+		 */
+		explicit ThreadPool(size_t argWorkerCount);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool &operator=(const ThreadPool&) = delete;
+
+	public:
+		/**
+		 *	@fn			WorkerCount
+		 *	@brief		ワーカーの数
+		 *	@return		呼び出し側を含まないスレッドの数
+		 */
+		size_t WorkerCount() const;
+
+		/**
+		 *	@fn			ParallelFor
+		 *	@brief		[0, argCount)をargGrain個ずつに分けて並列に処理する
+		 *	@param[in]	argCount	!<	要素数
+		 *	@param[in]	argGrain	!<	1回に処理する要素数(0なら1)
+		 *	@param[in]	argFunc		!<	[argBegin, argEnd)を処理する関数(別々のスレッドから同時に呼ばれる)
+		 *	@note		argFuncが例外を投げると残りの範囲は処理しない。全てのスレッドが手を離してから、
+		 *				呼んだスレッドの例外、なければワーカーで最初に投げられた例外を呼んだスレッドに投げ直す
+		 */
+		void ParallelFor(size_t argCount, size_t argGrain, const RangeFunc &argFunc);
+	};
+}
@@ -5,6 +5,7 @@
  *	Copyright (c) Kastumi Takei. All rights reserved.
  */
 #include "ViewportManager.h"
+#include "../../Singleton/Singleton.h"
 
 void Utility::ViewportManager::Create(DirectX::XMFLOAT2 argWindowPos, DirectX::XMFLOAT2 argWindowSize, DirectX::XMFLOAT2 argWindowDepth, std::string argViewportName)
 {
@@ -16,7 +17,7 @@ void Utility::ViewportManager::Create(DirectX::XMFLOAT2 argWindowPos, DirectX::X
 	viewport.Height = static_cast<FLOAT>(argWindowSize.y);
 	viewport.MinDepth = argWindowDepth.x;
 	viewport.MaxDepth = argWindowDepth.y;
-	viewports_.insert(std::make_pair(argViewportName, viewport));
+	viewports_.insert(std::make_pair(Atom(argViewportName), viewport));
 }
 
 Utility::ViewportManager::ViewportManager() = default;
@@ -39,15 +40,20 @@ void Utility::ViewportManager::CreateViewport(DirectX::XMFLOAT2 argWindowPos, Di
 
 void Utility::ViewportManager::CreateViewport(D3D11_VIEWPORT argViewport, std::string argViewportName)
 {
-	viewports_.insert(std::make_pair(argViewportName, argViewport));
+	viewports_.insert(std::make_pair(Atom(argViewportName), argViewport));
 }
 
 void Utility::ViewportManager::CreateViewport(D3D11_VIEWPORT argViewport)
 {
-	viewports_.insert(std::make_pair("Default View", argViewport));
+	viewports_.insert(std::make_pair(Atom("Default View"), argViewport));
 }
 
 D3D11_VIEWPORT Utility::ViewportManager::GetViewport(std::string argViewportName) const
+{
+	return GetViewport(Singleton<AtomTable>::Get()->Find(argViewportName));
+}
+
+D3D11_VIEWPORT Utility::ViewportManager::GetViewport(Atom argViewportName) const
 {
 	return viewports_.at(argViewportName);
 }
@@ -67,6 +73,11 @@ void Utility::ViewportManager::RSSetViewports(ID3D11DeviceContext *argContext, u
 }
 
 void Utility::ViewportManager::RSSetViewports(ID3D11DeviceContext * argContext, unsigned int argSetViewportsNum, std::string argSetViewName)
+{
+	RSSetViewports(argContext, argSetViewportsNum, Singleton<AtomTable>::Get()->Find(argSetViewName));
+}
+
+void Utility::ViewportManager::RSSetViewports(ID3D11DeviceContext * argContext, unsigned int argSetViewportsNum, Atom argSetViewName)
 {
 	D3D11_VIEWPORT *viewport = &viewports_.at(argSetViewName);
 	assert(viewport && "arg viewport don't found...");
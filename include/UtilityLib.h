@@ -9,6 +9,7 @@
 #include <UtilityLib\Encode.h>
 #include <UtilityLib\Function.h>
 #include <UtilityLib\Macro.h>
+#include <UtilityLib\Span.h>
 #include <UtilityLib\Tween.h>
 #include <UtilityLib\Archive\Archive.h>
 #include <UtilityLib\Camera\BottomViewCamera.h>
@@ -17,8 +18,14 @@
 #include <UtilityLib\Camera\FollowingCamera.h>
 #include <UtilityLib\Collision\Collision2D.h>
 #include <UtilityLib\Collision\Collision3D.h>
+#include <UtilityLib\Collision\CollisionStream3D.h>
+#include <UtilityLib\Collision\DynamicAabbTree.h>
 #include <UtilityLib\Collision\Shape2D.h>
+#include <UtilityLib\Collision\SpatialHashGrid2D.h>
+#include <UtilityLib\Collision\SweepAndPrune.h>
+#include <UtilityLib\Collision\TriangleBvh.h>
 #include <UtilityLib\ConfigManager\ConfigManager.h>
+#include <UtilityLib\ConfigManager\ConfigTable.h>
 #include <UtilityLib\Debug\Debug.h>
 #include <UtilityLib\Debug\InitializeSpy.h>
 #include <UtilityLib\DeviceResources\DeviceResources.h>
@@ -62,11 +69,27 @@
 #include <UtilityLib\InputManager\Mouse.h>
 #include <UtilityLib\Loader\File.h>
 #include <UtilityLib\Loader\Loader.h>
+#include <UtilityLib\Math\FastMath.h>
+#include <UtilityLib\Math\Fixed.h>
 #include <UtilityLib\Math\Math.h>
+#include <UtilityLib\Math\MathConfig.h>
 #include <UtilityLib\Math\Matrix.h>
+#include <UtilityLib\Math\Noise.h>
+#include <UtilityLib\Math\PackedFormat.h>
 #include <UtilityLib\Math\Quaternion.h>
+#include <UtilityLib\Math\QuaternionStream.h>
+#include <UtilityLib\Math\Random.h>
+#include <UtilityLib\Math\SimdLanes.h>
+#include <UtilityLib\Math\Spline.h>
+#include <UtilityLib\Math\StaticMath.h>
+#include <UtilityLib\Math\StreamBuffer.h>
+#include <UtilityLib\Math\Transform.h>
+#include <UtilityLib\Math\TransformHierarchy.h>
 #include <UtilityLib\Math\Vector2f.h>
+#include <UtilityLib\Math\Vector3A.h>
 #include <UtilityLib\Math\Vector3f.h>
+#include <UtilityLib\Math\Vector3Stream.h>
+#include <UtilityLib\Math\Vector4A.h>
 #include <UtilityLib\Math\Vector4f.h>
 #include <UtilityLib\Menu\CMenu.h>
 #include <UtilityLib\Menu\CMenuButton.h>
@@ -88,9 +111,14 @@
 #include <UtilityLib\Sound\OrgSound.h>
 #include <UtilityLib\Sound\Sound.h>
 #include <UtilityLib\Sound\SoundManager.h>
+#include <UtilityLib\String\Atom.h>
+#include <UtilityLib\String\NumberFormat.h>
 #include <UtilityLib\String\String.h>
+#include <UtilityLib\String\TextEncoding.h>
+#include <UtilityLib\String\TextFormat.h>
 #include <UtilityLib\Task\Task.h>
 #include <UtilityLib\Task\TaskManager.h>
+#include <UtilityLib\Task\ThreadPool.h>
 #include <UtilityLib\Window\Window.h>
 #include <UtilityLib\Window\Viewport\ViewportManager.h>
 
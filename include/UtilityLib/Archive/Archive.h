@@ -6,12 +6,14 @@
  */
 #pragma once
 
-#include <map>
+#include <unordered_map>
 #include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "../String/Atom.h"
+
 struct ID3D11Device;
 
 namespace Utility
@@ -32,7 +34,7 @@ namespace Utility
 			int Size;
 		};
 		std::unique_ptr<std::ifstream> stream_;
-		std::map<std::string, Entry> entries_;
+		std::unordered_map<Atom, Entry> entries_;
 		std::vector<char*> deleteList_;
 	public:
 
@@ -74,6 +76,14 @@ namespace Utility
 		 *  @param[in]	argFileSize	!<	データのサイズを格納する変数
 		 */
 		void Read(const char *argFileName, char** argFileData, int *argFileSize);
+		/**
+		 *  @fn			Read
+		 *  @brief		データの読み込み
+		 *  @param[in]	argFileName	!<	ファイルのパスの識別子
+		 *  @param[in]	argFileData	!<	データを格納する変数
+		 *  @param[in]	argFileSize	!<	データのサイズを格納する変数
+		 */
+		void Read(Atom argFileName, char** argFileData, int *argFileSize);
 
 	public:
 		/**
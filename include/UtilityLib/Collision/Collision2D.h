@@ -6,10 +6,54 @@
  */
 #pragma once
 
+#include "../Math/Fixed.h"
+
 namespace Utility
 {
 	class CShape;
 
+	/*
+	 *	Check～はベクトルの型を引数に取る。実体化しているのは
+	 *	Math::Vector2、Math::FixedVector2<Math::Fixed16>、Math::FixedVector2<Math::Fixed32>の3つ。
+	 *	CShape同士の判定はMath::Vector2で呼ぶ。
+	 *	距離の2乗を使うので、Fixed16では中心どうしや角どうしの差を128程度未満に収める(Fixed32は46000程度未満)。
+	 */
+
+	/**
+	 *  @fn			CheckCircle2Circle
+	 *  @brief		円vs円の当たり判定
+	 *  @param[in]	argCenterA	!<	円Aの中心
+	 *  @param[in]	argRadiusA	!<	円Aの半径
+	 *  @param[in]	argCenterB	!<	円Bの中心
+	 *  @param[in]	argRadiusB	!<	円Bの半径
+	 *  @return		当たっていればtrue(接している場合を含む)
+	 */
+	template<typename TVector>
+	bool CheckCircle2Circle(const TVector& argCenterA, typename Math::VectorTraits<TVector>::Scalar argRadiusA,
+		const TVector& argCenterB, typename Math::VectorTraits<TVector>::Scalar argRadiusB);
+	/**
+	 *  @fn			CheckCircle2Rect
+	 *  @brief		円vs矩形の当たり判定
+	 *  @param[in]	argCenter	!<	円の中心
+	 *  @param[in]	argRadius	!<	円の半径
+	 *  @param[in]	argRectMin	!<	矩形の最小の角(left, bottom)
+	 *  @param[in]	argRectMax	!<	矩形の最大の角(right, top)
+	 *  @return		円の中心が矩形の内側にあるか、矩形の角が円の内側にあればtrue
+	 */
+	template<typename TVector>
+	bool CheckCircle2Rect(const TVector& argCenter, typename Math::VectorTraits<TVector>::Scalar argRadius, const TVector& argRectMin, const TVector& argRectMax);
+	/**
+	 *  @fn			CheckRect2Rect
+	 *  @brief		矩形vs矩形の当たり判定
+	 *  @param[in]	argMinA	!<	矩形Aの最小の角(left, bottom)
+	 *  @param[in]	argMaxA	!<	矩形Aの最大の角(right, top)
+	 *  @param[in]	argMinB	!<	矩形Bの最小の角(left, bottom)
+	 *  @param[in]	argMaxB	!<	矩形Bの最大の角(right, top)
+	 *  @return		当たっていればtrue(接している場合を含む)
+	 */
+	template<typename TVector>
+	bool CheckRect2Rect(const TVector& argMinA, const TVector& argMaxA, const TVector& argMinB, const TVector& argMaxB);
+
 	/**
 	 *  @fn			CircleToCircle
 	 *  @brief		円vs円の当たり判定
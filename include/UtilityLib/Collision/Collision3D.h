@@ -7,70 +7,172 @@
 #pragma once
 
 #include "../Math/Math.h"
+#include "../Math/Fixed.h"
 
 namespace Utility
 {
+	/*
+	 *	形状と判定はベクトルの型を引数に取る。判定を実体化しているのは
+	 *	Math::Vector3とMath::FixedVector3<Math::Fixed32>の2つ。
+	 *	固定小数点数のベクトルを使うと、全ての環境で同じ結果になる(ロックステップやリプレイ用)。
+	 *	三角形と線分の判定は長さの4乗になる積を使うので、Fixed32では形状の大きさと形状どうしの距離を
+	 *	0.25～128程度に収める(大きいと積が±2^31を超えてあふれ、小さいと桁が落ちる。あふれるとデバッグビルドではFixed::Multiplyのassertで止まる)。
+	 *	座標そのものは範囲内ならどこでもよい。
+	 *	Fixed16(Q16.16)は10程度の大きさでもあふれるので実体化していない。
+	 */
+
 	/**
-	 *	@struct	Triangle
+	 *	@struct	BasicTriangle
 	 *	@brief	法線付き三角形（反時計回りが表面）
 	 */
-	struct Triangle
+	template<typename TVector>
+	struct BasicTriangle
 	{
 	public:
-		Math::Vector3	pointTop;
-		Math::Vector3	pointLeft;
-		Math::Vector3	pointRight;
-		Math::Vector3	normal;
+		TVector	pointTop;
+		TVector	pointLeft;
+		TVector	pointRight;
+		TVector	normal;
 	};
 	/**
-	 *	@struct	Sphere
+	 *	@struct	BasicSphere
 	 *	@brief	球型の当たり判定
 	 */
-	struct Sphere
+	template<typename TVector>
+	struct BasicSphere
 	{
 	public:
-		Math::Vector3 center;
-		float radius;
+		TVector center;
+		typename Math::VectorTraits<TVector>::Scalar radius;
 
-		Sphere()
-			:radius(1.0f)
+		BasicSphere()
+			:center(), radius(1)
 		{
 		}
 	};
 	/**
-	 *	@struct	Segment
+	 *	@struct	BasicSegment
 	 *	@brief	当たり判定に使う線分
 	 */
-	struct Segment
+	template<typename TVector>
+	struct BasicSegment
 	{
 	public:
-		Math::Vector3 start;
-		Math::Vector3 end;
+		TVector start;
+		TVector end;
 
-		Segment()
+		BasicSegment()
+			:start(), end()
 		{
 		}
 
-		Segment(Math::Vector3 argStart, Math::Vector3 argEnd)
+		BasicSegment(TVector argStart, TVector argEnd)
 			:start(argStart), end(argEnd)
 		{
 		}
 	};
 	/**
-	 *	@struct	Capsule
+	 *	@struct	BasicCapsule
 	 *	@brief	カプセル型の当たり判定
 	 */
-	struct Capsule
+	template<typename TVector>
+	struct BasicCapsule
+	{
+	public:
+		BasicSegment<TVector> segment;
+		typename Math::VectorTraits<TVector>::Scalar radius;
+		BasicCapsule()
+			:segment(TVector(), TVector(0, 1, 0)), radius(1)
+		{
+		}
+
+	};
+
+	/**
+	 *	@struct	BasicAabb
+	 *	@brief	軸に平行な箱(広域判定用)
+	 */
+	template<typename TVector>
+	struct BasicAabb
+	{
+	public:
+		TVector lower;	//	!<	最小の角
+		TVector upper;	//	!<	最大の角
+
+		BasicAabb()
+			:lower(), upper()
+		{
+		}
+
+		BasicAabb(TVector argLower, TVector argUpper)
+			:lower(argLower), upper(argUpper)
+		{
+		}
+	};
+
+	/**
+	 *	@struct	NonDeduced
+	 *	@brief	テンプレート引数の推論に使わない引数の型(C++20のstd::type_identityと同じ)
+	 *	@note	判定の点と結果の出力先の型は形状の型から決めるので、nullptrやMath::Vector3に変換できる値をそのまま渡せる
+	 */
+	template<typename T>
+	struct NonDeduced
+	{
+		using Type = T;
+	};
+	template<typename T>
+	using NonDeducedT = typename NonDeduced<T>::Type;
+
+	/*
+	 *	Math::Vector3の形状は別名ではなく派生した構造体にして、以前と同じように前方宣言(struct Sphere;)できるようにする。
+	 *	判定の関数は基底のBasicSphere<TVector>などで受けるので、そのまま渡せる。
+	 */
+
+	/**
+	 *	@struct	Triangle
+	 *	@brief	法線付き三角形（反時計回りが表面）
+	 */
+	struct Triangle : public BasicTriangle<Math::Vector3>
+	{
+	};
+	/**
+	 *	@struct	Sphere
+	 *	@brief	球型の当たり判定
+	 */
+	struct Sphere : public BasicSphere<Math::Vector3>
+	{
+	};
+	/**
+	 *	@struct	Segment
+	 *	@brief	当たり判定に使う線分
+	 */
+	struct Segment : public BasicSegment<Math::Vector3>
 	{
 	public:
-		Segment segment;
-		float radius;
-		Capsule()
-			:segment(Math::Vector3(), Math::Vector3(0, 1, 0)), radius(1.0f)
+		Segment()
+		{
+		}
+
+		Segment(Math::Vector3 argStart, Math::Vector3 argEnd)
+			:BasicSegment(argStart, argEnd)
 		{
 		}
 
+		// Capsule::segmentなど基底の型の線分から作る
+		Segment(const BasicSegment<Math::Vector3> &argSegment)
+			:BasicSegment(argSegment)
+		{
+		}
+	};
+	/**
+	 *	@struct	Capsule
+	 *	@brief	カプセル型の当たり判定
+	 */
+	struct Capsule : public BasicCapsule<Math::Vector3>
+	{
 	};
+	using Aabb = BasicAabb<Math::Vector3>;
+
 	/**
 	 *	@fn			CheckCapsule2Capsule
 	 *	@brief		カプセル型とカプセル型の当たり判定
@@ -79,7 +181,8 @@ namespace Utility
 	 *	@param[in]	argInter	!<	交点（省略可）
 	 *	@return		球同士が当たっていればtrue、そうでなければfalse
 	 */
-	bool CheckSphere2Sphere(const Sphere& argSphereA, const Sphere& argSphereB, Math::Vector3 *argInter = nullptr);
+	template<typename TVector>
+	bool CheckSphere2Sphere(const BasicSphere<TVector>& argSphereA, const BasicSphere<TVector>& argSphereB, NonDeducedT<TVector> *argInter = nullptr);
 	/**
 	 *	@fn			CheckCapsule2Capsule
 	 *	@brief		カプセル型とカプセル型の当たり判定
@@ -88,7 +191,8 @@ namespace Utility
 	 *	@param[in]	argInter	!<	交点（省略可）
 	 *	@return		カプセル同士が当たっていればtrue、そうでなければfalse
 	 */
-	bool CheckCapsule2Capsule(const Capsule& argCapsuleA, const Capsule& argCapsuleB, Math::Vector3 *argInter = nullptr);
+	template<typename TVector>
+	bool CheckCapsule2Capsule(const BasicCapsule<TVector>& argCapsuleA, const BasicCapsule<TVector>& argCapsuleB, NonDeducedT<TVector> *argInter = nullptr);
 	/**
 	 *	@fn			CheckSphere2Capsule
 	 *	@brief		球型とカプセル型の当たり判定
@@ -97,7 +201,8 @@ namespace Utility
 	 *	@param[in]	argInter	!<	交点（省略可）
 	 *	@return		球とカプセルが当たっていればtrue、そうでなければfalse
 	 */
-	bool CheckSphere2Capsule(const Sphere& argSphereA, const Capsule& argCapsuleB, Math::Vector3 *argInter = nullptr);
+	template<typename TVector>
+	bool CheckSphere2Capsule(const BasicSphere<TVector>& argSphereA, const BasicCapsule<TVector>& argCapsuleB, NonDeducedT<TVector> *argInter = nullptr);
 	/**
 	 *	@fn			ClosestPtSegment2Segment
 	 *	@brief		線分と線分の最近接点を計算
@@ -106,7 +211,8 @@ namespace Utility
 	 *	@param[in]	argClosest0	!<	線分0上の最近接点（結果出力用）
 	 *	@param[in]	argClosest1	!<	線分1上の最近接点（結果出力用）
 	 */
-	void ClosestPtSegment2Segment(const Segment& argSegment0, const Segment& argSegment1, Math::Vector3* argClosest0, Math::Vector3* argClosest1);
+	template<typename TVector>
+	void ClosestPtSegment2Segment(const BasicSegment<TVector>& argSegment0, const BasicSegment<TVector>& argSegment1, NonDeducedT<TVector> *argClosest0, NonDeducedT<TVector> *argClosest1);
 	/**
 	 *	@fn			ClosestPtPoint2Segment
 	 *	@brief		点と線分の最近接点を計算
@@ -114,7 +220,8 @@ namespace Utility
 	 *	@param[in]	argSegment	!<	線分
 	 *	@param[in]	argClosest	!<	点と位置の最近接点（結果出力用）
 	 */
-	void ClosestPtPoint2Segment(const Math::Vector3& argPoint, const Segment& argSegment, Math::Vector3* argClosest);
+	template<typename TVector>
+	void ClosestPtPoint2Segment(const NonDeducedT<TVector>& argPoint, const BasicSegment<TVector>& argSegment, NonDeducedT<TVector> *argClosest);
 	/**
 	 *	@fn			ClosestPtPoint2Triangle
 	 *	@brief		線分と線分の最近接点を計算
@@ -122,7 +229,8 @@ namespace Utility
 	 *	@param[in]	argTriangle	!<	線分
 	 *	@param[in]	argClosest	!<	点と線分の最近接点（結果出力用）
 	 */
-	void ClosestPtPoint2Triangle(const Math::Vector3& argPoint, const Triangle& argTriangle, Math::Vector3* argClosest);
+	template<typename TVector>
+	void ClosestPtPoint2Triangle(const NonDeducedT<TVector>& argPoint, const BasicTriangle<TVector>& argTriangle, NonDeducedT<TVector> *argClosest);
 	/**
 	 *	@fn			CheckPoint2Triangle
 	 *	@brief		点と三角形の当たり判定
@@ -133,7 +241,8 @@ namespace Utility
 	 *	@note		線上は外とみなします
 	 *	@note		ABCが三角形かどうかのチェックは省略...
 	 */
-	bool CheckPoint2Triangle(const Math::Vector3& argPoint, const Triangle& argTriangle);
+	template<typename TVector>
+	bool CheckPoint2Triangle(const NonDeducedT<TVector>& argPoint, const BasicTriangle<TVector>& argTriangle);
 	/**
 	 *	@fn			CheckSphere2Triangle
 	 *	@brief		球と法線付き三角形の当たりチェック
@@ -143,7 +252,8 @@ namespace Utility
 	 *	@return		点と三角形が交差していればtrue、そうでなければfalse
 	 *	@note		裏面の当たり判定は取らない
 	 */
-	bool CheckSphere2Triangle(const Sphere& argSphere, const Triangle& argTriangle, Math::Vector3 *argInter = nullptr);
+	template<typename TVector>
+	bool CheckSphere2Triangle(const BasicSphere<TVector>& argSphere, const BasicTriangle<TVector>& argTriangle, NonDeducedT<TVector> *argInter = nullptr);
 	/**
 	 *	@fn			CheckSphere2Triangle
 	 *	@brief		球と法線付き三角形の当たりチェック
@@ -152,7 +262,8 @@ namespace Utility
 	 *	@param[in]	argPointRight	!<	三角形の右角
 	 *	@param[in]	argTriangle		!<	操作したい三角形
 	 */
-	void ComputeTriangle(const Math::Vector3& argPointTop, const Math::Vector3& argPointLeft, const Math::Vector3& argPointRight, Triangle* argTriangle);
+	template<typename TVector>
+	void ComputeTriangle(const NonDeducedT<TVector>& argPointTop, const NonDeducedT<TVector>& argPointLeft, const NonDeducedT<TVector>& argPointRight, BasicTriangle<TVector>* argTriangle);
 	/**
 	 *	@fn			CheckSegment2Triangle
 	 *	@brief		線分（有向）と法線付き三角形の当たりチェック
@@ -162,5 +273,56 @@ namespace Utility
 	 *	@return		線分と三角形が交差していればtrue、そうでなければfalse
 	 *	@note		裏面の当たりはとらない
 	 */
-	bool CheckSegment2Triangle(const Segment& argSegment, const Triangle& argTriangle, Math::Vector3 *argInter = nullptr);
+	template<typename TVector>
+	bool CheckSegment2Triangle(const BasicSegment<TVector>& argSegment, const BasicTriangle<TVector>& argTriangle, NonDeducedT<TVector> *argInter = nullptr);
+	/**
+	 *	@fn			CheckCapsule2Triangle
+	 *	@brief		カプセルと法線付き三角形の当たりチェック
+	 *	@param[in]	argCapsule	!<	カプセル
+	 *	@param[in]	argTriangle	!<	法線付き三角形
+	 *	@param[in]	argInter	!<	三角形上の最近接点（省略可）
+	 *	@return		カプセルと三角形が交差していればtrue、そうでなければfalse
+	 *	@note		表裏どちらからでも当たる
+	 */
+	template<typename TVector>
+	bool CheckCapsule2Triangle(const BasicCapsule<TVector>& argCapsule, const BasicTriangle<TVector>& argTriangle, NonDeducedT<TVector> *argInter = nullptr);
+	/**
+	 *	@fn			ComputeAabb
+	 *	@brief		球を囲む箱を計算
+	 *	@param[in]	argSphere	!<	球
+	 *	@return		球を囲む箱
+	 */
+	template<typename TVector>
+	BasicAabb<TVector> ComputeAabb(const BasicSphere<TVector>& argSphere);
+	/**
+	 *	@fn			ComputeAabb
+	 *	@brief		線分を囲む箱を計算
+	 *	@param[in]	argSegment	!<	線分
+	 *	@return		線分を囲む箱
+	 */
+	template<typename TVector>
+	BasicAabb<TVector> ComputeAabb(const BasicSegment<TVector>& argSegment);
+	/**
+	 *	@fn			ComputeAabb
+	 *	@brief		カプセルを囲む箱を計算
+	 *	@param[in]	argCapsule	!<	カプセル
+	 *	@return		カプセルを囲む箱
+	 */
+	template<typename TVector>
+	BasicAabb<TVector> ComputeAabb(const BasicCapsule<TVector>& argCapsule);
+	/**
+	 *	@fn			CheckAabb2Aabb
+	 *	@brief		箱と箱の当たり判定
+	 *	@param[in]	argAabbA	!<	箱A
+	 *	@param[in]	argAabbB	!<	箱B
+	 *	@return		当たっていればtrue(接している場合を含む)
+	 */
+	template<typename TVector>
+	inline bool CheckAabb2Aabb(const BasicAabb<TVector>& argAabbA, const BasicAabb<TVector>& argAabbB)
+	{
+		// 木や格子をたどるときに節ごとに呼ぶので、呼び出し側で展開できるようにヘッダーに置く
+		return !(argAabbA.upper.x < argAabbB.lower.x || argAabbB.upper.x < argAabbA.lower.x ||
+			argAabbA.upper.y < argAabbB.lower.y || argAabbB.upper.y < argAabbA.lower.y ||
+			argAabbA.upper.z < argAabbB.lower.z || argAabbB.upper.z < argAabbA.lower.z);
+	}
 };
\ No newline at end of file
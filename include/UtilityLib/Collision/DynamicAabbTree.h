@@ -0,0 +1,262 @@
+﻿/**
+ *	@file	DynamicAabbTree.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Collision3D.h"
+
+#include <cstdint>
+#include <vector>
+#include <assert.h>
+
+namespace Utility
+{
+	/**
+	 *  @class		DynamicAabbTree
+	 *  @brief		動く物体の広域判定用の箱の木
+	 *  @note		葉には物体の箱を少し広げた箱を置き、物体がその中で動いている間は木を変えない。
+	 *				はみ出したらMoveで挿し直す(木の形を保つ)か、Refitで葉の箱だけ広げて親をたどり直す(速いが重なりが増える)。
+	 *				挿入は表面積の増加が最小になる兄弟を選び、親をたどりながら回転で左右の高さを揃える(Box2Dのb2DynamicTreeと同じ方式)。
+	 *				QueryPairsは木と木を同時にたどるので、同じ組は1回しか返らない。返った組は葉のユーザーデータから
+	 *				形状を引き、CheckSphere2SphereやCheckCapsule2Capsuleで詳しく判定する。
+	 *				プロキシ(葉の番号)はRemoveするまで変わらない。同じ木を複数のスレッドから同時に変更しない。
+	 */
+	class DynamicAabbTree final
+	{
+	public:
+		static const int32_t NullNode = -1;
+		static const float DefaultMargin;				//	!<	葉の箱を広げる量
+		static const float DefaultDisplacementScale;	//	!<	移動量から先読みして広げる倍率
+
+		/**
+		 *  @struct		ProxyPair
+		 *  @brief		箱が重なった葉の組(proxyA < proxyB)
+		 */
+		struct ProxyPair
+		{
+			int32_t proxyA;
+			int32_t proxyB;
+		};
+
+	private:
+		/**
+		 *  @struct		Node
+		 *  @brief		木の節(葉はchild1がNullNode)
+		 */
+		struct Node
+		{
+			Aabb		bounds;
+			int32_t		parent;		//	!<	親(空いている節では次の空いている節)
+			int32_t		child1;
+			int32_t		child2;
+			int32_t		height;		//	!<	葉は0、空いている節は-1
+			uint32_t	userData;
+
+			inline bool IsLeaf() const { return child1 == NullNode; }
+		};
+
+		static const size_t QueryStackSize = 128;	//	!<	Queryでたどる途中の節の数の上限(高さ + 1以上)
+
+	private:
+		std::vector<Node>	nodes_;
+		int32_t				root_;
+		int32_t				freeList_;
+		size_t				proxyCount_;
+		float				margin_;
+		float				displacementScale_;
+
+	public:
+		/**
+		 *	@constructor	DynamicAabbTree
+		 *	@param[in]		argMargin				!<	葉の箱を広げる量
+		 *	@param[in]		argDisplacementScale	!<	Moveの移動量から先読みして広げる倍率
+		 */
+		explicit DynamicAabbTree(float argMargin = DefaultMargin, float argDisplacementScale = DefaultDisplacementScale);
+
+	public:
+		/**
+		 *	@fn			Insert
+		 *	@brief		葉を追加する
+		 *	@param[in]	argBounds	!<	物体の箱
+		 *	@param[in]	argUserData	!<	葉に持たせる値(形状の配列の添字など)
+		 *	@return		プロキシ
+		 */
+		int32_t Insert(const Aabb &argBounds, uint32_t argUserData);
+		/**
+		 *	@fn			Remove
+		 *	@brief		葉を取り除く
+		 *	@param[in]	argProxy	!<	Insertで返したプロキシ
+		 */
+		void Remove(int32_t argProxy);
+		/**
+		 *	@fn			Move
+		 *	@brief		物体の箱を更新し、広げた箱からはみ出していれば挿し直す
+		 *	@param[in]	argProxy		!<	プロキシ
+		 *	@param[in]	argBounds		!<	物体の今の箱
+		 *	@param[in]	argDisplacement	!<	1回の更新での移動量(移動する向きに広げておく)
+		 *	@return		挿し直したらtrue
+		 *	@note		広げた箱が物体に比べて大きくなりすぎたときも挿し直す
+		 */
+		bool Move(int32_t argProxy, const Aabb &argBounds, const Math::Vector3 &argDisplacement = Math::Vector3());
+		/**
+		 *	@fn			Refit
+		 *	@brief		物体の箱を更新し、広げた箱からはみ出していれば木の形を変えずに箱だけ広げ直す
+		 *	@param[in]	argProxy		!<	プロキシ
+		 *	@param[in]	argBounds		!<	物体の今の箱
+		 *	@param[in]	argDisplacement	!<	1回の更新での移動量
+		 *	@return		箱を広げ直したらtrue
+		 *	@note		親の箱は子から計算し直すので、小さくなることもある。大きく動いた物体はMoveの方が後の判定が速い
+		 */
+		bool Refit(int32_t argProxy, const Aabb &argBounds, const Math::Vector3 &argDisplacement = Math::Vector3());
+		/**
+		 *	@fn			Clear
+		 *	@brief		全ての葉を取り除く
+		 */
+		void Clear();
+
+		inline const Aabb &GetFatAabb(int32_t argProxy) const
+		{
+			assert(IsProxy(argProxy) && "Invalid proxy...");
+			return nodes_[argProxy].bounds;
+		}
+		inline uint32_t GetUserData(int32_t argProxy) const
+		{
+			assert(IsProxy(argProxy) && "Invalid proxy...");
+			return nodes_[argProxy].userData;
+		}
+		inline size_t GetProxyCount() const { return proxyCount_; }
+		/**
+		 *	@fn			GetHeight
+		 *	@brief		木の高さ(葉だけなら0、空なら-1)
+		 */
+		inline int32_t GetHeight() const { return (root_ == NullNode) ? -1 : nodes_[root_].height; }
+
+		/**
+		 *	@fn			Query
+		 *	@brief		広げた箱がargBoundsと重なる葉を列挙する
+		 *	@param[in]	argBounds	!<	調べる箱
+		 *	@param[in]	argFunc		!<	葉ごとに呼ぶ関数(void(int32_t proxy))
+		 */
+		template<typename Func>
+		void Query(const Aabb &argBounds, const Func &argFunc) const
+		{
+			if (root_ == NullNode)
+				return;
+
+			int32_t stack[QueryStackSize];
+			size_t count = 0;
+			stack[count++] = root_;
+			while (count > 0)
+			{
+				const int32_t Index = stack[--count];
+				const Node &Current = nodes_[Index];
+				if (!CheckAabb2Aabb(Current.bounds, argBounds))
+					continue;
+
+				if (Current.IsLeaf())
+				{
+					argFunc(Index);
+				}
+				else
+				{
+					assert(count + 2 <= QueryStackSize && "DynamicAabbTree is too deep...");
+					stack[count++] = Current.child1;
+					stack[count++] = Current.child2;
+				}
+			}
+		}
+		/**
+		 *	@fn			QueryPairs
+		 *	@brief		広げた箱が重なる葉の組を列挙する
+		 *	@param[in]	argFunc	!<	組ごとに呼ぶ関数(void(int32_t proxyA, int32_t proxyB)、proxyA < proxyB)
+		 */
+		template<typename Func>
+		void QueryPairs(const Func &argFunc) const
+		{
+			if (root_ == NullNode)
+				return;
+
+			// 同じ節同士の組は、その節の下にある葉同士の組を表す
+			std::vector<ProxyPair> stack;
+			stack.reserve(QueryStackSize);
+			stack.push_back({ root_, root_ });
+			while (!stack.empty())
+			{
+				const ProxyPair Current = stack.back();
+				stack.pop_back();
+
+				const Node &A = nodes_[Current.proxyA];
+				if (Current.proxyA == Current.proxyB)
+				{
+					if (!A.IsLeaf())
+					{
+						stack.push_back({ A.child1, A.child1 });
+						stack.push_back({ A.child2, A.child2 });
+						stack.push_back({ A.child1, A.child2 });
+					}
+					continue;
+				}
+
+				const Node &B = nodes_[Current.proxyB];
+				if (!CheckAabb2Aabb(A.bounds, B.bounds))
+					continue;
+
+				if (A.IsLeaf() && B.IsLeaf())
+				{
+					if (Current.proxyA < Current.proxyB)
+						argFunc(Current.proxyA, Current.proxyB);
+					else
+						argFunc(Current.proxyB, Current.proxyA);
+				}
+				else if (B.IsLeaf() || (!A.IsLeaf() && A.height >= B.height))
+				{
+					// 高い方を降りる
+					stack.push_back({ A.child1, Current.proxyB });
+					stack.push_back({ A.child2, Current.proxyB });
+				}
+				else
+				{
+					stack.push_back({ Current.proxyA, B.child1 });
+					stack.push_back({ Current.proxyA, B.child2 });
+				}
+			}
+		}
+		/**
+		 *	@fn			QueryPairs
+		 *	@brief		広げた箱が重なる葉の組を集める
+		 *	@param[out]	argPairs	!<	組(末尾に追加する)
+		 */
+		void QueryPairs(std::vector<ProxyPair> *argPairs) const;
+
+	private:
+		inline bool IsProxy(int32_t argProxy) const
+		{
+			return argProxy >= 0 && static_cast<size_t>(argProxy) < nodes_.size() && nodes_[argProxy].height == 0;
+		}
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t argNode);
+		/**
+		 *	@fn			Fatten
+		 *	@brief		物体の箱を余白と移動量の分だけ広げる
+		 */
+		Aabb Fatten(const Aabb &argBounds, const Math::Vector3 &argDisplacement) const;
+		void InsertLeaf(int32_t argLeaf);
+		void RemoveLeaf(int32_t argLeaf);
+		/**
+		 *	@fn			RefitAncestors
+		 *	@brief		argNodeから根までの箱と高さを子から計算し直す
+		 *	@param[in]	argBalance	!<	trueなら途中で回転して高さを揃える
+		 */
+		void RefitAncestors(int32_t argNode, bool argBalance);
+		/**
+		 *	@fn			Balance
+		 *	@brief		左右の高さが2以上違えば、高い方の子を持ち上げる
+		 *	@return		argNodeの位置に来た節
+		 */
+		int32_t Balance(int32_t argNode);
+	};
+}
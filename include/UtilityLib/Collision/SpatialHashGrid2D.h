@@ -0,0 +1,256 @@
+﻿/**
+ *	@file	SpatialHashGrid2D.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Shape2D.h"
+#include "../Span.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <assert.h>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	/**
+	 *  @class		SpatialHashGrid2D
+	 *  @brief		2D形状の広域判定用の一様格子(セルの座標をハッシュしてバケットに振り分ける)
+	 *  @note		毎フレームBuildで作り直す使い方を想定している。Buildは物体が掛かるセルごとに(バケット, 物体)を作り、
+	 *				バケット番号を1桁とした基数ソート(計数ソート)で並べる。ThreadPoolを渡すと、箱の計算と数え上げと
+	 *				書き込みをParallelGrain個ずつに分けて並列に処理する(結果はスレッドの数によらず同じ)。
+	 *				違うセルが同じバケットに入ることもあるので、列挙するときに物体の箱で確かめ直す。
+	 *				同じ組や同じ物体は、両方が掛かるセルのうち左下のセルでだけ返すので1回しか返らない。
+	 *				返った組はIsHitJudgmentやCheckCircle2Circleで詳しく判定する。
+	 *				セルの大きさは物体の直径くらいが良い。セルより大きな物体は掛かるセルの数だけ登録される。
+	 */
+	class SpatialHashGrid2D final
+	{
+	public:
+		static const size_t DefaultBucketCount = 4096;
+		static const size_t ParallelGrain = 4096;	//	!<	並列に処理するときの1回分の要素数
+
+		/**
+		 *  @struct		Bounds
+		 *  @brief		物体を囲む箱
+		 */
+		struct Bounds
+		{
+			Math::Vector2 lower;	//	!<	最小の角
+			Math::Vector2 upper;	//	!<	最大の角
+		};
+		/**
+		 *  @struct		ItemPair
+		 *  @brief		箱が重なった物体の組(itemA < itemB、Buildに渡した配列の添字)
+		 */
+		struct ItemPair
+		{
+			uint32_t itemA;
+			uint32_t itemB;
+		};
+
+	private:
+		/**
+		 *  @struct		CellRange
+		 *  @brief		物体が掛かるセルの範囲(両端を含む)
+		 */
+		struct CellRange
+		{
+			int32_t x0;
+			int32_t y0;
+			int32_t x1;
+			int32_t y1;
+		};
+
+		static const size_t PairGrain = 256;	//	!<	QueryPairsで1回に処理するバケットの数
+
+	private:
+		std::vector<Bounds>		bounds_;
+		std::vector<CellRange>	cells_;
+		std::vector<uint32_t>	entryOffset_;	//	!<	物体ごとの登録の先頭(物体の数 + 1)
+		std::vector<uint32_t>	entryKeys_;		//	!<	登録ごとのバケット(並べる前)
+		std::vector<uint32_t>	entryItems_;	//	!<	登録ごとの物体(並べる前)
+		std::vector<uint32_t>	histogram_;		//	!<	塊ごとのバケットの数(塊 × バケット)
+		std::vector<uint32_t>	bucketStart_;	//	!<	バケットごとの先頭(バケットの数 + 1)
+		std::vector<uint32_t>	items_;			//	!<	バケットの順に並べた物体
+		float					cellSize_;
+		float					inverseCellSize_;
+		uint32_t				bucketMask_;
+
+	public:
+		/**
+		 *	@constructor	SpatialHashGrid2D
+		 *	@param[in]		argCellSize		!<	セルの一辺の長さ
+		 *	@param[in]		argBucketCount	!<	バケットの数(2の累乗)
+		 */
+		explicit SpatialHashGrid2D(float argCellSize, size_t argBucketCount = DefaultBucketCount);
+
+	public:
+		/**
+		 *	@fn			Build
+		 *	@brief		箱の配列から作り直す
+		 *	@param[in]	argBounds	!<	物体の箱
+		 *	@param[in]	argPool		!<	並列に処理するスレッドプール(省略時は呼んだスレッドで処理する)
+		 */
+		void Build(Span<const Bounds> argBounds, ThreadPool *argPool = nullptr);
+		/**
+		 *	@fn			Build
+		 *	@brief		円の配列から作り直す
+		 *	@param[in]	argCircles	!<	円(連続した配列なので仮想関数を通さずに読む)
+		 *	@param[in]	argPool		!<	並列に処理するスレッドプール
+		 */
+		void Build(Span<const CircleShape> argCircles, ThreadPool *argPool = nullptr);
+		/**
+		 *	@fn			Build
+		 *	@brief		形状の配列から作り直す
+		 *	@param[in]	argShapes	!<	形状(円と矩形が混ざっていてよい)
+		 *	@param[in]	argPool		!<	並列に処理するスレッドプール
+		 */
+		void Build(Span<const CShape* const> argShapes, ThreadPool *argPool = nullptr);
+		/**
+		 *	@fn			Clear
+		 *	@brief		全ての物体を取り除く
+		 */
+		void Clear();
+
+		inline size_t GetItemCount() const { return bounds_.size(); }
+		inline size_t GetEntryCount() const { return items_.size(); }
+		inline size_t GetBucketCount() const { return bucketMask_ + 1; }
+		inline float GetCellSize() const { return cellSize_; }
+		inline const Bounds &GetBounds(uint32_t argItem) const
+		{
+			assert(argItem < bounds_.size() && "Invalid item...");
+			return bounds_[argItem];
+		}
+
+		/**
+		 *	@fn			ComputeBounds
+		 *	@brief		形状を囲む箱を計算
+		 *	@param[in]	argShape	!<	形状
+		 *	@return		形状を囲む箱
+		 *	@note		円はCircleToCircle(Posは左下、中心はPos + 半径)とCircleToRect(Posが中心)のどちらで判定しても漏れないように、両方を囲む
+		 */
+		static Bounds ComputeBounds(const CShape &argShape);
+
+		/**
+		 *	@fn			Query
+		 *	@brief		箱がargRegionと重なる物体を列挙する
+		 *	@param[in]	argRegion	!<	調べる範囲
+		 *	@param[in]	argFunc		!<	物体ごとに呼ぶ関数(void(uint32_t item))
+		 */
+		template<typename Func>
+		void Query(const Bounds &argRegion, const Func &argFunc) const
+		{
+			if (items_.empty())
+				return;
+
+			const CellRange Region = ComputeCellRange(argRegion);
+			for (int32_t y = Region.y0; y <= Region.y1; ++y)
+			{
+				for (int32_t x = Region.x0; x <= Region.x1; ++x)
+				{
+					const uint32_t Bucket = Hash(x, y);
+					uint32_t previous = UINT32_MAX;
+					for (uint32_t i = bucketStart_[Bucket]; i < bucketStart_[Bucket + 1]; ++i)
+					{
+						// 同じ物体が同じバケットに複数登録されていれば隣に並んでいる
+						const uint32_t Item = items_[i];
+						if (Item == previous)
+							continue;
+						previous = Item;
+
+						if (!Overlaps(bounds_[Item], argRegion))
+							continue;
+						const CellRange &Cells = cells_[Item];
+						if (std::max(Cells.x0, Region.x0) == x && std::max(Cells.y0, Region.y0) == y)
+							argFunc(Item);
+					}
+				}
+			}
+		}
+		/**
+		 *	@fn			QueryPairs
+		 *	@brief		箱が重なる物体の組を列挙する
+		 *	@param[in]	argFunc	!<	組ごとに呼ぶ関数(void(uint32_t itemA, uint32_t itemB)、itemA < itemB)
+		 */
+		template<typename Func>
+		void QueryPairs(const Func &argFunc) const
+		{
+			for (uint32_t bucket = 0; bucket + 1 < bucketStart_.size(); ++bucket)
+				QueryBucketPairs(bucket, argFunc);
+		}
+		/**
+		 *	@fn			QueryPairs
+		 *	@brief		箱が重なる物体の組を集める
+		 *	@param[out]	argPairs	!<	組(末尾に追加する、順番はスレッドの数によらず同じ)
+		 *	@param[in]	argPool		!<	並列に処理するスレッドプール
+		 */
+		void QueryPairs(std::vector<ItemPair> *argPairs, ThreadPool *argPool = nullptr) const;
+
+	private:
+		static inline bool Overlaps(const Bounds &argA, const Bounds &argB)
+		{
+			return !(argA.upper.x < argB.lower.x || argB.upper.x < argA.lower.x ||
+				argA.upper.y < argB.lower.y || argB.upper.y < argA.lower.y);
+		}
+		inline CellRange ComputeCellRange(const Bounds &argBounds) const
+		{
+			return {
+				static_cast<int32_t>(std::floor(argBounds.lower.x * inverseCellSize_)),
+				static_cast<int32_t>(std::floor(argBounds.lower.y * inverseCellSize_)),
+				static_cast<int32_t>(std::floor(argBounds.upper.x * inverseCellSize_)),
+				static_cast<int32_t>(std::floor(argBounds.upper.y * inverseCellSize_)) };
+		}
+		inline uint32_t Hash(int32_t argX, int32_t argY) const
+		{
+			const uint32_t H = static_cast<uint32_t>(argX) * 0x8da6b343u ^ static_cast<uint32_t>(argY) * 0xd8163841u;
+			return (H ^ (H >> 16)) & bucketMask_;
+		}
+		/**
+		 *	@fn			QueryBucketPairs
+		 *	@brief		1つのバケットの中で、重なる組のうち左下の共通のセルがこのバケットに入るものを列挙する
+		 */
+		template<typename Func>
+		void QueryBucketPairs(uint32_t argBucket, const Func &argFunc) const
+		{
+			// 物体は添字の順に登録して安定に並べているので、バケットの中でも添字の順に並んでいる
+			const uint32_t Begin = bucketStart_[argBucket];
+			const uint32_t End = bucketStart_[argBucket + 1];
+			for (uint32_t i = Begin; i < End; ++i)
+			{
+				const uint32_t ItemA = items_[i];
+				if (i > Begin && items_[i - 1] == ItemA)
+					continue;
+
+				const Bounds &BoundsA = bounds_[ItemA];
+				const CellRange &CellsA = cells_[ItemA];
+				uint32_t previous = ItemA;
+				for (uint32_t j = i + 1; j < End; ++j)
+				{
+					const uint32_t ItemB = items_[j];
+					if (ItemB == previous)
+						continue;
+					previous = ItemB;
+
+					if (!Overlaps(BoundsA, bounds_[ItemB]))
+						continue;
+					const CellRange &CellsB = cells_[ItemB];
+					if (Hash(std::max(CellsA.x0, CellsB.x0), std::max(CellsA.y0, CellsB.y0)) == argBucket)
+						argFunc(ItemA, ItemB);
+				}
+			}
+		}
+		/**
+		 *	@fn			BuildCells
+		 *	@brief		bounds_からセルの範囲を計算し、バケットの順に並べる
+		 */
+		void BuildCells(ThreadPool *argPool);
+	};
+}
@@ -0,0 +1,159 @@
+﻿/**
+ *	@file	SweepAndPrune.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Collision3D.h"
+#include "../Span.h"
+
+#include <cstdint>
+#include <vector>
+#include <assert.h>
+
+namespace Utility
+{
+	/**
+	 *  @class		SweepAndPrune
+	 *  @brief		X軸で並べた箱を掃いて重なる組を探す広域判定(毎フレーム少しずつ動く物体が多い場面用)
+	 *  @note		UpdatePairsは前のフレームの並びから挿入ソートで並べ直すので、動きが小さければほぼ線形で済む。
+	 *				新しく追加した箱だけは別に並べてから混ぜる。並べた箱をX、Y、Zごとの配列に書き出し、
+	 *				Xの区間が重なる相手をAVX2/SSE2で8/4個ずつ、Y、Zの区間と一緒に調べる。
+	 *				DynamicAabbTreeと違って箱を広げないので、Updateは毎フレーム呼んでよい。
+	 *				返った組はユーザーデータから形状を引き、CheckSphere2SphereやCheckCapsule2Capsuleで詳しく判定する。
+	 *				プロキシはRemoveするまで変わらない。
+	 */
+	class SweepAndPrune final
+	{
+	public:
+		static const int32_t NullProxy = -1;
+
+		/**
+		 *  @struct		ProxyPair
+		 *  @brief		箱が重なったプロキシの組(proxyA < proxyB)
+		 */
+		struct ProxyPair
+		{
+			int32_t proxyA;
+			int32_t proxyB;
+		};
+
+	private:
+		/**
+		 *  @struct		Proxy
+		 *  @brief		登録した箱
+		 */
+		struct Proxy
+		{
+			Aabb		bounds;
+			uint32_t	userData;
+			int32_t		next;		//	!<	空いているときは次の空いているプロキシ
+			bool		isActive;
+		};
+		/**
+		 *  @struct		SortKey
+		 *  @brief		X軸の並びの要素
+		 */
+		struct SortKey
+		{
+			float	lowerX;
+			int32_t	proxy;
+		};
+
+	private:
+		std::vector<Proxy>		proxies_;
+		std::vector<SortKey>	order_;			//	!<	lowerXの順(末尾のaddedCount_個は追加したばかりで並んでいない)
+		std::vector<float>		lowerX_;		//	!<	並べた順の箱(以下6つは同じ並びで、末尾に番兵を置く)
+		std::vector<float>		upperX_;
+		std::vector<float>		lowerY_;
+		std::vector<float>		upperY_;
+		std::vector<float>		lowerZ_;
+		std::vector<float>		upperZ_;
+		std::vector<ProxyPair>	pairs_;
+		std::vector<int32_t>	removed_;		//	!<	取り除いたがorder_に残っているプロキシ(並べ直すまで使い回さない)
+		int32_t					freeList_;
+		size_t					proxyCount_;
+		size_t					addedCount_;
+
+	public:
+		SweepAndPrune();
+
+	public:
+		/**
+		 *	@fn			Insert
+		 *	@brief		箱を追加する
+		 *	@param[in]	argBounds	!<	物体の箱
+		 *	@param[in]	argUserData	!<	プロキシに持たせる値(形状の配列の添字など)
+		 *	@return		プロキシ
+		 */
+		int32_t Insert(const Aabb &argBounds, uint32_t argUserData);
+		inline int32_t Insert(const Sphere &argSphere, uint32_t argUserData) { return Insert(ComputeAabb(argSphere), argUserData); }
+		inline int32_t Insert(const Capsule &argCapsule, uint32_t argUserData) { return Insert(ComputeAabb(argCapsule), argUserData); }
+		inline int32_t Insert(const Segment &argSegment, uint32_t argUserData) { return Insert(ComputeAabb(argSegment), argUserData); }
+		/**
+		 *	@fn			Update
+		 *	@brief		箱を更新する(並べ直すのは次のUpdatePairs)
+		 *	@param[in]	argProxy	!<	プロキシ
+		 *	@param[in]	argBounds	!<	物体の今の箱
+		 */
+		inline void Update(int32_t argProxy, const Aabb &argBounds)
+		{
+			assert(IsProxy(argProxy) && "Invalid proxy...");
+			proxies_[argProxy].bounds = argBounds;
+		}
+		inline void Update(int32_t argProxy, const Sphere &argSphere) { Update(argProxy, ComputeAabb(argSphere)); }
+		inline void Update(int32_t argProxy, const Capsule &argCapsule) { Update(argProxy, ComputeAabb(argCapsule)); }
+		inline void Update(int32_t argProxy, const Segment &argSegment) { Update(argProxy, ComputeAabb(argSegment)); }
+		/**
+		 *	@fn			Remove
+		 *	@brief		箱を取り除く
+		 *	@param[in]	argProxy	!<	Insertで返したプロキシ
+		 */
+		void Remove(int32_t argProxy);
+		/**
+		 *	@fn			Clear
+		 *	@brief		全ての箱を取り除く
+		 */
+		void Clear();
+
+		/**
+		 *	@fn			UpdatePairs
+		 *	@brief		箱を並べ直し、重なる組を探し直す
+		 *	@return		重なる組(次にUpdatePairsかClearを呼ぶまで有効)
+		 *	@note		組はX軸の並びの順に入っていて、同じ組は1回しか入らない
+		 */
+		Span<const ProxyPair> UpdatePairs();
+		inline Span<const ProxyPair> GetPairs() const { return Span<const ProxyPair>(pairs_.data(), pairs_.size()); }
+
+		inline const Aabb &GetAabb(int32_t argProxy) const
+		{
+			assert(IsProxy(argProxy) && "Invalid proxy...");
+			return proxies_[argProxy].bounds;
+		}
+		inline uint32_t GetUserData(int32_t argProxy) const
+		{
+			assert(IsProxy(argProxy) && "Invalid proxy...");
+			return proxies_[argProxy].userData;
+		}
+		inline size_t GetProxyCount() const { return proxyCount_; }
+
+	private:
+		inline bool IsProxy(int32_t argProxy) const
+		{
+			return argProxy >= 0 && static_cast<size_t>(argProxy) < proxies_.size() && proxies_[argProxy].isActive;
+		}
+
+		/**
+		 *	@fn			SortAxis
+		 *	@brief		order_をlowerXの順に並べ直す
+		 */
+		void SortAxis();
+		/**
+		 *	@fn			Sweep
+		 *	@brief		並べた箱を軸ごとの配列に書き出し、掃いて重なる組をpairs_に集める
+		 */
+		void Sweep();
+	};
+}
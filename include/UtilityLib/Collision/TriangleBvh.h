@@ -0,0 +1,275 @@
+﻿/**
+ *	@file	TriangleBvh.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Collision3D.h"
+#include "../Span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <assert.h>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	/**
+	 *  @class		TriangleBvh
+	 *  @brief		動かない三角形(ステージの地形など)の当たり判定用の箱の木
+	 *  @note		Buildは重心を軸ごとに16個の区間に分け、表面積(SAH)が最小になる区間の境目で分ける。
+	 *				ThreadPoolを渡すと、三角形の箱の計算と大きな節の分類を並列に行い、下の方の部分木は部分木ごとに並列に作る
+	 *				(結果はスレッドの数によらず同じ)。節は32バイトで、1つ目の子は親の直後に、2つ目の子は添字で指す。
+	 *				三角形は葉の順に並べ直して持つので、問い合わせにはBuildに渡した配列の添字を返す。
+	 *				Serializeしたデータをファイルに書いてArchiveにまとめておけば、Loadで作り直さずに読み込める。
+	 */
+	class TriangleBvh final
+	{
+	public:
+		static const uint32_t MaxLeafSize = 4;		//	!<	葉に入れる三角形の数の上限
+		static const size_t QueryStackSize = 96;	//	!<	たどる途中の節の数の上限(Buildで深さを抑え、Deserializeで確かめる)
+
+		/**
+		 *  @struct		RayHit
+		 *  @brief		線分が当たった三角形
+		 */
+		struct RayHit
+		{
+			uint32_t		triangle;	//	!<	Buildに渡した配列の添字
+			float			fraction;	//	!<	始点から終点までを1とした当たった位置
+			Math::Vector3	point;		//	!<	交点
+		};
+
+	private:
+		/**
+		 *  @struct		Node
+		 *  @brief		木の節(countが0なら内部の節)
+		 */
+		struct Node
+		{
+			float		lower[3];
+			uint32_t	index;		//	!<	葉はtriangles_の先頭、内部の節は2つ目の子
+			float		upper[3];
+			uint16_t	count;		//	!<	葉の三角形の数
+			uint16_t	axis;		//	!<	内部の節を分けた軸
+		};
+		static_assert(sizeof(Node) == 32, "TriangleBvh::Node must be 32 bytes...");
+
+	private:
+		std::vector<Node>		nodes_;
+		std::vector<Triangle>	triangles_;	//	!<	葉の順に並べ直した三角形
+		std::vector<uint32_t>	indices_;	//	!<	並べ直す前の添字
+
+	public:
+		TriangleBvh();
+
+	public:
+		/**
+		 *	@fn			Build
+		 *	@brief		三角形の配列から作り直す
+		 *	@param[in]	argTriangles	!<	三角形(ComputeTriangleで法線を計算したもの)
+		 *	@param[in]	argPool			!<	並列に処理するスレッドプール(省略時は呼んだスレッドで処理する)
+		 */
+		void Build(Span<const Triangle> argTriangles, ThreadPool *argPool = nullptr);
+		/**
+		 *	@fn			Clear
+		 *	@brief		全ての三角形を取り除く
+		 */
+		void Clear();
+
+		inline size_t GetTriangleCount() const { return triangles_.size(); }
+		inline size_t GetNodeCount() const { return nodes_.size(); }
+		/**
+		 *	@fn			GetBounds
+		 *	@brief		全ての三角形を囲む箱
+		 */
+		Aabb GetBounds() const;
+
+		/**
+		 *	@fn			QueryAabb
+		 *	@brief		箱が重なる三角形を列挙する
+		 *	@param[in]	argBounds	!<	調べる箱
+		 *	@param[in]	argFunc		!<	三角形ごとに呼ぶ関数(void(uint32_t triangle, const Triangle &))
+		 */
+		template<typename Func>
+		void QueryAabb(const Aabb &argBounds, const Func &argFunc) const
+		{
+			Traverse([&argBounds](const Node &argNode) { return Overlaps(argNode, argBounds); },
+				[this, &argBounds, &argFunc](uint32_t argIndex)
+			{
+				if (CheckAabb2Aabb(TriangleAabb(triangles_[argIndex]), argBounds))
+					argFunc(indices_[argIndex], triangles_[argIndex]);
+			});
+		}
+		/**
+		 *	@fn			QuerySphere
+		 *	@brief		球と当たる三角形を列挙する(CheckSphere2Triangleで判定する)
+		 *	@param[in]	argSphere	!<	球
+		 *	@param[in]	argFunc		!<	三角形ごとに呼ぶ関数(void(uint32_t triangle, const Math::Vector3 &closest))
+		 */
+		template<typename Func>
+		void QuerySphere(const Sphere &argSphere, const Func &argFunc) const
+		{
+			Traverse([&argSphere](const Node &argNode) { return Overlaps(argNode, argSphere); },
+				[this, &argSphere, &argFunc](uint32_t argIndex)
+			{
+				Math::Vector3 closest;
+				if (CheckSphere2Triangle(argSphere, triangles_[argIndex], &closest))
+					argFunc(indices_[argIndex], closest);
+			});
+		}
+		/**
+		 *	@fn			QueryCapsule
+		 *	@brief		カプセルと当たる三角形を列挙する(CheckCapsule2Triangleで判定する)
+		 *	@param[in]	argCapsule	!<	カプセル
+		 *	@param[in]	argFunc		!<	三角形ごとに呼ぶ関数(void(uint32_t triangle, const Math::Vector3 &closest))
+		 */
+		template<typename Func>
+		void QueryCapsule(const Capsule &argCapsule, const Func &argFunc) const
+		{
+			const Aabb Bounds = ComputeAabb(argCapsule);
+			Traverse([&Bounds](const Node &argNode) { return Overlaps(argNode, Bounds); },
+				[this, &argCapsule, &argFunc](uint32_t argIndex)
+			{
+				Math::Vector3 closest;
+				if (CheckCapsule2Triangle(argCapsule, triangles_[argIndex], &closest))
+					argFunc(indices_[argIndex], closest);
+			});
+		}
+		/**
+		 *	@fn			Raycast
+		 *	@brief		線分が最初に当たる三角形を探す(CheckSegment2Triangleで判定するので裏面には当たらない)
+		 *	@param[in]	argSegment	!<	線分(始点から終点に向かう)
+		 *	@param[out]	argHit		!<	当たった三角形(省略可)
+		 *	@return		当たっていればtrue
+		 */
+		bool Raycast(const Segment &argSegment, RayHit *argHit = nullptr) const;
+		/**
+		 *	@fn			RaycastAll
+		 *	@brief		線分が当たる全ての三角形を列挙する(順番は近い順とは限らない)
+		 *	@param[in]	argSegment	!<	線分(始点から終点に向かう)
+		 *	@param[in]	argFunc		!<	三角形ごとに呼ぶ関数(void(const RayHit &))
+		 */
+		template<typename Func>
+		void RaycastAll(const Segment &argSegment, const Func &argFunc) const
+		{
+			const RaySetup Ray(argSegment);
+			Traverse([&Ray](const Node &argNode) { float entry; return Ray.Overlaps(argNode, 1.f, &entry); },
+				[this, &argSegment, &argFunc](uint32_t argIndex)
+			{
+				RayHit hit;
+				if (IntersectSegment(argSegment, argIndex, &hit))
+					argFunc(hit);
+			});
+		}
+
+		/**
+		 *	@fn			Serialize
+		 *	@brief		作った木をバイト列にする
+		 *	@param[out]	argData	!<	バイト列(上書きする)
+		 */
+		void Serialize(std::vector<char> *argData) const;
+		/**
+		 *	@fn			Deserialize
+		 *	@brief		Serializeしたバイト列から読み込む
+		 *	@param[in]	argData	!<	バイト列
+		 *	@param[in]	argSize	!<	バイト数
+		 *	@retval		true	!<	成功
+		 *	@retval		false	!<	形式か版が違う、または壊れている(空になる)
+		 */
+		bool Deserialize(const char *argData, size_t argSize);
+		/**
+		 *	@fn			Save
+		 *	@brief		Serializeしたバイト列をファイルに書き出す(Archive::Exportでまとめる用)
+		 *	@param[in]	argFileName	!<	ファイルのパス
+		 *	@retval		true	!<	成功
+		 *	@retval		false	!<	失敗
+		 */
+		bool Save(const char *argFileName) const;
+		/**
+		 *	@fn			Load
+		 *	@brief		Saveしたファイルを読み込む
+		 *	@param[in]	argFileName		!<	ファイルのパス
+		 *	@param[in]	argUseArchive	!<	trueならSingleton<Archive>から読む
+		 *	@retval		true	!<	成功
+		 *	@retval		false	!<	失敗
+		 */
+		bool Load(const char *argFileName, bool argUseArchive = false);
+
+	private:
+		/**
+		 *  @struct		RaySetup
+		 *  @brief		線分と節の箱の判定に使う値
+		 */
+		struct RaySetup
+		{
+			float	start[3];
+			float	inverse[3];	//	!<	向きの逆数(向きが0の軸は0)
+			bool	isParallel[3];
+
+			explicit RaySetup(const Segment &argSegment);
+			/**
+			 *	@fn			Overlaps
+			 *	@brief		線分の[0, argMaxFraction]の部分が節の箱を通るか
+			 *	@param[out]	argEntry	!<	箱に入る位置
+			 */
+			bool Overlaps(const Node &argNode, float argMaxFraction, float *argEntry) const;
+		};
+
+		static bool Overlaps(const Node &argNode, const Aabb &argBounds);
+		static bool Overlaps(const Node &argNode, const Sphere &argSphere);
+		static Aabb TriangleAabb(const Triangle &argTriangle);
+		/**
+		 *	@fn			IntersectSegment
+		 *	@brief		並べ直した後のargIndex番目の三角形と線分の判定
+		 */
+		bool IntersectSegment(const Segment &argSegment, uint32_t argIndex, RayHit *argHit) const;
+
+		/**
+		 *	@fn			Traverse
+		 *	@brief		argOverlapsが真になる節をたどり、葉の三角形ごとにargLeafを呼ぶ
+		 *	@param[in]	argOverlaps	!<	bool(const Node &)
+		 *	@param[in]	argLeaf		!<	void(uint32_t 並べ直した後の添字)
+		 */
+		template<typename OverlapFunc, typename LeafFunc>
+		void Traverse(const OverlapFunc &argOverlaps, const LeafFunc &argLeaf) const
+		{
+			if (nodes_.empty())
+				return;
+
+			uint32_t stack[QueryStackSize];
+			size_t count = 0;
+			uint32_t index = 0;
+			for (;;)
+			{
+				const Node &Current = nodes_[index];
+				if (argOverlaps(Current))
+				{
+					if (Current.count > 0)
+					{
+						for (uint32_t i = Current.index; i < Current.index + Current.count; ++i)
+							argLeaf(i);
+					}
+					else
+					{
+						if (count == QueryStackSize)
+						{// Deserializeで深さを確かめているので起きないが、壊れた木でもスタックの外に書かない
+							assert(false && "TriangleBvh is too deep...");
+							return;
+						}
+						stack[count++] = Current.index;
+						index = index + 1;
+						continue;
+					}
+				}
+				if (count == 0)
+					break;
+				index = stack[--count];
+			}
+		}
+	};
+}
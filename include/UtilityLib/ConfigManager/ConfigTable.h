@@ -0,0 +1,125 @@
+﻿/**
+ *	@file	ConfigTable.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../Span.h"
+
+namespace Utility
+{
+	/**
+	 *  @class		ConfigTable
+	 *  @brief		コンフィグの配列・テーブルの値
+	 *  @note		列ごとに連続したバッファで保持する(SoA)。ロード時に一度だけ変換する
+	 */
+	class ConfigTable final
+	{
+	private:
+
+		/**
+		 *  @struct		Column
+		 *  @brief		列
+		 */
+		struct Column
+		{
+			std::string name_;
+			bool isInteger_;
+			std::vector<int> intData_;
+			std::vector<float> floatData_;
+		};
+	private:
+		std::vector<Column> columns_;
+		size_t rowSize_ = 0;
+
+	public:
+		ConfigTable() = default;
+		/**
+		 *	@constructor	ConfigTable
+		 *	@brief			文字列のセルからテーブルを作る
+		 *	@param[in]		argColumnNames	!<	列の名前
+		 *	@param[in]		argCells		!<	行優先で並んだセルの文字列
+		 *	@note			全てのセルが整数の列は整数と実数、それ以外の列は実数で保持する。列の名前がなければ空のテーブルになる
+		 */
+		ConfigTable(const std::vector<std::string> &argColumnNames, const std::vector<std::string> &argCells);
+
+	public:
+		/**
+		 *  @fn			RowSize
+		 *  @brief		行数の取得
+		 *  @return		行数
+		 */
+		inline size_t RowSize() const { return rowSize_; }
+		/**
+		 *  @fn			ColumnSize
+		 *  @brief		列数の取得
+		 *  @return		列数
+		 */
+		inline size_t ColumnSize() const { return columns_.size(); }
+		/**
+		 *  @fn			ColumnName
+		 *  @brief		列の名前の取得
+		 *  @param[in]	argColumn	!<	列のインデックス
+		 *  @return		列の名前
+		 */
+		inline const std::string &ColumnName(size_t argColumn) const { return columns_[argColumn].name_; }
+		/**
+		 *  @fn			IsInteger
+		 *  @brief		列が整数で取得できるか
+		 *  @param[in]	argColumn	!<	列のインデックス
+		 *  @retval		true		!<	整数の列
+		 *  @retval		false		!<	実数の列
+		 */
+		inline bool IsInteger(size_t argColumn) const { return columns_[argColumn].isInteger_; }
+		/**
+		 *  @fn			ColumnIndex
+		 *  @brief		列の名前からインデックスを取得
+		 *  @param[in]	argName	!<	列の名前
+		 *  @return		列のインデックス
+		 */
+		size_t ColumnIndex(const std::string &argName) const;
+
+		/**
+		 *  @fn			IntColumn
+		 *  @brief		整数の列の取得
+		 *  @param[in]	argColumn	!<	列のインデックス
+		 *  @return		列の値
+		 */
+		Span<const int> IntColumn(size_t argColumn) const;
+		/**
+		 *  @fn			IntColumn
+		 *  @brief		整数の列の取得
+		 *  @param[in]	argName	!<	列の名前
+		 *  @return		列の値
+		 */
+		inline Span<const int> IntColumn(const std::string &argName) const { return IntColumn(ColumnIndex(argName)); }
+		/**
+		 *  @fn			FloatColumn
+		 *  @brief		実数の列の取得
+		 *  @param[in]	argColumn	!<	列のインデックス
+		 *  @return		列の値
+		 */
+		inline Span<const float> FloatColumn(size_t argColumn) const { return columns_[argColumn].floatData_; }
+		/**
+		 *  @fn			FloatColumn
+		 *  @brief		実数の列の取得
+		 *  @param[in]	argName	!<	列の名前
+		 *  @return		列の値
+		 */
+		inline Span<const float> FloatColumn(const std::string &argName) const { return FloatColumn(ColumnIndex(argName)); }
+
+		/**
+		 *  @fn			CellString
+		 *  @brief		セルを書き出し用の文字列で取得
+		 *  @param[in]	argRow		!<	行のインデックス
+		 *  @param[in]	argColumn	!<	列のインデックス
+		 *  @return		セルの文字列
+		 */
+		std::string CellString(size_t argRow, size_t argColumn) const;
+	};
+}
@@ -8,7 +8,7 @@
 
 #include <string>
 #include <windows.h>
-#include <DirectXMath.h>
+#include "Math/MathConfig.h"
 
 namespace Utility
 {
@@ -42,7 +42,7 @@ namespace Utility
 		 *	@param[in]	argStr	!<	描画する文字列
 		 *	@param[in]	argPos	!<	描画する座標
 		 */
-		void DrawAndWriteText(const std::wstring argStr, DirectX::XMFLOAT2 argPos)const;
+		void DrawAndWriteText(std::wstring_view argStr, DirectX::XMFLOAT2 argPos)const;
 		/**
 		 *	@fn			ConfigTextColor
 		 *	@brief		DirectWriteで描画するテキストの色を変える
@@ -78,6 +78,13 @@ namespace Utility
 		 *	@return		テクスチャ
 		 */
 		std::shared_ptr<Texture> FindIndexTexture(const std::wstring argKey)const;
+		/**
+		 *	@fn			FindIndexTexture
+		 *	@brief		テクスチャの取得
+		 *	@param[in]	argKey	!<	取得したいテクスチャのキー
+		 *	@return		テクスチャ
+		 */
+		std::shared_ptr<Texture> FindIndexTexture(Atom argKey)const;
 
 		/**
 		 *	@fn			DirectWrite
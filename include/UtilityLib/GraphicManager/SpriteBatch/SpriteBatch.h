@@ -9,7 +9,7 @@
 #pragma once
 
 #include <memory>
-#include <DirectXMath.h>
+#include "../../Math/MathConfig.h"
 #include <DirectXColors.h>
 #include <Windows.h>
 
@@ -15,7 +15,7 @@
 #include <vector>
 #include <d3d11.h>
 #include <d3d11_1.h>
-#include <DirectXMath.h>
+#include "../../Math/MathConfig.h"
 
 struct IWICImagingFactory;
 struct IWICBitmapDecoder;
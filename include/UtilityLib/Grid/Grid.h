@@ -6,7 +6,7 @@
  */
 #pragma once
 #include <memory>
-#include <DirectXMath.h>
+#include "../Math/MathConfig.h"
 
 struct ID3D11DeviceContext;
 
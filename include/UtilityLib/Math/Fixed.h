@@ -0,0 +1,727 @@
+﻿/**
+ *	@file	Fixed.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Vector2f.h"
+#include "Vector3f.h"
+#include "../Span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <assert.h>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	namespace Math
+	{
+		/**
+		 *  @class		Fixed
+		 *  @brief		固定小数点数(小数部F bit)
+		 *  @note		整数演算だけで計算するので、コンパイラやCPU(x86/ARM)によらず同じ結果になる。
+		 *				ロックステップの通信対戦やリプレイの検証のように、全ての環境で結果を一致させたい計算に使う。
+		 *				掛け算は最も近い値に丸め、割り算は0方向に切り捨てる。範囲を超えた値は2の補数で折り返す
+		 *				(掛け算の積が範囲を超えたときはデバッグビルドではassertで止める)。
+		 *				floatとの変換は入出力のためだけに使い、途中の計算には入れないこと。
+		 */
+		template<typename TRaw, int F>
+		class Fixed final
+		{
+			static_assert(std::is_signed<TRaw>::value && F > 0 && F < static_cast<int>(sizeof(TRaw) * 8) - 1, "Fixed needs a signed raw type wider than the fraction...");
+
+		public:
+			using Raw = TRaw;
+			using Unsigned = typename std::make_unsigned<TRaw>::type;
+			static const int FractionBits = F;
+			static constexpr Raw OneRaw = static_cast<Raw>(1) << F;
+
+		private:
+			Raw	raw_;
+
+		public:
+			constexpr Fixed() : raw_(0) {}
+			constexpr Fixed(int argValue) : raw_(static_cast<Raw>(static_cast<Unsigned>(static_cast<Raw>(argValue)) << F)) {}
+			explicit constexpr Fixed(float argValue) : Fixed(static_cast<double>(argValue)) {}
+			explicit constexpr Fixed(double argValue) : raw_(static_cast<Raw>(argValue * OneRaw + ((argValue < 0.0) ? -0.5 : 0.5))) {}
+
+			/**
+			 *	@fn			FromRaw
+			 *	@brief		内部表現から作る
+			 *	@param[in]	argRaw	!<	内部表現(値 * 2^F)
+			 */
+			static constexpr Fixed FromRaw(Raw argRaw)
+			{
+				Fixed result;
+				result.raw_ = argRaw;
+				return result;
+			}
+
+			constexpr Raw RawValue() const { return raw_; }
+			constexpr float ToFloat() const { return static_cast<float>(raw_) * (1.f / static_cast<float>(OneRaw)); }
+			constexpr double ToDouble() const { return static_cast<double>(raw_) * (1.0 / static_cast<double>(OneRaw)); }
+			/**
+			 *	@fn			ToInt
+			 *	@brief		負の無限大方向に丸めた整数
+			 */
+			constexpr Raw ToInt() const { return raw_ >> F; }
+			explicit constexpr operator float() const { return ToFloat(); }
+
+		public:
+			constexpr Fixed operator+() const { return *this; }
+			constexpr Fixed operator-() const { return FromRaw(static_cast<Raw>(Unsigned(0) - static_cast<Unsigned>(raw_))); }
+
+			inline Fixed &operator+=(Fixed argOther) { return *this = *this + argOther; }
+			inline Fixed &operator-=(Fixed argOther) { return *this = *this - argOther; }
+			inline Fixed &operator*=(Fixed argOther) { return *this = *this * argOther; }
+			inline Fixed &operator/=(Fixed argOther) { return *this = *this / argOther; }
+
+			friend constexpr Fixed operator+(Fixed argA, Fixed argB) { return FromRaw(static_cast<Raw>(static_cast<Unsigned>(argA.raw_) + static_cast<Unsigned>(argB.raw_))); }
+			friend constexpr Fixed operator-(Fixed argA, Fixed argB) { return FromRaw(static_cast<Raw>(static_cast<Unsigned>(argA.raw_) - static_cast<Unsigned>(argB.raw_))); }
+			friend constexpr Fixed operator*(Fixed argA, Fixed argB) { return FromRaw(Multiply(argA.raw_, argB.raw_)); }
+			friend constexpr Fixed operator/(Fixed argA, Fixed argB)
+			{
+				assert(argB.raw_ != 0 && "Fixed division by zero...");
+				return FromRaw(Divide(argA.raw_, argB.raw_));
+			}
+
+			friend constexpr bool operator==(Fixed argA, Fixed argB) { return argA.raw_ == argB.raw_; }
+			friend constexpr bool operator!=(Fixed argA, Fixed argB) { return argA.raw_ != argB.raw_; }
+			friend constexpr bool operator<(Fixed argA, Fixed argB) { return argA.raw_ < argB.raw_; }
+			friend constexpr bool operator<=(Fixed argA, Fixed argB) { return argA.raw_ <= argB.raw_; }
+			friend constexpr bool operator>(Fixed argA, Fixed argB) { return argA.raw_ > argB.raw_; }
+			friend constexpr bool operator>=(Fixed argA, Fixed argB) { return argA.raw_ >= argB.raw_; }
+
+		public:
+			/**
+			 *	@fn			Multiply
+			 *	@brief		内部表現同士の掛け算((a * b + 2^(F-1)) >> F)
+			 *	@note		32bitは64bitで、64bitは32bitずつに分けて128bitの積を組み立てる。
+			 *				積が範囲を超えると折り返すので、デバッグビルドではassertで止める
+			 *				(Fixed32の判定で形状の大きさが0.25～128程度を超えたときなど。長さの2乗や4乗の積で最初にあふれる)
+			 */
+			static constexpr Raw Multiply(Raw argA, Raw argB)
+			{
+				if constexpr (sizeof(Raw) <= 4)
+				{
+					const int64_t Product = static_cast<int64_t>(argA) * argB + (static_cast<int64_t>(1) << (F - 1));
+					assert((Product >> F) >= std::numeric_limits<Raw>::min() && (Product >> F) <= std::numeric_limits<Raw>::max() && "Fixed multiply overflow...");
+					return static_cast<Raw>(static_cast<uint64_t>(Product) >> F);
+				}
+				else
+				{
+					static_assert(sizeof(Raw) == 8, "Fixed supports 32 or 64 bit raw types...");
+					// 符号無しとして128bitの積を32bitずつ組み立て、負の値の分を上位から引いて符号付きの積にする
+					const uint64_t UA = static_cast<uint64_t>(argA), UB = static_cast<uint64_t>(argB);
+					const uint64_t A0 = UA & 0xffffffffull, A1 = UA >> 32;
+					const uint64_t B0 = UB & 0xffffffffull, B1 = UB >> 32;
+					const uint64_t P00 = A0 * B0, P01 = A0 * B1, P10 = A1 * B0, P11 = A1 * B1;
+					const uint64_t Middle = (P00 >> 32) + (P01 & 0xffffffffull) + (P10 & 0xffffffffull);
+					uint64_t low = (P00 & 0xffffffffull) | (Middle << 32);
+					uint64_t high = P11 + (P01 >> 32) + (P10 >> 32) + (Middle >> 32);
+					if (argA < 0)
+						high -= UB;
+					if (argB < 0)
+						high -= UA;
+
+					// 2^(F-1)を足して丸め、Fだけずらした下位64bit
+					const uint64_t Rounded = low + (static_cast<uint64_t>(1) << (F - 1));
+					high += (Rounded < low) ? 1 : 0;
+					low = Rounded;
+					// 結果に入らない上位のbit(128bitの積のF + 63bit目より上)が全て符号と同じなら範囲内
+					assert(((static_cast<int64_t>(high) >> (F - 1)) == 0 || (static_cast<int64_t>(high) >> (F - 1)) == -1) && "Fixed multiply overflow...");
+					return static_cast<Raw>((low >> F) | (high << (64 - F)));
+				}
+			}
+			/**
+			 *	@fn			Divide
+			 *	@brief		内部表現同士の割り算((a << F) / b。0方向に切り捨て)
+			 */
+			static constexpr Raw Divide(Raw argA, Raw argB)
+			{
+				if constexpr (sizeof(Raw) <= 4)
+				{
+					return static_cast<Raw>(static_cast<int64_t>(static_cast<uint64_t>(static_cast<int64_t>(argA)) << F) / argB);
+				}
+				else
+				{
+					const bool Negative = (argA < 0) != (argB < 0);
+					const uint64_t N = (argA < 0) ? 0 - static_cast<uint64_t>(argA) : static_cast<uint64_t>(argA);
+					const uint64_t D = (argB < 0) ? 0 - static_cast<uint64_t>(argB) : static_cast<uint64_t>(argB);
+
+					// 整数部を割ってから、余りを1bitずつ割り進める
+					uint64_t quotient = N / D;
+					uint64_t remainder = N % D;
+					for (int i = 0; i < F; ++i)
+					{
+						const bool Over = (remainder >> 63) != 0;
+						remainder <<= 1;
+						quotient <<= 1;
+						if (Over || remainder >= D)
+						{
+							remainder -= D;
+							quotient |= 1;
+						}
+					}
+					return static_cast<Raw>(Negative ? 0 - quotient : quotient);
+				}
+			}
+		};
+
+		using Fixed16 = Fixed<int32_t, 16>;	//	!<	Q16.16(範囲±32768、精度1.5e-5)
+		using Fixed32 = Fixed<int64_t, 32>;	//	!<	Q32.32(範囲±2^31、精度2.3e-10)
+
+		/**
+		 *  @class		FixedMath
+		 *  @brief		固定小数点数の関数
+		 *  @note		三角関数は整数の多項式で計算する。誤差はFixed16で数LSB、Fixed32で1e-9程度。
+		 *				配列をまとめて計算する関数はFixed16ならAVX2/SSE2で8/4要素ずつ処理し、
+		 *				どの命令セットでもスカラーと同じ結果になる(Fixed32は1要素ずつ)。
+		 */
+		template<typename T>
+		class FixedMath final
+		{
+		public:
+			using Raw = typename T::Raw;
+			static const size_t ParallelGrain = 16384;	//	!<	並列に処理するときの1塊の要素数
+
+		public:
+			static constexpr T Pi() { return T(3.14159265358979323846); }
+			static constexpr T HalfPi() { return T(1.57079632679489661923); }
+			static constexpr T TwoPi() { return T(6.28318530717958647692); }
+
+			static constexpr T Abs(T argValue) { return (argValue < 0) ? -argValue : argValue; }
+			static constexpr T Min(T argA, T argB) { return (argB < argA) ? argB : argA; }
+			static constexpr T Max(T argA, T argB) { return (argA < argB) ? argB : argA; }
+			static constexpr T Clamp(T argValue, T argMin, T argMax) { return Min(Max(argValue, argMin), argMax); }
+
+			/**
+			 *	@fn			Sqrt
+			 *	@brief		平方根(切り捨て。0以下は0)
+			 *	@note		1bitずつ根を決める整数の開平法
+			 */
+			static constexpr T Sqrt(T argValue)
+			{
+				if (argValue <= 0)
+					return T();
+
+				// 値 * 2^Fの平方根が根の内部表現になる。根は最大で(bit数 + F) / 2 bit
+				const int Pairs = (static_cast<int>(sizeof(Raw) * 8) + T::FractionBits) / 2;
+				const uint64_t Value = static_cast<uint64_t>(argValue.RawValue());
+				uint64_t root = 0, remainder = 0;
+				for (int i = Pairs - 1; i >= 0; --i)
+				{
+					const int Shift = 2 * i - T::FractionBits;
+					const uint64_t Pair = (Shift >= 0) ? ((Value >> Shift) & 3) : 0;
+					remainder = (remainder << 2) | Pair;
+					const uint64_t Trial = (root << 2) | 1;
+					root <<= 1;
+					if (remainder >= Trial)
+					{
+						remainder -= Trial;
+						root |= 1;
+					}
+				}
+				return T::FromRaw(static_cast<Raw>(root));
+			}
+
+			/**
+			 *	@fn			SinCos
+			 *	@brief		正弦と余弦
+			 *	@param[in]	argAngle	!<	角度(ラジアン。|x| < 32768)
+			 *	@param[out]	argSin		!<	正弦
+			 *	@param[out]	argCos		!<	余弦
+			 */
+			static constexpr void SinCos(T argAngle, T *argSin, T *argCos)
+			{
+				// π/2の倍数を引いて[-π/4, π/4]にする。π/2は小数部を多く持ち、引き算は小数部F + Extra bitで行う
+				constexpr int Extra = (T::FractionBits > 16) ? 14 : 16;
+				constexpr int64_t HalfPiExt = static_cast<int64_t>(1.57079632679489661923 * static_cast<double>(static_cast<int64_t>(1) << (T::FractionBits + Extra)) + 0.5);
+				assert(argAngle.ToInt() >= -32768 && argAngle.ToInt() < 32768 && "FixedMath angle out of range...");
+
+				const T Quotient = argAngle * T(0.63661977236758134308);
+				const Raw Quadrant = (Quotient + T::FromRaw(T::OneRaw / 2)).ToInt();
+				const int64_t ReducedExt = static_cast<int64_t>(static_cast<uint64_t>(static_cast<int64_t>(argAngle.RawValue())) << Extra) - static_cast<int64_t>(Quadrant) * HalfPiExt;
+				const T R = T::FromRaw(static_cast<Raw>((ReducedExt + (static_cast<int64_t>(1) << (Extra - 1))) >> Extra));
+				const T R2 = R * R;
+
+				// テイラー展開(|r| <= π/4で13次の項が1e-11以下)
+				const T S = R * (T(1) + R2 * (T(-1.0 / 6.0) + R2 * (T(1.0 / 120.0) + R2 * (T(-1.0 / 5040.0) + R2 * (T(1.0 / 362880.0) + R2 * T(-1.0 / 39916800.0))))));
+				const T C = T(1) + R2 * (T(-0.5) + R2 * (T(1.0 / 24.0) + R2 * (T(-1.0 / 720.0) + R2 * (T(1.0 / 40320.0) + R2 * (T(-1.0 / 3628800.0) + R2 * T(1.0 / 479001600.0))))));
+
+				switch (Quadrant & 3)
+				{
+				case 0:
+					*argSin = S;
+					*argCos = C;
+					break;
+				case 1:
+					*argSin = C;
+					*argCos = -S;
+					break;
+				case 2:
+					*argSin = -S;
+					*argCos = -C;
+					break;
+				default:
+					*argSin = -C;
+					*argCos = S;
+					break;
+				}
+			}
+			static constexpr T Sin(T argAngle)
+			{
+				T s, c;
+				SinCos(argAngle, &s, &c);
+				return s;
+			}
+			static constexpr T Cos(T argAngle)
+			{
+				T s, c;
+				SinCos(argAngle, &s, &c);
+				return c;
+			}
+
+			/**
+			 *	@fn			Atan2
+			 *	@brief		逆正接(-π～π。両方0なら0)
+			 *	@param[in]	argY	!<	y
+			 *	@param[in]	argX	!<	x
+			 */
+			static constexpr T Atan2(T argY, T argX)
+			{
+				const T AX = Abs(argX), AY = Abs(argY);
+				if (AX == 0 && AY == 0)
+					return T();
+
+				// [0, 1]に畳んでから、tan(π/12)を超える分はπ/6回して[-0.268, 0.268]にする
+				const bool Swap = AY > AX;
+				const T Ratio = Swap ? AX / AY : AY / AX;
+				const T Sqrt3 = T(1.73205080756887729353);
+				const bool Shift = Ratio > T(0.26794919243112270647);
+				const T U = Shift ? (Ratio * Sqrt3 - T(1)) / (Ratio + Sqrt3) : Ratio;
+				const T U2 = U * U;
+
+				// テイラー展開(|u| <= 0.268で17次の項が1e-11以下)
+				T result = U * (T(1) + U2 * (T(-1.0 / 3.0) + U2 * (T(1.0 / 5.0) + U2 * (T(-1.0 / 7.0) + U2 * (T(1.0 / 9.0) + U2 * (T(-1.0 / 11.0) + U2 * (T(1.0 / 13.0) + U2 * T(-1.0 / 15.0))))))));
+				if (Shift)
+					result += T(0.52359877559829887308);
+				if (Swap)
+					result = HalfPi() - result;
+				if (argX < 0)
+					result = Pi() - result;
+				return (argY < 0) ? -result : result;
+			}
+
+		public:
+			/**
+			 *	@fn			Multiply
+			 *	@brief		要素ごとの掛け算
+			 *	@param[in]	argA	!<	値
+			 *	@param[in]	argB	!<	値(argAと同じ要素数)
+			 *	@param[out]	argDst	!<	積(argAの要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Multiply(Span<const T> argA, Span<const T> argB, Span<T> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			MultiplyAdd
+			 *	@brief		要素ごとのa * b + c(掛け算で丸めてから足す)
+			 *	@param[in]	argA	!<	値
+			 *	@param[in]	argB	!<	値(argAと同じ要素数)
+			 *	@param[in]	argC	!<	足す値(argAと同じ要素数)
+			 *	@param[out]	argDst	!<	結果(argAの要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void MultiplyAdd(Span<const T> argA, Span<const T> argB, Span<const T> argC, Span<T> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			Dot
+			 *	@brief		成分ごとの配列(SoA)に分けたベクトルの要素ごとの内積
+			 *	@param[in]	argAX, argAY, argAZ	!<	ベクトルAの成分
+			 *	@param[in]	argBX, argBY, argBZ	!<	ベクトルBの成分(全て同じ要素数)
+			 *	@param[out]	argDst				!<	内積(要素数以上)
+			 *	@param[in]	argPool				!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void Dot(Span<const T> argAX, Span<const T> argAY, Span<const T> argAZ,
+				Span<const T> argBX, Span<const T> argBY, Span<const T> argBZ, Span<T> argDst, ThreadPool *argPool = nullptr);
+		};
+
+		extern template class FixedMath<Fixed16>;
+		extern template class FixedMath<Fixed32>;
+
+		/**
+		 *	@fn			Clamp
+		 *	@brief		値を引数のmin～maxの間に補正する(固定小数点数版)
+		 */
+		template<typename TRaw, int F>
+		inline Fixed<TRaw, F> Clamp(Fixed<TRaw, F> argSeedValue, Fixed<TRaw, F> argMinValue, Fixed<TRaw, F> argMaxValue)
+		{
+			return FixedMath<Fixed<TRaw, F>>::Clamp(argSeedValue, argMinValue, argMaxValue);
+		}
+
+		/**
+		 *  @struct		FixedVector2
+		 *  @brief		固定小数点数の2次元ベクトル
+		 */
+		template<typename T>
+		struct FixedVector2
+		{
+			T x;
+			T y;
+
+			constexpr FixedVector2() : x(), y() {}
+			constexpr FixedVector2(T argX, T argY) : x(argX), y(argY) {}
+			explicit constexpr FixedVector2(const Vector2 &argValue) : x(argValue.x), y(argValue.y) {}
+			explicit operator Vector2() const { return Vector2(x.ToFloat(), y.ToFloat()); }
+
+			constexpr FixedVector2 operator+() const { return *this; }
+			constexpr FixedVector2 operator-() const { return FixedVector2(-x, -y); }
+			inline FixedVector2 &operator+=(const FixedVector2 &argOther) { x += argOther.x; y += argOther.y; return *this; }
+			inline FixedVector2 &operator-=(const FixedVector2 &argOther) { x -= argOther.x; y -= argOther.y; return *this; }
+			inline FixedVector2 &operator*=(T argScale) { x *= argScale; y *= argScale; return *this; }
+			inline FixedVector2 &operator/=(T argScale) { x /= argScale; y /= argScale; return *this; }
+			constexpr bool operator==(const FixedVector2 &argOther) const { return x == argOther.x && y == argOther.y; }
+			constexpr bool operator!=(const FixedVector2 &argOther) const { return !(*this == argOther); }
+
+			constexpr T Dot(const FixedVector2 &argOther) const { return x * argOther.x + y * argOther.y; }
+			constexpr T Cross(const FixedVector2 &argOther) const { return x * argOther.y - y * argOther.x; }
+			constexpr T LengthSquared() const { return Dot(*this); }
+			constexpr T Length() const { return FixedMath<T>::Sqrt(LengthSquared()); }
+			/**
+			 *	@fn			Normalize
+			 *	@brief		正規化(長さ0なら0のまま)
+			 */
+			inline void Normalize()
+			{
+				const T Length = this->Length();
+				if (Length > 0)
+					*this /= Length;
+			}
+		};
+
+		template<typename T> constexpr FixedVector2<T> operator+(const FixedVector2<T> &argA, const FixedVector2<T> &argB) { return FixedVector2<T>(argA.x + argB.x, argA.y + argB.y); }
+		template<typename T> constexpr FixedVector2<T> operator-(const FixedVector2<T> &argA, const FixedVector2<T> &argB) { return FixedVector2<T>(argA.x - argB.x, argA.y - argB.y); }
+		template<typename T> constexpr FixedVector2<T> operator*(const FixedVector2<T> &argV, T argS) { return FixedVector2<T>(argV.x * argS, argV.y * argS); }
+		template<typename T> constexpr FixedVector2<T> operator*(T argS, const FixedVector2<T> &argV) { return FixedVector2<T>(argS * argV.x, argS * argV.y); }
+		template<typename T> inline FixedVector2<T> operator/(const FixedVector2<T> &argV, T argS) { return FixedVector2<T>(argV.x / argS, argV.y / argS); }
+
+		/**
+		 *  @struct		FixedVector3
+		 *  @brief		固定小数点数の3次元ベクトル
+		 */
+		template<typename T>
+		struct FixedVector3
+		{
+			T x;
+			T y;
+			T z;
+
+			constexpr FixedVector3() : x(), y(), z() {}
+			constexpr FixedVector3(T argX, T argY, T argZ) : x(argX), y(argY), z(argZ) {}
+			explicit constexpr FixedVector3(const Vector3 &argValue) : x(argValue.x), y(argValue.y), z(argValue.z) {}
+			explicit operator Vector3() const { return Vector3(x.ToFloat(), y.ToFloat(), z.ToFloat()); }
+
+			constexpr FixedVector3 operator+() const { return *this; }
+			constexpr FixedVector3 operator-() const { return FixedVector3(-x, -y, -z); }
+			inline FixedVector3 &operator+=(const FixedVector3 &argOther) { x += argOther.x; y += argOther.y; z += argOther.z; return *this; }
+			inline FixedVector3 &operator-=(const FixedVector3 &argOther) { x -= argOther.x; y -= argOther.y; z -= argOther.z; return *this; }
+			inline FixedVector3 &operator*=(T argScale) { x *= argScale; y *= argScale; z *= argScale; return *this; }
+			inline FixedVector3 &operator/=(T argScale) { x /= argScale; y /= argScale; z /= argScale; return *this; }
+			constexpr bool operator==(const FixedVector3 &argOther) const { return x == argOther.x && y == argOther.y && z == argOther.z; }
+			constexpr bool operator!=(const FixedVector3 &argOther) const { return !(*this == argOther); }
+
+			constexpr T Dot(const FixedVector3 &argOther) const { return x * argOther.x + y * argOther.y + z * argOther.z; }
+			constexpr FixedVector3 Cross(const FixedVector3 &argOther) const
+			{
+				return FixedVector3(y * argOther.z - z * argOther.y, z * argOther.x - x * argOther.z, x * argOther.y - y * argOther.x);
+			}
+			constexpr T LengthSquared() const { return Dot(*this); }
+			constexpr T Length() const { return FixedMath<T>::Sqrt(LengthSquared()); }
+			/**
+			 *	@fn			Normalize
+			 *	@brief		正規化(長さ0なら0のまま)
+			 */
+			inline void Normalize()
+			{
+				const T Length = this->Length();
+				if (Length > 0)
+					*this /= Length;
+			}
+		};
+
+		template<typename T> constexpr FixedVector3<T> operator+(const FixedVector3<T> &argA, const FixedVector3<T> &argB) { return FixedVector3<T>(argA.x + argB.x, argA.y + argB.y, argA.z + argB.z); }
+		template<typename T> constexpr FixedVector3<T> operator-(const FixedVector3<T> &argA, const FixedVector3<T> &argB) { return FixedVector3<T>(argA.x - argB.x, argA.y - argB.y, argA.z - argB.z); }
+		template<typename T> constexpr FixedVector3<T> operator*(const FixedVector3<T> &argV, T argS) { return FixedVector3<T>(argV.x * argS, argV.y * argS, argV.z * argS); }
+		template<typename T> constexpr FixedVector3<T> operator*(T argS, const FixedVector3<T> &argV) { return FixedVector3<T>(argS * argV.x, argS * argV.y, argS * argV.z); }
+		template<typename T> inline FixedVector3<T> operator/(const FixedVector3<T> &argV, T argS) { return FixedVector3<T>(argV.x / argS, argV.y / argS, argV.z / argS); }
+
+		/**
+		 *  @struct		FixedQuaternion
+		 *  @brief		固定小数点数のクォータニオン(Quaternionと同じ掛け算の順序)
+		 */
+		template<typename T>
+		struct FixedQuaternion
+		{
+			T x;
+			T y;
+			T z;
+			T w;
+
+			constexpr FixedQuaternion() : x(), y(), z(), w(1) {}
+			constexpr FixedQuaternion(T argX, T argY, T argZ, T argW) : x(argX), y(argY), z(argZ), w(argW) {}
+
+			/**
+			 *	@fn			RotationAxis
+			 *	@brief		軸回りの回転(XMQuaternionRotationAxisと同じ向き)
+			 *	@param[in]	argAxis		!<	回転軸(正規化しなくてもよい)
+			 *	@param[in]	argAngle	!<	角度(ラジアン)
+			 */
+			static inline FixedQuaternion RotationAxis(FixedVector3<T> argAxis, T argAngle)
+			{
+				T s, c;
+				FixedMath<T>::SinCos(argAngle * T(0.5), &s, &c);
+				argAxis.Normalize();
+				return FixedQuaternion(argAxis.x * s, argAxis.y * s, argAxis.z * s, c);
+			}
+
+			/**
+			 *	@fn			operator*
+			 *	@brief		自身の回転の後にargOtherの回転
+			 */
+			constexpr FixedQuaternion operator*(const FixedQuaternion &argOther) const
+			{
+				const FixedQuaternion &A = *this;
+				const FixedQuaternion &B = argOther;
+				return FixedQuaternion(
+					B.w * A.x + B.x * A.w + B.y * A.z - B.z * A.y,
+					B.w * A.y - B.x * A.z + B.y * A.w + B.z * A.x,
+					B.w * A.z + B.x * A.y - B.y * A.x + B.z * A.w,
+					B.w * A.w - B.x * A.x - B.y * A.y - B.z * A.z);
+			}
+			constexpr bool operator==(const FixedQuaternion &argOther) const { return x == argOther.x && y == argOther.y && z == argOther.z && w == argOther.w; }
+			constexpr bool operator!=(const FixedQuaternion &argOther) const { return !(*this == argOther); }
+
+			constexpr FixedQuaternion Conjugate() const { return FixedQuaternion(-x, -y, -z, w); }
+			inline void Normalize()
+			{
+				const T Length = FixedMath<T>::Sqrt(x * x + y * y + z * z + w * w);
+				if (Length > 0)
+				{
+					x /= Length;
+					y /= Length;
+					z /= Length;
+					w /= Length;
+				}
+			}
+			/**
+			 *	@fn			Rotate
+			 *	@brief		ベクトルを回転する(XMVector3Rotateと同じ)
+			 */
+			constexpr FixedVector3<T> Rotate(const FixedVector3<T> &argVector) const
+			{
+				const FixedQuaternion Result = Conjugate() * FixedQuaternion(argVector.x, argVector.y, argVector.z, T()) * *this;
+				return FixedVector3<T>(Result.x, Result.y, Result.z);
+			}
+		};
+
+		/**
+		 *  @struct		FixedMatrix
+		 *  @brief		固定小数点数の4x4行列(XMFLOAT4X4と同じ並び。行ベクトルに右から掛ける)
+		 */
+		template<typename T>
+		struct FixedMatrix
+		{
+			T m[4][4];
+
+			constexpr FixedMatrix() : m{ { T(1), T(), T(), T() }, { T(), T(1), T(), T() }, { T(), T(), T(1), T() }, { T(), T(), T(), T(1) } } {}
+
+			static constexpr FixedMatrix Identity() { return FixedMatrix(); }
+			static constexpr FixedMatrix Translation(const FixedVector3<T> &argPosition)
+			{
+				FixedMatrix result;
+				result.m[3][0] = argPosition.x;
+				result.m[3][1] = argPosition.y;
+				result.m[3][2] = argPosition.z;
+				return result;
+			}
+			static constexpr FixedMatrix Scaling(const FixedVector3<T> &argScale)
+			{
+				FixedMatrix result;
+				result.m[0][0] = argScale.x;
+				result.m[1][1] = argScale.y;
+				result.m[2][2] = argScale.z;
+				return result;
+			}
+			static constexpr FixedMatrix RotationX(T argAngle)
+			{
+				T s, c;
+				FixedMath<T>::SinCos(argAngle, &s, &c);
+				FixedMatrix result;
+				result.m[1][1] = c;
+				result.m[1][2] = s;
+				result.m[2][1] = -s;
+				result.m[2][2] = c;
+				return result;
+			}
+			static constexpr FixedMatrix RotationY(T argAngle)
+			{
+				T s, c;
+				FixedMath<T>::SinCos(argAngle, &s, &c);
+				FixedMatrix result;
+				result.m[0][0] = c;
+				result.m[0][2] = -s;
+				result.m[2][0] = s;
+				result.m[2][2] = c;
+				return result;
+			}
+			static constexpr FixedMatrix RotationZ(T argAngle)
+			{
+				T s, c;
+				FixedMath<T>::SinCos(argAngle, &s, &c);
+				FixedMatrix result;
+				result.m[0][0] = c;
+				result.m[0][1] = s;
+				result.m[1][0] = -s;
+				result.m[1][1] = c;
+				return result;
+			}
+			/**
+			 *	@fn			RotationQuaternion
+			 *	@brief		クォータニオンから回転行列を作る(XMMatrixRotationQuaternionと同じ)
+			 */
+			static constexpr FixedMatrix RotationQuaternion(const FixedQuaternion<T> &argRotation)
+			{
+				const FixedQuaternion<T> &Q = argRotation;
+				const T XX = Q.x * Q.x, YY = Q.y * Q.y, ZZ = Q.z * Q.z;
+				const T XY = Q.x * Q.y, XZ = Q.x * Q.z, YZ = Q.y * Q.z;
+				const T WX = Q.w * Q.x, WY = Q.w * Q.y, WZ = Q.w * Q.z;
+				FixedMatrix result;
+				result.m[0][0] = T(1) - T(2) * (YY + ZZ);
+				result.m[0][1] = T(2) * (XY + WZ);
+				result.m[0][2] = T(2) * (XZ - WY);
+				result.m[1][0] = T(2) * (XY - WZ);
+				result.m[1][1] = T(1) - T(2) * (XX + ZZ);
+				result.m[1][2] = T(2) * (YZ + WX);
+				result.m[2][0] = T(2) * (XZ + WY);
+				result.m[2][1] = T(2) * (YZ - WX);
+				result.m[2][2] = T(1) - T(2) * (XX + YY);
+				return result;
+			}
+			/**
+			 *	@fn			AffineTransformation
+			 *	@brief		拡大、回転、平行移動の順に合成した行列
+			 */
+			static constexpr FixedMatrix AffineTransformation(const FixedVector3<T> &argScale, const FixedQuaternion<T> &argRotation, const FixedVector3<T> &argPosition)
+			{
+				return Scaling(argScale) * RotationQuaternion(argRotation) * Translation(argPosition);
+			}
+
+			/**
+			 *	@fn			operator*
+			 *	@brief		自身の変換の後にargOtherの変換(XMMatrixMultiplyと同じ)
+			 */
+			constexpr FixedMatrix operator*(const FixedMatrix &argOther) const
+			{
+				FixedMatrix result;
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int column = 0; column < 4; ++column)
+					{
+						result.m[row][column] = m[row][0] * argOther.m[0][column] + m[row][1] * argOther.m[1][column]
+							+ m[row][2] * argOther.m[2][column] + m[row][3] * argOther.m[3][column];
+					}
+				}
+				return result;
+			}
+			constexpr bool operator==(const FixedMatrix &argOther) const
+			{
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int column = 0; column < 4; ++column)
+					{
+						if (m[row][column] != argOther.m[row][column])
+							return false;
+					}
+				}
+				return true;
+			}
+			constexpr bool operator!=(const FixedMatrix &argOther) const { return !(*this == argOther); }
+
+			constexpr FixedMatrix Transpose() const
+			{
+				FixedMatrix result;
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int column = 0; column < 4; ++column)
+						result.m[row][column] = m[column][row];
+				}
+				return result;
+			}
+			/**
+			 *	@fn			TransformCoord
+			 *	@brief		座標の変換(平行移動してwで割る。XMVector3TransformCoordと同じ)
+			 */
+			inline FixedVector3<T> TransformCoord(const FixedVector3<T> &argPoint) const
+			{
+				const FixedVector3<T> Result = TransformAffine(argPoint);
+				const T W = argPoint.x * m[0][3] + argPoint.y * m[1][3] + argPoint.z * m[2][3] + m[3][3];
+				return (W == T(1)) ? Result : Result / W;
+			}
+			/**
+			 *	@fn			TransformAffine
+			 *	@brief		座標の変換(アフィン変換として扱い、wで割らない)
+			 */
+			constexpr FixedVector3<T> TransformAffine(const FixedVector3<T> &argPoint) const
+			{
+				return FixedVector3<T>(
+					argPoint.x * m[0][0] + argPoint.y * m[1][0] + argPoint.z * m[2][0] + m[3][0],
+					argPoint.x * m[0][1] + argPoint.y * m[1][1] + argPoint.z * m[2][1] + m[3][1],
+					argPoint.x * m[0][2] + argPoint.y * m[1][2] + argPoint.z * m[2][2] + m[3][2]);
+			}
+			/**
+			 *	@fn			TransformNormal
+			 *	@brief		方向の変換(平行移動しない。XMVector3TransformNormalと同じ)
+			 */
+			constexpr FixedVector3<T> TransformNormal(const FixedVector3<T> &argVector) const
+			{
+				return FixedVector3<T>(
+					argVector.x * m[0][0] + argVector.y * m[1][0] + argVector.z * m[2][0],
+					argVector.x * m[0][1] + argVector.y * m[1][1] + argVector.z * m[2][1],
+					argVector.x * m[0][2] + argVector.y * m[1][2] + argVector.z * m[2][2]);
+			}
+		};
+
+		/**
+		 *  @struct		VectorTraits
+		 *  @brief		当たり判定などをベクトルの型で切り替えるための情報
+		 */
+		template<typename TVector>
+		struct VectorTraits;
+
+		template<>
+		struct VectorTraits<Vector2>
+		{
+			using Scalar = float;
+		};
+		template<>
+		struct VectorTraits<Vector3>
+		{
+			using Scalar = float;
+		};
+		template<typename T>
+		struct VectorTraits<FixedVector2<T>>
+		{
+			using Scalar = T;
+		};
+		template<typename T>
+		struct VectorTraits<FixedVector3<T>>
+		{
+			using Scalar = T;
+		};
+	}
+}
@@ -6,8 +6,9 @@
  */
 #pragma once
 
-#include <DirectXMath.h>
+#include "MathConfig.h"
 #include <functional>
+#include <cstring>
 
 namespace Utility
 {
@@ -44,9 +45,9 @@ namespace Utility
 			explicit Matrix(const Vector4& r0, const Vector4& r1, const Vector4& r2, const Vector4& r3);
 			Matrix(const XMFLOAT4X4& M)
 			{
-				memcpy_s(this, sizeof(float) * 16, &M, sizeof(XMFLOAT4X4));
+				std::memcpy(this, &M, sizeof(XMFLOAT4X4));
 			}
-			inline Matrix::Matrix(const DirectX::XMFLOAT3X3& M)
+			inline Matrix(const DirectX::XMFLOAT3X3& M)
 			{
 				_11 = M._11; _12 = M._12; _13 = M._13; _14 = 0.f;
 				_21 = M._21; _22 = M._22; _23 = M._23; _24 = 0.f;
@@ -54,7 +55,7 @@ namespace Utility
 				_41 = 0.f;   _42 = 0.f;   _43 = 0.f;   _44 = 1.f;
 			}
 
-			inline Matrix::Matrix(const DirectX::XMFLOAT4X3& M)
+			inline Matrix(const DirectX::XMFLOAT4X3& M)
 			{
 				_11 = M._11; _12 = M._12; _13 = M._13; _14 = 0.f;
 				_21 = M._21; _22 = M._22; _23 = M._23; _24 = 0.f;
@@ -131,8 +132,8 @@ namespace Utility
 			}
 
 			// Assignment operators
-			Matrix& operator= (const Matrix& M) { memcpy_s(this, sizeof(float) * 16, &M, sizeof(float) * 16); return *this; }
-			Matrix& operator= (const XMFLOAT4X4& M) { memcpy_s(this, sizeof(float) * 16, &M, sizeof(XMFLOAT4X4)); return *this; }
+			Matrix& operator= (const Matrix& M) { std::memcpy(this, &M, sizeof(float) * 16); return *this; }
+			Matrix& operator= (const XMFLOAT4X4& M) { std::memcpy(this, &M, sizeof(XMFLOAT4X4)); return *this; }
 
 			inline Matrix& operator= (const DirectX::XMFLOAT3X3& M)
 			{
@@ -305,13 +306,13 @@ namespace Utility
 				return R;
 			}
 
-			inline const float* Matrix::operator[](int i) const
+			inline const float* operator[](int i) const
 			{
 				assert(i >= 0 && i < 4);
 				return m[i];
 			}
 
-			inline float* Matrix::operator[](int i)
+			inline float* operator[](int i)
 			{
 				assert(i >= 0 && i < 4);
 				return m[i];
@@ -0,0 +1,144 @@
+﻿/**
+ *	@file	Noise.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Vector2f.h"
+#include "Vector3f.h"
+#include "../Span.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	namespace Math
+	{
+		/**
+		 *  @enum		eNoiseType
+		 *  @brief		ノイズの種類
+		 */
+		enum class eNoiseType
+		{
+			Value,		//	!<	格子点の値を補間する(ブロック状の模様が出やすい)
+			Perlin,		//	!<	格子点の勾配を補間する
+			Simplex,	//	!<	単体の頂点の勾配を足し合わせる(格子の向きが目立ちにくい)
+		};
+
+		/**
+		 *  @enum		eFractal
+		 *  @brief		オクターブの重ね方
+		 */
+		enum class eFractal
+		{
+			Fbm,		//	!<	そのまま重ねる。おおよそ[-1, 1]
+			Ridged,		//	!<	(1 - |ノイズ|)^2を重ねる(尾根状の模様)。[0, 1]
+		};
+
+		/**
+		 *  @struct		NoiseSettings
+		 *  @brief		ノイズの設定(octavesが1ならノイズそのもの)
+		 */
+		struct NoiseSettings
+		{
+			eNoiseType	type = eNoiseType::Perlin;
+			eFractal	fractal = eFractal::Fbm;
+			uint32_t	octaves = 1;		//	!<	重ねる数(1以上)
+			float		frequency = 1.f;	//	!<	1オクターブ目の座標に掛ける値
+			float		lacunarity = 2.f;	//	!<	オクターブごとに周波数に掛ける値
+			float		gain = 0.5f;		//	!<	オクターブごとに振幅に掛ける値
+		};
+
+		/**
+		 *  @class		Noise
+		 *  @brief		シードを持つValue、Perlin、Simplexノイズ(1点ずつとSpanでまとめて計算する版)
+		 *  @note		格子点の乱数は座標とシードのハッシュで作るので、同じシードなら命令セットやスレッド数によらずビット単位で同じ結果になる。
+		 *				Noise.cppではa * b + cをFMAにまとめさせないので、/arch:AVX2や-mfmaで作っても変わらない(Tests/Math/NoiseTest.cppで確認)。
+		 *				まとめて計算する版はAVX2/SSE2で8/4点ずつ処理し、ThreadPoolを渡すとParallelGrain個ずつに分けて並列に処理する。
+		 *				ノイズの値はおおよそ[-1, 1]。座標は|x| < 2^31であること。
+		 *				オクターブごとにシードをずらすので、原点付近でもオクターブ同士が揃わない。
+		 */
+		class Noise final
+		{
+		public:
+			static const uint64_t DefaultSeed = 0x853c49e6748fea9bull;
+			static const size_t ParallelGrain = 4096;	//	!<	並列に処理するときの1塊の要素数
+
+		private:
+			uint32_t	seed_;
+
+		public:
+			explicit Noise(uint64_t argSeed = DefaultSeed) { Seed(argSeed); }
+
+		public:
+			/**
+			 *	@fn			Seed
+			 *	@brief		シードを設定する
+			 *	@param[in]	argSeed	!<	シード
+			 */
+			void Seed(uint64_t argSeed);
+
+#pragma region	Scalar
+			float Value(float argX, float argY) const;
+			float Value(float argX, float argY, float argZ) const;
+			float Value(float argX, float argY, float argZ, float argW) const;
+			float Perlin(float argX, float argY) const;
+			float Perlin(float argX, float argY, float argZ) const;
+			float Perlin(float argX, float argY, float argZ, float argW) const;
+			float Simplex(float argX, float argY) const;
+			float Simplex(float argX, float argY, float argZ) const;
+			float Simplex(float argX, float argY, float argZ, float argW) const;
+
+			/**
+			 *	@fn			Fractal
+			 *	@brief		設定どおりにオクターブを重ねた値
+			 *	@param[in]	argSettings	!<	設定
+			 *	@param[in]	argX		!<	x座標
+			 *	@param[in]	argY		!<	y座標
+			 */
+			float Fractal(const NoiseSettings &argSettings, float argX, float argY) const;
+			float Fractal(const NoiseSettings &argSettings, float argX, float argY, float argZ) const;
+			float Fractal(const NoiseSettings &argSettings, float argX, float argY, float argZ, float argW) const;
+#pragma endregion	Scalar
+
+#pragma region	Batch
+			/**
+			 *	@fn			Evaluate
+			 *	@brief		成分ごとの配列で渡した点をまとめて計算する
+			 *	@param[in]	argSettings	!<	設定
+			 *	@param[in]	argX		!<	x座標
+			 *	@param[in]	argY		!<	y座標(argXと同じ要素数以上)
+			 *	@param[out]	argDst		!<	値(argXと同じ要素数以上)
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			void Evaluate(const NoiseSettings &argSettings, Span<const float> argX, Span<const float> argY, Span<float> argDst, ThreadPool *argPool = nullptr) const;
+			void Evaluate(const NoiseSettings &argSettings, Span<const float> argX, Span<const float> argY, Span<const float> argZ, Span<float> argDst, ThreadPool *argPool = nullptr) const;
+			void Evaluate(const NoiseSettings &argSettings, Span<const float> argX, Span<const float> argY, Span<const float> argZ, Span<const float> argW, Span<float> argDst, ThreadPool *argPool = nullptr) const;
+
+			/**
+			 *	@fn			Grid
+			 *	@brief		等間隔の格子の各点をまとめて計算する(行優先でargDst[y * argWidth + x])
+			 *	@param[in]	argSettings	!<	設定
+			 *	@param[out]	argDst		!<	値(argWidth * argHeight要素以上)
+			 *	@param[in]	argWidth	!<	x方向の点の数
+			 *	@param[in]	argHeight	!<	y方向の点の数
+			 *	@param[in]	argOrigin	!<	最初の点の座標
+			 *	@param[in]	argStep		!<	点の間隔
+			 *	@param[in]	argPool		!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			void Grid(const NoiseSettings &argSettings, Span<float> argDst, size_t argWidth, size_t argHeight, const Vector2 &argOrigin, const Vector2 &argStep, ThreadPool *argPool = nullptr) const;
+			/**
+			 *	@fn			Grid
+			 *	@brief		等間隔の3次元の格子の各点をまとめて計算する(argDst[(z * argHeight + y) * argWidth + x])
+			 *	@param[in]	argDepth	!<	z方向の点の数
+			 */
+			void Grid(const NoiseSettings &argSettings, Span<float> argDst, size_t argWidth, size_t argHeight, size_t argDepth, const Vector3 &argOrigin, const Vector3 &argStep, ThreadPool *argPool = nullptr) const;
+#pragma endregion	Batch
+		};
+	}
+}
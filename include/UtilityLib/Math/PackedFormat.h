@@ -0,0 +1,122 @@
+﻿/**
+ *	@file	PackedFormat.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Vector3f.h"
+#include "../Span.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	namespace Math
+	{
+		/**
+		 *  @struct		PackedNormal
+		 *  @brief		八面体写像で2成分にした法線(DXGI_FORMAT_R16G16_SNORMとしてそのまま頂点に置ける)
+		 */
+		struct PackedNormal
+		{
+			std::int16_t x;
+			std::int16_t y;
+		};
+		static_assert(sizeof(PackedNormal) == sizeof(std::int32_t), "PackedNormal must be 4 bytes...");
+
+		/**
+		 *  @class		PackedFormat
+		 *  @brief		頂点データを小さい形式に詰め替える変換(1要素ずつとSpanでまとめて変換する版)
+		 *  @note		まとめて変換する版はAVX2/SSE2で8/4要素ずつ処理し、ThreadPoolを渡すとParallelGrain個ずつに分けて並列に処理する。
+		 *				どの命令セットでも1要素ずつの版とビット単位で同じ結果になる。
+		 *				Half	!<	IEEE 754の半精度。最近接偶数に丸め、範囲外は無限大、NaNはNaNにする(NaN以外はF16Cの命令と同じ結果。半精度からはNaNの仮数をそのまま残す)
+		 *				Norm	!<	整数の型で形式が決まる(int8_t/int16_tはSNORM、uint8_t/uint16_tはUNORM)。
+		 *						範囲外は丸め、NaNは範囲の下限になる。SNORMの最小値は-1に戻す
+		 *				Octahedral	!<	単位ベクトルを八面体に写して2成分のSNORM16にする。往復の角度の誤差は6.5e-5ラジアン以下。
+		 *							長さ0のベクトルは(0, 0, 1)に戻る
+		 */
+		class PackedFormat final
+		{
+		public:
+			static const size_t ParallelGrain = 16384;	//	!<	並列に処理するときの1塊の要素数
+
+		public:
+			static std::uint16_t FloatToHalf(float argValue);
+			static float HalfToFloat(std::uint16_t argValue);
+			/**
+			 *	@fn			EncodeOctahedral
+			 *	@brief		法線を八面体写像で詰める
+			 *	@param[in]	argNormal	!<	法線(正規化していなくてもよい)
+			 */
+			static PackedNormal EncodeOctahedral(const Vector3 &argNormal);
+			/**
+			 *	@fn			DecodeOctahedral
+			 *	@brief		八面体写像で詰めた法線を正規化した法線に戻す
+			 */
+			static Vector3 DecodeOctahedral(PackedNormal argPacked);
+
+		public:
+			/**
+			 *	@fn			FloatToHalf
+			 *	@brief		半精度にまとめて変換する
+			 *	@param[in]	argSrc	!<	値
+			 *	@param[out]	argDst	!<	半精度のビット列(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void FloatToHalf(Span<const float> argSrc, Span<std::uint16_t> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			HalfToFloat
+			 *	@brief		半精度からまとめて変換する
+			 *	@param[in]	argSrc	!<	半精度のビット列
+			 *	@param[out]	argDst	!<	値(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void HalfToFloat(Span<const std::uint16_t> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+
+			/**
+			 *	@fn			FloatToNorm
+			 *	@brief		正規化整数にまとめて変換する(SNORMは[-1, 1]、UNORMは[0, 1]に丸めてから量子化する)
+			 *	@param[in]	argSrc	!<	値
+			 *	@param[out]	argDst	!<	正規化整数(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void FloatToNorm(Span<const float> argSrc, Span<std::int8_t> argDst, ThreadPool *argPool = nullptr);
+			static void FloatToNorm(Span<const float> argSrc, Span<std::int16_t> argDst, ThreadPool *argPool = nullptr);
+			static void FloatToNorm(Span<const float> argSrc, Span<std::uint8_t> argDst, ThreadPool *argPool = nullptr);
+			static void FloatToNorm(Span<const float> argSrc, Span<std::uint16_t> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			NormToFloat
+			 *	@brief		正規化整数からまとめて変換する
+			 *	@param[in]	argSrc	!<	正規化整数
+			 *	@param[out]	argDst	!<	値(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void NormToFloat(Span<const std::int8_t> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+			static void NormToFloat(Span<const std::int16_t> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+			static void NormToFloat(Span<const std::uint8_t> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+			static void NormToFloat(Span<const std::uint16_t> argSrc, Span<float> argDst, ThreadPool *argPool = nullptr);
+
+			/**
+			 *	@fn			EncodeOctahedral
+			 *	@brief		法線をまとめて八面体写像で詰める
+			 *	@param[in]	argSrc	!<	法線(正規化していなくてもよい)
+			 *	@param[out]	argDst	!<	詰めた法線(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void EncodeOctahedral(Span<const Vector3> argSrc, Span<PackedNormal> argDst, ThreadPool *argPool = nullptr);
+			/**
+			 *	@fn			DecodeOctahedral
+			 *	@brief		八面体写像で詰めた法線をまとめて戻す
+			 *	@param[in]	argSrc	!<	詰めた法線
+			 *	@param[out]	argDst	!<	正規化した法線(argSrcと同じ要素数以上)
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			static void DecodeOctahedral(Span<const PackedNormal> argSrc, Span<Vector3> argDst, ThreadPool *argPool = nullptr);
+		};
+	}
+}
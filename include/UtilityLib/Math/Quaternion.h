@@ -7,7 +7,7 @@
  */
 #pragma once
 
-#include <DirectXMath.h>
+#include "MathConfig.h"
 #include <functional>
 
 namespace Utility
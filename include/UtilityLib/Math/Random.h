@@ -0,0 +1,300 @@
+﻿/**
+ *	@file	Random.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "FastMath.h"
+#include "../Span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <assert.h>
+
+namespace Utility
+{
+	namespace Math
+	{
+		/**
+		 *  @class		Xoshiro256
+		 *  @brief		xoshiro256**による疑似乱数生成(周期2^256 - 1)
+		 *  @note		インスタンスごとに状態を持つので、スレッドごとに別のインスタンスを使う。
+		 *				std::のUniformRandomBitGeneratorの要件を満たすので、std::の分布にも渡せる。
+		 */
+		class Xoshiro256 final
+		{
+		public:
+			using result_type = uint64_t;
+			static const uint64_t DefaultSeed = 0x853c49e6748fea9bull;
+
+		private:
+			uint64_t	s_[4];
+
+		public:
+			explicit Xoshiro256(uint64_t argSeed = DefaultSeed) { Seed(argSeed); }
+
+		public:
+			/**
+			 *	@fn			Seed
+			 *	@brief		シードから状態を作り直す(SplitMix64で4つに広げる)
+			 *	@param[in]	argSeed	!<	シード
+			 */
+			void Seed(uint64_t argSeed);
+			/**
+			 *	@fn			Jump
+			 *	@brief		2^128回分進める(並列に使う生成器を重ならないように作る)
+			 */
+			void Jump();
+			/**
+			 *	@fn			LongJump
+			 *	@brief		2^192回分進める
+			 */
+			void LongJump();
+
+			inline uint64_t Next()
+			{
+				const uint64_t Result = Rotl(s_[1] * 5, 7) * 9;
+				const uint64_t T = s_[1] << 17;
+				s_[2] ^= s_[0];
+				s_[3] ^= s_[1];
+				s_[1] ^= s_[2];
+				s_[0] ^= s_[3];
+				s_[2] ^= T;
+				s_[3] = Rotl(s_[3], 45);
+				return Result;
+			}
+			inline uint32_t NextUInt32() { return static_cast<uint32_t>(Next() >> 32); }
+
+			/**
+			 *	@fn			SetState
+			 *	@brief		状態を設定する(保存した状態から再開する)
+			 *	@param[in]	argState	!<	4要素の状態(全て0は不可)
+			 */
+			inline void SetState(const uint64_t *argState)
+			{
+				assert((argState[0] | argState[1] | argState[2] | argState[3]) != 0 && "Xoshiro256 state must not be all zero...");
+				for (int i = 0; i < 4; ++i)
+					s_[i] = argState[i];
+			}
+			inline const uint64_t *State() const { return s_; }
+
+		public:
+			static constexpr result_type min() { return 0; }
+			static constexpr result_type max() { return UINT64_MAX; }
+			inline result_type operator()() { return Next(); }
+
+		private:
+			static inline uint64_t Rotl(uint64_t argValue, int argShift) { return (argValue << argShift) | (argValue >> (64 - argShift)); }
+		};
+
+		/**
+		 *  @class		Pcg32
+		 *  @brief		PCG(XSH RR 64/32)による疑似乱数生成(周期2^64)
+		 *  @note		状態が小さく、Advanceで任意の回数を対数時間で進められる。
+		 *				ストリームが違えば同じシードでも別の列になる。
+		 */
+		class Pcg32 final
+		{
+		public:
+			using result_type = uint32_t;
+			static const uint64_t DefaultSeed = 0x853c49e6748fea9bull;
+
+		private:
+			static const uint64_t Multiplier = 6364136223846793005ull;
+
+		private:
+			uint64_t	state_;
+			uint64_t	increment_;
+
+		public:
+			explicit Pcg32(uint64_t argSeed = DefaultSeed, uint64_t argStream = 0) { Seed(argSeed, argStream); }
+
+		public:
+			/**
+			 *	@fn			Seed
+			 *	@brief		シードとストリームから状態を作り直す
+			 *	@param[in]	argSeed		!<	シード
+			 *	@param[in]	argStream	!<	ストリーム番号
+			 */
+			void Seed(uint64_t argSeed, uint64_t argStream = 0);
+			/**
+			 *	@fn			Advance
+			 *	@brief		argDelta回分進める
+			 *	@param[in]	argDelta	!<	進める回数
+			 */
+			void Advance(uint64_t argDelta);
+
+			inline uint32_t Next()
+			{
+				const uint64_t Old = state_;
+				state_ = Old * Multiplier + increment_;
+				const uint32_t XorShifted = static_cast<uint32_t>(((Old >> 18) ^ Old) >> 27);
+				const uint32_t Rot = static_cast<uint32_t>(Old >> 59);
+				return (XorShifted >> Rot) | (XorShifted << ((0u - Rot) & 31));
+			}
+			inline uint32_t NextUInt32() { return Next(); }
+
+		public:
+			static constexpr result_type min() { return 0; }
+			static constexpr result_type max() { return UINT32_MAX; }
+			inline result_type operator()() { return Next(); }
+		};
+
+		/**
+		 *  @class		Random
+		 *  @brief		乱数の分布
+		 *  @note		生成器はNextUInt32()を持つ型(Xoshiro256、Pcg32)
+		 */
+		class Random final
+		{
+		public:
+			/**
+			 *	@fn			Uniform
+			 *	@brief		[0, 1)の一様乱数(24bitの精度)
+			 *	@param[in,out]	argGenerator	!<	生成器
+			 */
+			template<typename TGenerator>
+			inline static float Uniform(TGenerator *argGenerator)
+			{
+				return ToUniform(argGenerator->NextUInt32());
+			}
+			/**
+			 *	@fn			Range
+			 *	@brief		[argMin, argMax)の一様乱数
+			 *	@param[in,out]	argGenerator	!<	生成器
+			 *	@param[in]		argMin			!<	最小値
+			 *	@param[in]		argMax			!<	最大値
+			 */
+			template<typename TGenerator>
+			inline static float Range(TGenerator *argGenerator, float argMin, float argMax)
+			{
+				return argMin + (argMax - argMin) * Uniform(argGenerator);
+			}
+			/**
+			 *	@fn			RangeInt
+			 *	@brief		[argMin, argMax]の偏りのない整数の一様乱数
+			 *	@param[in,out]	argGenerator	!<	生成器
+			 *	@param[in]		argMin			!<	最小値
+			 *	@param[in]		argMax			!<	最大値(含む)
+			 */
+			template<typename TGenerator>
+			static int32_t RangeInt(TGenerator *argGenerator, int32_t argMin, int32_t argMax)
+			{
+				assert(argMin <= argMax && "Random::RangeInt min is greater than max...");
+				const uint32_t Count = static_cast<uint32_t>(argMax) - static_cast<uint32_t>(argMin) + 1;
+				if (Count == 0)
+				{// 全域
+					return static_cast<int32_t>(argGenerator->NextUInt32());
+				}
+
+				// 掛け算で範囲に縮め、偏る分だけ引き直す(Lemire)
+				uint64_t product = static_cast<uint64_t>(argGenerator->NextUInt32()) * Count;
+				if (static_cast<uint32_t>(product) < Count)
+				{
+					const uint32_t Threshold = (0u - Count) % Count;
+					while (static_cast<uint32_t>(product) < Threshold)
+						product = static_cast<uint64_t>(argGenerator->NextUInt32()) * Count;
+				}
+				return static_cast<int32_t>(static_cast<uint32_t>(argMin) + static_cast<uint32_t>(product >> 32));
+			}
+			/**
+			 *	@fn			Normal
+			 *	@brief		正規分布の乱数(Box-Muller法)
+			 *	@param[in,out]	argGenerator	!<	生成器
+			 *	@param[in]		argMean			!<	平均
+			 *	@param[in]		argStdDev		!<	標準偏差
+			 */
+			template<typename TGenerator>
+			inline static float Normal(TGenerator *argGenerator, float argMean = 0.f, float argStdDev = 1.f)
+			{
+				const float U1 = 1.f - Uniform(argGenerator);
+				const float U2 = Uniform(argGenerator);
+				return argMean + argStdDev * std::sqrt(-2.f * FastMath<>::Log(U1)) * FastMath<>::Cos(6.28318530717958648f * U2);
+			}
+
+			/**
+			 *	@fn			ToUniform
+			 *	@brief		32bitの乱数を[0, 1)の実数にする
+			 */
+			inline static float ToUniform(uint32_t argBits)
+			{
+				return static_cast<float>(argBits >> 8) * (1.f / 16777216.f);
+			}
+		};
+
+		/**
+		 *  @class		RandomStream
+		 *  @brief		配列をまとめて埋める乱数生成(xoshiro256**を8本並べてAVX2/SSE2で同時に進める)
+		 *  @note		8本はシードから作ったXoshiro256を0～7回Jumpしたもの。命令セットによらず同じ列になる。
+		 *				1回で8本から64bitずつ、32bitの値なら16個を作り、端数は捨てる。
+		 *				並列に使う場合はSplitで作ったストリームをタスクごとに持たせる(どのスレッドで動いても同じ結果になる)。
+		 */
+		class RandomStream final
+		{
+		public:
+			static const size_t LaneCount = 8;
+			static const size_t BlockSize = LaneCount * 2;	//	!<	1回で作る32bitの値の数
+
+		private:
+			alignas(32) uint64_t s_[4][LaneCount];
+
+		public:
+			explicit RandomStream(uint64_t argSeed = Xoshiro256::DefaultSeed) { Seed(argSeed); }
+			explicit RandomStream(const Xoshiro256 &argGenerator) { Seed(argGenerator); }
+
+		public:
+			/**
+			 *	@fn			Seed
+			 *	@brief		シードから状態を作り直す
+			 *	@param[in]	argSeed		!<	シード
+			 */
+			void Seed(uint64_t argSeed);
+			/**
+			 *	@fn			Seed
+			 *	@brief		生成器の状態から作り直す
+			 *	@param[in]	argGenerator	!<	1本目にする生成器
+			 */
+			void Seed(const Xoshiro256 &argGenerator);
+			/**
+			 *	@fn			Split
+			 *	@brief		重ならない別のストリームを作る(自身は各本を2^192回分進める)
+			 *	@return		作ったストリーム
+			 */
+			RandomStream Split();
+
+			/**
+			 *	@fn			Fill
+			 *	@brief		32bitの乱数で埋める
+			 *	@param[out]	argDst	!<	埋める配列
+			 */
+			void Fill(Span<uint32_t> argDst);
+			/**
+			 *	@fn			FillUniform
+			 *	@brief		[argMin, argMax)の一様乱数で埋める
+			 *	@param[out]	argDst	!<	埋める配列
+			 *	@param[in]	argMin	!<	最小値
+			 *	@param[in]	argMax	!<	最大値
+			 */
+			void FillUniform(Span<float> argDst, float argMin = 0.f, float argMax = 1.f);
+			/**
+			 *	@fn			FillNormal
+			 *	@brief		正規分布の乱数で埋める(Box-Muller法。FastMath<>のLogとSinCosを使う)
+			 *	@param[out]	argDst		!<	埋める配列
+			 *	@param[in]	argMean		!<	平均
+			 *	@param[in]	argStdDev	!<	標準偏差
+			 */
+			void FillNormal(Span<float> argDst, float argMean = 0.f, float argStdDev = 1.f);
+
+		private:
+			/**
+			 *	@fn			NextBlock
+			 *	@brief		BlockSize個の32bitの乱数を作る
+			 *	@param[out]	argDst	!<	書き込み先(BlockSize個)
+			 */
+			void NextBlock(uint32_t *argDst);
+		};
+	}
+}
@@ -0,0 +1,163 @@
+﻿/**
+ *	@file	StreamBuffer.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace Utility
+{
+	namespace Math
+	{
+		/**
+		 *  @class		StreamBuffer
+		 *  @brief		成分ごとの配列(SoA)を1つの領域に並べて持つfloatの配列
+		 *  @note		Vector3StreamやQuaternionStreamの中身。
+		 *				各成分の配列の先頭はAlignmentに揃え、確保済みの要素数もそれに合わせて切り上げる。
+		 *	@tparam		N	!<	成分の数
+		 */
+		template<size_t N>
+		class StreamBuffer final
+		{
+			static_assert(N > 0, "StreamBuffer needs at least one component");
+
+		public:
+			static const size_t Alignment = 32;		//	!<	各成分の配列の先頭の境界
+
+		private:
+			float	*component_[N];
+			size_t	size_;
+			size_t	capacity_;
+
+		public:
+			StreamBuffer()
+				: component_(), size_(0), capacity_(0)
+			{
+			}
+			StreamBuffer(const StreamBuffer &argOther)
+				: StreamBuffer()
+			{
+				*this = argOther;
+			}
+			StreamBuffer(StreamBuffer &&argOther) noexcept
+				: StreamBuffer()
+			{
+				Swap(argOther);
+			}
+			~StreamBuffer()
+			{
+				if (component_[0] != nullptr)
+					::operator delete(component_[0], std::align_val_t(Alignment));
+			}
+
+			StreamBuffer &operator=(const StreamBuffer &argOther)
+			{
+				if (this == &argOther)
+					return *this;
+
+				size_ = 0;
+				Reserve(argOther.size_);
+				for (size_t i = 0; i < N; ++i)
+					std::copy_n(argOther.component_[i], argOther.size_, component_[i]);
+				size_ = argOther.size_;
+				return *this;
+			}
+			StreamBuffer &operator=(StreamBuffer &&argOther) noexcept
+			{
+				StreamBuffer Moved(std::move(argOther));
+				Swap(Moved);
+				return *this;
+			}
+
+		public:
+			/**
+			 *	@fn			Reserve
+			 *	@brief		確保済みの要素数を増やす(今の要素は残す)
+			 *	@param[in]	argCapacity	!<	確保する要素数
+			 */
+			void Reserve(size_t argCapacity)
+			{
+				if (argCapacity <= capacity_)
+					return;
+
+				const size_t Lanes = Alignment / sizeof(float);
+				const size_t Capacity = (argCapacity + Lanes - 1) / Lanes * Lanes;
+				float *data = static_cast<float*>(::operator new(sizeof(float) * Capacity * N, std::align_val_t(Alignment)));
+				if (component_[0] != nullptr)
+				{
+					for (size_t i = 0; i < N; ++i)
+						std::copy_n(component_[i], size_, data + Capacity * i);
+					::operator delete(component_[0], std::align_val_t(Alignment));
+				}
+				for (size_t i = 0; i < N; ++i)
+					component_[i] = data + Capacity * i;
+				capacity_ = Capacity;
+			}
+			/**
+			 *	@fn			Resize
+			 *	@brief		要素数を変える
+			 *	@param[in]	argCount	!<	要素数
+			 *	@param[in]	argFill		!<	増えた分に入れる成分ごとの値
+			 */
+			void Resize(size_t argCount, const float (&argFill)[N])
+			{
+				Reserve(argCount);
+				if (argCount > size_)
+				{
+					for (size_t i = 0; i < N; ++i)
+						std::fill(component_[i] + size_, component_[i] + argCount, argFill[i]);
+				}
+				size_ = argCount;
+			}
+			/**
+			 *	@fn			Assign
+			 *	@brief		中身を捨てて要素数を変える(値は呼んだ側が全部書き込む)
+			 *	@param[in]	argCount	!<	要素数
+			 */
+			void Assign(size_t argCount)
+			{
+				size_ = 0;
+				Reserve(argCount);
+				size_ = argCount;
+			}
+			/**
+			 *	@fn			Clear
+			 *	@brief		要素数を0にする(確保したメモリは残す)
+			 */
+			inline void Clear() { size_ = 0; }
+			/**
+			 *	@fn			Swap
+			 *	@brief		中身を入れ替える
+			 *	@param[in,out]	argOther	!<	入れ替える相手
+			 */
+			inline void Swap(StreamBuffer &argOther) noexcept
+			{
+				std::swap(component_, argOther.component_);
+				std::swap(size_, argOther.size_);
+				std::swap(capacity_, argOther.capacity_);
+			}
+
+		public:
+			inline size_t Size() const { return size_; }
+			inline size_t Capacity() const { return capacity_; }
+
+			inline float *Component(size_t argIndex)
+			{
+				assert(argIndex < N && "StreamBuffer component out of range...");
+				return component_[argIndex];
+			}
+			inline const float *Component(size_t argIndex) const
+			{
+				assert(argIndex < N && "StreamBuffer component out of range...");
+				return component_[argIndex];
+			}
+		};
+	}
+}
@@ -0,0 +1,151 @@
+﻿/**
+ *	@file	TransformHierarchy.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "Vector3Stream.h"
+#include "../Span.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Utility
+{
+	class ThreadPool;
+
+	namespace Math
+	{
+		/**
+		 *  @class		TransformHierarchy
+		 *  @brief		親子関係を持つ大量の姿勢からワールド行列をまとめて求める
+		 *  @note		ノードは親より後に追加する(親の番号 < 子の番号)。
+		 *				ローカルの姿勢(位置、回転、拡縮)は成分ごとの配列で持ち、
+		 *				Updateで ローカル(S * R * T) * 親のワールド を全ノード分1回で計算する。
+		 *				ローカルの行列を求めて親のワールド行列を掛けるまでを、AVX2/SSE2で8/4ノードずつまとめて計算する。
+		 *				ThreadPoolを渡さなければ番号順に処理する(8/4ノードの中に親子がいればその塊だけ1ノードずつ掛ける)。
+		 *				同じ深さのノードは互いに依存しないので、ThreadPoolを渡すと深さごとに並列に処理する。
+		 */
+		class TransformHierarchy final
+		{
+		public:
+			static const int32_t NoParent = -1;			//	!<	親を持たないノードの親番号
+			static const size_t ParallelGrain = 256;	//	!<	並列に処理するときの1塊のノード数
+
+		private:
+			std::vector<int32_t>	parents_;
+			Vector3Stream			position_;
+			Vector3Stream			scale_;
+			std::vector<float>		rotationX_;
+			std::vector<float>		rotationY_;
+			std::vector<float>		rotationZ_;
+			std::vector<float>		rotationW_;
+			std::vector<Matrix>		world_;
+			std::vector<uint32_t>	order_;			//	!<	深さ順に並べたノードの番号
+			std::vector<size_t>		levelBegin_;	//	!<	order_の中の各深さの先頭(末尾に総数)
+			bool					isOrderDirty_;
+
+		public:
+			TransformHierarchy();
+			~TransformHierarchy() = default;
+
+		public:
+			/**
+			 *	@fn			Add
+			 *	@brief		ノードの追加
+			 *	@param[in]	argParent	!<	親の番号(NoParentなら親なし。追加済みのノードであること)
+			 *	@param[in]	argPosition	!<	親から見た位置
+			 *	@param[in]	argRotation	!<	親から見た回転
+			 *	@param[in]	argScale	!<	拡縮
+			 *	@return		追加したノードの番号
+			 */
+			uint32_t Add(int32_t argParent, const Vector3 &argPosition, const Quaternion &argRotation = Quaternion::Identity, const Vector3 &argScale = Vector3(1.f));
+			/**
+			 *	@fn			Reserve
+			 *	@brief		ノードの領域を確保しておく
+			 *	@param[in]	argCapacity	!<	ノード数
+			 */
+			void Reserve(size_t argCapacity);
+			/**
+			 *	@fn			Clear
+			 *	@brief		全てのノードを消す
+			 */
+			void Clear();
+
+			/**
+			 *	@fn			Update
+			 *	@brief		全ノードのワールド行列を求める
+			 *	@param[in]	argPool	!<	並列に処理するプール(nullptrなら呼んだスレッドだけで処理する)
+			 */
+			void Update(ThreadPool *argPool = nullptr);
+
+		public:
+			inline size_t Size() const { return parents_.size(); }
+			inline int32_t Parent(size_t argIndex) const { return parents_[argIndex]; }
+
+			inline void SetPosition(size_t argIndex, const Vector3 &argPosition) { position_.Set(argIndex, argPosition); }
+			inline void SetScale(size_t argIndex, const Vector3 &argScale) { scale_.Set(argIndex, argScale); }
+			inline void SetRotation(size_t argIndex, const Quaternion &argRotation)
+			{
+				assert(argIndex < Size() && "TransformHierarchy index out of range...");
+				rotationX_[argIndex] = argRotation.x;
+				rotationY_[argIndex] = argRotation.y;
+				rotationZ_[argIndex] = argRotation.z;
+				rotationW_[argIndex] = argRotation.w;
+			}
+			inline Vector3 Position(size_t argIndex) const { return position_.Get(argIndex); }
+			inline Vector3 Scale(size_t argIndex) const { return scale_.Get(argIndex); }
+			inline Quaternion Rotation(size_t argIndex) const
+			{
+				assert(argIndex < Size() && "TransformHierarchy index out of range...");
+				return Quaternion(rotationX_[argIndex], rotationY_[argIndex], rotationZ_[argIndex], rotationW_[argIndex]);
+			}
+
+			/**
+			 *	@fn			SetPositions
+			 *	@brief		全ノードの位置をまとめて書き換える(Vector3Streamの演算の結果を入れる用)
+			 *	@param[in]	argPositions	!<	位置(ノード数と同じ要素数)
+			 */
+			void SetPositions(const Vector3Stream &argPositions);
+			/**
+			 *	@fn			SetScales
+			 *	@brief		全ノードの拡縮をまとめて書き換える
+			 *	@param[in]	argScales	!<	拡縮(ノード数と同じ要素数)
+			 */
+			void SetScales(const Vector3Stream &argScales);
+
+			/**
+			 *	@brief		成分ごとの配列(要素数はノード数のまま、値だけを書き換える用)
+			 */
+			inline const Vector3Stream &Positions() const { return position_; }
+			inline const Vector3Stream &Scales() const { return scale_; }
+			inline Span<float> PositionX() { return Span<float>(position_.X(), Size()); }
+			inline Span<float> PositionY() { return Span<float>(position_.Y(), Size()); }
+			inline Span<float> PositionZ() { return Span<float>(position_.Z(), Size()); }
+			inline Span<float> ScaleX() { return Span<float>(scale_.X(), Size()); }
+			inline Span<float> ScaleY() { return Span<float>(scale_.Y(), Size()); }
+			inline Span<float> ScaleZ() { return Span<float>(scale_.Z(), Size()); }
+			inline Span<float> RotationX() { return Span<float>(rotationX_.data(), Size()); }
+			inline Span<float> RotationY() { return Span<float>(rotationY_.data(), Size()); }
+			inline Span<float> RotationZ() { return Span<float>(rotationZ_.data(), Size()); }
+			inline Span<float> RotationW() { return Span<float>(rotationW_.data(), Size()); }
+
+			/**
+			 *	@brief		Updateで求めたワールド行列
+			 */
+			inline const Matrix &World(size_t argIndex) const { return world_[argIndex]; }
+			inline Span<const Matrix> WorldMatrices() const { return Span<const Matrix>(world_.data(), world_.size()); }
+
+		private:
+			/**
+			 *	@fn			BuildOrder
+			 *	@brief		ノードを深さ順に並べ直す
+			 */
+			void BuildOrder();
+		};
+	}
+}
@@ -0,0 +1,140 @@
+﻿/**
+ *	@file	Vector4A.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "Vector4f.h"
+
+namespace Utility
+{
+	namespace Math
+	{
+		/**
+		 *  @struct		Vector4A
+		 *  @brief		XMVECTORのまま持つVector4(16byte境界)
+		 *  @note		何度も演算する処理ではこちらで受けて最後にVector4へ戻す。Vector4との変換は明示的に行う。
+		 */
+		struct alignas(16) Vector4A
+		{
+		public:
+			DirectX::XMVECTOR v;
+
+		public:
+			Vector4A() : v(DirectX::XMVectorZero()) {}
+			explicit Vector4A(float x) : v(DirectX::XMVectorReplicate(x)) {}
+			Vector4A(float _x, float _y, float _z, float _w) : v(DirectX::XMVectorSet(_x, _y, _z, _w)) {}
+			explicit Vector4A(_In_reads_(4) const float *pArray) : v(DirectX::XMLoadFloat4(reinterpret_cast<const DirectX::XMFLOAT4*>(pArray))) {}
+			Vector4A(DirectX::FXMVECTOR V) : v(V) {}
+			explicit Vector4A(const DirectX::XMFLOAT4& V) : v(DirectX::XMLoadFloat4(&V)) {}
+
+		public:
+#pragma region	Operator
+			operator DirectX::XMVECTOR() const { return v; }
+			explicit operator Vector4() const { return Vector4(v); }
+
+			inline bool operator == (const Vector4A& V) const { return DirectX::XMVector4Equal(v, V.v); }
+			inline bool operator != (const Vector4A& V) const { return DirectX::XMVector4NotEqual(v, V.v); }
+
+			inline Vector4A& operator+= (const Vector4A& V)
+			{
+				v = DirectX::XMVectorAdd(v, V.v);
+				return *this;
+			}
+			inline Vector4A& operator-= (const Vector4A& V)
+			{
+				v = DirectX::XMVectorSubtract(v, V.v);
+				return *this;
+			}
+			inline Vector4A& operator*= (const Vector4A& V)
+			{
+				v = DirectX::XMVectorMultiply(v, V.v);
+				return *this;
+			}
+			inline Vector4A& operator*= (float S)
+			{
+				v = DirectX::XMVectorScale(v, S);
+				return *this;
+			}
+			inline Vector4A& operator/= (float S)
+			{
+				assert(S != 0.0f);
+				v = DirectX::XMVectorScale(v, 1.f / S);
+				return *this;
+			}
+
+			Vector4A operator+ () const { return *this; }
+			inline Vector4A operator- () const { return Vector4A(DirectX::XMVectorNegate(v)); }
+#pragma endregion	Operator
+
+		public:
+			inline float X() const { return DirectX::XMVectorGetX(v); }
+			inline float Y() const { return DirectX::XMVectorGetY(v); }
+			inline float Z() const { return DirectX::XMVectorGetZ(v); }
+			inline float W() const { return DirectX::XMVectorGetW(v); }
+			inline void X(float argX) { v = DirectX::XMVectorSetX(v, argX); }
+			inline void Y(float argY) { v = DirectX::XMVectorSetY(v, argY); }
+			inline void Z(float argZ) { v = DirectX::XMVectorSetZ(v, argZ); }
+			inline void W(float argW) { v = DirectX::XMVectorSetW(v, argW); }
+			/**
+			 *	@fn			Store
+			 *	@brief		XMFLOAT4に書き出す
+			 */
+			inline void Store(DirectX::XMFLOAT4 *argDst) const { DirectX::XMStoreFloat4(argDst, v); }
+
+			inline bool InBounds(const Vector4A& Bounds) const { return DirectX::XMVector4InBounds(v, Bounds.v); }
+			inline float Length() const { return DirectX::XMVectorGetX(DirectX::XMVector4Length(v)); }
+			inline float LengthSquared() const { return DirectX::XMVectorGetX(DirectX::XMVector4LengthSq(v)); }
+			inline float Dot(const Vector4A& V) const { return DirectX::XMVectorGetX(DirectX::XMVector4Dot(v, V.v)); }
+			inline void Cross(const Vector4A& v1, const Vector4A& v2, Vector4A& result) const { result.v = DirectX::XMVector4Cross(v, v1.v, v2.v); }
+			inline Vector4A Cross(const Vector4A& v1, const Vector4A& v2) const { return Vector4A(DirectX::XMVector4Cross(v, v1.v, v2.v)); }
+			inline void Normalize() { v = DirectX::XMVector4Normalize(v); }
+			inline void Normalize(Vector4A& result) const { result.v = DirectX::XMVector4Normalize(v); }
+
+			inline static float Distance(const Vector4A& v1, const Vector4A& v2)
+			{
+				using namespace DirectX;
+				return XMVectorGetX(XMVector4Length(XMVectorSubtract(v2.v, v1.v)));
+			}
+			inline static float DistanceSquared(const Vector4A& v1, const Vector4A& v2)
+			{
+				using namespace DirectX;
+				return XMVectorGetX(XMVector4LengthSq(XMVectorSubtract(v2.v, v1.v)));
+			}
+			inline static void Min(const Vector4A& v1, const Vector4A& v2, Vector4A& result) { result.v = DirectX::XMVectorMin(v1.v, v2.v); }
+			inline static Vector4A Min(const Vector4A& v1, const Vector4A& v2) { return Vector4A(DirectX::XMVectorMin(v1.v, v2.v)); }
+			inline static void Max(const Vector4A& v1, const Vector4A& v2, Vector4A& result) { result.v = DirectX::XMVectorMax(v1.v, v2.v); }
+			inline static Vector4A Max(const Vector4A& v1, const Vector4A& v2) { return Vector4A(DirectX::XMVectorMax(v1.v, v2.v)); }
+			inline static void Lerp(const Vector4A& v1, const Vector4A& v2, float t, Vector4A& result) { result.v = DirectX::XMVectorLerp(v1.v, v2.v, t); }
+			inline static Vector4A Lerp(const Vector4A& v1, const Vector4A& v2, float t) { return Vector4A(DirectX::XMVectorLerp(v1.v, v2.v, t)); }
+
+			/**
+			 *	@fn			Transform
+			 *	@brief		xyzを回転する(wはそのまま)
+			 */
+			inline static Vector4A Transform(const Vector4A& V, const Quaternion& quat)
+			{
+				using namespace DirectX;
+				const XMVECTOR Rotated = XMVector3Rotate(V.v, XMLoadFloat4(&quat));
+				return Vector4A(XMVectorSelect(V.v, Rotated, g_XMSelect1110));
+			}
+			inline static Vector4A Transform(const Vector4A& V, const Matrix& m) { return Transform(V, DirectX::XMLoadFloat4x4(&m)); }
+			/**
+			 *	@fn			Transform
+			 *	@brief		読み込み済みの行列で変換する(同じ行列で何度も変換するとき用)
+			 */
+			inline static Vector4A Transform(const Vector4A& V, DirectX::FXMMATRIX M) { return Vector4A(DirectX::XMVector4Transform(V.v, M)); }
+		};
+
+		inline Vector4A operator+ (const Vector4A& V1, const Vector4A& V2) { return Vector4A(DirectX::XMVectorAdd(V1.v, V2.v)); }
+		inline Vector4A operator- (const Vector4A& V1, const Vector4A& V2) { return Vector4A(DirectX::XMVectorSubtract(V1.v, V2.v)); }
+		inline Vector4A operator* (const Vector4A& V1, const Vector4A& V2) { return Vector4A(DirectX::XMVectorMultiply(V1.v, V2.v)); }
+		inline Vector4A operator* (const Vector4A& V, float S) { return Vector4A(DirectX::XMVectorScale(V.v, S)); }
+		inline Vector4A operator/ (const Vector4A& V1, const Vector4A& V2) { return Vector4A(DirectX::XMVectorDivide(V1.v, V2.v)); }
+		inline Vector4A operator* (float S, const Vector4A& V) { return Vector4A(DirectX::XMVectorScale(V.v, S)); }
+	};
+};
@@ -9,6 +9,8 @@
 #include <memory>
 #include <string>
 
+#include "../String/Atom.h"
+
 namespace Utility
 {
 	/**
@@ -52,12 +54,25 @@ namespace Utility
 		 *	@param[in]	argType	再生形式
 		 */
 		void PlaySounds(std::string argKey, eSoundType argType)const;
+		/**
+		 *	@fn			PlaySounds
+		 *	@brief		サウンドの再生
+		 *	@param[in]	argKey	再生したいサウンドのキー
+		 *	@param[in]	argType	再生形式
+		 */
+		void PlaySounds(Atom argKey, eSoundType argType)const;
 		/**
 		 *	@fn			StopSounds
 		 *	@brief		サウンドの停止
 		 *	@param[in]	argKey	停止したいサウンドのキー
 		 */
 		void StopSounds(std::string argKey)const;
+		/**
+		 *	@fn			StopSounds
+		 *	@brief		サウンドの停止
+		 *	@param[in]	argKey	停止したいサウンドのキー
+		 */
+		void StopSounds(Atom argKey)const;
 		/**
 		 *	@fn			StopCurrentBgm
 		 *	@brief		現在再生しているサウンドの停止
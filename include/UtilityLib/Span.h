@@ -0,0 +1,96 @@
+﻿/**
+ *	@file	Span.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <assert.h>
+
+namespace Utility
+{
+	/**
+	 *  @class		Span
+	 *  @brief		連続したメモリ領域への所有権を持たない参照(std::spanの代用)
+	 */
+	template<typename T>
+	class Span final
+	{
+	private:
+		T *data_;
+		size_t size_;
+
+	public:
+		Span()
+			: data_(nullptr), size_(0)
+		{
+		}
+		/**
+		 *	@constructor	Span
+		 *	@brief			先頭ポインタと要素数から作る
+		 *	@param[in]		argData	!<	先頭ポインタ
+		 *	@param[in]		argSize	!<	要素数
+		 */
+		Span(T *argData, size_t argSize)
+			: data_(argData), size_(argSize)
+		{
+		}
+		/**
+		 *	@constructor	Span
+		 *	@brief			配列から作る
+		 *	@param[in]		argArray	!<	配列
+		 */
+		template<size_t N>
+		Span(T (&argArray)[N])
+			: data_(argArray), size_(N)
+		{
+		}
+		/**
+		 *	@constructor	Span
+		 *	@brief			data()とsize()を持つコンテナ(std::vector等)から作る
+		 *	@param[in]		argContainer	!<	コンテナ
+		 */
+		template<typename Container, typename = decltype(static_cast<T*>(std::declval<Container&>().data()))>
+		Span(Container &argContainer)
+			: data_(argContainer.data()), size_(argContainer.size())
+		{
+		}
+		/**
+		 *	@constructor	Span
+		 *	@brief			Span<U>からの変換(Span<T>→Span<const T>)
+		 */
+		template<typename U, typename = decltype(static_cast<T*>(std::declval<U*>()))>
+		Span(const Span<U> &argOther)
+			: data_(argOther.data()), size_(argOther.size())
+		{
+		}
+
+	public:
+		inline T *data() const { return data_; }
+		inline size_t size() const { return size_; }
+		inline bool empty() const { return size_ == 0; }
+		inline T *begin() const { return data_; }
+		inline T *end() const { return data_ + size_; }
+
+		inline T &operator[](size_t argIndex) const
+		{
+			assert(argIndex < size_ && "Span index out of range...");
+			return data_[argIndex];
+		}
+		/**
+		 *	@fn			Sub
+		 *	@brief		部分範囲の取得
+		 *	@param[in]	argOffset	!<	開始位置
+		 *	@param[in]	argCount	!<	要素数
+		 *	@return		部分範囲
+		 */
+		inline Span Sub(size_t argOffset, size_t argCount) const
+		{
+			assert(argOffset + argCount <= size_ && "Span range out of range...");
+			return Span(data_ + argOffset, argCount);
+		}
+	};
+}
@@ -0,0 +1,172 @@
+﻿/**
+ *	@file	Atom.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Utility
+{
+	/**
+	 *  @class		Atom
+	 *  @brief		AtomTableに登録した文字列の識別子
+	 *  @note		同じ文字列からは必ず同じ値になるので、比較やハッシュは整数として行える。
+	 *				空文字列と未登録の文字列は無効な値(0)になる。
+	 *				ワイド文字列は区別を失わないようにUTF-8で登録するので、ASCIIだけの名前は狭い文字列と同じ識別子になり、
+	 *				それ以外はShift-JISの狭い文字列とは別の識別子になる(Nameもその名前はUTF-8で返す)
+	 */
+	class Atom final
+	{
+	public:
+		static const uint32_t InvalidId = 0;
+
+	private:
+		uint32_t id_;
+
+	public:
+		constexpr Atom() : id_(InvalidId) {}
+		constexpr explicit Atom(uint32_t argId) : id_(argId) {}
+		/**
+		 *  @constructor	Atom
+		 *  @brief			文字列を登録して識別子を得る
+		 *	@param[in]		argName	!<	文字列
+		 */
+		explicit Atom(std::string_view argName);
+		/**
+		 *  @constructor	Atom
+		 *  @brief			ワイド文字列を登録して識別子を得る
+		 *	@param[in]		argName	!<	ワイド文字列(UTF-8にしてから登録する)
+		 */
+		explicit Atom(std::wstring_view argName);
+		explicit Atom(const char *argName) : Atom(std::string_view(argName)) {}
+		explicit Atom(const wchar_t *argName) : Atom(std::wstring_view(argName)) {}
+		explicit Atom(const std::string &argName) : Atom(std::string_view(argName)) {}
+		explicit Atom(const std::wstring &argName) : Atom(std::wstring_view(argName)) {}
+
+	public:
+		/**
+		 *  @fn			Id
+		 *  @brief		識別子の値
+		 *  @return		識別子の値
+		 */
+		constexpr uint32_t Id() const { return id_; }
+		/**
+		 *  @fn			IsValid
+		 *  @brief		有効な識別子か
+		 *	@retval		true	!<	有効
+		 *	@retval		false	!<	無効
+		 */
+		constexpr bool IsValid() const { return id_ != InvalidId; }
+		/**
+		 *  @fn			Name
+		 *  @brief		登録した文字列
+		 *  @return		文字列(無効な識別子なら空)
+		 */
+		std::string_view Name() const;
+
+	public:
+		constexpr bool operator==(Atom argOther) const { return id_ == argOther.id_; }
+		constexpr bool operator!=(Atom argOther) const { return id_ != argOther.id_; }
+		constexpr bool operator<(Atom argOther) const { return id_ < argOther.id_; }
+	};
+
+	/**
+	 *  @class		AtomTable
+	 *  @brief		文字列を識別子に変換する表(スレッドセーフ)
+	 *  @note		登録した文字列は一度だけ保存され、表が破棄されるまで移動しない
+	 */
+	class AtomTable final
+	{
+	private:
+		static const size_t BlockSize = 4096;
+
+	private:
+		mutable std::shared_mutex						mutex_;
+		std::unordered_map<std::string_view, uint32_t>	ids_;		//	!<	文字列→識別子
+		std::deque<std::string_view>					names_;		//	!<	識別子→文字列(先頭は無効な識別子)
+		std::vector<std::unique_ptr<char[]>>			blocks_;	//	!<	文字列の保存先
+		size_t											blockUsed_;	//	!<	最後のブロックの使用量
+
+	private:
+		/**
+		 *  @fn			Store
+		 *  @brief		文字列を保存先にコピーする
+		 *  @param[in]	argName	!<	文字列
+		 *  @return		コピーした文字列
+		 */
+		std::string_view Store(std::string_view argName);
+
+	public:
+		AtomTable();
+		~AtomTable() = default;
+		AtomTable(const AtomTable&) = delete;
+		AtomTable &operator=(const AtomTable&) = delete;
+
+	public:
+		/**
+		 *  @fn			Intern
+		 *  @brief		文字列を登録する
+		 *  @param[in]	argName	!<	文字列
+		 *  @return		識別子(登録済みなら同じ識別子)
+		 */
+		Atom Intern(std::string_view argName);
+		/**
+		 *  @fn			Intern
+		 *  @brief		ワイド文字列をUTF-8にして登録する
+		 *  @param[in]	argName	!<	ワイド文字列
+		 *  @return		識別子(登録済みなら同じ識別子)
+		 */
+		Atom Intern(std::wstring_view argName);
+		/**
+		 *  @fn			Find
+		 *  @brief		登録せずに識別子を探す
+		 *  @param[in]	argName	!<	文字列
+		 *  @return		識別子(未登録なら無効な識別子)
+		 */
+		Atom Find(std::string_view argName) const;
+		/**
+		 *  @fn			Find
+		 *  @brief		登録せずにワイド文字列の識別子を探す
+		 *  @param[in]	argName	!<	ワイド文字列
+		 *  @return		識別子(未登録なら無効な識別子)
+		 */
+		Atom Find(std::wstring_view argName) const;
+		/**
+		 *  @fn			Name
+		 *  @brief		識別子の文字列
+		 *  @param[in]	argAtom	!<	識別子
+		 *  @return		文字列(無効な識別子なら空)
+		 */
+		std::string_view Name(Atom argAtom) const;
+		/**
+		 *  @fn			Size
+		 *  @brief		登録した文字列の数
+		 *  @return		文字列の数
+		 */
+		size_t Size() const;
+	};
+}
+
+namespace std
+{
+	template<>
+	struct hash<Utility::Atom>
+	{
+		size_t operator()(Utility::Atom argAtom) const noexcept
+		{
+			// 識別子は連番なので、そのままでもバケットに偏りなく散らばる
+			return static_cast<size_t>(argAtom.Id());
+		}
+	};
+}
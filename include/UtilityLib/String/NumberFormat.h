@@ -0,0 +1,112 @@
+﻿/**
+ *	@file	NumberFormat.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include <string_view>
+
+namespace Utility
+{
+	/**
+	 *  @class		NumberFormat
+	 *  @brief		確保しない数値の文字列化と解析(to_chars / from_chars)
+	 *  @note		書き込み先が足りない場合は空の文字列を返す。返す文字列は終端文字付き
+	 */
+	class NumberFormat final
+	{
+	public:
+		static const size_t IntegerBufferSize = 32;	//	!<	64bit整数を区切り文字付きで書き込める大きさ
+		static const size_t FloatBufferSize = 64;	//	!<	桁数指定なしの実数を区切り文字付きで書き込める大きさ
+
+	public:
+		/**
+		 *	@fn			FormatInt
+		 *	@brief		整数の文字列化
+		 *	@param[in]	argValue		!<	値
+		 *	@param[out]	argBuf			!<	書き込み先
+		 *	@param[in]	argBufSize		!<	書き込み先のサイズ(終端文字を含む)
+		 *	@param[in]	argMinDigits	!<	最小の桁数(足りない分は0で埋める)
+		 *	@param[in]	argSeparator	!<	3桁ごとの区切り文字('\0'なら区切らない)
+		 *	@return		書き込んだ文字列
+		 */
+		static std::string_view FormatInt(long long argValue, char *argBuf, size_t argBufSize, int argMinDigits = 0, char argSeparator = '\0');
+		template<size_t N>
+		inline static std::string_view FormatInt(long long argValue, char (&argBuf)[N], int argMinDigits = 0, char argSeparator = '\0')
+		{
+			return FormatInt(argValue, argBuf, N, argMinDigits, argSeparator);
+		}
+		/**
+		 *	@fn			FormatUnsigned
+		 *	@brief		符号なし整数の文字列化(LLONG_MAXを超える値もそのまま書く)
+		 *	@param[in]	argValue		!<	値
+		 *	@param[out]	argBuf			!<	書き込み先
+		 *	@param[in]	argBufSize		!<	書き込み先のサイズ(終端文字を含む)
+		 *	@param[in]	argMinDigits	!<	最小の桁数(足りない分は0で埋める)
+		 *	@param[in]	argSeparator	!<	3桁ごとの区切り文字('\0'なら区切らない)
+		 *	@return		書き込んだ文字列
+		 */
+		static std::string_view FormatUnsigned(unsigned long long argValue, char *argBuf, size_t argBufSize, int argMinDigits = 0, char argSeparator = '\0');
+		template<size_t N>
+		inline static std::string_view FormatUnsigned(unsigned long long argValue, char (&argBuf)[N], int argMinDigits = 0, char argSeparator = '\0')
+		{
+			return FormatUnsigned(argValue, argBuf, N, argMinDigits, argSeparator);
+		}
+
+		/**
+		 *	@fn			FormatFloat
+		 *	@brief		実数の文字列化
+		 *	@param[in]	argValue		!<	値
+		 *	@param[out]	argBuf			!<	書き込み先
+		 *	@param[in]	argBufSize		!<	書き込み先のサイズ(終端文字を含む)
+		 *	@param[in]	argPrecision	!<	小数点以下の桁数(負なら値を再現できる最短の表記)
+		 *	@param[in]	argMinDigits	!<	整数部の最小の桁数(足りない分は0で埋める)
+		 *	@param[in]	argSeparator	!<	整数部の3桁ごとの区切り文字('\0'なら区切らない)
+		 *	@return		書き込んだ文字列
+		 */
+		static std::string_view FormatFloat(float argValue, char *argBuf, size_t argBufSize, int argPrecision = -1, int argMinDigits = 0, char argSeparator = '\0');
+		static std::string_view FormatFloat(double argValue, char *argBuf, size_t argBufSize, int argPrecision = -1, int argMinDigits = 0, char argSeparator = '\0');
+		template<size_t N>
+		inline static std::string_view FormatFloat(float argValue, char (&argBuf)[N], int argPrecision = -1, int argMinDigits = 0, char argSeparator = '\0')
+		{
+			return FormatFloat(argValue, argBuf, N, argPrecision, argMinDigits, argSeparator);
+		}
+		template<size_t N>
+		inline static std::string_view FormatFloat(double argValue, char (&argBuf)[N], int argPrecision = -1, int argMinDigits = 0, char argSeparator = '\0')
+		{
+			return FormatFloat(argValue, argBuf, N, argPrecision, argMinDigits, argSeparator);
+		}
+
+		/**
+		 *	@fn			ParseInt
+		 *	@brief		文字列を整数として解析する
+		 *	@param[in]	argSrc	!<	文字列(前後の空白と先頭の'+'は許す)
+		 *	@param[out]	argDst	!<	解析した値(失敗したら変更しない)
+		 *	@retval		true	!<	文字列全体が範囲内の整数だった
+		 *	@retval		false	!<	整数でない、または範囲外
+		 */
+		static bool ParseInt(std::string_view argSrc, int *argDst);
+		static bool ParseInt(std::string_view argSrc, long long *argDst);
+		/**
+		 *	@fn			ParseLeadingInt
+		 *	@brief		文字列の先頭の整数を解析する(std::stoiと同じく、数字が続かなくなった所で止める)
+		 *	@param[in]	argSrc	!<	文字列(前の空白と先頭の'+'は許す。"12abc"や"3.5"は12や3になる)
+		 *	@param[out]	argDst	!<	解析した値(失敗したら変更しない)
+		 *	@retval		true	!<	先頭が範囲内の整数だった
+		 *	@retval		false	!<	先頭が整数でない、または範囲外
+		 */
+		static bool ParseLeadingInt(std::string_view argSrc, int *argDst);
+		/**
+		 *	@fn			ParseFloat
+		 *	@brief		文字列を実数として解析する
+		 *	@param[in]	argSrc	!<	文字列(前後の空白と先頭の'+'は許す)
+		 *	@param[out]	argDst	!<	解析した値(失敗したら変更しない)
+		 *	@retval		true	!<	文字列全体が範囲内の実数だった
+		 *	@retval		false	!<	実数でない、または範囲外
+		 */
+		static bool ParseFloat(std::string_view argSrc, float *argDst);
+		static bool ParseFloat(std::string_view argSrc, double *argDst);
+	};
+}
@@ -0,0 +1,304 @@
+﻿/**
+ *	@file	TextFormat.h
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <assert.h>
+
+namespace Utility
+{
+	/**
+	 *  @class		TextFormat
+	 *  @brief		確保しない書式付きのテキスト作成(ワイド文字)
+	 *  @note		書式は"{}"で引数を順に、"{1}"で番号の引数を埋め込む。"{{"と"}}"は括弧そのもの。
+	 *				":"の後ろに[0][幅][,][.精度]を指定できる(例 "{:08.2}" "{:,}" "{0:5}")。
+	 *				0は数値を0で埋める(区切り文字も幅に数え、"{:08,}"の12345は"0,012,345"のように幅以上になる最小の桁数にする)、
+	 *				幅は足りない分を空白で埋める(数値は右、文字列は左寄せ)、
+	 *				,は3桁ごとに区切る、精度は実数の小数点以下の桁数と文字列の最大文字数。
+	 *				書き込み先に入りきらない分は切り捨てる。常に終端文字を書き込む。
+	 *				書式はTextFormat::IsValidでコンパイル時に検査できる
+	 *				(例 static_assert(TextFormat::IsValid(L"Score {:,}", 1));)
+	 */
+	class TextFormat final
+	{
+	public:
+		/**
+		 *  @class		Arg
+		 *  @brief		型を消した引数(文字列は参照するだけなので、書式化が終わるまで元を残すこと)
+		 */
+		class Arg final
+		{
+		public:
+			/**
+			 *  @enum		eType
+			 *  @brief		引数の型
+			 */
+			enum class eType
+			{
+				None,
+				Int,
+				Unsigned,	//	!<	LLONG_MAXを超えうる符号なし整数
+				Float,
+				Double,
+				Bool,
+				Char,
+				WideChar,
+				String,		//	!<	Shift-JIS
+				WideString,
+			};
+
+		public:
+			eType type_;
+			union
+			{
+				long long			int_;
+				unsigned long long	unsigned_;
+				float				float_;
+				double				double_;
+				bool				bool_;
+				wchar_t				char_;
+				struct
+				{
+					const void	*data_;
+					size_t		size_;
+				}					str_;
+			};
+
+		public:
+			Arg() : type_(eType::None), int_(0) {}
+			template<typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+			Arg(T argValue) : type_(eType::Int), int_(static_cast<long long>(argValue)) {}
+			template<typename T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, int>::type = 0>
+			Arg(T argValue) : type_(eType::Unsigned), unsigned_(static_cast<unsigned long long>(argValue)) {}
+			template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+			Arg(T argValue) : Arg(static_cast<typename std::underlying_type<T>::type>(argValue)) {}
+			Arg(bool argValue) : type_(eType::Bool), bool_(argValue) {}
+			Arg(char argValue) : type_(eType::Char), char_(static_cast<wchar_t>(static_cast<unsigned char>(argValue))) {}
+			Arg(wchar_t argValue) : type_(eType::WideChar), char_(argValue) {}
+			Arg(float argValue) : type_(eType::Float), float_(argValue) {}
+			Arg(double argValue) : type_(eType::Double), double_(argValue) {}
+			Arg(std::string_view argValue) : type_(eType::String) { str_.data_ = argValue.data(); str_.size_ = argValue.size(); }
+			Arg(std::wstring_view argValue) : type_(eType::WideString) { str_.data_ = argValue.data(); str_.size_ = argValue.size(); }
+			Arg(const char *argValue) : Arg(std::string_view(argValue)) {}
+			Arg(const wchar_t *argValue) : Arg(std::wstring_view(argValue)) {}
+			Arg(const std::string &argValue) : Arg(std::string_view(argValue)) {}
+			Arg(const std::wstring &argValue) : Arg(std::wstring_view(argValue)) {}
+		};
+
+		/**
+		 *  @struct		Spec
+		 *  @brief		置き換えフィールドの指定
+		 */
+		struct Spec
+		{
+			size_t	index_;			//	!<	引数の番号
+			bool	hasIndex_;		//	!<	番号を指定したか
+			bool	isZeroPad_;		//	!<	0で埋めるか
+			bool	hasSeparator_;	//	!<	3桁ごとに区切るか
+			int		width_;			//	!<	最小の幅
+			int		precision_;		//	!<	精度(負なら指定なし)
+		};
+
+	public:
+		/**
+		 *	@fn			ParseSpec
+		 *	@brief		置き換えフィールドの解析
+		 *	@param[in]	argFormat	!<	書式
+		 *	@param[in]	argPos		!<	'{'の次の位置
+		 *	@param[out]	argSpec		!<	解析結果
+		 *	@return		'}'の次の位置(不正な書式ならnpos)
+		 */
+		static constexpr size_t ParseSpec(std::wstring_view argFormat, size_t argPos, Spec *argSpec)
+		{
+			Spec spec = { 0, false, false, false, 0, -1 };
+			size_t pos = argPos;
+			auto IsDigit = [&](size_t argAt) { return argAt < argFormat.size() && argFormat[argAt] >= L'0' && argFormat[argAt] <= L'9'; };
+			auto Number = [&](size_t *argAt)
+			{
+				int value = 0;
+				while (IsDigit(*argAt) && value < 10000)
+					value = value * 10 + (argFormat[(*argAt)++] - L'0');
+				return value;
+			};
+
+			if (IsDigit(pos))
+			{
+				spec.hasIndex_ = true;
+				spec.index_ = static_cast<size_t>(Number(&pos));
+			}
+			if (pos < argFormat.size() && argFormat[pos] == L':')
+			{
+				++pos;
+				if (pos < argFormat.size() && argFormat[pos] == L'0')
+				{
+					spec.isZeroPad_ = true;
+					++pos;
+				}
+				spec.width_ = Number(&pos);
+				if (pos < argFormat.size() && argFormat[pos] == L',')
+				{
+					spec.hasSeparator_ = true;
+					++pos;
+				}
+				if (pos < argFormat.size() && argFormat[pos] == L'.')
+				{
+					++pos;
+					if (!IsDigit(pos))
+						return std::wstring_view::npos;
+					spec.precision_ = Number(&pos);
+				}
+			}
+			if (pos >= argFormat.size() || argFormat[pos] != L'}')
+				return std::wstring_view::npos;
+
+			*argSpec = spec;
+			return pos + 1;
+		}
+
+		/**
+		 *	@fn			IsValid
+		 *	@brief		書式が正しいかを調べる(コンパイル時に使える)
+		 *	@param[in]	argFormat	!<	書式
+		 *	@param[in]	argArgCount	!<	引数の数
+		 *	@retval		true		!<	正しい書式で、全ての置き換えフィールドに引数がある
+		 *	@retval		false		!<	不正な書式か引数が足りない
+		 */
+		static constexpr bool IsValid(std::wstring_view argFormat, size_t argArgCount)
+		{
+			size_t next = 0;
+			for (size_t pos = 0; pos < argFormat.size(); ++pos)
+			{
+				if (argFormat[pos] == L'}')
+				{
+					if (pos + 1 >= argFormat.size() || argFormat[pos + 1] != L'}')
+						return false;
+					++pos;
+					continue;
+				}
+				if (argFormat[pos] != L'{')
+					continue;
+				if (pos + 1 < argFormat.size() && argFormat[pos + 1] == L'{')
+				{
+					++pos;
+					continue;
+				}
+
+				Spec spec = { 0, false, false, false, 0, -1 };
+				size_t end = ParseSpec(argFormat, pos + 1, &spec);
+				if (end == std::wstring_view::npos)
+					return false;
+				if ((spec.hasIndex_ ? spec.index_ : next++) >= argArgCount)
+					return false;
+				pos = end - 1;
+			}
+			return true;
+		}
+
+		/**
+		 *	@fn			FormatArgs
+		 *	@brief		型を消した引数での書式化
+		 *	@param[out]	argBuf		!<	書き込み先
+		 *	@param[in]	argBufSize	!<	書き込み先のサイズ(終端文字を含む)
+		 *	@param[in]	argFormat	!<	書式
+		 *	@param[in]	argArgs		!<	引数
+		 *	@param[in]	argArgCount	!<	引数の数
+		 *	@return		書き込んだ文字列
+		 */
+		static std::wstring_view FormatArgs(wchar_t *argBuf, size_t argBufSize, std::wstring_view argFormat, const Arg *argArgs, size_t argArgCount);
+
+		/**
+		 *	@fn			Format
+		 *	@brief		書式化
+		 *	@param[out]	argBuf		!<	書き込み先
+		 *	@param[in]	argBufSize	!<	書き込み先のサイズ(終端文字を含む)
+		 *	@param[in]	argFormat	!<	書式
+		 *	@param[in]	argArgs		!<	引数
+		 *	@return		書き込んだ文字列
+		 */
+		template<typename... Ts>
+		inline static std::wstring_view Format(wchar_t *argBuf, size_t argBufSize, std::wstring_view argFormat, const Ts &...argArgs)
+		{
+			// 引数がなくても配列を作れるように末尾に空の引数を足す
+			const Arg Args[] = { Arg(argArgs)..., Arg() };
+			return FormatArgs(argBuf, argBufSize, argFormat, Args, sizeof...(Ts));
+		}
+		template<size_t N, typename... Ts>
+		inline static std::wstring_view Format(wchar_t (&argBuf)[N], std::wstring_view argFormat, const Ts &...argArgs)
+		{
+			return Format(argBuf, N, argFormat, argArgs...);
+		}
+	};
+
+	/**
+	 *  @class		FixedText
+	 *  @brief		固定長のバッファに書式化するテキスト(スタックに置いて毎フレーム作り直す用途)
+	 *  @tparam		N	!<	終端文字を含むバッファの要素数
+	 */
+	template<size_t N>
+	class FixedText final
+	{
+		static_assert(N > 0, "FixedText needs space for the terminator...");
+
+	private:
+		wchar_t	buf_[N];
+		size_t	length_;
+
+	public:
+		FixedText() : length_(0) { buf_[0] = L'\0'; }
+		template<typename... Ts>
+		explicit FixedText(std::wstring_view argFormat, const Ts &...argArgs) : length_(0)
+		{
+			Format(argFormat, argArgs...);
+		}
+
+	public:
+		/**
+		 *	@fn			Format
+		 *	@brief		書式化した内容で置き換える
+		 *	@param[in]	argFormat	!<	書式
+		 *	@param[in]	argArgs		!<	引数
+		 *	@return		自身
+		 */
+		template<typename... Ts>
+		FixedText &Format(std::wstring_view argFormat, const Ts &...argArgs)
+		{
+			length_ = TextFormat::Format(buf_, N, argFormat, argArgs...).size();
+			return *this;
+		}
+		/**
+		 *	@fn			Append
+		 *	@brief		書式化した内容を後ろに追加する
+		 *	@param[in]	argFormat	!<	書式
+		 *	@param[in]	argArgs		!<	引数
+		 *	@return		自身
+		 */
+		template<typename... Ts>
+		FixedText &Append(std::wstring_view argFormat, const Ts &...argArgs)
+		{
+			length_ += TextFormat::Format(buf_ + length_, N - length_, argFormat, argArgs...).size();
+			return *this;
+		}
+		/**
+		 *	@fn			Clear
+		 *	@brief		空にする
+		 */
+		void Clear()
+		{
+			length_ = 0;
+			buf_[0] = L'\0';
+		}
+
+	public:
+		inline std::wstring_view View() const { return std::wstring_view(buf_, length_); }
+		inline const wchar_t *c_str() const { return buf_; }
+		inline size_t size() const { return length_; }
+		inline bool empty() const { return length_ == 0; }
+		inline operator std::wstring_view() const { return View(); }
+	};
+}
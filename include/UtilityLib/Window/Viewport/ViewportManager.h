@@ -7,10 +7,12 @@
 #pragma once
 
 #include <d3d11.h>
-#include <DirectXMath.h>
-#include <map>
+#include "../../Math/MathConfig.h"
+#include <unordered_map>
 #include <string>
 
+#include "../../String/Atom.h"
+
 struct ID3D11DeviceContext;
 struct D3D11_VIEWPORT;
 
@@ -19,7 +21,7 @@ namespace Utility
 	class ViewportManager
 	{
 	private:
-		std::map<std::string, D3D11_VIEWPORT>	viewports_;
+		std::unordered_map<Atom, D3D11_VIEWPORT>	viewports_;
 		std::string								nowViewName_;
 	private:
 		void Create(DirectX::XMFLOAT2 argWindowPos, DirectX::XMFLOAT2 argWindowSize, DirectX::XMFLOAT2 argWindowDepth, std::string argViewportName);
@@ -36,8 +38,10 @@ namespace Utility
 		void CreateViewport(D3D11_VIEWPORT argViewport);
 
 		D3D11_VIEWPORT GetViewport(std::string argViewportName)const;
+		D3D11_VIEWPORT GetViewport(Atom argViewportName)const;
 		D3D11_VIEWPORT GetNowViewport(ID3D11DeviceContext *argContext)const;
 		void RSSetViewports(ID3D11DeviceContext *argContext, unsigned int argSetViewportsNum, D3D11_VIEWPORT *argViewports);
 		void RSSetViewports(ID3D11DeviceContext *argContext, unsigned int argSetViewportsNum, std::string argSetViewName);
+		void RSSetViewports(ID3D11DeviceContext *argContext, unsigned int argSetViewportsNum, Atom argSetViewName);
 	};
 }
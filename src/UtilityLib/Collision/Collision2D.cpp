@@ -7,77 +7,100 @@
 #include "Collision2D.h"
 #include "Shape2D.h"
 
-bool Utility::CircleToCircle(const CShape& s1, const CShape& s2)
+namespace
 {
-	bool result = false;
+	template<typename TVector>
+	using ScalarOf = typename Utility::Math::VectorTraits<TVector>::Scalar;
 
-	if (s1.Type() != eShapeType::Circle || s2.Type() != eShapeType::Circle)
-		return result;
+	/**
+	 *	@fn			DistanceSQ
+	 *	@brief		2点間の距離の二乗
+	 */
+	template<typename TVector>
+	inline ScalarOf<TVector> DistanceSQ(const TVector& argPointA, const TVector& argPointB)
+	{
+		const ScalarOf<TVector> X = argPointB.x - argPointA.x;
+		const ScalarOf<TVector> Y = argPointB.y - argPointA.y;
+		return X * X + Y * Y;
+	}
+
+	/**
+	 *	@fn			RectMin
+	 *	@brief		矩形の最小の角(left, bottom)
+	 */
+	inline Utility::Math::Vector2 RectMin(const Utility::ShapeRect& argRect)
+	{
+		return Utility::Math::Vector2(static_cast<float>(argRect.left), static_cast<float>(argRect.bottom));
+	}
+	/**
+	 *	@fn			RectMax
+	 *	@brief		矩形の最大の角(right, top)
+	 */
+	inline Utility::Math::Vector2 RectMax(const Utility::ShapeRect& argRect)
+	{
+		return Utility::Math::Vector2(static_cast<float>(argRect.right), static_cast<float>(argRect.top));
+	}
+}
 
-	float x1 = s1.Pos().x + s1.Radius();
-	float x2 = s2.Pos().x + s2.Radius();
-	float y1 = s1.Pos().y + s1.Radius();
-	float y2 = s2.Pos().y + s2.Radius();
-	float r1 = s1.Radius();
-	float r2 = s2.Radius();
+template<typename TVector>
+bool Utility::CheckCircle2Circle(const TVector& argCenterA, typename Math::VectorTraits<TVector>::Scalar argRadiusA,
+	const TVector& argCenterB, typename Math::VectorTraits<TVector>::Scalar argRadiusB)
+{
+	const ScalarOf<TVector> RadiusSum = argRadiusA + argRadiusB;
+	return DistanceSQ(argCenterA, argCenterB) <= RadiusSum * RadiusSum;
+}
 
-	if ((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1)
-		<= (r1 + r2) * (r1 + r2))
+template<typename TVector>
+bool Utility::CheckCircle2Rect(const TVector& argCenter, typename Math::VectorTraits<TVector>::Scalar argRadius, const TVector& argRectMin, const TVector& argRectMax)
+{
+	// 円の中心点と矩形の当たり判定
+	if ((argCenter.x > argRectMin.x) && (argCenter.x < argRectMax.x) &&
+		(argCenter.y < argRectMax.y) && (argCenter.y > argRectMin.y))
 	{
-		result = true;
+		return true;
 	}
-	return result;
+
+	// 矩形の角と円の当たり判定
+	const ScalarOf<TVector> RadiusSQ = argRadius * argRadius;
+	return DistanceSQ(argCenter, TVector(argRectMin.x, argRectMax.y)) < RadiusSQ ||
+		DistanceSQ(argCenter, argRectMax) < RadiusSQ ||
+		DistanceSQ(argCenter, TVector(argRectMax.x, argRectMin.y)) < RadiusSQ ||
+		DistanceSQ(argCenter, argRectMin) < RadiusSQ;
+}
+
+template<typename TVector>
+bool Utility::CheckRect2Rect(const TVector& argMinA, const TVector& argMaxA, const TVector& argMinB, const TVector& argMaxB)
+{
+	return (argMinA.x <= argMaxB.x) && (argMinB.x <= argMaxA.x) && (argMaxA.y >= argMinB.y) && (argMaxB.y >= argMinA.y);
+}
+
+bool Utility::CircleToCircle(const CShape& s1, const CShape& s2)
+{
+	if (s1.Type() != eShapeType::Circle || s2.Type() != eShapeType::Circle)
+		return false;
+
+	const float r1 = s1.Radius();
+	const float r2 = s2.Radius();
+	const Math::Vector2 Center1(s1.Pos().x + r1, s1.Pos().y + r1);
+	const Math::Vector2 Center2(s2.Pos().x + r2, s2.Pos().y + r2);
+
+	return CheckCircle2Circle(Center1, r1, Center2, r2);
 };
 
 bool Utility::CircleToRect(const CShape& s1, const CShape& s2)
 {
-	bool result = false;
-	
 	if (s1.Type() != eShapeType::Circle || s2.Type() != eShapeType::Rect)
-		return result;
+		return false;
 
-	// 点の中心点と矩形の当たり判定
-	bool a = (s1.Pos().x > s2.Rect().left) && (s1.Pos().x < s2.Rect().left) &&
-		(s1.Pos().y < s2.Rect().top) && (s1.Pos().y > s2.Rect().bottom);
-	bool b = (s1.Pos().x > s2.Rect().left) && (s1.Pos().x < s2.Rect().right) &&
-		(s1.Pos().y < s2.Rect().top) && (s1.Pos().y > s2.Rect().bottom);
-
-	// 矩形の角と円の当たり判定
-	bool c = (s2.Rect().left - s1.Pos().x) * (s2.Rect().left - s1.Pos().x) +
-		(s2.Rect().top - s1.Pos().y) * (s2.Rect().top - s1.Pos().y) < s1.Radius() * s1.Radius();
-	bool d = (s2.Rect().right - s1.Pos().x) * (s2.Rect().right - s1.Pos().x) +
-		(s2.Rect().top - s1.Pos().y) * (s2.Rect().top - s1.Pos().y) < s1.Radius() * s1.Radius();
-	bool e = (s2.Rect().right - s1.Pos().x) * (s2.Rect().right - s1.Pos().x) +
-		(s2.Rect().bottom - s1.Pos().y) * (s2.Rect().bottom - s1.Pos().y) < s1.Radius() * s1.Radius();
-	bool f = (s2.Rect().left - s1.Pos().x) * (s2.Rect().left - s1.Pos().x) +
-		(s2.Rect().bottom - s1.Pos().y) * (s2.Rect().bottom - s1.Pos().y) < s1.Radius() * s1.Radius();
-
-	result = a || b || c || d || e || f;
-
-	return result;
+	return CheckCircle2Rect(s1.Pos(), s1.Radius(), RectMin(s2.Rect()), RectMax(s2.Rect()));
 };
 
 bool Utility::RectToRect(const CShape& s1, const CShape& s2)
 {
-	bool result = false;
-
 	if (s1.Type() != eShapeType::Rect || s2.Type() != eShapeType::Rect)
-		return result;
-
-	auto ax1 = s1.Rect().left;
-	auto ax2 = s1.Rect().right;
-	auto ay1 = s1.Rect().top;
-	auto ay2 = s1.Rect().bottom;
-	auto bx1 = s2.Rect().left;
-	auto bx2 = s2.Rect().right;
-	auto by1 = s2.Rect().top;
-	auto by2 = s2.Rect().bottom;
-
-	if ((ax1 <= bx2) && (bx1 <= ax2) && (ay1 >= by2) && (by1 >= ay2))
-	{
-		result = true;
-	}
-	return result;
+		return false;
+
+	return CheckRect2Rect(RectMin(s1.Rect()), RectMax(s1.Rect()), RectMin(s2.Rect()), RectMax(s2.Rect()));
 };
 
 bool Utility::IsHitJudgment(const CShape& s1, const CShape& s2)
@@ -95,4 +118,15 @@ bool Utility::IsHitJudgment(const CShape& s1, const CShape& s2)
 		return true;
 	}
 	return false;
-}
\ No newline at end of file
+}
+
+#define UTILITY_COLLISION2D_INSTANTIATE(TVector) \
+	template bool Utility::CheckCircle2Circle(const TVector&, Math::VectorTraits<TVector>::Scalar, const TVector&, Math::VectorTraits<TVector>::Scalar); \
+	template bool Utility::CheckCircle2Rect(const TVector&, Math::VectorTraits<TVector>::Scalar, const TVector&, const TVector&); \
+	template bool Utility::CheckRect2Rect(const TVector&, const TVector&, const TVector&, const TVector&);
+
+UTILITY_COLLISION2D_INSTANTIATE(Utility::Math::Vector2)
+UTILITY_COLLISION2D_INSTANTIATE(Utility::Math::FixedVector2<Utility::Math::Fixed16>)
+UTILITY_COLLISION2D_INSTANTIATE(Utility::Math::FixedVector2<Utility::Math::Fixed32>)
+
+#undef UTILITY_COLLISION2D_INSTANTIATE
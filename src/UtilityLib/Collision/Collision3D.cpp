@@ -5,14 +5,18 @@
  *	Copyright (c) Kastumi Takei. All rights reserved.
  */
 #include "Collision3D.h"
-#include "../../Function.h"
+
+#include <cmath>
 
 namespace
 {
-	float GetSqDistanceSegment2Segment(const Utility::Segment& argSegment0, const Utility::Segment& argSegment1);
-	float GetSqDistancePoint2Segment(const Utility::Math::Vector3& argPoint, const Utility::Segment& argSegment);
-	void Utility::ClosestPtSegment2Segment(const Segment& argSegment0, const Segment& argSegment1, Math::Vector3* argClosest0, Math::Vector3* argClosest1);
-	void Utility::ClosestPtPoint2Segment(const Math::Vector3& argPoint, const Segment& argSegment, Math::Vector3* argClosest);
+	template<typename TVector>
+	using ScalarOf = typename Utility::Math::VectorTraits<TVector>::Scalar;
+
+	template<typename TVector>
+	ScalarOf<TVector> GetSqDistanceSegment2Segment(const Utility::BasicSegment<TVector>& argSegment0, const Utility::BasicSegment<TVector>& argSegment1);
+	template<typename TVector>
+	ScalarOf<TVector> GetSqDistancePoint2Segment(const TVector& argPoint, const Utility::BasicSegment<TVector>& argSegment);
 
 
 	/**
@@ -21,9 +25,10 @@ namespace
 	 *	@param[in]	argVector	!<	平方根の値
 	 *	@return		平方根の解
 	 */
-	float VectorLenghSQ(const Utility::Math::Vector3& argVector)
+	template<typename TVector>
+	ScalarOf<TVector> VectorLenghSQ(const TVector& argVector)
 	{
-		float result = argVector.x * argVector.x + argVector.y * argVector.y + argVector.z * argVector.z;
+		ScalarOf<TVector> result = argVector.x * argVector.x + argVector.y * argVector.y + argVector.z * argVector.z;
 		return result;
 	}
 	/**
@@ -33,9 +38,10 @@ namespace
 	 *	@param[in]	argPoint2	!<	目的地
 	 *	@return		引数のポイント同士の距離を平方根とした解
 	 */
-	float Distance3DSQ(const Utility::Math::Vector3& argPoint1, const Utility::Math::Vector3& argPoint2)
+	template<typename TVector>
+	ScalarOf<TVector> Distance3DSQ(const TVector& argPoint1, const TVector& argPoint2)
 	{
-		Utility::Math::Vector3 sub = argPoint1 - argPoint2;
+		TVector sub = argPoint1 - argPoint2;
 		return VectorLenghSQ(sub);
 	}
 	/**
@@ -50,16 +56,18 @@ namespace
 	 *	③直線上の最接近点が両方の線分の外側に存在する時
 	 *	それぞれのケースで二つの線分上の最接近点を求め、その距離を算出する
 	 */
-	float GetSqDistanceSegment2Segment(const Utility::Segment& argSegment0, const Utility::Segment& argSegment1)
+	template<typename TVector>
+	ScalarOf<TVector> GetSqDistanceSegment2Segment(const Utility::BasicSegment<TVector>& argSegment0, const Utility::BasicSegment<TVector>& argSegment1)
 	{
-		const float epsilon = 1.0e-5f;	// 誤差吸収用の微小な値
-		Utility::Math::Vector3 v = Utility::Math::Vector3();		// c1→c0ベクトル
-
-		Utility::Math::Vector3 d0 = argSegment0.end - argSegment0.start;	// 線分0の方向ベクトル
-		Utility::Math::Vector3 d1 = argSegment1.end - argSegment1.start; // 線分1の方向ベクトル
-		Utility::Math::Vector3 r = argSegment0.start - argSegment1.start; // 線分1の始点から線分0の始点へのベクトル
-		float a = d0.Dot(d0);		// 線分0の距離の二乗
-		float e = d1.Dot(d1);		// 線分1の距離の二乗
+		using Scalar = ScalarOf<TVector>;
+		const Scalar epsilon(1.0e-5f);	// 誤差吸収用の微小な値
+		TVector v = TVector();		// c1→c0ベクトル
+
+		TVector d0 = argSegment0.end - argSegment0.start;	// 線分0の方向ベクトル
+		TVector d1 = argSegment1.end - argSegment1.start; // 線分1の方向ベクトル
+		TVector r = argSegment0.start - argSegment1.start; // 線分1の始点から線分0の始点へのベクトル
+		Scalar a = d0.Dot(d0);		// 線分0の距離の二乗
+		Scalar e = d1.Dot(d1);		// 線分1の距離の二乗
 							//	b = d0.Dot(d1);		// 最適化の為後方に移動した
 							//	c = d0.Dot(r);		// 最適化の為後方に移動した
 							//	f = d1.Dot(r);		// 最適化の為後方に移動した
@@ -82,19 +90,19 @@ namespace
 			return GetSqDistancePoint2Segment(argSegment1.start, argSegment0);
 		}
 
-		float b = d0.Dot(d1);
-		float f = d1.Dot(r);
-		float c = d0.Dot(r);
+		Scalar b = d0.Dot(d1);
+		Scalar f = d1.Dot(r);
+		Scalar c = d0.Dot(r);
 
-		float denom = a * e - b * b;	//	!<	常に非負
+		Scalar denom = a * e - b * b;	//	!<	常に非負
 								// 線分が平行でない場合、直線0上の直線1に対する最近接点を計算、そして
 								// 線分0上にクランプ。そうでない場合は任意のsを選択
 
-		float s = 0.f, t = 0.f;
+		Scalar s = 0, t = 0;
 
 		if (denom != 0)
 		{
-			s = Utility::Math::Clamp((b * f - c * e) / denom, 0, 1);
+			s = Utility::Math::Clamp((b * f - c * e) / denom, Scalar(0), Scalar(1));
 		}
 		else
 		{
@@ -102,25 +110,25 @@ namespace
 		}
 
 		// 直線1上の最接近点を計算
-		float tnom = b * s + f;
+		Scalar tnom = b * s + f;
 
 		if (tnom < 0)
 		{
 			t = 0;
-			s = Utility::Math::Clamp(-c / a, 0, 1);
+			s = Utility::Math::Clamp(-c / a, Scalar(0), Scalar(1));
 		}
 		else if (tnom > e)
 		{
 			t = 1;
-			s = Utility::Math::Clamp((b - c) / a, 0, 1);
+			s = Utility::Math::Clamp((b - c) / a, Scalar(0), Scalar(1));
 		}
 		else
 		{
 			t = tnom / e;
 		}
 
-		Utility::Math::Vector3 c0 = s * d0 + argSegment0.start;
-		Utility::Math::Vector3 c1 = t * d1 + argSegment1.start;
+		TVector c0 = s * d0 + argSegment0.start;
+		TVector c1 = t * d1 + argSegment1.start;
 		v = c0 - c1;
 
 		return v.Dot(v);
@@ -138,15 +146,16 @@ namespace
 	 *	②BAベクトルとBCベクトルの内積が負の時、点Bが点Cの最近傍である
 	 *	③　①、②に該当しない場合、点Cの射影がACの内側に存在するため、その点が最近傍である
 	 */
-	float GetSqDistancePoint2Segment(const Utility::Math::Vector3& argPoint, const Utility::Segment& argSegment)
+	template<typename TVector>
+	ScalarOf<TVector> GetSqDistancePoint2Segment(const TVector& argPoint, const Utility::BasicSegment<TVector>& argSegment)
 	{
-		const float epsilon = 1.0e-5f;	//	!<	誤差吸収用の微小な値
+		const ScalarOf<TVector> epsilon(1.0e-5f);	//	!<	誤差吸収用の微小な値
 
 		// 線分の始点から終点へのベクトル
-		Utility::Math::Vector3 SegmentSub = argSegment.end - argSegment.start;
+		TVector SegmentSub = argSegment.end - argSegment.start;
 
 		// 線分の始点から点へのベクトル
-		Utility::Math::Vector3 SegmentPoint = argPoint - argSegment.start;
+		TVector SegmentPoint = argPoint - argSegment.start;
 		if (SegmentSub.Dot(SegmentPoint) < epsilon)
 		{// ２ベクトルの内積が負なら、線分の始点が最近傍
 			return SegmentPoint.Dot(SegmentPoint);
@@ -161,7 +170,7 @@ namespace
 
 		// 上記のどちらにも該当しない場合、線分上に落とした射影が最近傍
 		// (本来ならサインで求めるが、外積の大きさ/線分のベクトルの大きさで求まる)
-		Utility::Math::Vector3 CP = SegmentSub.Cross(SegmentPoint);
+		TVector CP = SegmentSub.Cross(SegmentPoint);
 
 		return CP.Dot(CP) / SegmentSub.Dot(SegmentSub);
 	}
@@ -174,11 +183,13 @@ namespace
  *	@param[in]	argInter	!<	交点（省略可）
  *	@return		球同士が当たっていればtrue、そうでなければfalse
  */
-bool Utility::CheckSphere2Sphere(const Sphere& argSphereA, const Sphere& argSphereB, Math::Vector3 *argInter)
+template<typename TVector>
+bool Utility::CheckSphere2Sphere(const BasicSphere<TVector>& argSphereA, const BasicSphere<TVector>& argSphereB, NonDeducedT<TVector> *argInter)
 {
-	float distanceSQ = Distance3DSQ(argSphereA.center, argSphereB.center);
-	float radiusSum = argSphereA.radius + argSphereB.radius;
-	float radiusSumsQ = radiusSum * radiusSum;
+	using Scalar = ScalarOf<TVector>;
+	Scalar distanceSQ = Distance3DSQ(argSphereA.center, argSphereB.center);
+	Scalar radiusSum = argSphereA.radius + argSphereB.radius;
+	Scalar radiusSumsQ = radiusSum * radiusSum;
 
 	if (distanceSQ > radiusSumsQ)
 	{
@@ -186,8 +197,8 @@ bool Utility::CheckSphere2Sphere(const Sphere& argSphereA, const Sphere& argSphe
 	}
 	if (argInter)
 	{
-		Math::Vector3 sub = argSphereA.center - argSphereB.center;
-		Math::Vector3 BtoInter = sub * argSphereB.radius / (argSphereA.radius + argSphereB.radius);
+		TVector sub = argSphereA.center - argSphereB.center;
+		TVector BtoInter = sub * argSphereB.radius / (argSphereA.radius + argSphereB.radius);
 		*argInter = argSphereB.center + BtoInter;
 	}
 
@@ -201,11 +212,13 @@ bool Utility::CheckSphere2Sphere(const Sphere& argSphereA, const Sphere& argSphe
  *	@param[in]	argInter	!<	交点（省略可）
  *	@return		カプセル同士が当たっていればtrue、そうでなければfalse
  */
-bool Utility::CheckCapsule2Capsule(const Capsule& argCapsuleA, const Capsule& argCapsuleB, Math::Vector3 *argInter)
+template<typename TVector>
+bool Utility::CheckCapsule2Capsule(const BasicCapsule<TVector>& argCapsuleA, const BasicCapsule<TVector>& argCapsuleB, NonDeducedT<TVector> *argInter)
 {
-	float distanceSQ = GetSqDistanceSegment2Segment(argCapsuleA.segment, argCapsuleB.segment);
-	float radiusSum = argCapsuleA.radius + argCapsuleB.radius;
-	float radiusSumsQ = radiusSum * radiusSum;
+	using Scalar = ScalarOf<TVector>;
+	Scalar distanceSQ = GetSqDistanceSegment2Segment(argCapsuleA.segment, argCapsuleB.segment);
+	Scalar radiusSum = argCapsuleA.radius + argCapsuleB.radius;
+	Scalar radiusSumsQ = radiusSum * radiusSum;
 
 	if (distanceSQ > radiusSumsQ)
 	{
@@ -213,13 +226,13 @@ bool Utility::CheckCapsule2Capsule(const Capsule& argCapsuleA, const Capsule& ar
 	}
 	if (argInter) 
 	{
-		Math::Vector3 cponitA, cponitB;
+		TVector cponitA, cponitB;
 
 		ClosestPtSegment2Segment(argCapsuleA.segment, argCapsuleB.segment, &cponitA, &cponitB);
 
-		Math::Vector3 sub = cponitA - cponitB;
+		TVector sub = cponitA - cponitB;
 
-		Math::Vector3 BtoInter = sub * argCapsuleB.radius / (argCapsuleA.radius + argCapsuleB.radius);
+		TVector BtoInter = sub * argCapsuleB.radius / (argCapsuleA.radius + argCapsuleB.radius);
 		*argInter = cponitB+ BtoInter;
 	}
 
@@ -233,11 +246,13 @@ bool Utility::CheckCapsule2Capsule(const Capsule& argCapsuleA, const Capsule& ar
  *	@param[in]	argInter	!<	交点（省略可）
  *	@return		球とカプセルが当たっていればtrue、そうでなければfalse
  */
-bool Utility::CheckSphere2Capsule(const Sphere& argSphere, const Capsule& argCapsule, Math::Vector3 *argInter)
+template<typename TVector>
+bool Utility::CheckSphere2Capsule(const BasicSphere<TVector>& argSphere, const BasicCapsule<TVector>& argCapsule, NonDeducedT<TVector> *argInter)
 {
-	float distanceSQ = GetSqDistancePoint2Segment(argSphere.center, argCapsule.segment);
-	float radiusSum = argSphere.radius + argCapsule.radius;
-	float radiusSumsQ = radiusSum * radiusSum;
+	using Scalar = ScalarOf<TVector>;
+	Scalar distanceSQ = GetSqDistancePoint2Segment(argSphere.center, argCapsule.segment);
+	Scalar radiusSum = argSphere.radius + argCapsule.radius;
+	Scalar radiusSumsQ = radiusSum * radiusSum;
 
 	if (distanceSQ > radiusSumsQ)
 	{
@@ -245,13 +260,13 @@ bool Utility::CheckSphere2Capsule(const Sphere& argSphere, const Capsule& argCap
 	}
 	if (argInter) 
 	{
-		Math::Vector3 cponit;
+		TVector cponit;
 
 		ClosestPtPoint2Segment(argSphere.center, argCapsule.segment, &cponit);
 
-		Math::Vector3 sub = argSphere.center - cponit;
+		TVector sub = argSphere.center - cponit;
 
-		Math::Vector3 BtoInter = sub * argCapsule.radius / (argSphere.radius + argCapsule.radius);
+		TVector BtoInter = sub * argCapsule.radius / (argSphere.radius + argCapsule.radius);
 		*argInter = cponit + BtoInter;
 	}
 
@@ -264,14 +279,16 @@ bool Utility::CheckSphere2Capsule(const Sphere& argSphere, const Capsule& argCap
  *	@param[in]	argSegment	!<	線分
  *	@param[in]	argClosest	!<	点と位置の最近接点（結果出力用）
  */
-void Utility::ClosestPtPoint2Segment(const Math::Vector3& argPoint, const Segment& argSegment, Math::Vector3* argClosest)
+template<typename TVector>
+void Utility::ClosestPtPoint2Segment(const NonDeducedT<TVector>& argPoint, const BasicSegment<TVector>& argSegment, NonDeducedT<TVector> *argClosest)
 {
-	Math::Vector3 segv = argSegment.end - argSegment.start;
-	Math::Vector3 s2p = argPoint - argSegment.start;
-	float t = segv.Dot(s2p) / segv.Dot(segv);
+	using Scalar = ScalarOf<TVector>;
+	TVector segv = argSegment.end - argSegment.start;
+	TVector s2p = argPoint - argSegment.start;
+	Scalar t = segv.Dot(s2p) / segv.Dot(segv);
 
 	// 線分の外側にある場合、tを最接近点までクランプ
-	t = Math::Clamp(t, 0, 1);
+	t = Math::Clamp(t, Scalar(0), Scalar(1));
 
 	// クランプされているtからの射影されている位置を計算
 	*argClosest = t * segv + argSegment.start;
@@ -284,15 +301,17 @@ void Utility::ClosestPtPoint2Segment(const Math::Vector3& argPoint, const Segmen
  *	@param[in]	argClosest0	!<	線分0上の最近接点（結果出力用）
  *	@param[in]	argClosest1	!<	線分1上の最近接点（結果出力用）
  */
-void Utility::ClosestPtSegment2Segment(const Segment& argSegment0, const Segment& argSegment1, Math::Vector3* argClosest0, Math::Vector3* argClosest1)
+template<typename TVector>
+void Utility::ClosestPtSegment2Segment(const BasicSegment<TVector>& argSegment0, const BasicSegment<TVector>& argSegment1, NonDeducedT<TVector> *argClosest0, NonDeducedT<TVector> *argClosest1)
 {
-	const float epsilon = 1.0e-5f;	//	!<	誤差吸収用の微小な値
-
-	Math::Vector3 d0 = argSegment0.end - argSegment0.start;		//	!<	線分0の方向ベクトル
-	Math::Vector3 d1 = argSegment1.end - argSegment1.start;		//	!<	線分1の方向ベクトル
-	Math::Vector3 r = argSegment0.start- argSegment1.start;		//	!<	線分1の始点から線分0の始点へのベクトル
-	float a = d0.Dot(d0);	//	!<	線分0の距離の二乗
-	float e = d1.Dot(d1);	//	!<	線分1の距離の二乗
+	using Scalar = ScalarOf<TVector>;
+	const Scalar epsilon(1.0e-5f);	//	!<	誤差吸収用の微小な値
+
+	TVector d0 = argSegment0.end - argSegment0.start;		//	!<	線分0の方向ベクトル
+	TVector d1 = argSegment1.end - argSegment1.start;		//	!<	線分1の方向ベクトル
+	TVector r = argSegment0.start- argSegment1.start;		//	!<	線分1の始点から線分0の始点へのベクトル
+	Scalar a = d0.Dot(d0);	//	!<	線分0の距離の二乗
+	Scalar e = d1.Dot(d1);	//	!<	線分1の距離の二乗
 					//	b = d0.Dot(d1);	// 最適化の為後方に移動した
 					//	c = d0.Dot(r);	// 最適化の為後方に移動した
 					//	f = d1.Dot(r);	// 最適化の為後方に移動した
@@ -317,19 +336,19 @@ void Utility::ClosestPtSegment2Segment(const Segment& argSegment0, const Segment
 		ClosestPtPoint2Segment(argSegment1.start, argSegment0, argClosest0);
 	}
 
-	float b = d0.Dot(d1);
-	float f = d1.Dot(r);
-	float c = d0.Dot(r);
+	Scalar b = d0.Dot(d1);
+	Scalar f = d1.Dot(r);
+	Scalar c = d0.Dot(r);
 
-	float denom = a * e - b * b;	//	!<	常に非負
+	Scalar denom = a * e - b * b;	//	!<	常に非負
 									// 線分が平行でない場合、直線0上の直線1に対する最近接点を計算、そして
 									// 線分0上にクランプ。そうでない場合は任意のsを選択
 	
-	float s = 0.f, t = 0.f;
+	Scalar s = 0, t = 0;
 	
 	if (denom != 0)
 	{
-		s = Math::Clamp((b * f - c * e) / denom, 0, 1);
+		s = Math::Clamp((b * f - c * e) / denom, Scalar(0), Scalar(1));
 	}
 	else
 	{
@@ -337,17 +356,17 @@ void Utility::ClosestPtSegment2Segment(const Segment& argSegment0, const Segment
 	}
 
 	// 直線1上の最接近点を計算
-	float tnom = b * s + f;
+	Scalar tnom = b * s + f;
 
 	if (tnom < 0)
 	{
 		t = 0;
-		s = Math::Clamp(-c / a, 0, 1);
+		s = Math::Clamp(-c / a, Scalar(0), Scalar(1));
 	}
 	else if (tnom > e)
 	{
 		t = 1;
-		s = Math::Clamp((b - c) / a, 0, 1);
+		s = Math::Clamp((b - c) / a, Scalar(0), Scalar(1));
 	}
 	else
 	{
@@ -364,75 +383,78 @@ void Utility::ClosestPtSegment2Segment(const Segment& argSegment0, const Segment
  *	@param[in]	argTriangle	!<	線分
  *	@param[in]	argClosest	!<	点と線分の最近接点（結果出力用）
  */
-void Utility::ClosestPtPoint2Triangle(const Math::Vector3& argPoint, const Triangle& argTriangle, Math::Vector3* argClosest)
+template<typename TVector>
+void Utility::ClosestPtPoint2Triangle(const NonDeducedT<TVector>& argPoint, const BasicTriangle<TVector>& argTriangle, NonDeducedT<TVector> *argClosest)
 {
+	using Scalar = ScalarOf<TVector>;
 	// argPointがPointTopの外側の頂点領域の中にあるかどうかチェック
-	Math::Vector3 P0_P1 = argTriangle.pointLeft - argTriangle.pointTop;
-	Math::Vector3 P0_P2 = argTriangle.pointRight - argTriangle.pointTop;
-	Math::Vector3 P0_PT = argPoint - argTriangle.pointTop;
+	TVector P0_P1 = argTriangle.pointLeft - argTriangle.pointTop;
+	TVector P0_P2 = argTriangle.pointRight - argTriangle.pointTop;
+	TVector P0_PT = argPoint - argTriangle.pointTop;
 
-	float d1 = P0_P1.Dot(P0_PT);
-	float d2 = P0_P2.Dot(P0_PT);
+	Scalar d1 = P0_P1.Dot(P0_PT);
+	Scalar d2 = P0_P2.Dot(P0_PT);
 
-	if (d1 <= 0.0f && d2 <= 0.0f)
+	if (d1 <= 0 && d2 <= 0)
 	{// PintTopが最近傍
 		*argClosest = argTriangle.pointTop;
 		return;
 	}
 
 	// argPointがPointLeftの外側の頂点領域の中にあるかどうかチェック
-	Math::Vector3 P1_PT = argPoint - argTriangle.pointLeft;
+	TVector P1_PT = argPoint - argTriangle.pointLeft;
 
-	float d3 = P0_P1.Dot(P1_PT);
-	float d4 = P0_P2.Dot(P1_PT);
+	Scalar d3 = P0_P1.Dot(P1_PT);
+	Scalar d4 = P0_P2.Dot(P1_PT);
 
-	if (d3 >= 0.0f && d4 <= d3)
+	if (d3 >= 0 && d4 <= d3)
 	{// PointLeftが最近傍
 		*argClosest = argTriangle.pointLeft;
 		return;
 	}
 
 	// argPointがPointTop_PointLeftの辺領域の中にあるかどうかチェックし、あればargPointのPointTop_PointLeft上に対する射影を返す
-	float vc = d1 * d4 - d3 * d2;
-	if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+	Scalar vc = d1 * d4 - d3 * d2;
+	if (vc <= 0 && d1 >= 0 && d3 <= 0)
 	{
-		float v = d1 / (d1 - d3);
+		Scalar v = d1 / (d1 - d3);
 		*argClosest = argTriangle.pointTop + v * P0_P1;
 		return;
 	}
 
 	// argPointがPointRightの外側の頂点領域の中にあるかどうかチェック
-	Math::Vector3 P2_PT = argPoint - argTriangle.pointRight;
+	TVector P2_PT = argPoint - argTriangle.pointRight;
 
-	float d5 = P0_P1.Dot(P2_PT);
-	float d6 = P0_P2.Dot(P2_PT);
-	if (d6 >= 0.0f && d5 <= d6)
+	Scalar d5 = P0_P1.Dot(P2_PT);
+	Scalar d6 = P0_P2.Dot(P2_PT);
+	if (d6 >= 0 && d5 <= d6)
 	{
 		*argClosest = argTriangle.pointRight;
 		return;
 	}
 
 	// argPointがPointTop_PointRightの辺領域の中にあるかどうかチェックし、あればargPointのPointTop_PointRight上に対する射影を返す
-	float vb = d5 * d2 - d1 * d6;
-	if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+	Scalar vb = d5 * d2 - d1 * d6;
+	if (vb <= 0 && d2 >= 0 && d6 <= 0)
 	{
-		float w = d2 / (d2 - d6);
+		Scalar w = d2 / (d2 - d6);
 		*argClosest = argTriangle.pointTop + w * P0_P2;
 		return;
 	}
 
 	// argPointがPointLeft_PointRightの辺領域の中にあるかどうかチェックし、あればargPointのPointLeft_PointRight上に対する射影を返す
-	float va = d3 * d6 - d5 * d4;
-	if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+	Scalar va = d3 * d6 - d5 * d4;
+	if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
 	{
-		float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+		Scalar w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
 		*argClosest = argTriangle.pointLeft + w * (argTriangle.pointRight - argTriangle.pointLeft);
 		return;
 	}
 
-	float denom = 1.0f / (va + vb + vc);
-	float v = vb * denom;
-	float w = vc * denom;
+	// 逆数を掛けると固定小数点数では小さな逆数の桁が落ちるので、それぞれ割る
+	Scalar denom = va + vb + vc;
+	Scalar v = vb / denom;
+	Scalar w = vc / denom;
 	*argClosest = argTriangle.pointTop + P0_P1 * v + P0_P2 * w;
 }
 /**
@@ -445,23 +467,25 @@ void Utility::ClosestPtPoint2Triangle(const Math::Vector3& argPoint, const Trian
  *	@note		線上は外とみなします
  *	@note		ABCが三角形かどうかのチェックは省略...
  */
-bool Utility::CheckPoint2Triangle(const Math::Vector3& argPoint, const Triangle& argTriangle)
+template<typename TVector>
+bool Utility::CheckPoint2Triangle(const NonDeducedT<TVector>& argPoint, const BasicTriangle<TVector>& argTriangle)
 {
+	using Scalar = ScalarOf<TVector>;
 	// 点0→1、 1→2、 2→0 のベクトルをそれぞれ計算
-	Math::Vector3 v01 = argTriangle.pointLeft - argTriangle.pointTop;
-	Math::Vector3 v12 = argTriangle.pointRight - argTriangle.pointLeft;
-	Math::Vector3 v20 = argTriangle.pointTop - argTriangle.pointRight;
+	TVector v01 = argTriangle.pointLeft - argTriangle.pointTop;
+	TVector v12 = argTriangle.pointRight - argTriangle.pointLeft;
+	TVector v20 = argTriangle.pointTop - argTriangle.pointRight;
 	// 三角形の各頂点から点へのベクトルをそれぞれ計算
-	Math::Vector3 v0p = argPoint - argTriangle.pointTop;
-	Math::Vector3 v1p = argPoint - argTriangle.pointLeft;
-	Math::Vector3 v2p = argPoint - argTriangle.pointRight;
+	TVector v0p = argPoint - argTriangle.pointTop;
+	TVector v1p = argPoint - argTriangle.pointLeft;
+	TVector v2p = argPoint - argTriangle.pointRight;
 	// 各辺ベクトルと、点へのベクトルの外積を計算
-	Math::Vector3 c0 = v01.Cross(v0p);
-	Math::Vector3 c1 = v12.Cross(v1p);
-	Math::Vector3 c2 = v20.Cross(v2p);
+	TVector c0 = v01.Cross(v0p);
+	TVector c1 = v12.Cross(v1p);
+	TVector c2 = v20.Cross(v2p);
 	// 内積で同じ方向かどうか調べる
-	float dot01 = c0.Dot(c1);
-	float dot02 = c0.Dot(c2);
+	Scalar dot01 = c0.Dot(c1);
+	Scalar dot02 = c0.Dot(c2);
 	// 外積ベクトルが全て同じ方向なら、三角形の内側に点がある
 	if (dot01 > 0 && dot02 > 0)
 	{
@@ -481,14 +505,15 @@ bool Utility::CheckPoint2Triangle(const Math::Vector3& argPoint, const Triangle&
  *	@return		点と三角形が交差していればtrue、そうでなければfalse
  *	@note		裏面の当たり判定は取らない
  */
-bool Utility::CheckSphere2Triangle(const Sphere& argSphere, const Triangle& argTriangle, Math::Vector3 *argInter)
+template<typename TVector>
+bool Utility::CheckSphere2Triangle(const BasicSphere<TVector>& argSphere, const BasicTriangle<TVector>& argTriangle, NonDeducedT<TVector> *argInter)
 {
-	Math::Vector3 p;
+	TVector p;
 
 	// 球の中心に対する最近接点である三角形上にある点pを見つける
 	ClosestPtPoint2Triangle(argSphere.center, argTriangle, &p);
 
-	Math::Vector3 v = p - argSphere.center;
+	TVector v = p - argSphere.center;
 
 	// 球と三角形が交差するのは、球の中心から点pまでの距離が球の半径よりも小さい場合
 	if (v.Dot(v) <= argSphere.radius * argSphere.radius)
@@ -505,15 +530,15 @@ bool Utility::CheckSphere2Triangle(const Sphere& argSphere, const Triangle& argT
 #if 0
 	// 球と平面（三角形が乗っている平面）の当たり判定
 	// 球と平面の距離を計算
-	float ds = argSphere.center.Dot(argTriangle.normal);
-	float dt = argTriangle.pointTop.Dot(argTriangle.normal);
-	float dist = ds - dt;
+	Scalar ds = argSphere.center.Dot(argTriangle.normal);
+	Scalar dt = argTriangle.pointTop.Dot(argTriangle.normal);
+	Scalar dist = ds - dt;
 	// 距離が半径以上なら、当たらない
 	if (fabsf(dist) > argSphere.radius)	
 		return false;
 	// 中心点を平面に射影したとき、三角形の内側にあれば、当たっている
 	// 射影した座標
-	Math::Vector3 center = -dist * argTriangle.normal+ argSphere.center;
+	TVector center = -dist * argTriangle.normal+ argSphere.center;
 
 	// 三角形の外側になければ、当たっていない
 	if (!CheckPoint2Triangle(center, argTriangle))	
@@ -535,14 +560,15 @@ bool Utility::CheckSphere2Triangle(const Sphere& argSphere, const Triangle& argT
  *	@param[in]	argPointRight	!<	三角形の右角
  *	@param[in]	argTriangle		!<	操作したい三角形
  */
-void Utility::ComputeTriangle(const Math::Vector3& argPointTop, const Math::Vector3& argPointLeft, const Math::Vector3& argPointRight, Triangle* argTriangle)
+template<typename TVector>
+void Utility::ComputeTriangle(const NonDeducedT<TVector>& argPointTop, const NonDeducedT<TVector>& argPointLeft, const NonDeducedT<TVector>& argPointRight, BasicTriangle<TVector>* argTriangle)
 {
 	argTriangle->pointTop = argPointTop;
 	argTriangle->pointLeft = argPointLeft;
 	argTriangle->pointRight = argPointRight;
 
-	Math::Vector3 P0_P1 = argTriangle->pointLeft - argTriangle->pointTop;
-	Math::Vector3 P1_P2 = argTriangle->pointRight - argTriangle->pointLeft;
+	TVector P0_P1 = argTriangle->pointLeft - argTriangle->pointTop;
+	TVector P1_P2 = argTriangle->pointRight - argTriangle->pointLeft;
 
 	argTriangle->normal = P0_P1.Cross(P1_P2);
 	argTriangle->normal.Normalize();
@@ -556,51 +582,53 @@ void Utility::ComputeTriangle(const Math::Vector3& argPointTop, const Math::Vect
  *	@return		線分と三角形が交差していればtrue、そうでなければfalse
  *	@note		裏面の当たりはとらない
  */
-bool Utility::CheckSegment2Triangle(const Segment& argSegment, const Triangle& argTriangle, Math::Vector3 *argInter)
+template<typename TVector>
+bool Utility::CheckSegment2Triangle(const BasicSegment<TVector>& argSegment, const BasicTriangle<TVector>& argTriangle, NonDeducedT<TVector> *argInter)
 {
-	const float epsilon = -1.0e-5f;	//	!<	誤差吸収用の微小な値
+	using Scalar = ScalarOf<TVector>;
+	const Scalar epsilon(-1.0e-5f);	//	!<	誤差吸収用の微小な値
 
-	Math::Vector3 tls = argSegment.start - argTriangle.pointTop;
-	float distl0 = tls.Dot(argTriangle.normal);	//	!<	線分の始点と平面の距離
+	TVector tls = argSegment.start - argTriangle.pointTop;
+	Scalar distl0 = tls.Dot(argTriangle.normal);	//	!<	線分の始点と平面の距離
 	if (distl0 <= epsilon)
 	{// 線分の始点が三角系の裏側にあれば、当たらない
 		return false;
 	}
 	
-	Math::Vector3 tle = argSegment.end - argTriangle.pointTop;
-	float distl1 = tle.Dot(argTriangle.normal);	//	!<	線分の終点と平面の距離
+	TVector tle = argSegment.end - argTriangle.pointTop;
+	Scalar distl1 = tle.Dot(argTriangle.normal);	//	!<	線分の終点と平面の距離
 	if (distl1 >= -epsilon)
 	{// 線分の終点が三角系の表側にあれば、当たらない
 		return false;
 	}
 	// 直線と平面との交点sを取る
-	float denom = distl0 - distl1;
-	float t = distl0 / denom;
-	Math::Vector3 LayV = argSegment.end - argSegment.start;	//	!<	線分の方向ベクトルを取得
-	Math::Vector3 s = t * LayV + argSegment.start;
+	Scalar denom = distl0 - distl1;
+	Scalar t = distl0 / denom;
+	TVector LayV = argSegment.end - argSegment.start;	//	!<	線分の方向ベクトルを取得
+	TVector s = t * LayV + argSegment.start;
 
 	// 交点が三角形の内側にあるかどうかを調べる。
 	// 三角形の内側にある場合、交点から各頂点へのベクトルと各辺ベクトルの外積（三組）が、
 	// 全て法線と同じ方向を向く
 	// 一つでも方向が一致しなければ、当たらない。
-	Math::Vector3 st0 = argTriangle.pointTop - s;
-	Math::Vector3 t01 = argTriangle.pointLeft - argTriangle.pointTop;
-	Math::Vector3 m = st0.Cross(t01);
-	float dp = m.Dot(argTriangle.normal);
+	TVector st0 = argTriangle.pointTop - s;
+	TVector t01 = argTriangle.pointLeft - argTriangle.pointTop;
+	TVector m = st0.Cross(t01);
+	Scalar dp = m.Dot(argTriangle.normal);
 	if (dp <= epsilon)
 	{
 		return false;
 	}
-	Math::Vector3 st1 = argTriangle.pointLeft - s;
-	Math::Vector3 t12 = argTriangle.pointRight - argTriangle.pointLeft;
+	TVector st1 = argTriangle.pointLeft - s;
+	TVector t12 = argTriangle.pointRight - argTriangle.pointLeft;
 	m = st1.Cross(t12);
 	dp = m.Dot(argTriangle.normal);
 	if (dp <= epsilon)
 	{
 		return false;
 	}
-	Math::Vector3 st2 = argTriangle.pointRight - s;
-	Math::Vector3 t20 = argTriangle.pointTop - argTriangle.pointRight;
+	TVector st2 = argTriangle.pointRight - s;
+	TVector t20 = argTriangle.pointTop - argTriangle.pointRight;
 	m = st2.Cross(t20);
 	dp = m.Dot(argTriangle.normal);
 	if (dp <= epsilon)
@@ -614,3 +642,132 @@ bool Utility::CheckSegment2Triangle(const Segment& argSegment, const Triangle& a
 
 	return true;
 }
+
+/**
+ *	@fn			CheckCapsule2Triangle
+ *	@brief		カプセルと法線付き三角形の当たりチェック
+ *	@param[in]	argCapsule	!<	カプセル
+ *	@param[in]	argTriangle	!<	法線付き三角形
+ *	@param[in]	argInter	!<	三角形上の最近接点（省略可）
+ *	@return		カプセルと三角形が交差していればtrue、そうでなければfalse
+ *	@note		表裏どちらからでも当たる
+ */
+template<typename TVector>
+bool Utility::CheckCapsule2Triangle(const BasicCapsule<TVector>& argCapsule, const BasicTriangle<TVector>& argTriangle, NonDeducedT<TVector> *argInter)
+{
+	using Scalar = ScalarOf<TVector>;
+	const BasicSegment<TVector>& Axis = argCapsule.segment;
+
+	// 軸が三角形を貫いていれば、貫いた点で当たる
+	TVector closest;
+	if (CheckSegment2Triangle(Axis, argTriangle, &closest) ||
+		CheckSegment2Triangle(BasicSegment<TVector>(Axis.end, Axis.start), argTriangle, &closest))
+	{
+		if (argInter)
+		{
+			*argInter = closest;
+		}
+		return true;
+	}
+
+	// 貫いていなければ、最も近いのは軸の端点と三角形の間か、軸と三角形の辺の間
+	ClosestPtPoint2Triangle(Axis.start, argTriangle, &closest);
+	Scalar distanceSQ = Distance3DSQ(Axis.start, closest);
+
+	TVector point;
+	ClosestPtPoint2Triangle(Axis.end, argTriangle, &point);
+	Scalar d = Distance3DSQ(Axis.end, point);
+	if (d < distanceSQ)
+	{
+		distanceSQ = d;
+		closest = point;
+	}
+
+	const BasicSegment<TVector> Edges[3] = {
+		BasicSegment<TVector>(argTriangle.pointTop, argTriangle.pointLeft),
+		BasicSegment<TVector>(argTriangle.pointLeft, argTriangle.pointRight),
+		BasicSegment<TVector>(argTriangle.pointRight, argTriangle.pointTop) };
+	for (const BasicSegment<TVector>& Edge : Edges)
+	{
+		TVector onAxis;
+		ClosestPtSegment2Segment(Axis, Edge, &onAxis, &point);
+		d = Distance3DSQ(onAxis, point);
+		if (d < distanceSQ)
+		{
+			distanceSQ = d;
+			closest = point;
+		}
+	}
+
+	if (distanceSQ <= argCapsule.radius * argCapsule.radius)
+	{
+		if (argInter)
+		{
+			*argInter = closest;
+		}
+		return true;
+	}
+
+	return false;
+}
+/**
+ *	@fn			ComputeAabb
+ *	@brief		球を囲む箱を計算
+ *	@param[in]	argSphere	!<	球
+ *	@return		球を囲む箱
+ */
+template<typename TVector>
+Utility::BasicAabb<TVector> Utility::ComputeAabb(const BasicSphere<TVector>& argSphere)
+{
+	const TVector Extent(argSphere.radius, argSphere.radius, argSphere.radius);
+	return BasicAabb<TVector>(argSphere.center - Extent, argSphere.center + Extent);
+}
+/**
+ *	@fn			ComputeAabb
+ *	@brief		線分を囲む箱を計算
+ *	@param[in]	argSegment	!<	線分
+ *	@return		線分を囲む箱
+ */
+template<typename TVector>
+Utility::BasicAabb<TVector> Utility::ComputeAabb(const BasicSegment<TVector>& argSegment)
+{
+	const TVector& Start = argSegment.start;
+	const TVector& End = argSegment.end;
+	const TVector Lower((Start.x < End.x) ? Start.x : End.x, (Start.y < End.y) ? Start.y : End.y, (Start.z < End.z) ? Start.z : End.z);
+	const TVector Upper((Start.x < End.x) ? End.x : Start.x, (Start.y < End.y) ? End.y : Start.y, (Start.z < End.z) ? End.z : Start.z);
+	return BasicAabb<TVector>(Lower, Upper);
+}
+/**
+ *	@fn			ComputeAabb
+ *	@brief		カプセルを囲む箱を計算
+ *	@param[in]	argCapsule	!<	カプセル
+ *	@return		カプセルを囲む箱
+ */
+template<typename TVector>
+Utility::BasicAabb<TVector> Utility::ComputeAabb(const BasicCapsule<TVector>& argCapsule)
+{
+	const BasicAabb<TVector> Bounds = ComputeAabb(argCapsule.segment);
+	const TVector Extent(argCapsule.radius, argCapsule.radius, argCapsule.radius);
+	return BasicAabb<TVector>(Bounds.lower - Extent, Bounds.upper + Extent);
+}
+
+#define UTILITY_COLLISION3D_INSTANTIATE(TVector) \
+	template bool Utility::CheckSphere2Sphere(const BasicSphere<TVector>&, const BasicSphere<TVector>&, TVector*); \
+	template bool Utility::CheckCapsule2Capsule(const BasicCapsule<TVector>&, const BasicCapsule<TVector>&, TVector*); \
+	template bool Utility::CheckSphere2Capsule(const BasicSphere<TVector>&, const BasicCapsule<TVector>&, TVector*); \
+	template void Utility::ClosestPtSegment2Segment(const BasicSegment<TVector>&, const BasicSegment<TVector>&, TVector*, TVector*); \
+	template void Utility::ClosestPtPoint2Segment(const TVector&, const BasicSegment<TVector>&, TVector*); \
+	template void Utility::ClosestPtPoint2Triangle(const TVector&, const BasicTriangle<TVector>&, TVector*); \
+	template bool Utility::CheckPoint2Triangle(const TVector&, const BasicTriangle<TVector>&); \
+	template bool Utility::CheckSphere2Triangle(const BasicSphere<TVector>&, const BasicTriangle<TVector>&, TVector*); \
+	template void Utility::ComputeTriangle(const TVector&, const TVector&, const TVector&, BasicTriangle<TVector>*); \
+	template bool Utility::CheckSegment2Triangle(const BasicSegment<TVector>&, const BasicTriangle<TVector>&, TVector*); \
+	template bool Utility::CheckCapsule2Triangle(const BasicCapsule<TVector>&, const BasicTriangle<TVector>&, TVector*); \
+	template Utility::BasicAabb<TVector> Utility::ComputeAabb(const BasicSphere<TVector>&); \
+	template Utility::BasicAabb<TVector> Utility::ComputeAabb(const BasicSegment<TVector>&); \
+	template Utility::BasicAabb<TVector> Utility::ComputeAabb(const BasicCapsule<TVector>&);
+
+UTILITY_COLLISION3D_INSTANTIATE(Utility::Math::Vector3)
+UTILITY_COLLISION3D_INSTANTIATE(Utility::Math::FixedVector3<Utility::Math::Fixed32>)
+
+#undef UTILITY_COLLISION3D_INSTANTIATE
@@ -0,0 +1,264 @@
+﻿/**
+ *	@file	CollisionStream3D.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "CollisionStream3D.h"
+#include "../Math/SimdLanes.h"
+
+namespace
+{
+	using Utility::ContactStream;
+	using Utility::Math::Vector3Stream;
+
+	static_assert(Vector3Stream::ParallelGrain % ContactStream::MaskBits == 0, "ParallelGrain must be a multiple of MaskBits...");
+
+#pragma region		Lanes
+	/*
+	 *	SimdLanesに判定のための比較と、比較結果をビットにまとめる演算を足したもの。
+	 *	MoveMaskは要素ごとの比較結果を下位ビットから並べた整数にする。
+	 */
+
+	/**
+	 *  @struct		ScalarContactLanes
+	 *  @brief		1要素ずつの演算
+	 */
+	struct ScalarContactLanes : public Utility::Math::Simd::ScalarLanes
+	{
+		static inline Mask LessEqual(Reg argA, Reg argB) { return argA <= argB; }
+		static inline unsigned int MoveMask(Mask argMask) { return argMask ? 1u : 0u; }
+	};
+
+#if defined(UTILITY_MATH_LANES_AVX2)
+	/**
+	 *  @struct		Avx2ContactLanes
+	 *  @brief		8要素ずつの演算
+	 */
+	struct Avx2ContactLanes : public Utility::Math::Simd::Avx2Lanes
+	{
+		static inline Mask LessEqual(Reg argA, Reg argB) { return _mm256_cmp_ps(argA, argB, _CMP_LE_OQ); }
+		static inline unsigned int MoveMask(Mask argMask) { return static_cast<unsigned int>(_mm256_movemask_ps(argMask)); }
+	};
+	using WideContactLanes = Avx2ContactLanes;
+#elif defined(UTILITY_MATH_LANES_SSE2)
+	/**
+	 *  @struct		Sse2ContactLanes
+	 *  @brief		4要素ずつの演算
+	 */
+	struct Sse2ContactLanes : public Utility::Math::Simd::Sse2Lanes
+	{
+		static inline Mask LessEqual(Reg argA, Reg argB) { return _mm_cmple_ps(argA, argB); }
+		static inline unsigned int MoveMask(Mask argMask) { return static_cast<unsigned int>(_mm_movemask_ps(argMask)); }
+	};
+	using WideContactLanes = Sse2ContactLanes;
+#else
+	using WideContactLanes = ScalarContactLanes;
+#endif
+#pragma endregion	Lanes
+
+#pragma region		Kernel
+	/*
+	 *	各カーネルはApply<Lanes>(i)でi番目からLanes::Width個の組を処理する。
+	 *	Simd::Runは塊(ParallelGrain個、MaskBitsの倍数)の先頭から順に処理するので、
+	 *	hitMaskの各要素は先頭の組で上書きし、残りの組はビットを足していく。
+	 */
+
+	/**
+	 *  @struct		ContactOutput
+	 *  @brief		判定結果の書き出し先
+	 */
+	struct ContactOutput
+	{
+		uint32_t	*hitMask_;
+		float		*pointX_;
+		float		*pointY_;
+		float		*pointZ_;
+		float		*normalX_;
+		float		*normalY_;
+		float		*normalZ_;
+		float		*depth_;
+
+		explicit ContactOutput(ContactStream *argContacts)
+			: hitMask_(argContacts->hitMask.data()),
+			pointX_(argContacts->point.X()), pointY_(argContacts->point.Y()), pointZ_(argContacts->point.Z()),
+			normalX_(argContacts->normal.X()), normalY_(argContacts->normal.Y()), normalZ_(argContacts->normal.Z()),
+			depth_(argContacts->depth.data())
+		{
+		}
+
+		/**
+		 *	@fn			Write
+		 *	@brief		Aの点とBの点の距離を半径の和と比べ、判定結果を書き出す
+		 *	@note		交点はB + (A - B) * rB / (rA + rB)で、1組ずつの版と同じ
+		 */
+		template<typename L>
+		inline void Write(size_t argIndex,
+			typename L::Reg argAX, typename L::Reg argAY, typename L::Reg argAZ, typename L::Reg argRadiusA,
+			typename L::Reg argBX, typename L::Reg argBY, typename L::Reg argBZ, typename L::Reg argRadiusB) const
+		{
+			using Reg = typename L::Reg;
+			const Reg DX = L::Sub(argAX, argBX);
+			const Reg DY = L::Sub(argAY, argBY);
+			const Reg DZ = L::Sub(argAZ, argBZ);
+			const Reg DistanceSQ = L::Add(L::Add(L::Mul(DX, DX), L::Mul(DY, DY)), L::Mul(DZ, DZ));
+			const Reg RadiusSum = L::Add(argRadiusA, argRadiusB);
+
+			const uint32_t Bits = L::MoveMask(L::LessEqual(DistanceSQ, L::Mul(RadiusSum, RadiusSum)));
+			const size_t Shift = argIndex % ContactStream::MaskBits;
+			uint32_t &word = hitMask_[argIndex / ContactStream::MaskBits];
+			word = (Shift == 0) ? Bits : (word | (Bits << Shift));
+
+			L::Store(pointX_ + argIndex, L::Add(argBX, L::Div(L::Mul(DX, argRadiusB), RadiusSum)));
+			L::Store(pointY_ + argIndex, L::Add(argBY, L::Div(L::Mul(DY, argRadiusB), RadiusSum)));
+			L::Store(pointZ_ + argIndex, L::Add(argBZ, L::Div(L::Mul(DZ, argRadiusB), RadiusSum)));
+
+			const Reg Distance = L::Sqrt(DistanceSQ);
+			const Reg Inverse = L::ZeroIfZero(Distance, L::Div(L::Set(1.f), Distance));
+			L::Store(normalX_ + argIndex, L::Mul(DX, Inverse));
+			L::Store(normalY_ + argIndex, L::Mul(DY, Inverse));
+			L::Store(normalZ_ + argIndex, L::Mul(DZ, Inverse));
+			L::Store(depth_ + argIndex, L::Sub(RadiusSum, Distance));
+		}
+	};
+
+	/**
+	 *  @struct		SphereSphereKernel
+	 *  @brief		球と球の判定
+	 */
+	struct SphereSphereKernel
+	{
+		const float		*ax_;
+		const float		*ay_;
+		const float		*az_;
+		const float		*radiusA_;
+		const float		*bx_;
+		const float		*by_;
+		const float		*bz_;
+		const float		*radiusB_;
+		ContactOutput	output_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			output_.Write<L>(argIndex,
+				L::Load(ax_ + argIndex), L::Load(ay_ + argIndex), L::Load(az_ + argIndex), L::Load(radiusA_ + argIndex),
+				L::Load(bx_ + argIndex), L::Load(by_ + argIndex), L::Load(bz_ + argIndex), L::Load(radiusB_ + argIndex));
+		}
+	};
+
+	/**
+	 *  @struct		SphereCapsuleKernel
+	 *  @brief		球とカプセルの判定
+	 */
+	struct SphereCapsuleKernel
+	{
+		const float		*cx_;
+		const float		*cy_;
+		const float		*cz_;
+		const float		*radiusA_;
+		const float		*sx_;
+		const float		*sy_;
+		const float		*sz_;
+		const float		*ex_;
+		const float		*ey_;
+		const float		*ez_;
+		const float		*radiusB_;
+		ContactOutput	output_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			using Reg = typename L::Reg;
+			const Reg CX = L::Load(cx_ + argIndex);
+			const Reg CY = L::Load(cy_ + argIndex);
+			const Reg CZ = L::Load(cz_ + argIndex);
+			const Reg SX = L::Load(sx_ + argIndex);
+			const Reg SY = L::Load(sy_ + argIndex);
+			const Reg SZ = L::Load(sz_ + argIndex);
+			const Reg VX = L::Sub(L::Load(ex_ + argIndex), SX);
+			const Reg VY = L::Sub(L::Load(ey_ + argIndex), SY);
+			const Reg VZ = L::Sub(L::Load(ez_ + argIndex), SZ);
+
+			// ClosestPtPoint2Segmentと同じく、射影した位置を[0, 1]に収める(長さ0の線分は始点)
+			const Reg LengthSQ = L::Add(L::Add(L::Mul(VX, VX), L::Mul(VY, VY)), L::Mul(VZ, VZ));
+			const Reg Projection = L::Add(L::Add(L::Mul(VX, L::Sub(CX, SX)), L::Mul(VY, L::Sub(CY, SY))), L::Mul(VZ, L::Sub(CZ, SZ)));
+			const Reg T = L::Max(L::Min(L::ZeroIfZero(LengthSQ, L::Div(Projection, LengthSQ)), L::Set(1.f)), L::Set(0.f));
+
+			output_.Write<L>(argIndex, CX, CY, CZ, L::Load(radiusA_ + argIndex),
+				L::Add(L::Mul(T, VX), SX), L::Add(L::Mul(T, VY), SY), L::Add(L::Mul(T, VZ), SZ), L::Load(radiusB_ + argIndex));
+		}
+	};
+#pragma endregion	Kernel
+}
+
+void Utility::SphereStream::Resize(size_t argCount)
+{
+	center.Resize(argCount);
+	radius.resize(argCount);
+}
+
+void Utility::SphereStream::Load(const Sphere *argSrc, size_t argCount)
+{
+	Resize(argCount);
+	for (size_t i = 0; i < argCount; ++i)
+		Set(i, argSrc[i]);
+}
+
+void Utility::CapsuleStream::Resize(size_t argCount)
+{
+	start.Resize(argCount);
+	end.Resize(argCount);
+	radius.resize(argCount);
+}
+
+void Utility::CapsuleStream::Load(const Capsule *argSrc, size_t argCount)
+{
+	Resize(argCount);
+	for (size_t i = 0; i < argCount; ++i)
+		Set(i, argSrc[i]);
+}
+
+void Utility::ContactStream::Resize(size_t argCount)
+{
+	hitMask.resize((argCount + MaskBits - 1) / MaskBits);
+	point.Resize(argCount);
+	normal.Resize(argCount);
+	depth.resize(argCount);
+}
+
+size_t Utility::ContactStream::CountHits() const
+{
+	size_t count = 0;
+	for (uint32_t bits : hitMask)
+	{
+		for (; bits != 0; bits &= bits - 1)
+			++count;
+	}
+	return count;
+}
+
+void Utility::CheckSphere2Sphere(const SphereStream &argSphereA, const SphereStream &argSphereB, ContactStream *argContacts, ThreadPool *argPool)
+{
+	assert(argSphereA.Size() == argSphereB.Size() && "SphereStream size mismatch...");
+	const size_t Count = argSphereA.Size();
+	argContacts->Resize(Count);
+	const SphereSphereKernel Kernel = {
+		argSphereA.center.X(), argSphereA.center.Y(), argSphereA.center.Z(), argSphereA.radius.data(),
+		argSphereB.center.X(), argSphereB.center.Y(), argSphereB.center.Z(), argSphereB.radius.data(),
+		ContactOutput(argContacts) };
+	Math::Simd::Run<WideContactLanes, ScalarContactLanes>(Kernel, Count, Math::Vector3Stream::ParallelGrain, argPool);
+}
+
+void Utility::CheckSphere2Capsule(const SphereStream &argSphere, const CapsuleStream &argCapsule, ContactStream *argContacts, ThreadPool *argPool)
+{
+	assert(argSphere.Size() == argCapsule.Size() && "SphereStream and CapsuleStream size mismatch...");
+	const size_t Count = argSphere.Size();
+	argContacts->Resize(Count);
+	const SphereCapsuleKernel Kernel = {
+		argSphere.center.X(), argSphere.center.Y(), argSphere.center.Z(), argSphere.radius.data(),
+		argCapsule.start.X(), argCapsule.start.Y(), argCapsule.start.Z(),
+		argCapsule.end.X(), argCapsule.end.Y(), argCapsule.end.Z(), argCapsule.radius.data(),
+		ContactOutput(argContacts) };
+	Math::Simd::Run<WideContactLanes, ScalarContactLanes>(Kernel, Count, Math::Vector3Stream::ParallelGrain, argPool);
+}
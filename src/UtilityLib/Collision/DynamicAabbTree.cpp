@@ -0,0 +1,323 @@
+﻿/**
+ *	@file	DynamicAabbTree.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "DynamicAabbTree.h"
+
+#include <algorithm>
+
+namespace
+{
+	using Utility::Aabb;
+
+	inline Aabb Union(const Aabb &argA, const Aabb &argB)
+	{
+		return Aabb(
+			Utility::Math::Vector3(std::min(argA.lower.x, argB.lower.x), std::min(argA.lower.y, argB.lower.y), std::min(argA.lower.z, argB.lower.z)),
+			Utility::Math::Vector3(std::max(argA.upper.x, argB.upper.x), std::max(argA.upper.y, argB.upper.y), std::max(argA.upper.z, argB.upper.z)));
+	}
+
+	/**
+	 *	@fn			Contains
+	 *	@brief		argOuterがargInnerを含んでいるか
+	 */
+	inline bool Contains(const Aabb &argOuter, const Aabb &argInner)
+	{
+		return argOuter.lower.x <= argInner.lower.x && argOuter.lower.y <= argInner.lower.y && argOuter.lower.z <= argInner.lower.z &&
+			argInner.upper.x <= argOuter.upper.x && argInner.upper.y <= argOuter.upper.y && argInner.upper.z <= argOuter.upper.z;
+	}
+
+	/**
+	 *	@fn			SurfaceArea
+	 *	@brief		表面積の半分(比べるだけなので2倍しない)
+	 */
+	inline float SurfaceArea(const Aabb &argBounds)
+	{
+		const float X = argBounds.upper.x - argBounds.lower.x;
+		const float Y = argBounds.upper.y - argBounds.lower.y;
+		const float Z = argBounds.upper.z - argBounds.lower.z;
+		return X * Y + Y * Z + Z * X;
+	}
+
+	inline Aabb Expand(const Aabb &argBounds, float argAmount)
+	{
+		const Utility::Math::Vector3 Extent(argAmount, argAmount, argAmount);
+		return Aabb(argBounds.lower - Extent, argBounds.upper + Extent);
+	}
+}
+
+const float Utility::DynamicAabbTree::DefaultMargin = 0.1f;
+const float Utility::DynamicAabbTree::DefaultDisplacementScale = 4.f;
+
+Utility::DynamicAabbTree::DynamicAabbTree(float argMargin, float argDisplacementScale)
+	: nodes_(), root_(NullNode), freeList_(NullNode), proxyCount_(0), margin_(argMargin), displacementScale_(argDisplacementScale)
+{
+	assert(argMargin >= 0.f && "DynamicAabbTree margin must not be negative...");
+}
+
+int32_t Utility::DynamicAabbTree::Insert(const Aabb &argBounds, uint32_t argUserData)
+{
+	const int32_t Proxy = AllocateNode();
+	Node &leaf = nodes_[Proxy];
+	leaf.bounds = Fatten(argBounds, Math::Vector3());
+	leaf.userData = argUserData;
+	leaf.height = 0;
+
+	InsertLeaf(Proxy);
+	++proxyCount_;
+	return Proxy;
+}
+
+void Utility::DynamicAabbTree::Remove(int32_t argProxy)
+{
+	assert(IsProxy(argProxy) && "Invalid proxy...");
+	RemoveLeaf(argProxy);
+	FreeNode(argProxy);
+	--proxyCount_;
+}
+
+bool Utility::DynamicAabbTree::Move(int32_t argProxy, const Aabb &argBounds, const Math::Vector3 &argDisplacement)
+{
+	assert(IsProxy(argProxy) && "Invalid proxy...");
+	const Aabb &Current = nodes_[argProxy].bounds;
+	if (Contains(Current, argBounds))
+	{
+		// 前に大きく動いたときの先読みで広がったままなら、小さくするために挿し直す
+		const Aabb Limit = Expand(Fatten(argBounds, argDisplacement), margin_ * 4.f);
+		if (Contains(Limit, Current))
+			return false;
+	}
+
+	RemoveLeaf(argProxy);
+	nodes_[argProxy].bounds = Fatten(argBounds, argDisplacement);
+	InsertLeaf(argProxy);
+	return true;
+}
+
+bool Utility::DynamicAabbTree::Refit(int32_t argProxy, const Aabb &argBounds, const Math::Vector3 &argDisplacement)
+{
+	assert(IsProxy(argProxy) && "Invalid proxy...");
+	if (Contains(nodes_[argProxy].bounds, argBounds))
+		return false;
+
+	nodes_[argProxy].bounds = Fatten(argBounds, argDisplacement);
+	RefitAncestors(nodes_[argProxy].parent, false);
+	return true;
+}
+
+void Utility::DynamicAabbTree::Clear()
+{
+	nodes_.clear();
+	root_ = NullNode;
+	freeList_ = NullNode;
+	proxyCount_ = 0;
+}
+
+void Utility::DynamicAabbTree::QueryPairs(std::vector<ProxyPair> *argPairs) const
+{
+	QueryPairs([argPairs](int32_t argProxyA, int32_t argProxyB)
+	{
+		argPairs->push_back({ argProxyA, argProxyB });
+	});
+}
+
+int32_t Utility::DynamicAabbTree::AllocateNode()
+{
+	int32_t index = freeList_;
+	if (index == NullNode)
+	{
+		index = static_cast<int32_t>(nodes_.size());
+		nodes_.emplace_back();
+	}
+	else
+	{
+		freeList_ = nodes_[index].parent;
+	}
+
+	Node &node = nodes_[index];
+	node.parent = NullNode;
+	node.child1 = NullNode;
+	node.child2 = NullNode;
+	node.height = 0;
+	node.userData = 0;
+	return index;
+}
+
+void Utility::DynamicAabbTree::FreeNode(int32_t argNode)
+{
+	Node &node = nodes_[argNode];
+	node.parent = freeList_;
+	node.height = -1;
+	freeList_ = argNode;
+}
+
+Utility::Aabb Utility::DynamicAabbTree::Fatten(const Aabb &argBounds, const Math::Vector3 &argDisplacement) const
+{
+	Aabb result = Expand(argBounds, margin_);
+	const Math::Vector3 Displacement = argDisplacement * displacementScale_;
+	// 移動する向きの面だけを押し出す
+	(Displacement.x < 0.f ? result.lower.x : result.upper.x) += Displacement.x;
+	(Displacement.y < 0.f ? result.lower.y : result.upper.y) += Displacement.y;
+	(Displacement.z < 0.f ? result.lower.z : result.upper.z) += Displacement.z;
+	return result;
+}
+
+void Utility::DynamicAabbTree::InsertLeaf(int32_t argLeaf)
+{
+	if (root_ == NullNode)
+	{
+		root_ = argLeaf;
+		nodes_[argLeaf].parent = NullNode;
+		return;
+	}
+
+	// 兄弟にしたときに増える表面積が最小の節まで降りる
+	const Aabb LeafBounds = nodes_[argLeaf].bounds;
+	int32_t index = root_;
+	while (!nodes_[index].IsLeaf())
+	{
+		const Node &Current = nodes_[index];
+		const float Area = SurfaceArea(Current.bounds);
+		const float CombinedArea = SurfaceArea(Union(Current.bounds, LeafBounds));
+		// ここに新しい親を作る費用と、これより下に降りたときに祖先が広がる分の費用
+		const float Cost = 2.f * CombinedArea;
+		const float InheritanceCost = 2.f * (CombinedArea - Area);
+
+		float childCost[2];
+		const int32_t Children[2] = { Current.child1, Current.child2 };
+		for (int i = 0; i < 2; ++i)
+		{
+			const Node &Child = nodes_[Children[i]];
+			const float Combined = SurfaceArea(Union(LeafBounds, Child.bounds));
+			childCost[i] = (Child.IsLeaf() ? Combined : Combined - SurfaceArea(Child.bounds)) + InheritanceCost;
+		}
+
+		if (Cost < childCost[0] && Cost < childCost[1])
+			break;
+		index = (childCost[0] < childCost[1]) ? Children[0] : Children[1];
+	}
+
+	// 兄弟と葉をまとめる親を作る(AllocateNodeで配列が伸びるので、参照はこの後で取る)
+	const int32_t Sibling = index;
+	const int32_t NewParent = AllocateNode();
+	const int32_t OldParent = nodes_[Sibling].parent;
+	Node &parent = nodes_[NewParent];
+	parent.parent = OldParent;
+	parent.bounds = Union(LeafBounds, nodes_[Sibling].bounds);
+	parent.height = nodes_[Sibling].height + 1;
+	parent.child1 = Sibling;
+	parent.child2 = argLeaf;
+	nodes_[Sibling].parent = NewParent;
+	nodes_[argLeaf].parent = NewParent;
+
+	if (OldParent == NullNode)
+	{
+		root_ = NewParent;
+	}
+	else
+	{
+		Node &grand = nodes_[OldParent];
+		(grand.child1 == Sibling ? grand.child1 : grand.child2) = NewParent;
+	}
+
+	RefitAncestors(NewParent, true);
+}
+
+void Utility::DynamicAabbTree::RemoveLeaf(int32_t argLeaf)
+{
+	if (argLeaf == root_)
+	{
+		root_ = NullNode;
+		return;
+	}
+
+	// 親を取り除き、兄弟を祖父の子にする
+	const int32_t Parent = nodes_[argLeaf].parent;
+	const int32_t Grand = nodes_[Parent].parent;
+	const int32_t Sibling = (nodes_[Parent].child1 == argLeaf) ? nodes_[Parent].child2 : nodes_[Parent].child1;
+	FreeNode(Parent);
+	nodes_[Sibling].parent = Grand;
+	if (Grand == NullNode)
+	{
+		root_ = Sibling;
+		return;
+	}
+
+	Node &grand = nodes_[Grand];
+	(grand.child1 == Parent ? grand.child1 : grand.child2) = Sibling;
+	RefitAncestors(Grand, true);
+}
+
+void Utility::DynamicAabbTree::RefitAncestors(int32_t argNode, bool argBalance)
+{
+	int32_t index = argNode;
+	while (index != NullNode)
+	{
+		if (argBalance)
+			index = Balance(index);
+
+		Node &node = nodes_[index];
+		const Node &Child1 = nodes_[node.child1];
+		const Node &Child2 = nodes_[node.child2];
+		node.height = 1 + std::max(Child1.height, Child2.height);
+		node.bounds = Union(Child1.bounds, Child2.bounds);
+		index = node.parent;
+	}
+}
+
+int32_t Utility::DynamicAabbTree::Balance(int32_t argNode)
+{
+	Node &a = nodes_[argNode];
+	if (a.IsLeaf() || a.height < 2)
+		return argNode;
+
+	const int32_t IndexB = a.child1;
+	const int32_t IndexC = a.child2;
+	Node &b = nodes_[IndexB];
+	Node &c = nodes_[IndexC];
+	const int32_t Difference = c.height - b.height;
+
+	// 高い方の子(up)をaの位置に上げ、upの子のうち高い方をupに残し、低い方をaに渡す
+	const auto Rotate = [this, argNode, &a](int32_t argUp, Node &argUpNode, const Node &argStay, bool argUpIsChild2) -> int32_t
+	{
+		const int32_t IndexF = argUpNode.child1;
+		const int32_t IndexG = argUpNode.child2;
+		Node &f = nodes_[IndexF];
+		Node &g = nodes_[IndexG];
+
+		argUpNode.child1 = argNode;
+		argUpNode.parent = a.parent;
+		a.parent = argUp;
+		if (argUpNode.parent == NullNode)
+		{
+			root_ = argUp;
+		}
+		else
+		{
+			Node &grand = nodes_[argUpNode.parent];
+			(grand.child1 == argNode ? grand.child1 : grand.child2) = argUp;
+		}
+
+		const bool KeepF = f.height > g.height;
+		const int32_t Keep = KeepF ? IndexF : IndexG;
+		const int32_t Give = KeepF ? IndexG : IndexF;
+		Node &give = nodes_[Give];
+		argUpNode.child2 = Keep;
+		(argUpIsChild2 ? a.child2 : a.child1) = Give;
+		give.parent = argNode;
+
+		a.bounds = Union(argStay.bounds, give.bounds);
+		a.height = 1 + std::max(argStay.height, give.height);
+		argUpNode.bounds = Union(a.bounds, nodes_[Keep].bounds);
+		argUpNode.height = 1 + std::max(a.height, nodes_[Keep].height);
+		return argUp;
+	};
+
+	if (Difference > 1)
+		return Rotate(IndexC, c, b, true);
+	if (Difference < -1)
+		return Rotate(IndexB, b, c, false);
+	return argNode;
+}
@@ -0,0 +1,210 @@
+﻿/**
+ *	@file	SpatialHashGrid2D.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "SpatialHashGrid2D.h"
+#include "../Task/ThreadPool.h"
+
+namespace
+{
+	using Utility::SpatialHashGrid2D;
+
+	/**
+	 *	@fn			ForEachChunk
+	 *	@brief		[0, argCount)をargGrain個ずつの塊に分けて処理する(argPoolがあれば並列に)
+	 *	@note		塊の番号はargBegin / argGrainで求まる
+	 */
+	template<typename Func>
+	void ForEachChunk(size_t argCount, size_t argGrain, Utility::ThreadPool *argPool, const Func &argFunc)
+	{
+		if (argPool)
+		{
+			argPool->ParallelFor(argCount, argGrain, argFunc);
+			return;
+		}
+		for (size_t begin = 0; begin < argCount; begin += argGrain)
+			argFunc(begin, std::min(begin + argGrain, argCount));
+	}
+
+	inline SpatialHashGrid2D::Bounds CircleBounds(const Utility::Math::Vector2 &argPos, float argRadius)
+	{
+		const Utility::Math::Vector2 Radius(argRadius, argRadius);
+		return { argPos - Radius, argPos + Radius * 2.f };
+	}
+
+	inline SpatialHashGrid2D::Bounds RectBounds(const Utility::ShapeRect &argRect)
+	{
+		const float Left = static_cast<float>(argRect.left);
+		const float Right = static_cast<float>(argRect.right);
+		const float Top = static_cast<float>(argRect.top);
+		const float Bottom = static_cast<float>(argRect.bottom);
+		return {
+			Utility::Math::Vector2(std::min(Left, Right), std::min(Top, Bottom)),
+			Utility::Math::Vector2(std::max(Left, Right), std::max(Top, Bottom)) };
+	}
+}
+
+Utility::SpatialHashGrid2D::SpatialHashGrid2D(float argCellSize, size_t argBucketCount)
+	: bounds_(), cells_(), entryOffset_(), entryKeys_(), entryItems_(), histogram_(), bucketStart_(), items_(),
+	cellSize_(argCellSize), inverseCellSize_(1.f / argCellSize), bucketMask_(static_cast<uint32_t>(argBucketCount - 1))
+{
+	assert(argCellSize > 0.f && "SpatialHashGrid2D cell size must be positive...");
+	assert(argBucketCount > 0 && (argBucketCount & (argBucketCount - 1)) == 0 && argBucketCount <= (size_t(1) << 31) && "SpatialHashGrid2D bucket count must be a power of two...");
+}
+
+void Utility::SpatialHashGrid2D::Build(Span<const Bounds> argBounds, ThreadPool *argPool)
+{
+	bounds_.assign(argBounds.data(), argBounds.data() + argBounds.size());
+	BuildCells(argPool);
+}
+
+void Utility::SpatialHashGrid2D::Build(Span<const CircleShape> argCircles, ThreadPool *argPool)
+{
+	bounds_.resize(argCircles.size());
+	ForEachChunk(argCircles.size(), ParallelGrain, argPool, [this, argCircles](size_t argBegin, size_t argEnd)
+	{
+		for (size_t i = argBegin; i < argEnd; ++i)
+			bounds_[i] = CircleBounds(argCircles[i].Pos(), argCircles[i].Radius());
+	});
+	BuildCells(argPool);
+}
+
+void Utility::SpatialHashGrid2D::Build(Span<const CShape* const> argShapes, ThreadPool *argPool)
+{
+	bounds_.resize(argShapes.size());
+	ForEachChunk(argShapes.size(), ParallelGrain, argPool, [this, argShapes](size_t argBegin, size_t argEnd)
+	{
+		for (size_t i = argBegin; i < argEnd; ++i)
+			bounds_[i] = ComputeBounds(*argShapes[i]);
+	});
+	BuildCells(argPool);
+}
+
+void Utility::SpatialHashGrid2D::Clear()
+{
+	bounds_.clear();
+	cells_.clear();
+	entryOffset_.clear();
+	items_.clear();
+	bucketStart_.clear();
+}
+
+Utility::SpatialHashGrid2D::Bounds Utility::SpatialHashGrid2D::ComputeBounds(const CShape &argShape)
+{
+	if (argShape.Type() == eShapeType::Circle)
+		return CircleBounds(argShape.Pos(), argShape.Radius());
+	return RectBounds(argShape.Rect());
+}
+
+void Utility::SpatialHashGrid2D::QueryPairs(std::vector<ItemPair> *argPairs, ThreadPool *argPool) const
+{
+	if (items_.empty())
+		return;
+
+	// 塊ごとに集めてから塊の順につなげる
+	const size_t BucketCount = GetBucketCount();
+	std::vector<std::vector<ItemPair>> chunkPairs((BucketCount + PairGrain - 1) / PairGrain);
+	ForEachChunk(BucketCount, PairGrain, argPool, [this, &chunkPairs](size_t argBegin, size_t argEnd)
+	{
+		std::vector<ItemPair> &pairs = chunkPairs[argBegin / PairGrain];
+		for (size_t bucket = argBegin; bucket < argEnd; ++bucket)
+		{
+			QueryBucketPairs(static_cast<uint32_t>(bucket), [&pairs](uint32_t argItemA, uint32_t argItemB)
+			{
+				pairs.push_back({ argItemA, argItemB });
+			});
+		}
+	});
+
+	size_t total = argPairs->size();
+	for (const std::vector<ItemPair> &Pairs : chunkPairs)
+		total += Pairs.size();
+	argPairs->reserve(total);
+	for (const std::vector<ItemPair> &Pairs : chunkPairs)
+		argPairs->insert(argPairs->end(), Pairs.begin(), Pairs.end());
+}
+
+void Utility::SpatialHashGrid2D::BuildCells(ThreadPool *argPool)
+{
+	assert(bounds_.size() < UINT32_MAX && "Too many items...");
+	const size_t ItemCount = bounds_.size();
+	const size_t BucketCount = GetBucketCount();
+
+	// 物体ごとのセルの範囲と登録の数
+	cells_.resize(ItemCount);
+	entryOffset_.resize(ItemCount + 1);
+	ForEachChunk(ItemCount, ParallelGrain, argPool, [this](size_t argBegin, size_t argEnd)
+	{
+		for (size_t i = argBegin; i < argEnd; ++i)
+		{
+			const CellRange Cells = ComputeCellRange(bounds_[i]);
+			cells_[i] = Cells;
+			entryOffset_[i + 1] = static_cast<uint32_t>(Cells.x1 - Cells.x0 + 1) * static_cast<uint32_t>(Cells.y1 - Cells.y0 + 1);
+		}
+	});
+	entryOffset_[0] = 0;
+	for (size_t i = 0; i < ItemCount; ++i)
+	{
+		assert(entryOffset_[i + 1] <= UINT32_MAX - entryOffset_[i] && "Too many cell entries...");
+		entryOffset_[i + 1] += entryOffset_[i];
+	}
+
+	// 登録を物体の添字の順に書き出す
+	const size_t EntryCount = entryOffset_[ItemCount];
+	entryKeys_.resize(EntryCount);
+	entryItems_.resize(EntryCount);
+	ForEachChunk(ItemCount, ParallelGrain, argPool, [this](size_t argBegin, size_t argEnd)
+	{
+		for (size_t i = argBegin; i < argEnd; ++i)
+		{
+			const CellRange &Cells = cells_[i];
+			uint32_t entry = entryOffset_[i];
+			for (int32_t y = Cells.y0; y <= Cells.y1; ++y)
+			{
+				for (int32_t x = Cells.x0; x <= Cells.x1; ++x)
+				{
+					entryKeys_[entry] = Hash(x, y);
+					entryItems_[entry] = static_cast<uint32_t>(i);
+					++entry;
+				}
+			}
+		}
+	});
+
+	// 塊ごとにバケットの数を数える
+	const size_t ChunkCount = (EntryCount + ParallelGrain - 1) / ParallelGrain;
+	histogram_.assign(ChunkCount * BucketCount, 0);
+	ForEachChunk(EntryCount, ParallelGrain, argPool, [this, BucketCount](size_t argBegin, size_t argEnd)
+	{
+		uint32_t *counts = &histogram_[argBegin / ParallelGrain * BucketCount];
+		for (size_t i = argBegin; i < argEnd; ++i)
+			++counts[entryKeys_[i]];
+	});
+
+	// バケットの順、同じバケットの中では塊の順に書き込み位置を決める
+	bucketStart_.resize(BucketCount + 1);
+	uint32_t offset = 0;
+	for (size_t bucket = 0; bucket < BucketCount; ++bucket)
+	{
+		bucketStart_[bucket] = offset;
+		for (size_t chunk = 0; chunk < ChunkCount; ++chunk)
+		{
+			uint32_t &count = histogram_[chunk * BucketCount + bucket];
+			const uint32_t Count = count;
+			count = offset;
+			offset += Count;
+		}
+	}
+	bucketStart_[BucketCount] = offset;
+
+	// 塊の中でも順に書き込むので、並べ替えは安定になる
+	items_.resize(EntryCount);
+	ForEachChunk(EntryCount, ParallelGrain, argPool, [this, BucketCount](size_t argBegin, size_t argEnd)
+	{
+		uint32_t *offsets = &histogram_[argBegin / ParallelGrain * BucketCount];
+		for (size_t i = argBegin; i < argEnd; ++i)
+			items_[offsets[entryKeys_[i]]++] = entryItems_[i];
+	});
+}
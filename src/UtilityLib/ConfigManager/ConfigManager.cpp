@@ -16,6 +16,154 @@
 
 std::string Utility::ConfigManager::dataPath_ = "";
 
+namespace
+{
+	/**
+	 *  @fn			SplitCells
+	 *  @brief		カンマ区切りのセルを分割して追加する
+	 *  @param[in]	argBuf		!<	空白を削除した文字列
+	 *  @param[out]	argCells	!<	セルの追加先
+	 */
+	void SplitCells(const std::string &argBuf, std::vector<std::string> *argCells)
+	{
+		std::string::size_type begin = 0;
+		while (begin < argBuf.size())
+		{
+			std::string::size_type end = argBuf.find(',', begin);
+			if (end == std::string::npos)
+				end = argBuf.size();
+			if (end != begin)
+				argCells->push_back(argBuf.substr(begin, end - begin));
+			begin = end + 1;
+		}
+	}
+}
+
+void Utility::ConfigManager::Parse(const std::string &argText)
+{
+	enum class State
+	{
+		Scalar,
+		Array,
+		TableHeader,
+		TableRow,
+		SkipTable,
+	};
+	State state = State::Scalar;
+	std::string key;
+	std::vector<std::string> columnNames;
+	std::vector<std::string> cells;
+
+	std::istringstream lines(argText);
+	std::string buf;
+	while (std::getline(lines, buf))
+	{
+		std::string::size_type commentStart = 0;
+		// '#'以降はコメントとして無視
+		commentStart = buf.find('#');
+		if (commentStart != std::string::size_type(-1))
+			buf = buf.substr(0, commentStart);
+
+		String::DeleteSpace(&buf);
+
+		// 空行は無視
+		if (buf.empty())
+			continue;
+
+		if (state == State::Scalar)
+		{
+			std::string::size_type colon = buf.find(':');
+			char open = (colon != std::string::npos && colon + 1 < buf.size()) ? buf[colon + 1] : '\0';
+			if (open != '[' && open != '{')
+			{
+				// 行文字列を使った処理
+				String::Replace(&buf, ":", " ");
+
+				std::stringstream ss;
+				ss.str(buf);
+
+				while (true)
+				{
+					Constant temp = {};
+					ss >> temp.name_;
+					ss >> temp.data_;
+					if (strcmp(temp.name_, "") == 0)
+						break;
+					data_.push_back(temp);
+					checker_.insert(std::make_pair(Atom(temp.name_), dataIndex_++));
+				}
+				continue;
+			}
+
+			// 配列かテーブルの開始。括弧の後ろは同じ行の続きとして処理する
+			key = buf.substr(0, colon);
+			columnNames.clear();
+			cells.clear();
+			state = (open == '[') ? State::Array : State::TableHeader;
+			buf = buf.substr(colon + 2);
+			if (buf.empty())
+				continue;
+		}
+
+		switch (state)
+		{
+		case State::Array:
+		{
+			std::string::size_type close = buf.find(']');
+			SplitCells(buf.substr(0, close), &cells);
+			if (close != std::string::npos)
+			{
+				tables_[key] = ConfigTable(std::vector<std::string>(1), cells);
+				state = State::Scalar;
+			}
+			break;
+		}
+		case State::TableHeader:
+		{
+			// すぐに閉じたブロックは列も行もない空のテーブルにする
+			std::string::size_type close = buf.find('}');
+			SplitCells(buf.substr(0, close), &columnNames);
+			if (close != std::string::npos)
+			{
+				tables_[key] = ConfigTable(columnNames, cells);
+				state = State::Scalar;
+			}
+			else if (columnNames.empty())
+			{
+				assert(false && "Table header has no column name...");
+				state = State::SkipTable;
+			}
+			else
+			{
+				state = State::TableRow;
+			}
+			break;
+		}
+		case State::TableRow:
+		{
+			std::string::size_type close = buf.find('}');
+			size_t cellNum = cells.size();
+			SplitCells(buf.substr(0, close), &cells);
+			assert((cells.size() - cellNum) % columnNames.size() == 0 && "Table row doesn't match column count...");
+			if (close != std::string::npos)
+			{
+				tables_[key] = ConfigTable(columnNames, cells);
+				state = State::Scalar;
+			}
+			break;
+		}
+		case State::SkipTable:
+			// 読めないテーブルは登録せず、閉じるまで読み飛ばす
+			if (buf.find('}') != std::string::npos)
+				state = State::Scalar;
+			break;
+		default:
+			break;
+		}
+	}
+	assert(state == State::Scalar && "Array or table isn't closed...");
+}
+
 void Utility::ConfigManager::LoadArchive(const char * argFileName, bool argIsDecode)
 {
 	char* binData = nullptr;
@@ -28,33 +176,7 @@ void Utility::ConfigManager::LoadArchive(const char * argFileName, bool argIsDec
 	if(argIsDecode)
 		buf = decode(buf);
 
-	std::string::size_type commentStart = 0;
-	// '#'以降はコメントとして無視
-	commentStart = buf.find('#');
-	if (commentStart != std::string::size_type(-1))
-		buf = buf.substr(0, commentStart);
-
-	// 空行は無視
-	if (buf.empty())
-		return;
-
-	// 行文字列を使った処理
-	buf = String::DeleteSpace(buf);
-	buf = String::Replace(buf, ":", " ");
-
-	std::stringstream ss;
-	ss.str(buf);
-
-	while (true)
-	{
-		Constant temp;
-		ss >> temp.name_;
-		ss >> temp.data_;
-		if (strcmp(temp.name_, "") == 0)
-			break;
-		data_.push_back(temp);
-		checker_.insert(std::make_pair(temp.name_, dataIndex_++));
-	}
+	Parse(buf);
 }
 
 void Utility::ConfigManager::Import(const char * argFilename, bool argIsDecode)
@@ -71,6 +193,7 @@ void Utility::ConfigManager::Import(const char * argFilename, bool argIsDecode)
 	assert(ifs || ifs.is_open() || !ifs.bad() || !ifs.fail() && "file open failed...");
 	Encode decode(Key_);
 
+	std::string text;
 	while (!ifs.eof())
 	{
 		std::string buf;
@@ -78,35 +201,10 @@ void Utility::ConfigManager::Import(const char * argFilename, bool argIsDecode)
 		if (argIsDecode)
 			buf = decode(buf);
 
-		std::string::size_type commentStart = 0;
-		// '#'以降はコメントとして無視
-		commentStart = buf.find('#');
-		if (commentStart != std::string::size_type(-1))
-			buf = buf.substr(0, commentStart);
-
-		// 空行は無視
-		if (buf.empty())
-			continue;
-
-		// 行文字列を使った処理
-		buf = String::DeleteSpace(buf);
-		buf = String::Replace(buf, ":", " ");
-
-		std::stringstream ss;
-		ss.str(buf);
-
-		while (true)
-		{
-			Constant temp;
-			ss >> temp.name_;
-			ss >> temp.data_;
-			if (strcmp(temp.name_, "") == 0)
-				break;
-			data_.push_back(temp);
-			checker_.insert(std::make_pair(temp.name_, dataIndex_++));
-		}
-
+		text += buf;
+		text += '\n';
 	}
+	Parse(text);
 
 	ifs.close();
 }
@@ -130,6 +228,56 @@ void Utility::ConfigManager::Export(const char *argFilename, bool argIsEncode)
 		ofs.write(buf.c_str(), buf.size());
 	}
 
+	for (auto &table : tables_)
+	{
+		const ConfigTable &Src = table.second;
+		const bool IsArray = (Src.ColumnSize() == 1 && Src.ColumnName(0).empty());
+
+		std::string buf = table.first;
+		if (IsArray)
+		{
+			buf += " : [";
+			for (size_t row = 0; row < Src.RowSize(); ++row)
+			{
+				if (row != 0)
+					buf += ", ";
+				buf += Src.CellString(row, 0);
+			}
+			buf += "]\n";
+		}
+		else
+		{
+			buf += " : {\n";
+			if (Src.ColumnSize() > 0)
+			{
+				buf += "\t";
+				for (size_t column = 0; column < Src.ColumnSize(); ++column)
+				{
+					if (column != 0)
+						buf += ", ";
+					buf += Src.ColumnName(column);
+				}
+				buf += "\n";
+			}
+			for (size_t row = 0; row < Src.RowSize(); ++row)
+			{
+				buf += "\t";
+				for (size_t column = 0; column < Src.ColumnSize(); ++column)
+				{
+					if (column != 0)
+						buf += ", ";
+					buf += Src.CellString(row, column);
+				}
+				buf += "\n";
+			}
+			buf += "}\n";
+		}
+		if (argIsEncode)
+			buf = encode(buf);
+
+		ofs.write(buf.c_str(), buf.size());
+	}
+
 	ofs.close();
 }
 
@@ -141,12 +289,24 @@ void Utility::ConfigManager::CanUseArchive(bool argCanUseArchive)
 
 
 const int Utility::ConfigManager::IntData(std::string argKey)
+{
+	// 検索だけなので登録はしない
+	return IntData(Singleton<AtomTable>::Get()->Find(argKey));
+}
+
+const int Utility::ConfigManager::IntData(Atom argKey)
 {
 	const int Res = checker_.at(argKey);
-	assert(CanGetData(Res, argKey.c_str()) && "Can't found Argment key...");
+	assert(CanGetData(Res, std::string(argKey.Name())) && "Can't found Argment key...");
 	return IntData(Res);
 }
 
+const Utility::ConfigTable &Utility::ConfigManager::Table(const std::string &argKey) const
+{
+	assert(HasTable(argKey) && "Can't found Argment key...");
+	return tables_.at(argKey);
+}
+
 void Utility::ConfigManager::DataPath(std::string argDataPath)
 {
 	dataPath_ = argDataPath;
@@ -0,0 +1,90 @@
+﻿/**
+ *	@file	ConfigTable.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "ConfigTable.h"
+#include "../String/String.h"
+#include "../String/NumberFormat.h"
+
+#include <assert.h>
+
+Utility::ConfigTable::ConfigTable(const std::vector<std::string> &argColumnNames, const std::vector<std::string> &argCells)
+{
+	// 中身のないブロックは列も行もない
+	if (argColumnNames.empty())
+	{
+		assert(argCells.empty() && "Table has no column...");
+		return;
+	}
+	assert(argCells.size() % argColumnNames.size() == 0 && "Table cell count doesn't match column count...");
+
+	const size_t ColumnNum = argColumnNames.size();
+	rowSize_ = argCells.size() / ColumnNum;
+	columns_.resize(ColumnNum);
+
+	for (size_t column = 0; column < ColumnNum; ++column)
+	{
+		Column &dst = columns_[column];
+		dst.name_ = argColumnNames[column];
+
+		// 全ての行がintとして読めたら整数の列、読めない行("3000000000"、"1.5"など)があれば実数の列として扱う
+		dst.isInteger_ = true;
+		dst.intData_.resize(rowSize_);
+		for (size_t row = 0; row < rowSize_ && dst.isInteger_; ++row)
+			dst.isInteger_ = NumberFormat::ParseInt(argCells[row * ColumnNum + column], &dst.intData_[row]);
+
+		dst.floatData_.resize(rowSize_);
+		if (dst.isInteger_)
+		{
+			for (size_t row = 0; row < rowSize_; ++row)
+				dst.floatData_[row] = static_cast<float>(dst.intData_[row]);
+		}
+		else
+		{
+			dst.intData_.clear();
+			dst.intData_.shrink_to_fit();
+			for (size_t row = 0; row < rowSize_; ++row)
+			{
+				if (!NumberFormat::ParseFloat(argCells[row * ColumnNum + column], &dst.floatData_[row]))
+				{
+					assert(false && "Table cell isn't number...");
+					dst.floatData_[row] = 0.f;
+				}
+			}
+		}
+	}
+}
+
+size_t Utility::ConfigTable::ColumnIndex(const std::string &argName) const
+{
+	for (size_t i = 0; i < columns_.size(); ++i)
+	{
+		if (columns_[i].name_ == argName)
+			return i;
+	}
+	assert(false && "Can't found Argment column...");
+	return 0;
+}
+
+Utility::Span<const int> Utility::ConfigTable::IntColumn(size_t argColumn) const
+{
+	assert(columns_[argColumn].isInteger_ && "Column isn't integer...");
+	return columns_[argColumn].intData_;
+}
+
+std::string Utility::ConfigTable::CellString(size_t argRow, size_t argColumn) const
+{
+	const Column &src = columns_[argColumn];
+	char buf[NumberFormat::FloatBufferSize];
+	if (src.isInteger_)
+		return std::string(NumberFormat::FormatInt(src.intData_[argRow], buf));
+
+	// 書き出し→読み込みで値が変わらない最短の表記で出力する。
+	// 整数と同じ表記だと読み込んだときに整数の列になるので、小数点を付けて実数の列のままにする
+	std::string cell(NumberFormat::FormatFloat(src.floatData_[argRow], buf));
+	if (String::IsInteger(cell))
+		cell += ".0";
+	return cell;
+}
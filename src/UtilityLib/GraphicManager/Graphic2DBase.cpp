@@ -11,10 +11,13 @@
 
 #include "../Archive/Archive.h"
 #include "../String/String.h"
+#include "../String/NumberFormat.h"
 #include "GraphManager.h"
 #include "../Singleton/Singleton.h"
 
-#include <map>
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
 #include <wrl/client.h>
 
 
@@ -106,7 +109,7 @@ public:
 		auto device = GetD3Ddevice(context_.Get()).Get();
 		std::shared_ptr<Texture> texture = (canUseArchive_) ? LoadTexture(String::ToString(TexPath).c_str(), device) : std::make_shared<Texture>(TexPath, device);
 
-		textures_.insert(std::map<const std::wstring, std::shared_ptr<Texture>>::value_type(nextLoadTextureName_, texture));
+		textures_.insert(std::make_pair(Atom(nextLoadTextureName_), texture));
 		nextLoadTextureName_ = L"";
 	}
 	void Tex()
@@ -116,7 +119,7 @@ public:
 		auto device = GetD3Ddevice(context_.Get()).Get();
 		std::shared_ptr<Texture> texture = (canUseArchive_) ? LoadTexture(String::ToString(TexPath).c_str(), device) : std::make_shared<Texture>(TexPath, device);
 
-		textures_.insert(std::map<const std::wstring, std::shared_ptr<Texture>>::value_type(nextLoadTextureName_, texture));
+		textures_.insert(std::make_pair(Atom(nextLoadTextureName_), texture));
 		nextLoadTextureName_ = L"";
 	}
 
@@ -124,7 +127,7 @@ public:
 private:
 	Microsoft::WRL::ComPtr<ID3D11DeviceContext> context_;
 public:
-	std::map<const std::wstring,
+	std::unordered_map<Atom,
 	std::shared_ptr<Texture>>						textures_;				//	!<	テクスチャキャッシュ
 	std::wstring									nextLoadTextureName_;	//	!<	次にロードするテクスチャ名
 	std::unique_ptr<Direct2DBase>					direct2D_;				//	!<	2Dグラフィックス用リソース
@@ -159,9 +162,16 @@ Utility::Graphic2DBase *Utility::Graphic2DBase::AddAndLoadImage(const std::wstri
 }
 
 std::shared_ptr<Utility::Texture> Utility::Graphic2DBase::FindIndexTexture(const std::wstring argKey)const
+{
+	// 検索だけなので登録はしない
+	return FindIndexTexture(Singleton<AtomTable>::Get()->Find(argKey));
+}
+
+std::shared_ptr<Utility::Texture> Utility::Graphic2DBase::FindIndexTexture(Atom argKey)const
 {
 	assert(pImpl->nextLoadTextureName_ == L"" && "拡張子をつけ忘れています");
-	return (pImpl->textures_.count(argKey) != 0) ? pImpl->textures_.at(argKey) : nullptr;
+	auto it = pImpl->textures_.find(argKey);
+	return (it != pImpl->textures_.end()) ? it->second : nullptr;
 }
 /**
 *	@fn			ConfigTextColor
@@ -195,11 +205,11 @@ void Utility::Graphic2DBase::ConfigTextSize(float argStrSize)
 *	@param[in]	argStr	!<	書き込むテキスト
 *	@param[in]	argPos	!<	テキストを描画する座標
 */
-void Utility::Graphic2DBase::DrawAndWriteText(const std::wstring argStr, DirectX::XMFLOAT2 argPos)const
+void Utility::Graphic2DBase::DrawAndWriteText(std::wstring_view argStr, DirectX::XMFLOAT2 argPos)const
 {
 	pImpl->direct2D_->RenderTarget(pImpl->rt2dDepth_)->DrawTextW(
-		argStr.c_str(),
-		argStr.size(),
+		argStr.data(),
+		static_cast<UINT32>(argStr.size()),
 		pImpl->textFormat_.Get(),
 		D2D1::RectF(argPos.x, argPos.y, static_cast<FLOAT>(Window::Get()->WindowRect().right - Window::Get()->WindowRect().left), static_cast<FLOAT>(Window::Get()->WindowRect().bottom - Window::Get()->WindowRect().top)),
 		pImpl->brushWhite_.Get(),
@@ -212,11 +222,11 @@ void Utility::Graphic2DBase::DrawAndWriteText(const std::wstring argStr, DirectX
 *	@param[in]	argPos			!<	テキストを描画する座標
 *	@param[in]	argScreenSize	!<	スクリーンサイズ
 */
-void Utility::Graphic2DBase::DrawAndWriteText(const std::wstring argStr, DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argScreenSize)const
+void Utility::Graphic2DBase::DrawAndWriteText(std::wstring_view argStr, DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argScreenSize)const
 {
 	pImpl->direct2D_->RenderTarget(pImpl->rt2dDepth_)->DrawTextW(
-		argStr.c_str(),
-		argStr.size(),
+		argStr.data(),
+		static_cast<UINT32>(argStr.size()),
 		pImpl->textFormat_.Get(),
 		D2D1::RectF(argPos.x, argPos.y, argScreenSize.x, argScreenSize.y),
 		pImpl->brushWhite_.Get(),
@@ -281,6 +291,35 @@ namespace
 
 		return true;
 	}
+
+	const int MinusCell = 10;	//	!<	数字のテクスチャで'-'があるコマ(0～9の次)
+
+	/**
+	 *	@fn			NumDigits
+	 *	@brief		描画する数字の文字列化
+	 *	@param[in]	argNum			!<	描画したい数字(小数部は描画しない)
+	 *	@param[in]	argDigitMax		!<	最大桁数
+	 *	@param[out]	argBuf			!<	書き込み先
+	 *	@param[out]	argIsNegative	!<	整数部が負か
+	 *	@return		絶対値の数字の文字列(最大桁数まで上位を0で埋める)
+	 *	@note		桁ごとに実数で割り直さず、整数にしてからまとめて文字列にする
+	 */
+	std::string_view NumDigits(float argNum, int argDigitMax, char (&argBuf)[Utility::NumberFormat::IntegerBufferSize], bool *argIsNegative)
+	{
+		const float Magnitude = std::fabs(argNum);
+		const long long Num = (Magnitude < 1e18f) ? static_cast<long long>(Magnitude) : 999999999999999999LL;
+		*argIsNegative = (argNum < 0.f) && (Num != 0);
+		return Utility::NumberFormat::FormatInt(Num, argBuf, std::min(argDigitMax, static_cast<int>(sizeof(argBuf)) - 1));
+	}
+
+	/**
+	 *	@fn			HasMinusCell
+	 *	@brief		数字のテクスチャに'-'のコマがあるか
+	 */
+	bool HasMinusCell(const std::weak_ptr<Utility::Texture> &argTexture, float argCellWidth)
+	{
+		return !argTexture.expired() && argTexture.lock()->ImageSize().x >= argCellWidth * (MinusCell + 1);
+	}
 }
 /**
 *	@fn			DrawNum
@@ -294,27 +333,17 @@ namespace
 */
 void Utility::DrawNum(DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argSize, const float argNum, const std::weak_ptr<Texture> &argTexture, const int argDigitMax, DirectX::XMFLOAT4 argColor)
 {
-	float w = argNum;
-	int i = 0;	//	!<	作業用の変数
-
-	if (static_cast<int>(w) == 0)
+	char buf[NumberFormat::IntegerBufferSize];
+	bool isNegative = false;
+	const std::string_view Digits = NumDigits(argNum, argDigitMax, buf, &isNegative);
+	const int Count = std::min(static_cast<int>(Digits.size()), argDigitMax);
+	for (int i = 0; i < Count; ++i)
 	{
-		for (i = 0; i < argDigitMax; ++i)
-		{
-			DrawRectGraph(DirectX::XMFLOAT2(argPos.x - i * argSize.x, argPos.y), DirectX::XMFLOAT2(0, 0), argSize, argTexture, argColor);
-		}
-	}
-	else
-	{
-		while (w)
-		{
-			DrawRectGraph(DirectX::XMFLOAT2(argPos.x - i * argSize.x, argPos.y), DirectX::XMFLOAT2(((static_cast<int>(w) % 10) * argSize.x), 0), argSize, argTexture, argColor);
-			w *= 0.1f;
-			++i;
-			if (i >= argDigitMax)
-				break;
-		}
+		const int Digit = Digits[Digits.size() - 1 - i] - '0';
+		DrawRectGraph(DirectX::XMFLOAT2(argPos.x - i * argSize.x, argPos.y), DirectX::XMFLOAT2(Digit * argSize.x, 0), argSize, argTexture, argColor);
 	}
+	if (isNegative && HasMinusCell(argTexture, argSize.x))
+		DrawRectGraph(DirectX::XMFLOAT2(argPos.x - Count * argSize.x, argPos.y), DirectX::XMFLOAT2(MinusCell * argSize.x, 0), argSize, argTexture, argColor);
 }
 /**
 *	@fn			DrawNum
@@ -329,27 +358,17 @@ void Utility::DrawNum(DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argSize, const
 */
 void Utility::DrawNum(DirectX::XMFLOAT2 argPos, DirectX::XMFLOAT2 argSize, float argExRate, const float argNum, const std::weak_ptr<Texture> &argTexture, const int argDigitMax, DirectX::XMFLOAT4 argColor)
 {
-	float w = argNum;
-	int i = 0;	//	!<	作業用の変数
-
-	if (static_cast<int>(w) == 0)
-	{
-		for (i = 0; i < argDigitMax; ++i)
-		{
-			DrawRectRotaGraph(DirectX::XMFLOAT2(argPos.x - i * argSize.x, argPos.y), DirectX::XMFLOAT2(0, 0), argSize, argExRate, 0.f, argTexture, argColor);
-		}
-	}
-	else
+	char buf[NumberFormat::IntegerBufferSize];
+	bool isNegative = false;
+	const std::string_view Digits = NumDigits(argNum, argDigitMax, buf, &isNegative);
+	const int Count = std::min(static_cast<int>(Digits.size()), argDigitMax);
+	for (int i = 0; i < Count; ++i)
 	{
-		while (w)
-		{
-			DrawRectRotaGraph(DirectX::XMFLOAT2(argPos.x - i * argSize.x, argPos.y), DirectX::XMFLOAT2(((static_cast<int>(w) % 10) * argSize.x), 0), argSize, argExRate, 0.f, argTexture, argColor);
-			w *= 0.1f;
-			++i;
-			if (i >= argDigitMax)
-				break;
-		}
+		const int Digit = Digits[Digits.size() - 1 - i] - '0';
+		DrawRectRotaGraph(DirectX::XMFLOAT2(argPos.x - i * argSize.x, argPos.y), DirectX::XMFLOAT2(Digit * argSize.x, 0), argSize, argExRate, 0.f, argTexture, argColor);
 	}
+	if (isNegative && HasMinusCell(argTexture, argSize.x))
+		DrawRectRotaGraph(DirectX::XMFLOAT2(argPos.x - Count * argSize.x, argPos.y), DirectX::XMFLOAT2(MinusCell * argSize.x, 0), argSize, argExRate, 0.f, argTexture, argColor);
 }
 /**
 *	@fn			DrawGraph（描画サイズ、深度指定なし）
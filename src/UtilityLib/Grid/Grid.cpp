@@ -9,10 +9,51 @@
 #include "../Singleton/Singleton.h"
 #include "../ConstantBuffer.h"
 #include "../DeviceResources/DeviceResources.h"
+#include "../Math/StaticMath.h"
 
 #include "../Resource/GridVS.h"
 #include "../Resource/GridPS.h"
 
+#include <array>
+
+namespace
+{
+	const size_t	GridVertices = 8;							//	!<	グリッドの格子1つ分の頂点
+	const size_t	GridNumX = 12;								//	!<	描画したい格子の列の数
+	const size_t	GridNumY = 12;								//	!<	描画したい格子の行の数
+	const size_t	VertexDivX = GridVertices * GridNumX;		//	!<	1行の頂点数
+	const size_t	VertexDivY = GridVertices * GridNumY;		//	!<	1列の頂点数
+	const uint32_t	VertexNum = static_cast<uint32_t>(VertexDivX + VertexDivY) * 2;	//	!<	総頂点数
+
+	using GridLineTable = std::array<Utility::Math::StaticVector4, VertexDivX + VertexDivY>;
+
+	/**
+	 *	@fn			MakeGridLines
+	 *	@brief		グリッドの線の頂点を作る(コンパイル時に計算する)
+	 */
+	constexpr GridLineTable MakeGridLines()
+	{
+		const float Space = VertexDivX * 0.05f;
+		const float Origin = -Space * (VertexDivX * 0.5f);
+
+		GridLineTable lines = {};
+		for (size_t i = 0; i < VertexDivX; i += 2)
+		{
+			lines[i] = Utility::Math::StaticVector4(Origin + Space * i, 0.f, Origin, 1.f);			//	上
+			lines[i + 1] = Utility::Math::StaticVector4(Origin + Space * i, 0.f, -Origin, 1.f);	//	下
+		}
+
+		for (size_t i = 0; i < VertexDivY; i += 2)
+		{
+			lines[i + VertexDivX] = Utility::Math::StaticVector4(Origin, 0.f, Origin + Space * i, 1.f);		//	左
+			lines[i + VertexDivX + 1] = Utility::Math::StaticVector4(-Origin, 0.f, Origin + Space * i, 1.f);	//	右
+		}
+		return lines;
+	}
+
+	constexpr GridLineTable GridLines = MakeGridLines();
+}
+
 class Utility::Grid::Impl
 {
 public:
@@ -26,37 +67,20 @@ public:
 		ID3D11Device* device = GetD3Ddevice(context_.Get()).Get();
 		cbGridMatrix_ = std::make_unique<ConstantBuffer<SimpleMatrix>>(device, eShaderType::Vertex, 0);
 		vertexBuffer_ = VertexBuffer<SimpleVertex>(device, VertexNum);
+		for (size_t i = 0; i < GridLines.size(); ++i)
+			vertexBuffer_[i]->Pos = Math::Vector4(GridLines[i]);
+		vertexBuffer_.Update(context_.Get());
 	}
 
 	~Impl() = default;
 
 private:
-	void DrawGrid(size_t argXdivs, size_t argYdivs)
+	void DrawGrid()
 	{
-		const float Space = argXdivs * 0.05f;
-		const float Origin = -Space * (argXdivs * 0.5f);
-
-		for (size_t i = 0; i < argXdivs; i += 2)
-		{
-			const DirectX::XMFLOAT4 Up = DirectX::XMFLOAT4(Origin + Space * i, 0.f, Origin, 1.f);
-			const DirectX::XMFLOAT4 Under = DirectX::XMFLOAT4(Origin + Space * i, 0.f, -Origin, 1.f);
-			vertexBuffer_[i]->Pos = Up;			//	上
-			vertexBuffer_[i + 1]->Pos = Under;	//	下
-		}
-
-		for (size_t i = 0; i < argYdivs; i += 2)
-		{
-			const DirectX::XMFLOAT4 Left = DirectX::XMFLOAT4(Origin, 0.f, Origin + Space * i, 1.f);
-			const DirectX::XMFLOAT4 Right = DirectX::XMFLOAT4(-Origin, 0.f, Origin + Space * i, 1.f);
-			vertexBuffer_[i + argXdivs]->Pos = Left;			//	左
-			vertexBuffer_[i + argXdivs + 1]->Pos = Right;	//	右
-		}
-
 		vertexShader_.SetShader(context_.Get());
 		pixelShader_.SetShader(context_.Get());
 
 		cbGridMatrix_->Update(context_.Get());
-		vertexBuffer_.Update(context_.Get());
 
 		inputLayout_.SetInputLayout(context_.Get());
 		vertexBuffer_.SetVertexBuffers(context_.Get());
@@ -75,16 +99,12 @@ public:
 		cbGridMatrix_->View = argView;
 		cbGridMatrix_->Proj = argProj;
 		
-		DrawGrid(static_cast<size_t>(VertexDiv.x), static_cast<size_t>(VertexDiv.y));
+		DrawGrid();
 
 	}
 
 
 private:
-	const int							GridVertices = 8;			//	!<	グリッドの格子1つ分の頂点
-	const DirectX::XMFLOAT2						GridNum = DirectX::XMFLOAT2(12.f,12.f);	//	!<	描画したい格子の行と列の数
-	const DirectX::XMFLOAT2						VertexDiv = DirectX::XMFLOAT2(GridVertices * GridNum.x, GridVertices * GridNum.y);	//	!<	1行と1列の頂点数
-	const uint32_t						VertexNum = static_cast<uint32_t>(VertexDiv.x + VertexDiv.y) * 2;	//	!<	総頂点数
 	Microsoft::WRL::ComPtr<ID3D11DeviceContext>	context_;
 	VertexShader								vertexShader_;
 	PixelShader									pixelShader_;
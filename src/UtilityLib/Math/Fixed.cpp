@@ -0,0 +1,220 @@
+﻿/**
+ *	@file	Fixed.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "Fixed.h"
+#include "SimdLanes.h"
+
+namespace
+{
+	using Utility::Math::Fixed16;
+
+#pragma region		Lanes
+	/*
+	 *	固定小数点数の演算。整数演算なので、どのLanesでも1要素ずつと同じ結果になる。
+	 */
+
+	/**
+	 *  @struct		ScalarFixedLanes
+	 *  @brief		1要素ずつの演算
+	 */
+	template<typename T>
+	struct ScalarFixedLanes
+	{
+		using Reg = T;
+		static const size_t Width = 1;
+
+		static inline Reg Load(const T *argSrc) { return *argSrc; }
+		static inline void Store(T *argDst, Reg argValue) { *argDst = argValue; }
+		static inline Reg Add(Reg argA, Reg argB) { return argA + argB; }
+		static inline Reg Mul(Reg argA, Reg argB) { return argA * argB; }
+	};
+
+	static_assert(sizeof(Fixed16) == sizeof(int32_t), "Fixed16 must be a plain 32 bit integer...");
+
+#if defined(UTILITY_MATH_LANES_AVX2)
+	/**
+	 *  @struct		Avx2Fixed16Lanes
+	 *  @brief		Fixed16を8要素ずつの演算
+	 */
+	struct Avx2Fixed16Lanes
+	{
+		using Reg = __m256i;
+		static const size_t Width = 8;
+
+		static inline Reg Load(const Fixed16 *argSrc) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(argSrc)); }
+		static inline void Store(Fixed16 *argDst, Reg argValue) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(argDst), argValue); }
+		static inline Reg Add(Reg argA, Reg argB) { return _mm256_add_epi32(argA, argB); }
+		static inline Reg Mul(Reg argA, Reg argB)
+		{
+			// 偶数番目と奇数番目を64bitの積にして丸め、bit16～47を取り出す
+			const __m256i Round = _mm256_set1_epi64x(static_cast<int64_t>(1) << 15);
+			const __m256i Even = _mm256_add_epi64(_mm256_mul_epi32(argA, argB), Round);
+			const __m256i Odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(argA, 32), _mm256_srli_epi64(argB, 32)), Round);
+			return _mm256_blend_epi32(_mm256_srli_epi64(Even, 16), _mm256_slli_epi64(Odd, 16), 0xaa);
+		}
+	};
+	using WideFixed16Lanes = Avx2Fixed16Lanes;
+#elif defined(UTILITY_MATH_LANES_SSE2)
+	/**
+	 *  @struct		Sse2Fixed16Lanes
+	 *  @brief		Fixed16を4要素ずつの演算
+	 */
+	struct Sse2Fixed16Lanes
+	{
+		using Reg = __m128i;
+		static const size_t Width = 4;
+
+		static inline Reg Load(const Fixed16 *argSrc) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc)); }
+		static inline void Store(Fixed16 *argDst, Reg argValue) { _mm_storeu_si128(reinterpret_cast<__m128i*>(argDst), argValue); }
+		static inline Reg Add(Reg argA, Reg argB) { return _mm_add_epi32(argA, argB); }
+		static inline Reg Mul(Reg argA, Reg argB)
+		{
+			const __m128i Low = _mm_set_epi32(0, -1, 0, -1);
+			const __m128i Even = _mm_srli_epi64(MulEven(argA, argB), 16);
+			const __m128i Odd = _mm_slli_epi64(MulEven(_mm_srli_epi64(argA, 32), _mm_srli_epi64(argB, 32)), 16);
+			return _mm_or_si128(_mm_and_si128(Even, Low), _mm_andnot_si128(Low, Odd));
+		}
+
+	private:
+		/**
+		 *	@fn			MulEven
+		 *	@brief		偶数番目の符号付きの64bitの積 + 2^15
+		 *	@note		SSE2には符号無しの積しかないので、負の値の分を上位32bitから引く
+		 */
+		static inline Reg MulEven(Reg argA, Reg argB)
+		{
+			const __m128i Correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(argA, 31), argB), _mm_and_si128(_mm_srai_epi32(argB, 31), argA));
+			const __m128i Product = _mm_sub_epi64(_mm_mul_epu32(argA, argB), _mm_slli_epi64(Correction, 32));
+			return _mm_add_epi64(Product, _mm_set_epi32(0, 1 << 15, 0, 1 << 15));
+		}
+	};
+	using WideFixed16Lanes = Sse2Fixed16Lanes;
+#else
+	using WideFixed16Lanes = ScalarFixedLanes<Fixed16>;
+#endif
+
+	/**
+	 *  @struct		WideFixedLanes
+	 *  @brief		型ごとのまとめて処理するLanes(64bitの積は命令がないので1要素ずつ)
+	 */
+	template<typename T>
+	struct WideFixedLanes
+	{
+		using Type = ScalarFixedLanes<T>;
+	};
+	template<>
+	struct WideFixedLanes<Fixed16>
+	{
+		using Type = WideFixed16Lanes;
+	};
+#pragma endregion	Lanes
+
+#pragma region		Kernel
+	/**
+	 *  @struct		MultiplyKernel
+	 *  @brief		a * b
+	 */
+	template<typename T>
+	struct MultiplyKernel
+	{
+		const T	*a_;
+		const T	*b_;
+		T		*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			L::Store(dst_ + argIndex, L::Mul(L::Load(a_ + argIndex), L::Load(b_ + argIndex)));
+		}
+	};
+
+	/**
+	 *  @struct		MultiplyAddKernel
+	 *  @brief		a * b + c
+	 */
+	template<typename T>
+	struct MultiplyAddKernel
+	{
+		const T	*a_;
+		const T	*b_;
+		const T	*c_;
+		T		*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			L::Store(dst_ + argIndex, L::Add(L::Mul(L::Load(a_ + argIndex), L::Load(b_ + argIndex)), L::Load(c_ + argIndex)));
+		}
+	};
+
+	/**
+	 *  @struct		DotKernel
+	 *  @brief		内積(FixedVector3::Dotと同じ順序)
+	 */
+	template<typename T>
+	struct DotKernel
+	{
+		const T	*ax_;
+		const T	*ay_;
+		const T	*az_;
+		const T	*bx_;
+		const T	*by_;
+		const T	*bz_;
+		T		*dst_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			const typename L::Reg X = L::Mul(L::Load(ax_ + argIndex), L::Load(bx_ + argIndex));
+			const typename L::Reg Y = L::Mul(L::Load(ay_ + argIndex), L::Load(by_ + argIndex));
+			const typename L::Reg Z = L::Mul(L::Load(az_ + argIndex), L::Load(bz_ + argIndex));
+			L::Store(dst_ + argIndex, L::Add(L::Add(X, Y), Z));
+		}
+	};
+#pragma endregion	Kernel
+
+	/**
+	 *	@fn			RunFixed
+	 *	@brief		型に合ったLanesでカーネルを適用する
+	 */
+	template<typename T, typename Kernel>
+	void RunFixed(const Kernel &argKernel, size_t argCount, Utility::ThreadPool *argPool)
+	{
+		Utility::Math::Simd::Run<typename WideFixedLanes<T>::Type, ScalarFixedLanes<T>>(argKernel, argCount, Utility::Math::FixedMath<T>::ParallelGrain, argPool);
+	}
+}
+
+template<typename T>
+void Utility::Math::FixedMath<T>::Multiply(Span<const T> argA, Span<const T> argB, Span<T> argDst, ThreadPool *argPool)
+{
+	assert(argA.size() == argB.size() && "FixedMath::Multiply size mismatch...");
+	assert(argDst.size() >= argA.size() && "Destination is too small...");
+	const MultiplyKernel<T> Kernel = { argA.data(), argB.data(), argDst.data() };
+	RunFixed<T>(Kernel, argA.size(), argPool);
+}
+
+template<typename T>
+void Utility::Math::FixedMath<T>::MultiplyAdd(Span<const T> argA, Span<const T> argB, Span<const T> argC, Span<T> argDst, ThreadPool *argPool)
+{
+	assert(argA.size() == argB.size() && argA.size() == argC.size() && "FixedMath::MultiplyAdd size mismatch...");
+	assert(argDst.size() >= argA.size() && "Destination is too small...");
+	const MultiplyAddKernel<T> Kernel = { argA.data(), argB.data(), argC.data(), argDst.data() };
+	RunFixed<T>(Kernel, argA.size(), argPool);
+}
+
+template<typename T>
+void Utility::Math::FixedMath<T>::Dot(Span<const T> argAX, Span<const T> argAY, Span<const T> argAZ,
+	Span<const T> argBX, Span<const T> argBY, Span<const T> argBZ, Span<T> argDst, ThreadPool *argPool)
+{
+	const size_t Count = argAX.size();
+	assert(argAY.size() == Count && argAZ.size() == Count && argBX.size() == Count && argBY.size() == Count && argBZ.size() == Count && "FixedMath::Dot size mismatch...");
+	assert(argDst.size() >= Count && "Destination is too small...");
+	const DotKernel<T> Kernel = { argAX.data(), argAY.data(), argAZ.data(), argBX.data(), argBY.data(), argBZ.data(), argDst.data() };
+	RunFixed<T>(Kernel, Count, argPool);
+}
+
+template class Utility::Math::FixedMath<Utility::Math::Fixed16>;
+template class Utility::Math::FixedMath<Utility::Math::Fixed32>;
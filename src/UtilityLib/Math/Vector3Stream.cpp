@@ -0,0 +1,351 @@
+﻿/**
+ *	@file	Vector3Stream.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "Vector3Stream.h"
+#include "Matrix.h"
+#include "SimdLanes.h"
+
+#include <cstring>
+
+namespace
+{
+#pragma region		Kernel
+	/*
+	 *	各カーネルはApply<Lanes>(i)でi番目からLanes::Width個を処理する。
+	 *	計算の順序はDirectXMathのSSE2実装(Vector3の各関数)に合わせ、FMAは使わない。
+	 */
+
+	/**
+	 *  @struct		TransformKernel
+	 *  @brief		行列による変換
+	 */
+	struct TransformKernel
+	{
+		const float	*x_;
+		const float	*y_;
+		const float	*z_;
+		float		*dstX_;
+		float		*dstY_;
+		float		*dstZ_;
+		float		m_[4][4];
+		bool		isCoord_;	//	!<	座標として平行移動してwで割るか
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			const typename L::Reg X = L::Load(x_ + argIndex);
+			const typename L::Reg Y = L::Load(y_ + argIndex);
+			const typename L::Reg Z = L::Load(z_ + argIndex);
+			// ((z * r2 + r3) + y * r1) + x * r0 の順
+			auto Row = [&](int argColumn)
+			{
+				typename L::Reg r = L::Mul(Z, L::Set(m_[2][argColumn]));
+				if (isCoord_)
+					r = L::Add(r, L::Set(m_[3][argColumn]));
+				r = L::Add(L::Mul(Y, L::Set(m_[1][argColumn])), r);
+				return L::Add(L::Mul(X, L::Set(m_[0][argColumn])), r);
+			};
+
+			typename L::Reg rx = Row(0);
+			typename L::Reg ry = Row(1);
+			typename L::Reg rz = Row(2);
+			if (isCoord_)
+			{
+				const typename L::Reg W = Row(3);
+				rx = L::Div(rx, W);
+				ry = L::Div(ry, W);
+				rz = L::Div(rz, W);
+			}
+			L::Store(dstX_ + argIndex, rx);
+			L::Store(dstY_ + argIndex, ry);
+			L::Store(dstZ_ + argIndex, rz);
+		}
+	};
+
+	/**
+	 *  @struct		NormalizeKernel
+	 *  @brief		正規化
+	 */
+	struct NormalizeKernel
+	{
+		const float	*x_;
+		const float	*y_;
+		const float	*z_;
+		float		*dstX_;
+		float		*dstY_;
+		float		*dstZ_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			const typename L::Reg X = L::Load(x_ + argIndex);
+			const typename L::Reg Y = L::Load(y_ + argIndex);
+			const typename L::Reg Z = L::Load(z_ + argIndex);
+			const typename L::Reg Length = L::Sqrt(L::Add(L::Add(L::Mul(X, X), L::Mul(Y, Y)), L::Mul(Z, Z)));
+			L::Store(dstX_ + argIndex, L::ZeroIfZero(Length, L::Div(X, Length)));
+			L::Store(dstY_ + argIndex, L::ZeroIfZero(Length, L::Div(Y, Length)));
+			L::Store(dstZ_ + argIndex, L::ZeroIfZero(Length, L::Div(Z, Length)));
+		}
+	};
+
+	/**
+	 *  @struct		DotKernel
+	 *  @brief		内積と距離
+	 */
+	struct DotKernel
+	{
+		/**
+		 *  @enum		eMode
+		 *  @brief		何を求めるか
+		 */
+		enum class eMode
+		{
+			Dot,
+			Distance,
+			DistanceSquared,
+		};
+
+		const float	*ax_;
+		const float	*ay_;
+		const float	*az_;
+		const float	*bx_;
+		const float	*by_;
+		const float	*bz_;
+		float		*dst_;
+		eMode		mode_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			typename L::Reg ax = L::Load(ax_ + argIndex);
+			typename L::Reg ay = L::Load(ay_ + argIndex);
+			typename L::Reg az = L::Load(az_ + argIndex);
+			typename L::Reg bx = L::Load(bx_ + argIndex);
+			typename L::Reg by = L::Load(by_ + argIndex);
+			typename L::Reg bz = L::Load(bz_ + argIndex);
+			if (mode_ != eMode::Dot)
+			{// b - aの長さ
+				ax = bx = L::Sub(bx, ax);
+				ay = by = L::Sub(by, ay);
+				az = bz = L::Sub(bz, az);
+			}
+			typename L::Reg result = L::Add(L::Add(L::Mul(ax, bx), L::Mul(ay, by)), L::Mul(az, bz));
+			if (mode_ == eMode::Distance)
+				result = L::Sqrt(result);
+			L::Store(dst_ + argIndex, result);
+		}
+	};
+
+	/**
+	 *  @struct		BinaryKernel
+	 *  @brief		2つのベクトルから1つのベクトルを作る演算
+	 */
+	struct BinaryKernel
+	{
+		/**
+		 *  @enum		eMode
+		 *  @brief		演算の種類
+		 */
+		enum class eMode
+		{
+			Cross,
+			Lerp,
+			Min,
+			Max,
+		};
+
+		const float	*ax_;
+		const float	*ay_;
+		const float	*az_;
+		const float	*bx_;
+		const float	*by_;
+		const float	*bz_;
+		float		*dstX_;
+		float		*dstY_;
+		float		*dstZ_;
+		float		t_;
+		eMode		mode_;
+
+		template<typename L>
+		inline void Apply(size_t argIndex) const
+		{
+			const typename L::Reg AX = L::Load(ax_ + argIndex);
+			const typename L::Reg AY = L::Load(ay_ + argIndex);
+			const typename L::Reg AZ = L::Load(az_ + argIndex);
+			const typename L::Reg BX = L::Load(bx_ + argIndex);
+			const typename L::Reg BY = L::Load(by_ + argIndex);
+			const typename L::Reg BZ = L::Load(bz_ + argIndex);
+			typename L::Reg rx, ry, rz;
+			switch (mode_)
+			{
+			case eMode::Cross:
+				rx = L::Sub(L::Mul(AY, BZ), L::Mul(AZ, BY));
+				ry = L::Sub(L::Mul(AZ, BX), L::Mul(AX, BZ));
+				rz = L::Sub(L::Mul(AX, BY), L::Mul(AY, BX));
+				break;
+			case eMode::Lerp:
+			{// a + (b - a) * t
+				const typename L::Reg T = L::Set(t_);
+				rx = L::Add(AX, L::Mul(L::Sub(BX, AX), T));
+				ry = L::Add(AY, L::Mul(L::Sub(BY, AY), T));
+				rz = L::Add(AZ, L::Mul(L::Sub(BZ, AZ), T));
+				break;
+			}
+			case eMode::Min:
+				rx = L::Min(AX, BX);
+				ry = L::Min(AY, BY);
+				rz = L::Min(AZ, BZ);
+				break;
+			default:
+				rx = L::Max(AX, BX);
+				ry = L::Max(AY, BY);
+				rz = L::Max(AZ, BZ);
+				break;
+			}
+			L::Store(dstX_ + argIndex, rx);
+			L::Store(dstY_ + argIndex, ry);
+			L::Store(dstZ_ + argIndex, rz);
+		}
+	};
+
+	/**
+	 *	@fn			RunBinary
+	 *	@brief		BinaryKernelを組み立てて適用する
+	 */
+	void RunBinary(const Utility::Math::Vector3Stream &argA, const Utility::Math::Vector3Stream &argB, float argT, BinaryKernel::eMode argMode, Utility::Math::Vector3Stream *argDst, Utility::ThreadPool *argPool)
+	{
+		assert(argA.Size() == argB.Size() && "Vector3Stream size mismatch...");
+		argDst->Resize(argA.Size());
+		const BinaryKernel Kernel = { argA.X(), argA.Y(), argA.Z(), argB.X(), argB.Y(), argB.Z(), argDst->X(), argDst->Y(), argDst->Z(), argT, argMode };
+		Utility::Math::Simd::Run(Kernel, argA.Size(), Utility::Math::Vector3Stream::ParallelGrain, argPool);
+	}
+
+	/**
+	 *	@fn			RunDot
+	 *	@brief		DotKernelを組み立てて適用する
+	 */
+	void RunDot(const Utility::Math::Vector3Stream &argA, const Utility::Math::Vector3Stream &argB, DotKernel::eMode argMode, Utility::Span<float> argDst, Utility::ThreadPool *argPool)
+	{
+		assert(argA.Size() == argB.Size() && "Vector3Stream size mismatch...");
+		assert(argDst.size() >= argA.Size() && "Destination is too small...");
+		const DotKernel Kernel = { argA.X(), argA.Y(), argA.Z(), argB.X(), argB.Y(), argB.Z(), argDst.data(), argMode };
+		Utility::Math::Simd::Run(Kernel, argA.Size(), Utility::Math::Vector3Stream::ParallelGrain, argPool);
+	}
+
+	/**
+	 *	@fn			RunTransform
+	 *	@brief		TransformKernelを組み立てて適用する
+	 */
+	void RunTransform(const Utility::Math::Vector3Stream &argSrc, const Utility::Math::Matrix &argMatrix, bool argIsCoord, Utility::Math::Vector3Stream *argDst, Utility::ThreadPool *argPool)
+	{
+		argDst->Resize(argSrc.Size());
+		TransformKernel kernel = { argSrc.X(), argSrc.Y(), argSrc.Z(), argDst->X(), argDst->Y(), argDst->Z() };
+		std::memcpy(kernel.m_, argMatrix.m, sizeof(kernel.m_));
+		kernel.isCoord_ = argIsCoord;
+		Utility::Math::Simd::Run(kernel, argSrc.Size(), Utility::Math::Vector3Stream::ParallelGrain, argPool);
+	}
+#pragma endregion	Kernel
+}
+
+Utility::Math::Vector3Stream::Vector3Stream()
+	: buffer_()
+{
+}
+
+Utility::Math::Vector3Stream::Vector3Stream(size_t argCount)
+	: Vector3Stream()
+{
+	Resize(argCount);
+}
+
+void Utility::Math::Vector3Stream::Reserve(size_t argCapacity)
+{
+	buffer_.Reserve(argCapacity);
+}
+
+void Utility::Math::Vector3Stream::Resize(size_t argCount)
+{
+	buffer_.Resize(argCount, { 0.f, 0.f, 0.f });
+}
+
+void Utility::Math::Vector3Stream::Load(const Vector3 *argSrc, size_t argCount)
+{
+	buffer_.Assign(argCount);
+	float *xs = X();
+	float *ys = Y();
+	float *zs = Z();
+	for (size_t i = 0; i < argCount; ++i)
+	{
+		xs[i] = argSrc[i].x;
+		ys[i] = argSrc[i].y;
+		zs[i] = argSrc[i].z;
+	}
+}
+
+void Utility::Math::Vector3Stream::Store(Vector3 *argDst) const
+{
+	const float *xs = X();
+	const float *ys = Y();
+	const float *zs = Z();
+	for (size_t i = 0; i < Size(); ++i)
+	{
+		argDst[i].x = xs[i];
+		argDst[i].y = ys[i];
+		argDst[i].z = zs[i];
+	}
+}
+
+void Utility::Math::Vector3Stream::Transform(const Vector3Stream &argSrc, const Matrix &argMatrix, Vector3Stream *argDst, ThreadPool *argPool)
+{
+	RunTransform(argSrc, argMatrix, true, argDst, argPool);
+}
+
+void Utility::Math::Vector3Stream::TransformNormal(const Vector3Stream &argSrc, const Matrix &argMatrix, Vector3Stream *argDst, ThreadPool *argPool)
+{
+	RunTransform(argSrc, argMatrix, false, argDst, argPool);
+}
+
+void Utility::Math::Vector3Stream::Normalize(const Vector3Stream &argSrc, Vector3Stream *argDst, ThreadPool *argPool)
+{
+	argDst->Resize(argSrc.Size());
+	const NormalizeKernel Kernel = { argSrc.X(), argSrc.Y(), argSrc.Z(), argDst->X(), argDst->Y(), argDst->Z() };
+	Utility::Math::Simd::Run(Kernel, argSrc.Size(), ParallelGrain, argPool);
+}
+
+void Utility::Math::Vector3Stream::Dot(const Vector3Stream &argA, const Vector3Stream &argB, Span<float> argDst, ThreadPool *argPool)
+{
+	RunDot(argA, argB, DotKernel::eMode::Dot, argDst, argPool);
+}
+
+void Utility::Math::Vector3Stream::Cross(const Vector3Stream &argA, const Vector3Stream &argB, Vector3Stream *argDst, ThreadPool *argPool)
+{
+	RunBinary(argA, argB, 0.f, BinaryKernel::eMode::Cross, argDst, argPool);
+}
+
+void Utility::Math::Vector3Stream::Lerp(const Vector3Stream &argA, const Vector3Stream &argB, float argT, Vector3Stream *argDst, ThreadPool *argPool)
+{
+	RunBinary(argA, argB, argT, BinaryKernel::eMode::Lerp, argDst, argPool);
+}
+
+void Utility::Math::Vector3Stream::Min(const Vector3Stream &argA, const Vector3Stream &argB, Vector3Stream *argDst, ThreadPool *argPool)
+{
+	RunBinary(argA, argB, 0.f, BinaryKernel::eMode::Min, argDst, argPool);
+}
+
+void Utility::Math::Vector3Stream::Max(const Vector3Stream &argA, const Vector3Stream &argB, Vector3Stream *argDst, ThreadPool *argPool)
+{
+	RunBinary(argA, argB, 0.f, BinaryKernel::eMode::Max, argDst, argPool);
+}
+
+void Utility::Math::Vector3Stream::Distance(const Vector3Stream &argA, const Vector3Stream &argB, Span<float> argDst, ThreadPool *argPool)
+{
+	RunDot(argA, argB, DotKernel::eMode::Distance, argDst, argPool);
+}
+
+void Utility::Math::Vector3Stream::DistanceSquared(const Vector3Stream &argA, const Vector3Stream &argB, Span<float> argDst, ThreadPool *argPool)
+{
+	RunDot(argA, argB, DotKernel::eMode::DistanceSquared, argDst, argPool);
+}
@@ -10,14 +10,14 @@
 #include "../Archive/Archive.h"
 #include "../Singleton/Singleton.h"
 
-#include <map>
+#include <unordered_map>
 #include <assert.h>
 
 class Utility::SoundManager::Impl
 {
 public:
 	Impl() 
-		: index_(0), currentPlayBgm_(""), canUseArchive_(false)
+		: index_(0), canUseArchive_(false)
 	{
 	}
 	~Impl()
@@ -28,7 +28,7 @@ public:
 public:
 	void AddAndLoadSound(std::string argFilename)
 	{
-		sound_.insert(std::map<std::string, int>::value_type(argFilename, index_));
+		sound_.insert(std::make_pair(Atom(argFilename), index_));
 		
 		const std::string SoundName = soundPath_ + argFilename + ".wav";
 		(canUseArchive_) ? LoadSound(SoundName.c_str()) : Sound::LoadS(index_, SoundName.c_str());
@@ -47,16 +47,16 @@ public:
 
 	void AddAndLoadSound(std::string argFilename, void * argBuffer)
 	{
-		sound_.insert(std::map<std::string, int>::value_type(argFilename, index_));
+		sound_.insert(std::make_pair(Atom(argFilename), index_));
 		Sound::LoadS(index_, argBuffer);
 		index_++;
 	}
 
-	void PlaySounds(std::string argKey, eSoundType argType)
+	void PlaySounds(Atom argKey, eSoundType argType)
 	{
 		if (argType == eSoundType::Loop) 
 		{
-			if (currentPlayBgm_ != "")
+			if (currentPlayBgm_.IsValid())
 			{
 				StopCurrentBgm();
 			}
@@ -71,23 +71,23 @@ public:
 
 	void StopCurrentBgm()
 	{
-		if (currentPlayBgm_.empty())
+		if (!currentPlayBgm_.IsValid())
 			return;
 		Sound::StopS(sound_.at(currentPlayBgm_));
-		currentPlayBgm_.clear();
+		currentPlayBgm_ = Atom();
 	}
 
 	std::string CurrentPlayBgm()
 	{
-		return currentPlayBgm_;
+		return std::string(currentPlayBgm_.Name());
 	}
 
 public:
-	int							index_;
-	std::map<std::string, int>	sound_;
-	std::string					currentPlayBgm_;
-	std::string					soundPath_;
-	bool						canUseArchive_;
+	int								index_;
+	std::unordered_map<Atom, int>	sound_;
+	Atom							currentPlayBgm_;
+	std::string						soundPath_;
+	bool							canUseArchive_;
 
 };
 
@@ -127,6 +127,12 @@ void Utility::SoundManager::AddAndLoadSound(std::string argFilename)
  *	@param[in]	argType	再生形式
  */
 void Utility::SoundManager::PlaySounds(std::string argKey, eSoundType argType)const
+{
+	// 検索だけなので登録はしない(未登録のキーは無効な識別子になりatで例外になる)
+	pImpl->PlaySounds(Singleton<AtomTable>::Get()->Find(argKey), argType);
+}
+
+void Utility::SoundManager::PlaySounds(Atom argKey, eSoundType argType)const
 {
 	pImpl->PlaySounds(argKey, argType);
 }
@@ -136,6 +142,11 @@ void Utility::SoundManager::PlaySounds(std::string argKey, eSoundType argType)co
  *	@param[in]	argKey	停止したいサウンドのキー
  */
 void Utility::SoundManager::StopSounds(std::string argKey)const
+{
+	StopSounds(Singleton<AtomTable>::Get()->Find(argKey));
+}
+
+void Utility::SoundManager::StopSounds(Atom argKey)const
 {
 	Sound::StopS(pImpl->sound_.at(argKey));
 }
@@ -0,0 +1,138 @@
+﻿/**
+ *	@file	Atom.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "Atom.h"
+#include "TextEncoding.h"
+#include "../Singleton/Singleton.h"
+
+#include <cstring>
+#include <mutex>
+#include <assert.h>
+
+namespace
+{
+	/**
+	 *	@fn			WithUtf8
+	 *	@brief		ワイド文字列をUTF-8にして関数に渡す
+	 *	@param[in]	argName		!<	ワイド文字列
+	 *	@param[in]	argFunc		!<	UTF-8の文字列を受け取る関数
+	 *	@return		関数の戻り値
+	 *	@note		Shift-JISにない文字を'?'にすると違う名前が同じ識別子になるので、全ての文字を表せるUTF-8にする。
+	 *				短い名前はスタック上で変換し、確保しない
+	 */
+	template<typename Func>
+	Utility::Atom WithUtf8(std::wstring_view argName, Func argFunc)
+	{
+		char buf[256];
+		size_t length = Utility::TextEncoding::WideToUtf8(argName, buf, sizeof(buf));
+		if (length <= sizeof(buf))
+			return argFunc(std::string_view(buf, length));
+
+		std::string dst(length, '\0');
+		Utility::TextEncoding::WideToUtf8(argName, &dst[0], dst.size());
+		return argFunc(std::string_view(dst));
+	}
+}
+
+Utility::Atom::Atom(std::string_view argName)
+	: id_(Singleton<AtomTable>::Get()->Intern(argName).Id())
+{
+}
+
+Utility::Atom::Atom(std::wstring_view argName)
+	: id_(Singleton<AtomTable>::Get()->Intern(argName).Id())
+{
+}
+
+std::string_view Utility::Atom::Name() const
+{
+	return Singleton<AtomTable>::Get()->Name(*this);
+}
+
+Utility::AtomTable::AtomTable()
+	: blockUsed_(BlockSize)
+{
+	names_.push_back(std::string_view());
+}
+
+std::string_view Utility::AtomTable::Store(std::string_view argName)
+{
+	if (argName.size() > BlockSize / 4)
+	{// 長い名前は専用のブロックに置き、使いかけのブロックはそのまま使い続ける
+		std::unique_ptr<char[]> block(new char[argName.size()]);
+		std::memcpy(block.get(), argName.data(), argName.size());
+		std::string_view dst(block.get(), argName.size());
+		blocks_.insert(blocks_.end() - ((blocks_.empty()) ? 0 : 1), std::move(block));
+		return dst;
+	}
+
+	if (BlockSize - blockUsed_ < argName.size())
+	{
+		blocks_.emplace_back(new char[BlockSize]);
+		blockUsed_ = 0;
+	}
+	char *dst = blocks_.back().get() + blockUsed_;
+	std::memcpy(dst, argName.data(), argName.size());
+	blockUsed_ += argName.size();
+	return std::string_view(dst, argName.size());
+}
+
+Utility::Atom Utility::AtomTable::Intern(std::string_view argName)
+{
+	if (argName.empty())
+		return Atom();
+
+	{// 登録済みなら読み込みロックだけで済ませる
+		std::shared_lock<std::shared_mutex> lock(mutex_);
+		auto it = ids_.find(argName);
+		if (it != ids_.end())
+			return Atom(it->second);
+	}
+
+	std::unique_lock<std::shared_mutex> lock(mutex_);
+	// ロックを取り直す間に他のスレッドが登録しているかもしれない
+	auto it = ids_.find(argName);
+	if (it != ids_.end())
+		return Atom(it->second);
+
+	assert(names_.size() < UINT32_MAX && "Atom table is full...");
+	const uint32_t Id = static_cast<uint32_t>(names_.size());
+	std::string_view name = Store(argName);
+	names_.push_back(name);
+	ids_.emplace(name, Id);
+	return Atom(Id);
+}
+
+Utility::Atom Utility::AtomTable::Intern(std::wstring_view argName)
+{
+	return WithUtf8(argName, [this](std::string_view argUtf8) { return Intern(argUtf8); });
+}
+
+Utility::Atom Utility::AtomTable::Find(std::string_view argName) const
+{
+	std::shared_lock<std::shared_mutex> lock(mutex_);
+	auto it = ids_.find(argName);
+	return (it != ids_.end()) ? Atom(it->second) : Atom();
+}
+
+Utility::Atom Utility::AtomTable::Find(std::wstring_view argName) const
+{
+	return WithUtf8(argName, [this](std::string_view argUtf8) { return Find(argUtf8); });
+}
+
+std::string_view Utility::AtomTable::Name(Atom argAtom) const
+{
+	// names_はdequeなので、末尾に追加されても返した文字列は移動しない
+	std::shared_lock<std::shared_mutex> lock(mutex_);
+	assert(argAtom.Id() < names_.size() && "Atom doesn't belong to this table...");
+	return names_[argAtom.Id()];
+}
+
+size_t Utility::AtomTable::Size() const
+{
+	std::shared_lock<std::shared_mutex> lock(mutex_);
+	return names_.size() - 1;
+}
@@ -0,0 +1,265 @@
+﻿/**
+ *	@file	String.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "String.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UTILITY_STRING_AVX2 1
+#endif
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTILITY_STRING_SSE2 1
+#endif
+
+namespace
+{
+	/**
+	 *	@fn			SpaceLength
+	 *	@brief		指定位置の空白のバイト数
+	 *	@param[in]	argPos	!<	調べる位置
+	 *	@param[in]	argEnd	!<	文字列の終端
+	 *	@return		空白のバイト数(空白でなければ0)
+	 */
+	inline size_t SpaceLength(const unsigned char *argPos, const unsigned char *argEnd)
+	{
+		switch (argPos[0])
+		{
+		case ' ':
+		case '\t':
+			return 1;
+		case 0xE3:	// UTF-8の全角スペース
+			return (argEnd - argPos >= 3 && argPos[1] == 0x80 && argPos[2] == 0x80) ? 3 : 0;
+		case 0x81:	// Shift-JISの全角スペース
+			return (argEnd - argPos >= 2 && argPos[1] == 0x40) ? 2 : 0;
+		default:
+			return 0;
+		}
+	}
+
+	/**
+	 *	@fn			DeleteSpaceScalar
+	 *	@brief		空白を削除しながら指定位置までコピーする
+	 *	@param[in]	argSrc		!<	読み込み位置
+	 *	@param[in]	argStop		!<	処理を止める位置
+	 *	@param[in]	argEnd		!<	文字列の終端
+	 *	@param[out]	argDst		!<	書き込み位置
+	 *	@return		処理後の読み込み位置(全角スペースの途中で止めないのでargStopを超えることがある)
+	 */
+	inline const unsigned char *DeleteSpaceScalar(const unsigned char *argSrc, const unsigned char *argStop, const unsigned char *argEnd, char **argDst)
+	{
+		char *dst = *argDst;
+		while (argSrc < argStop)
+		{
+			size_t length = SpaceLength(argSrc, argEnd);
+			if (length != 0)
+			{
+				argSrc += length;
+			}
+			else
+			{
+				*dst++ = static_cast<char>(*argSrc++);
+			}
+		}
+		*argDst = dst;
+		return argSrc;
+	}
+
+	/**
+	 *	@fn			Compact
+	 *	@brief		マスクの立っていないバイトだけを詰めて書き込む
+	 *	@param[in]	argLanes	!<	ブロックのバイト列
+	 *	@param[in]	argMask		!<	削除するバイトのマスク
+	 *	@param[in]	argCount	!<	ブロックのバイト数
+	 *	@param[out]	argDst		!<	書き込み位置
+	 *	@return		書き込み後の位置
+	 */
+	inline char *Compact(const char *argLanes, unsigned int argMask, size_t argCount, char *argDst)
+	{
+		// 分岐せずに書き込み、残すバイトのときだけ進める
+		for (size_t i = 0; i < argCount; ++i)
+		{
+			*argDst = argLanes[i];
+			argDst += ((argMask >> i) & 1) ^ 1;
+		}
+		return argDst;
+	}
+}
+
+size_t Utility::String::DeleteSpace(const char *argSrc, size_t argSize, char *argDst)
+{
+	const unsigned char *src = reinterpret_cast<const unsigned char*>(argSrc);
+	const unsigned char *end = src + argSize;
+	char *dst = argDst;
+
+	// 書き込み位置は読み込み位置を追い越さないのでargSrc == argDstでもよい
+#if defined(UTILITY_STRING_AVX2)
+	{
+		const __m256i Space = _mm256_set1_epi8(' ');
+		const __m256i Tab = _mm256_set1_epi8('\t');
+		const __m256i Utf8Lead = _mm256_set1_epi8(static_cast<char>(0xE3));
+		const __m256i SjisLead = _mm256_set1_epi8(static_cast<char>(0x81));
+		alignas(32) char lanes[32];
+		while (end - src >= 32)
+		{
+			__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+			unsigned int lead = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, Utf8Lead), _mm256_cmpeq_epi8(v, SjisLead))));
+			if (lead != 0)
+			{// 全角スペースの可能性があるブロックは1バイトずつ処理する
+				src = DeleteSpaceScalar(src, src + 32, end, &dst);
+				continue;
+			}
+
+			unsigned int space = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, Space), _mm256_cmpeq_epi8(v, Tab))));
+			if (space == 0)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+				dst += 32;
+			}
+			else
+			{
+				_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+				dst = Compact(lanes, space, 32, dst);
+			}
+			src += 32;
+		}
+	}
+#endif
+#if defined(UTILITY_STRING_SSE2)
+	{
+		const __m128i Space = _mm_set1_epi8(' ');
+		const __m128i Tab = _mm_set1_epi8('\t');
+		const __m128i Utf8Lead = _mm_set1_epi8(static_cast<char>(0xE3));
+		const __m128i SjisLead = _mm_set1_epi8(static_cast<char>(0x81));
+		alignas(16) char lanes[16];
+		while (end - src >= 16)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+			unsigned int lead = static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, Utf8Lead), _mm_cmpeq_epi8(v, SjisLead))));
+			if (lead != 0)
+			{// 全角スペースの可能性があるブロックは1バイトずつ処理する
+				src = DeleteSpaceScalar(src, src + 16, end, &dst);
+				continue;
+			}
+
+			unsigned int space = static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, Space), _mm_cmpeq_epi8(v, Tab))));
+			if (space == 0)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+				dst += 16;
+			}
+			else
+			{
+				_mm_store_si128(reinterpret_cast<__m128i*>(lanes), v);
+				dst = Compact(lanes, space, 16, dst);
+			}
+			src += 16;
+		}
+	}
+#endif
+	DeleteSpaceScalar(src, end, end, &dst);
+
+	return static_cast<size_t>(dst - argDst);
+}
+
+size_t Utility::String::Replace(std::string_view argSrc, std::string_view argFrom, std::string_view argTo, char *argDst, size_t argDstSize)
+{
+	size_t length = 0;
+	size_t pos = 0;
+	auto Append = [&](const char *argData, size_t argSize)
+	{
+		if (argSize != 0 && length + argSize <= argDstSize)
+			std::memcpy(argDst + length, argData, argSize);
+		length += argSize;
+	};
+
+	if (!argFrom.empty())
+	{
+		size_t hit;
+		while ((hit = argSrc.find(argFrom, pos)) != std::string_view::npos)
+		{
+			Append(argSrc.data() + pos, hit - pos);
+			Append(argTo.data(), argTo.size());
+			pos = hit + argFrom.size();
+		}
+	}
+	Append(argSrc.data() + pos, argSrc.size() - pos);
+
+	return length;
+}
+
+void Utility::String::Replace(std::string *argBuf, std::string_view argFrom, std::string_view argTo)
+{
+	if (argFrom.empty())
+		return;
+
+	char *data = &(*argBuf)[0];
+	const size_t Size = argBuf->size();
+
+	if (argFrom.size() == 1 && argTo.size() == 1)
+	{// 1文字同士の置換はブロック単位で置き換える
+		const char From = argFrom[0];
+		const char To = argTo[0];
+		size_t i = 0;
+#if defined(UTILITY_STRING_AVX2)
+		{
+			const __m256i FromV = _mm256_set1_epi8(From);
+			const __m256i ToV = _mm256_set1_epi8(To);
+			for (; i + 32 <= Size; i += 32)
+			{
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+				__m256i hit = _mm256_cmpeq_epi8(v, FromV);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_blendv_epi8(v, ToV, hit));
+			}
+		}
+#endif
+#if defined(UTILITY_STRING_SSE2)
+		{
+			const __m128i FromV = _mm_set1_epi8(From);
+			const __m128i ToV = _mm_set1_epi8(To);
+			for (; i + 16 <= Size; i += 16)
+			{
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				__m128i hit = _mm_cmpeq_epi8(v, FromV);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_or_si128(_mm_and_si128(hit, ToV), _mm_andnot_si128(hit, v)));
+			}
+		}
+#endif
+		for (; i < Size; ++i)
+		{
+			if (data[i] == From)
+				data[i] = To;
+		}
+		return;
+	}
+
+	std::string_view src(data, Size);
+	if (argTo.size() <= argFrom.size())
+	{// 短くなる置換は読み込み位置を追い越さないのでその場で詰める
+		size_t read = 0, write = 0, hit;
+		while ((hit = src.find(argFrom, read)) != std::string_view::npos)
+		{
+			std::memmove(data + write, data + read, hit - read);
+			write += hit - read;
+			std::memcpy(data + write, argTo.data(), argTo.size());
+			write += argTo.size();
+			read = hit + argFrom.size();
+		}
+		std::memmove(data + write, data + read, Size - read);
+		write += Size - read;
+		argBuf->resize(write);
+		return;
+	}
+
+	// 長くなる置換は必要な長さを求めてから一度だけ確保する
+	const size_t Length = Replace(src, argFrom, argTo, nullptr, 0);
+	if (Length == Size)
+		return;
+
+	std::string dst(Length, '\0');
+	Replace(src, argFrom, argTo, &dst[0], Length);
+	argBuf->swap(dst);
+}
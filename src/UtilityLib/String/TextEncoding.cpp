@@ -0,0 +1,581 @@
+﻿/**
+ *	@file	TextEncoding.cpp
+ *	@date	2026 / 10 / 19
+ *	@author	Katsumi Takei
+ *	Copyright (c) Kastumi Takei. All rights reserved.
+ */
+#include "TextEncoding.h"
+#include "ShiftJisTable.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTILITY_ENCODING_SSE2 1
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+	using Utility::TextEncoding;
+
+	const size_t ShiftJisTrailNum = 188;
+
+#pragma region		Ascii
+	/**
+	 *	@fn			CountTrailingZero
+	 *	@brief		下位から連続する0のビット数
+	 *	@param[in]	argMask	!<	0以外の値
+	 *	@return		ビット数
+	 */
+	inline unsigned int CountTrailingZero(unsigned int argMask)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, argMask);
+		return static_cast<unsigned int>(index);
+#else
+		return static_cast<unsigned int>(__builtin_ctz(argMask));
+#endif
+	}
+
+	/**
+	 *	@fn			AsciiLength
+	 *	@brief		先頭から連続するASCII文字の数
+	 *	@param[in]	argSrc	!<	文字列
+	 *	@param[in]	argSize	!<	文字列の長さ
+	 *	@return		ASCII文字の数
+	 */
+	inline size_t AsciiLength(const char *argSrc, size_t argSize)
+	{
+		size_t i = 0;
+#if defined(UTILITY_ENCODING_SSE2)
+		for (; i + 16 <= argSize; i += 16)
+		{
+			unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc + i))));
+			if (mask != 0)
+				return i + CountTrailingZero(mask);
+		}
+#else
+		for (; i + 8 <= argSize; i += 8)
+		{
+			uint64_t word;
+			std::memcpy(&word, argSrc + i, sizeof(word));
+			if ((word & 0x8080808080808080ull) != 0)
+				break;
+		}
+#endif
+		while (i < argSize && static_cast<unsigned char>(argSrc[i]) < 0x80)
+			++i;
+		return i;
+	}
+	inline size_t AsciiLength(const char16_t *argSrc, size_t argSize)
+	{
+		size_t i = 0;
+#if defined(UTILITY_ENCODING_SSE2)
+		const __m128i High = _mm_set1_epi16(static_cast<short>(0xFF80));
+		const __m128i Zero = _mm_setzero_si128();
+		for (; i + 8 <= argSize; i += 8)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc + i));
+			unsigned int mask = ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, High), Zero))) & 0xFFFF;
+			if (mask != 0)
+				return i + CountTrailingZero(mask) / 2;
+		}
+#endif
+		while (i < argSize && argSrc[i] < 0x80)
+			++i;
+		return i;
+	}
+	inline size_t AsciiLength(const char32_t *argSrc, size_t argSize)
+	{
+		size_t i = 0;
+#if defined(UTILITY_ENCODING_SSE2)
+		const __m128i High = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+		const __m128i Zero = _mm_setzero_si128();
+		for (; i + 4 <= argSize; i += 4)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc + i));
+			unsigned int mask = ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, High), Zero))) & 0xFFFF;
+			if (mask != 0)
+				return i + CountTrailingZero(mask) / 4;
+		}
+#endif
+		while (i < argSize && argSrc[i] < 0x80)
+			++i;
+		return i;
+	}
+
+	/**
+	 *	@fn			CopyAscii
+	 *	@brief		ASCII文字を変換先の型にコピーする
+	 *	@param[in]	argSrc		!<	ASCII文字列
+	 *	@param[in]	argCount	!<	文字数
+	 *	@param[out]	argDst		!<	書き込み先
+	 */
+	template<typename SrcChar, typename DstChar>
+	inline void CopyAscii(const SrcChar *argSrc, size_t argCount, DstChar *argDst)
+	{
+		for (size_t i = 0; i < argCount; ++i)
+			argDst[i] = static_cast<DstChar>(argSrc[i]);
+	}
+	inline void CopyAscii(const char *argSrc, size_t argCount, char *argDst)
+	{
+		std::memcpy(argDst, argSrc, argCount);
+	}
+	inline void CopyAscii(const char *argSrc, size_t argCount, char16_t *argDst)
+	{
+		size_t i = 0;
+#if defined(UTILITY_ENCODING_SSE2)
+		const __m128i Zero = _mm_setzero_si128();
+		for (; i + 16 <= argCount; i += 16)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(argDst + i), _mm_unpacklo_epi8(v, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(argDst + i + 8), _mm_unpackhi_epi8(v, Zero));
+		}
+#endif
+		for (; i < argCount; ++i)
+			argDst[i] = static_cast<char16_t>(argSrc[i]);
+	}
+	inline void CopyAscii(const char16_t *argSrc, size_t argCount, char *argDst)
+	{
+		size_t i = 0;
+#if defined(UTILITY_ENCODING_SSE2)
+		for (; i + 16 <= argCount; i += 16)
+		{
+			__m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc + i));
+			__m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(argSrc + i + 8));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(argDst + i), _mm_packus_epi16(lo, hi));
+		}
+#endif
+		for (; i < argCount; ++i)
+			argDst[i] = static_cast<char>(argSrc[i]);
+	}
+#pragma endregion	Ascii
+
+#pragma region		Decode
+	/**
+	 *	@fn			DecodeUtf8
+	 *	@brief		UTF-8を1文字読み込む
+	 *	@param[in,out]	argPos	!<	読み込み位置
+	 *	@param[in]		argEnd	!<	終端
+	 *	@return		コードポイント
+	 */
+	inline char32_t DecodeUtf8(const char *&argPos, const char *argEnd)
+	{
+		const unsigned char *p = reinterpret_cast<const unsigned char*>(argPos);
+		size_t length;
+		char32_t cp, min;
+		if (p[0] < 0x80)
+		{
+			++argPos;
+			return p[0];
+		}
+		else if ((p[0] & 0xE0) == 0xC0)
+		{
+			length = 2; cp = p[0] & 0x1F; min = 0x80;
+		}
+		else if ((p[0] & 0xF0) == 0xE0)
+		{
+			length = 3; cp = p[0] & 0x0F; min = 0x800;
+		}
+		else if ((p[0] & 0xF8) == 0xF0)
+		{
+			length = 4; cp = p[0] & 0x07; min = 0x10000;
+		}
+		else
+		{
+			++argPos;
+			return TextEncoding::ReplacementChar;
+		}
+
+		if (static_cast<size_t>(argEnd - argPos) < length)
+		{
+			++argPos;
+			return TextEncoding::ReplacementChar;
+		}
+		for (size_t i = 1; i < length; ++i)
+		{
+			if ((p[i] & 0xC0) != 0x80)
+			{
+				++argPos;
+				return TextEncoding::ReplacementChar;
+			}
+			cp = (cp << 6) | (p[i] & 0x3F);
+		}
+		// 冗長な表現、サロゲート、範囲外は不正
+		if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+		{
+			++argPos;
+			return TextEncoding::ReplacementChar;
+		}
+		argPos += length;
+		return cp;
+	}
+
+	inline char32_t DecodeUtf16(const char16_t *&argPos, const char16_t *argEnd)
+	{
+		char32_t c = *argPos++;
+		if (c < 0xD800 || c > 0xDFFF)
+			return c;
+
+		if (c <= 0xDBFF && argPos < argEnd && *argPos >= 0xDC00 && *argPos <= 0xDFFF)
+			return 0x10000 + ((c - 0xD800) << 10) + (*argPos++ - 0xDC00);
+
+		return TextEncoding::ReplacementChar;
+	}
+
+	inline char32_t DecodeUtf32(const char32_t *&argPos, const char32_t *)
+	{
+		char32_t c = *argPos++;
+		if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+			return TextEncoding::ReplacementChar;
+		return c;
+	}
+
+	inline int ShiftJisLeadIndex(unsigned char argByte)
+	{
+		if (argByte >= 0x81 && argByte <= 0x9F)
+			return argByte - 0x81;
+		if (argByte >= 0xE0 && argByte <= 0xFC)
+			return argByte - 0xE0 + 31;
+		return -1;
+	}
+
+	inline int ShiftJisTrailIndex(unsigned char argByte)
+	{
+		if (argByte >= 0x40 && argByte <= 0x7E)
+			return argByte - 0x40;
+		if (argByte >= 0x80 && argByte <= 0xFC)
+			return argByte - 0x41;
+		return -1;
+	}
+
+	inline char32_t DecodeShiftJis(const char *&argPos, const char *argEnd)
+	{
+		const unsigned char *p = reinterpret_cast<const unsigned char*>(argPos);
+		if (p[0] < 0x80)
+		{
+			++argPos;
+			return p[0];
+		}
+		if (p[0] >= 0xA1 && p[0] <= 0xDF)
+		{// 半角カナ
+			++argPos;
+			return 0xFF61 + (p[0] - 0xA1);
+		}
+
+		int lead = ShiftJisLeadIndex(p[0]);
+		if (lead < 0)
+		{// CP932で1バイトのまま私用領域などに割り当てられている文字
+			++argPos;
+			switch (p[0])
+			{
+			case 0x80: return 0x0080;
+			case 0xA0: return 0xF8F0;
+			case 0xFD: return 0xF8F1;
+			case 0xFE: return 0xF8F2;
+			case 0xFF: return 0xF8F3;
+			default: return TextEncoding::ReplacementChar;
+			}
+		}
+
+		int trail = (argEnd - argPos >= 2) ? ShiftJisTrailIndex(p[1]) : -1;
+		if (trail < 0)
+		{
+			++argPos;
+			return TextEncoding::ReplacementChar;
+		}
+		argPos += 2;
+		char32_t cp = ShiftJisTable[lead * ShiftJisTrailNum + trail];
+		return (cp != 0) ? cp : TextEncoding::ReplacementChar;
+	}
+#pragma endregion	Decode
+
+#pragma region		Encode
+	/**
+	 *	@fn			EncodeUtf8
+	 *	@brief		1文字をUTF-8で書き込む
+	 *	@param[in]	argCp		!<	コードポイント
+	 *	@param[out]	argDst		!<	書き込み先(nullptrなら書き込まない)
+	 *	@param[in]	argRoom		!<	書き込み先の残り
+	 *	@return		必要な要素数(残りが足りなければ書き込まない)
+	 */
+	inline size_t EncodeUtf8(char32_t argCp, char *argDst, size_t argRoom)
+	{
+		size_t length = (argCp < 0x80) ? 1 : (argCp < 0x800) ? 2 : (argCp < 0x10000) ? 3 : 4;
+		if (argDst == nullptr || length > argRoom)
+			return length;
+
+		switch (length)
+		{
+		case 1:
+			argDst[0] = static_cast<char>(argCp);
+			break;
+		case 2:
+			argDst[0] = static_cast<char>(0xC0 | (argCp >> 6));
+			argDst[1] = static_cast<char>(0x80 | (argCp & 0x3F));
+			break;
+		case 3:
+			argDst[0] = static_cast<char>(0xE0 | (argCp >> 12));
+			argDst[1] = static_cast<char>(0x80 | ((argCp >> 6) & 0x3F));
+			argDst[2] = static_cast<char>(0x80 | (argCp & 0x3F));
+			break;
+		default:
+			argDst[0] = static_cast<char>(0xF0 | (argCp >> 18));
+			argDst[1] = static_cast<char>(0x80 | ((argCp >> 12) & 0x3F));
+			argDst[2] = static_cast<char>(0x80 | ((argCp >> 6) & 0x3F));
+			argDst[3] = static_cast<char>(0x80 | (argCp & 0x3F));
+			break;
+		}
+		return length;
+	}
+
+	inline size_t EncodeUtf16(char32_t argCp, char16_t *argDst, size_t argRoom)
+	{
+		size_t length = (argCp < 0x10000) ? 1 : 2;
+		if (argDst == nullptr || length > argRoom)
+			return length;
+
+		if (length == 1)
+		{
+			argDst[0] = static_cast<char16_t>(argCp);
+		}
+		else
+		{
+			argCp -= 0x10000;
+			argDst[0] = static_cast<char16_t>(0xD800 + (argCp >> 10));
+			argDst[1] = static_cast<char16_t>(0xDC00 + (argCp & 0x3FF));
+		}
+		return length;
+	}
+
+	inline size_t EncodeUtf32(char32_t argCp, char32_t *argDst, size_t argRoom)
+	{
+		if (argDst != nullptr && argRoom >= 1)
+			argDst[0] = argCp;
+		return 1;
+	}
+
+	using ShiftJisReverseTable = std::vector<std::pair<unsigned short, unsigned short>>;
+
+	/**
+	 *	@fn			GetShiftJisReverseTable
+	 *	@brief		Unicode→Shift-JISの対応表(Unicodeの昇順)
+	 *	@return		対応表
+	 *	@note		初回呼び出し時に順方向の表から作る
+	 */
+	const ShiftJisReverseTable &GetShiftJisReverseTable()
+	{
+		static const ShiftJisReverseTable Table = []()
+		{
+			ShiftJisReverseTable table;
+			for (size_t i = 0; i < sizeof(ShiftJisTable) / sizeof(ShiftJisTable[0]); ++i)
+			{
+				if (ShiftJisTable[i] == 0)
+					continue;
+
+				size_t lead = i / ShiftJisTrailNum, trail = i % ShiftJisTrailNum;
+				unsigned short code = static_cast<unsigned short>((((lead < 31) ? 0x81 + lead : 0xE0 + lead - 31) << 8) | ((trail < 63) ? 0x40 + trail : 0x41 + trail));
+				table.emplace_back(ShiftJisTable[i], code);
+			}
+
+			// 同じ文字に複数のコードがある場合は小さいコードを使う。
+			// ただしNEC選定IBM拡張文字(0xED, 0xEE)よりIBM拡張文字(0xFA～0xFC)を優先する(Windowsと同じ)
+			auto Priority = [](unsigned short argCode)
+			{
+				return (argCode >= 0xED00 && argCode <= 0xEEFF) ? argCode + 0x10000u : static_cast<unsigned int>(argCode);
+			};
+			std::sort(table.begin(), table.end(), [&](const ShiftJisReverseTable::value_type &argLeft, const ShiftJisReverseTable::value_type &argRight)
+			{
+				if (argLeft.first != argRight.first)
+					return argLeft.first < argRight.first;
+				return Priority(argLeft.second) < Priority(argRight.second);
+			});
+			table.erase(std::unique(table.begin(), table.end(), [](const ShiftJisReverseTable::value_type &argLeft, const ShiftJisReverseTable::value_type &argRight)
+			{
+				return argLeft.first == argRight.first;
+			}), table.end());
+
+			return table;
+		}();
+		return Table;
+	}
+
+	inline size_t EncodeShiftJis(char32_t argCp, char *argDst, size_t argRoom)
+	{
+		unsigned int code = '?';
+		if (argCp < 0x80)
+		{
+			code = argCp;
+		}
+		else if (argCp >= 0xFF61 && argCp <= 0xFF9F)
+		{
+			code = 0xA1 + (argCp - 0xFF61);
+		}
+		else if (argCp == 0x0080)
+		{
+			code = 0x80;
+		}
+		else if (argCp == 0xF8F0)
+		{
+			code = 0xA0;
+		}
+		else if (argCp >= 0xF8F1 && argCp <= 0xF8F3)
+		{
+			code = 0xFD + (argCp - 0xF8F1);
+		}
+		else if (argCp <= 0xFFFF)
+		{
+			const ShiftJisReverseTable &Table = GetShiftJisReverseTable();
+			auto it = std::lower_bound(Table.begin(), Table.end(), static_cast<unsigned short>(argCp), [](const ShiftJisReverseTable::value_type &argEntry, unsigned short argKey)
+			{
+				return argEntry.first < argKey;
+			});
+			if (it != Table.end() && it->first == argCp)
+				code = it->second;
+		}
+
+		size_t length = (code > 0xFF) ? 2 : 1;
+		if (argDst == nullptr || length > argRoom)
+			return length;
+
+		if (length == 1)
+		{
+			argDst[0] = static_cast<char>(code);
+		}
+		else
+		{
+			argDst[0] = static_cast<char>(code >> 8);
+			argDst[1] = static_cast<char>(code & 0xFF);
+		}
+		return length;
+	}
+#pragma endregion	Encode
+
+	/**
+	 *	@fn			Convert
+	 *	@brief		文字コードの変換
+	 *	@param[in]	argSrc		!<	変換元
+	 *	@param[in]	argSrcSize	!<	変換元の要素数
+	 *	@param[out]	argDst		!<	書き込み先(nullptrなら長さだけ求める)
+	 *	@param[in]	argDstSize	!<	書き込み先の要素数
+	 *	@param[in]	argDecode	!<	1文字読み込む関数
+	 *	@param[in]	argEncode	!<	1文字書き込む関数
+	 *	@return		変換後の要素数
+	 */
+	template<typename SrcChar, typename DstChar, typename Decoder, typename Encoder>
+	size_t Convert(const SrcChar *argSrc, size_t argSrcSize, DstChar *argDst, size_t argDstSize, Decoder argDecode, Encoder argEncode)
+	{
+		const SrcChar *pos = argSrc;
+		const SrcChar *end = argSrc + argSrcSize;
+		DstChar *dst = argDst;	// 書き込み先が足りなくなったらnullptrにして長さだけ数える
+		size_t length = 0;
+
+		while (pos < end)
+		{
+			// ASCIIの連続はまとめてコピーする
+			size_t ascii = AsciiLength(pos, static_cast<size_t>(end - pos));
+			if (ascii != 0)
+			{
+				if (dst != nullptr)
+				{
+					size_t count = std::min(ascii, argDstSize - length);
+					CopyAscii(pos, count, dst + length);
+					if (count != ascii)
+						dst = nullptr;
+				}
+				pos += ascii;
+				length += ascii;
+				continue;
+			}
+
+			char32_t cp = argDecode(pos, end);
+			size_t units = argEncode(cp, (dst != nullptr) ? dst + length : nullptr, (dst != nullptr) ? argDstSize - length : 0);
+			if (dst != nullptr && units > argDstSize - length)
+				dst = nullptr;
+			length += units;
+		}
+
+		return length;
+	}
+}
+
+size_t Utility::TextEncoding::Utf8ToUtf16(std::string_view argSrc, char16_t *argDst, size_t argDstSize)
+{
+	return Convert(argSrc.data(), argSrc.size(), argDst, argDstSize, DecodeUtf8, EncodeUtf16);
+}
+
+size_t Utility::TextEncoding::Utf16ToUtf8(std::u16string_view argSrc, char *argDst, size_t argDstSize)
+{
+	return Convert(argSrc.data(), argSrc.size(), argDst, argDstSize, DecodeUtf16, EncodeUtf8);
+}
+
+size_t Utility::TextEncoding::Utf8ToUtf32(std::string_view argSrc, char32_t *argDst, size_t argDstSize)
+{
+	return Convert(argSrc.data(), argSrc.size(), argDst, argDstSize, DecodeUtf8, EncodeUtf32);
+}
+
+size_t Utility::TextEncoding::Utf32ToUtf8(std::u32string_view argSrc, char *argDst, size_t argDstSize)
+{
+	return Convert(argSrc.data(), argSrc.size(), argDst, argDstSize, DecodeUtf32, EncodeUtf8);
+}
+
+size_t Utility::TextEncoding::ShiftJisToUtf8(std::string_view argSrc, char *argDst, size_t argDstSize)
+{
+	return Convert(argSrc.data(), argSrc.size(), argDst, argDstSize, DecodeShiftJis, EncodeUtf8);
+}
+
+size_t Utility::TextEncoding::Utf8ToShiftJis(std::string_view argSrc, char *argDst, size_t argDstSize)
+{
+	return Convert(argSrc.data(), argSrc.size(), argDst, argDstSize, DecodeUtf8, EncodeShiftJis);
+}
+
+size_t Utility::TextEncoding::ShiftJisToUtf16(std::string_view argSrc, char16_t *argDst, size_t argDstSize)
+{
+	return Convert(argSrc.data(), argSrc.size(), argDst, argDstSize, DecodeShiftJis, EncodeUtf16);
+}
+
+size_t Utility::TextEncoding::Utf16ToShiftJis(std::u16string_view argSrc, char *argDst, size_t argDstSize)
+{
+	return Convert(argSrc.data(), argSrc.size(), argDst, argDstSize, DecodeUtf16, EncodeShiftJis);
+}
+
+size_t Utility::TextEncoding::Utf8ToWide(std::string_view argSrc, wchar_t *argDst, size_t argDstSize)
+{
+	if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+		return Convert(argSrc.data(), argSrc.size(), reinterpret_cast<char16_t*>(argDst), argDstSize, DecodeUtf8, EncodeUtf16);
+	else
+		return Convert(argSrc.data(), argSrc.size(), reinterpret_cast<char32_t*>(argDst), argDstSize, DecodeUtf8, EncodeUtf32);
+}
+
+size_t Utility::TextEncoding::WideToUtf8(std::wstring_view argSrc, char *argDst, size_t argDstSize)
+{
+	if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+		return Convert(reinterpret_cast<const char16_t*>(argSrc.data()), argSrc.size(), argDst, argDstSize, DecodeUtf16, EncodeUtf8);
+	else
+		return Convert(reinterpret_cast<const char32_t*>(argSrc.data()), argSrc.size(), argDst, argDstSize, DecodeUtf32, EncodeUtf8);
+}
+
+size_t Utility::TextEncoding::ShiftJisToWide(std::string_view argSrc, wchar_t *argDst, size_t argDstSize)
+{
+	if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+		return Convert(argSrc.data(), argSrc.size(), reinterpret_cast<char16_t*>(argDst), argDstSize, DecodeShiftJis, EncodeUtf16);
+	else
+		return Convert(argSrc.data(), argSrc.size(), reinterpret_cast<char32_t*>(argDst), argDstSize, DecodeShiftJis, EncodeUtf32);
+}
+
+size_t Utility::TextEncoding::WideToShiftJis(std::wstring_view argSrc, char *argDst, size_t argDstSize)
+{
+	if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+		return Convert(reinterpret_cast<const char16_t*>(argSrc.data()), argSrc.size(), argDst, argDstSize, DecodeUtf16, EncodeShiftJis);
+	else
+		return Convert(reinterpret_cast<const char32_t*>(argSrc.data()), argSrc.size(), argDst, argDstSize, DecodeUtf32, EncodeShiftJis);
+}